@@ -538,6 +538,9 @@ def runScons(main_module, quiet):
     if Options.isShowScons():
         options["show_scons"] = "true"
 
+    if Options.shallUseFiberGenerators():
+        options["fiber_generators"] = "true"
+
     if Options.isMingw():
         options["mingw_mode"] = "true"
 
@@ -397,6 +397,18 @@ compatibility reasons, the "__file__" value will always have ".py" suffix
 independent of what it really is."""
 )
 
+codegen_group.add_option(
+    "--fiber-generators",
+    action  = "store_true",
+    dest    = "fiber_generators",
+    default = False,
+    help    = """\
+Run generators, coroutines and asyncgens on their own machine stacks and
+switch between them, instead of keeping their state on the heap. This is
+the previous implementation and uses more memory per object. Defaults to
+off."""
+)
+
 parser.add_option_group(codegen_group)
 
 outputdir_group = OptionGroup(
@@ -1078,6 +1090,12 @@ def getIntendedPythonArch():
     return options.python_arch
 
 
+def shallUseFiberGenerators():
+    """ Use fibers with own stacks for generators instead of stackless code."""
+
+    return options.fiber_generators
+
+
 def isExperimental(indication):
     """ Are experimental features to be enabled."""
 
@@ -46,6 +46,69 @@ NUITKA_MAY_BE_UNUSED static PyObject *LOOKUP_BUILTIN( PyObject *name )
     return result;
 }
 
+// Cache for reading a module variable, that may also be a built-in value, at
+// one access site.
+struct Nuitka_ModuleVariableCache
+{
+#if PYTHON_VERSION >= 360
+    // The value is borrowed from one of the dictionaries, and valid while
+    // both keep their version.
+    uint64_t module_dict_version;
+    uint64_t builtin_dict_version;
+    PyObject *value;
+#elif PYTHON_VERSION < 330
+    struct Nuitka_DictEntryCache module_entry;
+    struct Nuitka_DictEntryCache builtin_entry;
+#else
+    int unused;
+#endif
+};
+
+NUITKA_MAY_BE_UNUSED static PyObject *GET_MODULE_VARIABLE_VALUE_CACHED( PyDictObject *module_dict, PyObject *name, struct Nuitka_ModuleVariableCache *cache )
+{
+    CHECK_OBJECT( name );
+    assert( Nuitka_String_CheckExact( name ) );
+
+#if PYTHON_VERSION >= 360
+    if ( likely( cache->module_dict_version == module_dict->ma_version_tag && cache->builtin_dict_version == dict_builtin->ma_version_tag ) )
+    {
+        return cache->value;
+    }
+
+    PyObject *result = GET_STRING_DICT_VALUE( module_dict, (Nuitka_StringObject *)name );
+
+    if ( result == NULL )
+    {
+        result = GET_STRING_DICT_VALUE( dict_builtin, (Nuitka_StringObject *)name );
+    }
+
+    if ( result != NULL )
+    {
+        cache->module_dict_version = module_dict->ma_version_tag;
+        cache->builtin_dict_version = dict_builtin->ma_version_tag;
+        cache->value = result;
+    }
+#elif PYTHON_VERSION < 330
+    // Without dictionary versions, not finding the name in the module
+    // dictionary still needs a lookup.
+    PyObject *result = GET_STRING_DICT_VALUE_CACHED( module_dict, (Nuitka_StringObject *)name, &cache->module_entry );
+
+    if ( result == NULL )
+    {
+        result = GET_STRING_DICT_VALUE_CACHED( dict_builtin, (Nuitka_StringObject *)name, &cache->builtin_entry );
+    }
+#else
+    PyObject *result = GET_STRING_DICT_VALUE( module_dict, (Nuitka_StringObject *)name );
+
+    if ( result == NULL )
+    {
+        result = GET_STRING_DICT_VALUE( dict_builtin, (Nuitka_StringObject *)name );
+    }
+#endif
+
+    return result;
+}
+
 extern void _initBuiltinModule();
 
 #define NUITKA_DECLARE_BUILTIN( name ) extern PyObject *_python_original_builtin_value_##name;
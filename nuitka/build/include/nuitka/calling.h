@@ -22,6 +22,9 @@
 
 extern PyObject *const_tuple_empty;
 
+// Call a plain Python function, creating its frame directly if possible.
+extern PyObject *callPythonFunctionPosArgsKwArgs( PyObject *func, PyObject **args, int count, PyObject *kw );
+
 NUITKA_MAY_BE_UNUSED static PyObject *CALL_FUNCTION( PyObject *function_object, PyObject *positional_args, PyObject *named_args )
 {
     // Not allowed to enter with an error set. This often catches leaked errors from
@@ -50,7 +53,21 @@ NUITKA_MAY_BE_UNUSED static PyObject *CALL_FUNCTION( PyObject *function_object,
         return NULL;
     }
 
-    PyObject *result = (*call_slot)( function_object, positional_args, named_args );
+    PyObject *result;
+
+    if ( PyFunction_Check( function_object ) )
+    {
+        result = callPythonFunctionPosArgsKwArgs(
+            function_object,
+            &PyTuple_GET_ITEM( positional_args, 0 ),
+            (int)PyTuple_GET_SIZE( positional_args ),
+            named_args
+        );
+    }
+    else
+    {
+        result = (*call_slot)( function_object, positional_args, named_args );
+    }
 
     Py_LeaveRecursiveCall();
 
@@ -36,8 +36,16 @@ struct Nuitka_AsyncgenObject {
     PyObject *m_qualname;
     PyObject *m_yieldfrom;
 
+#if _NUITKA_STACKLESS_GENERATORS
+    // The label to resume at, zero before the first run.
+    int m_yield_return_index;
+
+    // The locals surviving a suspension, stored behind the closure.
+    void *m_heap_storage;
+#else
     Fiber m_yielder_context;
     Fiber m_caller_context;
+#endif
 
     // Weak references are supported for async generator objects in CPython.
     PyObject *m_weakrefs;
@@ -47,7 +55,9 @@ struct Nuitka_AsyncgenObject {
 
     void *m_code;
 
+#ifndef _NUITKA_STACKLESS_GENERATORS
     PyObject *m_yielded;
+#endif
 
     PyObject *m_exception_type, *m_exception_value;
     PyTracebackObject *m_exception_tb;
@@ -74,23 +84,98 @@ struct Nuitka_AsyncgenObject {
 
 extern PyTypeObject Nuitka_Asyncgen_Type;
 
+#if _NUITKA_STACKLESS_GENERATORS
+typedef PyObject *(*asyncgen_code)( struct Nuitka_AsyncgenObject *, PyObject * );
+#else
 typedef void (*asyncgen_code)( struct Nuitka_AsyncgenObject * );
+#endif
 
-extern PyObject *Nuitka_Asyncgen_New( asyncgen_code code, PyObject *name, PyObject *qualname, PyCodeObject *code_object, Py_ssize_t closure_given );
+extern PyObject *Nuitka_Asyncgen_New( asyncgen_code code, PyObject *name, PyObject *qualname, PyCodeObject *code_object, Py_ssize_t closure_given, Py_ssize_t closure_inline, Py_ssize_t heap_storage_size );
 
 static inline bool Nuitka_Asyncgen_Check( PyObject *object )
 {
     return Py_TYPE( object ) == &Nuitka_Asyncgen_Type;
 }
 
+extern PyObject *Nuitka_AsyncGenValueWrapperNew( PyObject *value );
+
+#if _NUITKA_STACKLESS_GENERATORS
+
+// These work like the coroutine variants, see there.
+extern bool ASYNCGEN_AWAIT_START( struct Nuitka_AsyncgenObject *asyncgen, PyObject *awaitable );
+extern bool ASYNCGEN_ASYNC_MAKE_ITERATOR_START( struct Nuitka_AsyncgenObject *asyncgen, PyObject *value );
+extern bool ASYNCGEN_ASYNC_ITERATOR_NEXT_START( struct Nuitka_AsyncgenObject *asyncgen, PyObject *value );
+
+extern PyObject *ASYNCGEN_AWAIT_STEP( struct Nuitka_AsyncgenObject *asyncgen, PyObject *send_value, PyObject **result );
+extern PyObject *ASYNCGEN_AWAIT_STEP_IN_HANDLER( struct Nuitka_AsyncgenObject *asyncgen, PyObject *send_value, PyObject **result );
+
+// Compiled asyncgen objects are delegated to by "async for" in compiled code
+// directly, without an "asend" object. The value of an "async yield" is then
+// given in "*returned" rather than with "StopIteration".
+extern bool Nuitka_Asyncgen_startAnext( struct Nuitka_AsyncgenObject *asyncgen );
+extern PyObject *Nuitka_Asyncgen_sendAnext( struct Nuitka_AsyncgenObject *asyncgen, PyObject *value, PyObject **returned );
+extern PyObject *Nuitka_Asyncgen_throwAnext( struct Nuitka_AsyncgenObject *asyncgen, PyObject *exception_type, PyObject *exception_value, PyTracebackObject *exception_tb );
+
+static inline PyObject *ASYNCGEN_YIELD_SUSPEND( struct Nuitka_AsyncgenObject *asyncgen, PyObject *value )
+{
+    CHECK_OBJECT( value );
+
+    PyObject *result = Nuitka_AsyncGenValueWrapperNew( value );
+    Py_DECREF( value );
+
+    Nuitka_Frame_MarkAsNotExecuting( asyncgen->m_frame );
+
+    return result;
+}
+
+static inline PyObject *ASYNCGEN_YIELD_RESUME( struct Nuitka_AsyncgenObject *asyncgen, PyObject *yield_return_value )
+{
+    Nuitka_Frame_MarkAsExecuting( asyncgen->m_frame );
+
+    // Check for thrown exception.
+    if (unlikely( asyncgen->m_exception_type ))
+    {
+        RESTORE_ERROR_OCCURRED(
+            asyncgen->m_exception_type,
+            asyncgen->m_exception_value,
+            asyncgen->m_exception_tb
+        );
+
+        asyncgen->m_exception_type = NULL;
+        asyncgen->m_exception_value = NULL;
+        asyncgen->m_exception_tb = NULL;
+
+        return NULL;
+    }
+
+    CHECK_OBJECT( yield_return_value );
+    return yield_return_value;
+}
+
+static inline PyObject *ASYNCGEN_YIELD_IN_HANDLER_SUSPEND( struct Nuitka_AsyncgenObject *asyncgen, PyObject *value )
+{
+    PyObject *result = ASYNCGEN_YIELD_SUSPEND( asyncgen, value );
+
+    SWAP_FRAME_EXCEPTION();
+
+    return result;
+}
+
+static inline PyObject *ASYNCGEN_YIELD_IN_HANDLER_RESUME( struct Nuitka_AsyncgenObject *asyncgen, PyObject *yield_return_value )
+{
+    SWAP_FRAME_EXCEPTION();
+
+    return ASYNCGEN_YIELD_RESUME( asyncgen, yield_return_value );
+}
+
+#else
+
 extern PyObject *ASYNCGEN_AWAIT( struct Nuitka_AsyncgenObject *asyngen, PyObject *awaitable );
 extern PyObject *ASYNCGEN_AWAIT_IN_HANDLER( struct Nuitka_AsyncgenObject *asyngen, PyObject *awaitable );
 
 extern PyObject *ASYNCGEN_ASYNC_MAKE_ITERATOR( struct Nuitka_AsyncgenObject *asyncgen, PyObject *value );
 extern PyObject *ASYNCGEN_ASYNC_ITERATOR_NEXT( struct Nuitka_AsyncgenObject *asyncgen, PyObject *value );
 
-extern PyObject *Nuitka_AsyncGenValueWrapperNew( PyObject *value );
-
 static inline PyObject *ASYNCGEN_YIELD( struct Nuitka_AsyncgenObject *asyncgen, PyObject *value )
 {
     CHECK_OBJECT( value );
@@ -211,3 +296,5 @@ static inline PyObject *ASYNCGEN_YIELD_IN_HANDLER( struct Nuitka_AsyncgenObject
 #endif
 
 #endif
+
+#endif
@@ -72,4 +72,50 @@ NUITKA_MAY_BE_UNUSED static struct Nuitka_CellObject *PyCell_EMPTY( void )
     return result;
 }
 
+// Cells for closure values that cannot change after being taken can be part
+// of the object that has them in its closure, as nothing needs to share them.
+// They are stored behind its "m_closure" array and never leave the object.
+// Only their value is released, the cell itself is never reference counted.
+// Code knowing the closure layout accesses them at a fixed offset instead of
+// loading the pointer from "m_closure".
+#define NUITKA_INLINE_CELL_ITEMS( count ) ( ( count ) * ( ( sizeof( struct Nuitka_CellObject ) + sizeof( void * ) - 1 ) / sizeof( void * ) ) )
+#define NUITKA_INLINE_CELL( closure, closure_given, index ) ( (struct Nuitka_CellObject *)&( closure )[ ( closure_given ) + NUITKA_INLINE_CELL_ITEMS( index ) ] )
+
+NUITKA_MAY_BE_UNUSED static struct Nuitka_CellObject *Nuitka_Cell_NewInline( struct Nuitka_CellObject **closure, Py_ssize_t closure_given, Py_ssize_t index, PyObject *value )
+{
+    CHECK_OBJECT( value );
+
+    struct Nuitka_CellObject *result = NUITKA_INLINE_CELL( closure, closure_given, index );
+
+    Py_TYPE( result ) = &Nuitka_Cell_Type;
+    Py_REFCNT( result ) = 1;
+
+    result->ob_ref = value;
+    Py_INCREF( value );
+
+    return result;
+}
+
+NUITKA_MAY_BE_UNUSED static inline bool Nuitka_Cell_IsInline( PyObject *owner, struct Nuitka_CellObject *cell )
+{
+    char *start = (char *)owner;
+
+    return (char *)cell > start && (char *)cell < start + _PyObject_VAR_SIZE( Py_TYPE( owner ), Py_SIZE( owner ) );
+}
+
+// Release a cell from the closure of an object.
+NUITKA_MAY_BE_UNUSED static void Nuitka_Cell_ReleaseClosure( PyObject *owner, struct Nuitka_CellObject *cell )
+{
+    CHECK_OBJECT( cell );
+
+    if ( Nuitka_Cell_IsInline( owner, cell ) )
+    {
+        Py_CLEAR( cell->ob_ref );
+    }
+    else
+    {
+        Py_DECREF( cell );
+    }
+}
+
 #endif
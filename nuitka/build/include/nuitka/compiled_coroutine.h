@@ -36,8 +36,16 @@ struct Nuitka_CoroutineObject {
     PyObject *m_qualname;
     PyObject *m_yieldfrom;
 
+#if _NUITKA_STACKLESS_GENERATORS
+    // The label to resume at, zero before the first run.
+    int m_yield_return_index;
+
+    // The locals surviving a suspension, stored behind the closure.
+    void *m_heap_storage;
+#else
     Fiber m_yielder_context;
     Fiber m_caller_context;
+#endif
 
     // Weak references are supported for coroutine objects in CPython.
     PyObject *m_weakrefs;
@@ -47,7 +55,9 @@ struct Nuitka_CoroutineObject {
 
     void *m_code;
 
+#ifndef _NUITKA_STACKLESS_GENERATORS
     PyObject *m_yielded;
+#endif
     PyObject *m_returned;
 
     PyObject *m_exception_type, *m_exception_value;
@@ -66,9 +76,13 @@ struct Nuitka_CoroutineObject {
 
 extern PyTypeObject Nuitka_Coroutine_Type;
 
+#if _NUITKA_STACKLESS_GENERATORS
+typedef PyObject *(*coroutine_code)( struct Nuitka_CoroutineObject *, PyObject * );
+#else
 typedef void (*coroutine_code)( struct Nuitka_CoroutineObject * );
+#endif
 
-extern PyObject *Nuitka_Coroutine_New( coroutine_code code, PyObject *name, PyObject *qualname, PyCodeObject *code_object, Py_ssize_t closure_given );
+extern PyObject *Nuitka_Coroutine_New( coroutine_code code, PyObject *name, PyObject *qualname, PyCodeObject *code_object, Py_ssize_t closure_given, Py_ssize_t closure_inline, Py_ssize_t heap_storage_size );
 
 static inline bool Nuitka_Coroutine_Check( PyObject *object )
 {
@@ -82,6 +96,21 @@ struct Nuitka_CoroutineWrapperObject {
 
 extern PyTypeObject Nuitka_CoroutineWrapper_Type;
 
+#if _NUITKA_STACKLESS_GENERATORS
+
+// For stackless coroutines, the start helpers make the iterator to delegate to
+// for "await" and "async for", and the step helpers are called with each value
+// sent in, initially NULL. They return values to yield, or NULL when done, with
+// the result in "*result", NULL for an error.
+extern bool COROUTINE_AWAIT_START( struct Nuitka_CoroutineObject *coroutine, PyObject *awaitable );
+extern bool COROUTINE_ASYNC_MAKE_ITERATOR_START( struct Nuitka_CoroutineObject *coroutine, PyObject *value );
+extern bool COROUTINE_ASYNC_ITERATOR_NEXT_START( struct Nuitka_CoroutineObject *coroutine, PyObject *value );
+
+extern PyObject *COROUTINE_AWAIT_STEP( struct Nuitka_CoroutineObject *coroutine, PyObject *send_value, PyObject **result );
+extern PyObject *COROUTINE_AWAIT_STEP_IN_HANDLER( struct Nuitka_CoroutineObject *coroutine, PyObject *send_value, PyObject **result );
+
+#else
+
 extern PyObject *COROUTINE_AWAIT( struct Nuitka_CoroutineObject *coroutine, PyObject *awaitable );
 extern PyObject *COROUTINE_AWAIT_IN_HANDLER( struct Nuitka_CoroutineObject *coroutine, PyObject *awaitable );
 
@@ -196,10 +225,27 @@ static inline PyObject *COROUTINE_YIELD_IN_HANDLER( struct Nuitka_CoroutineObjec
     return coroutine->m_yielded;
 }
 
+#endif
+
 #if PYTHON_VERSION >= 360
 extern PyObject *PyCoro_GetAwaitableIter( PyObject *value );
 #endif
 
+// Make the awaitables "async for" delegates to, also used by asyncgen.
+extern PyObject *MAKE_ASYNC_ITERATOR_AWAITABLE( PyObject *value );
+extern PyObject *MAKE_ASYNC_NEXT_AWAITABLE( PyObject *value );
+
+#if _NUITKA_STACKLESS_GENERATORS
+extern PyObject *MAKE_AWAIT_ITERATOR( PyObject *awaitable );
+extern PyObject *MAKE_ASYNC_NEXT_DELEGATE( PyObject *value );
+
+// Resume a compiled coroutine that is delegated to directly. When it returns,
+// the value is given in "*returned" rather than raised with "StopIteration".
+extern PyObject *Nuitka_Coroutine_sendAwaited( struct Nuitka_CoroutineObject *coroutine, PyObject *value, PyObject **returned );
+// Throw an exception given as borrowed references into an awaited coroutine.
+extern PyObject *Nuitka_Coroutine_throwAwaited( struct Nuitka_CoroutineObject *coroutine, PyObject *exception_type, PyObject *exception_value, PyTracebackObject *exception_tb );
+#endif
+
 #endif
 
 #endif
@@ -52,6 +52,15 @@ struct Nuitka_FrameObject
     }                                                                                               \
     assert( ((struct Nuitka_FrameObject *)cache_identifier)->m_type_description == NULL );                                           \
 
+// Functions keep frames for reuse per recursion depth, so recursive calls do
+// not create new frames. The last slot is shared by all deeper calls. The
+// depth is counted while frames of the function are active.
+#ifndef _NUITKA_FRAME_CACHE_DEPTH
+#define _NUITKA_FRAME_CACHE_DEPTH 16
+#endif
+
+#define FRAME_CACHE_SLOT( cache_identifier, depth ) cache_identifier[ (depth) < _NUITKA_FRAME_CACHE_DEPTH ? (depth) : _NUITKA_FRAME_CACHE_DEPTH - 1 ]
+
 inline static void assertCodeObject( PyCodeObject *code_object )
 {
     CHECK_OBJECT( (PyObject *)code_object );
@@ -226,6 +235,8 @@ extern void Nuitka_Frame_ReleaseLocals( struct Nuitka_FrameObject *frame );
 #define NUITKA_TYPE_DESCRIPTION_OBJECT 'o'
 #define NUITKA_TYPE_DESCRIPTION_OBJECT_PTR 'O'
 #define NUITKA_TYPE_DESCRIPTION_BOOL 'b'
+#define NUITKA_TYPE_DESCRIPTION_CLONG 'l'
+#define NUITKA_TYPE_DESCRIPTION_CDOUBLE 'd'
 
 
 #endif
@@ -31,6 +31,10 @@ struct Nuitka_FunctionObject;
 // The actual function code with arguments as an array.
 typedef PyObject *(*function_impl_code)( struct Nuitka_FunctionObject const *, PyObject ** );
 
+// Argument parsing and calling of the function code, specialized for the
+// parameters of a function, taking arguments as an array and keyword dict.
+typedef PyObject *(*function_parse_code)( struct Nuitka_FunctionObject const *, PyObject **, Py_ssize_t, PyObject * );
+
 // The Nuitka_FunctionObject is the storage associated with a compiled function
 // instance of which there can be many for each code.
 struct Nuitka_FunctionObject {
@@ -52,8 +56,17 @@ struct Nuitka_FunctionObject {
     // Same as code_object->co_varnames
     PyObject **m_varnames;
 
+    // Hash table for the argument names that can be given as keywords, holds
+    // index plus one into "m_varnames" or zero for empty slots. Only present
+    // for functions with many of these, otherwise NULL.
+    unsigned short *m_keywords_table;
+    Py_ssize_t m_keywords_table_mask;
+
     function_impl_code m_c_code;
 
+    // Specialized argument parser if any, set after creation, otherwise NULL.
+    function_parse_code m_c_parse;
+
     PyObject *m_dict;
     PyObject *m_weakrefs;
 
@@ -87,11 +100,11 @@ extern PyTypeObject Nuitka_Function_Type;
 
 // Make a function with context.
 #if PYTHON_VERSION < 300
-extern struct Nuitka_FunctionObject *Nuitka_Function_New( function_impl_code c_code, PyObject *name, PyCodeObject *code_object, PyObject *defaults, PyObject *module, PyObject *doc, Py_ssize_t closure_given );
+extern struct Nuitka_FunctionObject *Nuitka_Function_New( function_impl_code c_code, PyObject *name, PyCodeObject *code_object, PyObject *defaults, PyObject *module, PyObject *doc, Py_ssize_t closure_given, Py_ssize_t closure_inline );
 #elif PYTHON_VERSION < 330
-extern struct Nuitka_FunctionObject *Nuitka_Function_New( function_impl_code c_code, PyObject *name, PyCodeObject *code_object, PyObject *defaults, PyObject *kwdefaults, PyObject *annotations, PyObject *module, PyObject *doc, Py_ssize_t closure_given );
+extern struct Nuitka_FunctionObject *Nuitka_Function_New( function_impl_code c_code, PyObject *name, PyCodeObject *code_object, PyObject *defaults, PyObject *kwdefaults, PyObject *annotations, PyObject *module, PyObject *doc, Py_ssize_t closure_given, Py_ssize_t closure_inline );
 #else
-extern struct Nuitka_FunctionObject *Nuitka_Function_New( function_impl_code c_code, PyObject *name, PyObject *qualname, PyCodeObject *code_object, PyObject *defaults, PyObject *kwdefaults, PyObject *annotations, PyObject *module, PyObject *doc, Py_ssize_t closure_given );
+extern struct Nuitka_FunctionObject *Nuitka_Function_New( function_impl_code c_code, PyObject *name, PyObject *qualname, PyCodeObject *code_object, PyObject *defaults, PyObject *kwdefaults, PyObject *annotations, PyObject *module, PyObject *doc, Py_ssize_t closure_given, Py_ssize_t closure_inline );
 #endif
 
 static inline bool Nuitka_Function_Check( PyObject *object )
@@ -104,6 +117,22 @@ static inline PyObject *Nuitka_Function_GetName( PyObject *object )
     return ((struct Nuitka_FunctionObject *)object)->m_name;
 }
 
+// Call of a compiled function, whose code is statically known, through its
+// specialized argument parser, with only positional arguments.
+NUITKA_MAY_BE_UNUSED static inline PyObject *Nuitka_CallFunctionParsed( function_parse_code parser, PyObject *called, PyObject **args, Py_ssize_t args_size )
+{
+    if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
+    {
+        return NULL;
+    }
+
+    PyObject *result = parser( (struct Nuitka_FunctionObject const *)called, args, args_size, NULL );
+
+    Py_LeaveRecursiveCall();
+
+    return result;
+}
+
 extern bool parseArgumentsPos( struct Nuitka_FunctionObject const *function, PyObject **python_pars, PyObject **args, Py_ssize_t args_size );
 extern bool parseArgumentsMethodPos( struct Nuitka_FunctionObject const *function, PyObject **python_pars, PyObject *object, PyObject **args, Py_ssize_t args_size );
 
@@ -118,4 +147,11 @@ extern PyObject *Nuitka_CallMethodFunctionPosArgs( struct Nuitka_FunctionObject
 // This is also used by bound compiled methods
 extern PyObject *Nuitka_CallMethodFunctionPosArgsKwArgs( struct Nuitka_FunctionObject const *function, PyObject *object, PyObject **args, Py_ssize_t args_size, PyObject *kw );
 
+// Vectorcall style entry points, the positional arguments are followed by the
+// values for the keyword arguments named in "kw_names", which may be NULL.
+// These avoid creating argument tuples and are used by the call helpers and
+// the "tp_call" slots of compiled functions and methods.
+extern PyObject *Nuitka_CallFunctionVectorcall( struct Nuitka_FunctionObject const *function, PyObject **args, Py_ssize_t args_size, PyObject *kw_names );
+extern PyObject *Nuitka_CallMethodFunctionVectorcall( struct Nuitka_FunctionObject const *function, PyObject *object, PyObject **args, Py_ssize_t args_size, PyObject *kw_names );
+
 #endif
@@ -27,7 +27,10 @@
 // Another cornerstone of the integration into CPython. Try to behave as well as
 // normal generator objects do or even better.
 
+// Unless stackless code is generated, generators run on fibers of their own.
+#ifndef _NUITKA_STACKLESS_GENERATORS
 #include "fibers.h"
+#endif
 
 // Status of the generator object.
 #ifdef __cplusplus
@@ -54,6 +57,9 @@ struct Nuitka_GeneratorObject {
 
 #if PYTHON_VERSION >= 350
     PyObject *m_qualname;
+#endif
+#if PYTHON_VERSION >= 330
+    // The iterator delegated to by "yield from", if any.
     PyObject *m_yieldfrom;
 #endif
 
@@ -73,8 +79,12 @@ struct Nuitka_GeneratorObject {
     // Was it ever used, is it still running, or already finished.
     Generator_Status m_status;
 
-#if _NUITKA_EXPERIMENTAL_GENERATOR_GOTO
+#if _NUITKA_STACKLESS_GENERATORS
+    // The label to resume at, zero before the first run.
     int m_yield_return_index;
+
+    // The locals surviving a suspension, stored behind the closure.
+    void *m_heap_storage;
 #else
     Fiber m_yielder_context;
     Fiber m_caller_context;
@@ -92,16 +102,20 @@ struct Nuitka_GeneratorObject {
 
 extern PyTypeObject Nuitka_Generator_Type;
 
-#if _NUITKA_EXPERIMENTAL_GENERATOR_GOTO
+#if _NUITKA_STACKLESS_GENERATORS
 typedef PyObject *(*generator_code)( struct Nuitka_GeneratorObject *, PyObject * );
 #else
 typedef void (*generator_code)( struct Nuitka_GeneratorObject * );
 #endif
 
+// The heap storage of locals is allocated behind the closure, counting in units
+// of its items. Also used for coroutines and asyncgens.
+#define NUITKA_HEAP_STORAGE_ITEMS( size ) ( ( (size) + sizeof(struct Nuitka_CellObject *) - 1 ) / sizeof(struct Nuitka_CellObject *) )
+
 #if PYTHON_VERSION < 350
-extern PyObject *Nuitka_Generator_New( generator_code code, PyObject *module, PyObject *name, PyCodeObject *code_object, Py_ssize_t closure_given );
+extern PyObject *Nuitka_Generator_New( generator_code code, PyObject *module, PyObject *name, PyCodeObject *code_object, Py_ssize_t closure_given, Py_ssize_t closure_inline, Py_ssize_t heap_storage_size );
 #else
-extern PyObject *Nuitka_Generator_New( generator_code code, PyObject *module, PyObject *name, PyObject *qualname, PyCodeObject *code_object, Py_ssize_t closure_given );
+extern PyObject *Nuitka_Generator_New( generator_code code, PyObject *module, PyObject *name, PyObject *qualname, PyCodeObject *code_object, Py_ssize_t closure_given, Py_ssize_t closure_inline, Py_ssize_t heap_storage_size );
 #endif
 
 extern PyObject *Nuitka_Generator_qiter( struct Nuitka_GeneratorObject *generator, bool *finished );
@@ -116,7 +130,116 @@ static inline PyObject *Nuitka_Generator_GetName( PyObject *object )
     return ((struct Nuitka_GeneratorObject *)object)->m_name;
 }
 
-#ifndef _NUITKA_EXPERIMENTAL_GENERATOR_GOTO
+#if _NUITKA_STACKLESS_GENERATORS
+
+// For stackless generators, a "yield" is split in two. The generated code
+// returns the result of the suspend helper to the caller, after recording the
+// label to resume at, and the resume helper runs after that label with the
+// value sent in.
+
+static inline PyObject *GENERATOR_YIELD_SUSPEND( struct Nuitka_GeneratorObject *generator, PyObject *value )
+{
+    CHECK_OBJECT( value );
+
+    Nuitka_Frame_MarkAsNotExecuting( generator->m_frame );
+
+    return value;
+}
+
+static inline PyObject *GENERATOR_YIELD_RESUME( struct Nuitka_GeneratorObject *generator, PyObject *yield_return_value )
+{
+    Nuitka_Frame_MarkAsExecuting( generator->m_frame );
+
+    // Check for thrown exception.
+    if (unlikely( generator->m_exception_type ))
+    {
+        RESTORE_ERROR_OCCURRED(
+            generator->m_exception_type,
+            generator->m_exception_value,
+            generator->m_exception_tb
+        );
+
+        generator->m_exception_type = NULL;
+        generator->m_exception_value = NULL;
+        generator->m_exception_tb = NULL;
+
+        return NULL;
+    }
+
+    CHECK_OBJECT( yield_return_value );
+    return yield_return_value;
+}
+
+#if PYTHON_VERSION >= 300
+// When yielding from an exception handler in Python3, the exception preserved
+// to the frame is restored, while the current one is put there, and the other
+// way around when resuming. Also used by coroutines and asyncgens.
+static inline void SWAP_FRAME_EXCEPTION( void )
+{
+    PyThreadState *thread_state = PyThreadState_GET();
+
+    PyObject *saved_exception_type = EXC_TYPE(thread_state);
+    PyObject *saved_exception_value = EXC_VALUE(thread_state);
+    PyObject *saved_exception_traceback = EXC_TRACEBACK(thread_state);
+
+    EXC_TYPE(thread_state) = thread_state->frame->f_exc_type;
+    EXC_VALUE(thread_state) = thread_state->frame->f_exc_value;
+    EXC_TRACEBACK(thread_state) = thread_state->frame->f_exc_traceback;
+
+    thread_state->frame->f_exc_type = saved_exception_type;
+    thread_state->frame->f_exc_value = saved_exception_value;
+    thread_state->frame->f_exc_traceback = saved_exception_traceback;
+}
+
+static inline PyObject *GENERATOR_YIELD_IN_HANDLER_SUSPEND( struct Nuitka_GeneratorObject *generator, PyObject *value )
+{
+    CHECK_OBJECT( value );
+
+    SWAP_FRAME_EXCEPTION();
+
+    Nuitka_Frame_MarkAsNotExecuting( generator->m_frame );
+
+    return value;
+}
+
+static inline PyObject *GENERATOR_YIELD_IN_HANDLER_RESUME( struct Nuitka_GeneratorObject *generator, PyObject *yield_return_value )
+{
+    Nuitka_Frame_MarkAsExecuting( generator->m_frame );
+
+    SWAP_FRAME_EXCEPTION();
+
+    // Check for thrown exception.
+    if (unlikely( generator->m_exception_type ))
+    {
+        RESTORE_ERROR_OCCURRED(
+            generator->m_exception_type,
+            generator->m_exception_value,
+            generator->m_exception_tb
+        );
+
+        generator->m_exception_type = NULL;
+        generator->m_exception_value = NULL;
+        generator->m_exception_tb = NULL;
+
+        return NULL;
+    }
+
+    CHECK_OBJECT( yield_return_value );
+    return yield_return_value;
+}
+#endif
+
+#if PYTHON_VERSION >= 330
+// For "yield from", the start helper makes the iterator to delegate to, and
+// the step helpers are called with each value sent in, initially NULL. They
+// return values to yield, or NULL when done, with the result of the "yield
+// from" in "*result", NULL for an error.
+extern bool GENERATOR_YIELD_FROM_START( struct Nuitka_GeneratorObject *generator, PyObject *target );
+extern PyObject *GENERATOR_YIELD_FROM_STEP( struct Nuitka_GeneratorObject *generator, PyObject *send_value, PyObject **result );
+extern PyObject *GENERATOR_YIELD_FROM_STEP_IN_HANDLER( struct Nuitka_GeneratorObject *generator, PyObject *send_value, PyObject **result );
+#endif
+
+#else
 
 static inline PyObject *GENERATOR_YIELD( struct Nuitka_GeneratorObject *generator, PyObject *value )
 {
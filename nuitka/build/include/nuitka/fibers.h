@@ -18,7 +18,9 @@
 #ifndef __NUITKA_FIBERS_H__
 #define __NUITKA_FIBERS_H__
 
-#if defined( _WIN32 )
+#if defined( _NUITKA_ASM_FIBERS )
+#include <stdint.h>
+#elif defined( _WIN32 )
 #include <windows.h>
 #elif defined( __OpenBSD__ )
 #ifdef __cplusplus
@@ -34,7 +36,11 @@ extern "C" {
 
 typedef struct _Fiber
 {
-#if defined( _WIN32 )
+#if defined( _NUITKA_ASM_FIBERS )
+    // Must be first, the assembler code of "_swapFiber" stores it there.
+    void *sp;
+    void *start_stack;
+#elif defined( _WIN32 )
     LPVOID fiber;
 #elif defined( __OpenBSD__ )
     struct coro_context coro_ctx;
@@ -45,6 +51,14 @@ typedef struct _Fiber
 #endif
 } Fiber;
 
+// Stacks for fibers are shared by all generator kinds, and pooled for reuse,
+// see "HelpersFiberStacks.c" for how to configure them.
+extern size_t getFiberStackSize( void );
+#if !defined( _WIN32 )
+extern void *allocateFiberStack( void );
+extern void releaseFiberStack( void *stack );
+#endif
+
 #ifdef __cplusplus
 extern "C" void _initFiber( Fiber *to );
 extern "C" void _swapFiber( Fiber *to, Fiber *from );
@@ -19,31 +19,6 @@
 #ifndef __NUITKA_FREELISTS_H__
 #define __NUITKA_FREELISTS_H__
 
-#define allocateFromFreeList( free_list, object_type, type_type, size ) \
-    if ( free_list != NULL )                                            \
-    {                                                                   \
-        result = free_list;                                             \
-        free_list = *((object_type **)free_list);                       \
-        free_list ## _count -= 1;                                       \
-        assert( free_list ## _count >= 0 );                             \
-                                                                        \
-        if ( Py_SIZE( result ) < size )                                 \
-        {                                                               \
-            result = PyObject_GC_Resize( object_type, result, size );   \
-            assert( result != NULL );                                   \
-        }                                                               \
-                                                                        \
-        _Py_NewReference( (PyObject *)result );                         \
-    }                                                                   \
-    else                                                                \
-    {                                                                   \
-        result = (object_type *)Nuitka_GC_NewVar(                       \
-            &type_type,                                                 \
-            size                                                        \
-        );                                                              \
-    }                                                                   \
-    CHECK_OBJECT( result );
-
 #define allocateFromFreeListFixed( free_list, object_type, type_type )  \
     if ( free_list != NULL )                                            \
     {                                                                   \
@@ -89,4 +64,137 @@
         free_list ## _count += 1;                                       \
     }                                                                   \
 
+
+// Free lists for objects of variable size, segregated into size classes by
+// their number of items, so objects are reused for similar sizes only. New
+// objects are given a size that all allocations from their class fit into,
+// except for the last class, which takes all larger sizes and may have to
+// resize them.
+#ifndef _NUITKA_FREE_LIST_CLASSES
+#define _NUITKA_FREE_LIST_CLASSES 12
+#endif
+
+struct Nuitka_SizedFreeList
+{
+    // Name for statistics and the environment variable of the limit.
+    char const *name;
+
+    // Limit of objects per size class, taken from the environment when the
+    // free list is first used, and -1 before that.
+    int default_limit;
+    int limit;
+
+    // All free lists that were used, for statistics.
+    struct Nuitka_SizedFreeList *next;
+
+    void *objects[ _NUITKA_FREE_LIST_CLASSES ];
+    int counts[ _NUITKA_FREE_LIST_CLASSES ];
+
+    unsigned long hits[ _NUITKA_FREE_LIST_CLASSES ];
+    unsigned long misses[ _NUITKA_FREE_LIST_CLASSES ];
+    unsigned long resizes[ _NUITKA_FREE_LIST_CLASSES ];
+    unsigned long releases[ _NUITKA_FREE_LIST_CLASSES ];
+    unsigned long frees[ _NUITKA_FREE_LIST_CLASSES ];
+};
+
+#define NUITKA_SIZED_FREE_LIST( name, default_limit ) { name, default_limit, -1 }
+
+extern struct Nuitka_SizedFreeList *Nuitka_SizedFreeLists;
+extern void initSizedFreeList( struct Nuitka_SizedFreeList *free_list );
+
+// Class with the objects that have at least "size" items.
+NUITKA_MAY_BE_UNUSED static inline int getFreeListAllocationClass( Py_ssize_t size )
+{
+    int result = 0;
+
+    while ( result < _NUITKA_FREE_LIST_CLASSES - 1 && ( (Py_ssize_t)1 << result ) - 1 < size )
+    {
+        result += 1;
+    }
+
+    return result;
+}
+
+// Number of items to allocate for a class, so that released objects serve
+// all allocations from it.
+NUITKA_MAY_BE_UNUSED static inline Py_ssize_t getFreeListClassSize( int size_class, Py_ssize_t size )
+{
+    Py_ssize_t class_size = ( (Py_ssize_t)1 << size_class ) - 1;
+
+    return size > class_size ? size : class_size;
+}
+
+// Class for an object with "size" items.
+NUITKA_MAY_BE_UNUSED static inline int getFreeListReleaseClass( Py_ssize_t size )
+{
+    int result = 0;
+
+    while ( result < _NUITKA_FREE_LIST_CLASSES - 1 && ( (Py_ssize_t)2 << result ) - 1 <= size )
+    {
+        result += 1;
+    }
+
+    return result;
+}
+
+#define allocateFromSizedFreeList( free_list, object_type, type_type, size )    \
+    {                                                                         \
+        int size_class = getFreeListAllocationClass( size );                  \
+        result = (object_type *)free_list.objects[ size_class ];              \
+                                                                              \
+        if ( result != NULL )                                                 \
+        {                                                                     \
+            free_list.objects[ size_class ] = *((void **)result);             \
+            free_list.counts[ size_class ] -= 1;                              \
+            assert( free_list.counts[ size_class ] >= 0 );                    \
+            free_list.hits[ size_class ] += 1;                                \
+                                                                              \
+            if ( Py_SIZE( result ) < size )                                   \
+            {                                                                 \
+                free_list.resizes[ size_class ] += 1;                         \
+                result = PyObject_GC_Resize( object_type, result, size );     \
+                assert( result != NULL );                                     \
+            }                                                                 \
+                                                                              \
+            _Py_NewReference( (PyObject *)result );                           \
+        }                                                                     \
+        else                                                                  \
+        {                                                                     \
+            if (unlikely( free_list.limit < 0 ))                              \
+            {                                                                 \
+                initSizedFreeList( &free_list );                              \
+            }                                                                 \
+            free_list.misses[ size_class ] += 1;                              \
+                                                                              \
+            result = (object_type *)Nuitka_GC_NewVar(                         \
+                &type_type,                                                   \
+                getFreeListClassSize( size_class, size )                      \
+            );                                                                \
+        }                                                                     \
+    }                                                                         \
+    CHECK_OBJECT( result );
+
+#define releaseToSizedFreeList( free_list, object )                           \
+    {                                                                         \
+        if (unlikely( free_list.limit < 0 ))                                  \
+        {                                                                     \
+            initSizedFreeList( &free_list );                                  \
+        }                                                                     \
+                                                                              \
+        int size_class = getFreeListReleaseClass( Py_SIZE( object ) );        \
+                                                                              \
+        if ( free_list.counts[ size_class ] >= free_list.limit )              \
+        {                                                                     \
+            free_list.frees[ size_class ] += 1;                               \
+            PyObject_GC_Del( object );                                        \
+        }                                                                     \
+        else                                                                  \
+        {                                                                     \
+            *((void **)object) = free_list.objects[ size_class ];             \
+            free_list.objects[ size_class ] = object;                         \
+            free_list.counts[ size_class ] += 1;                              \
+            free_list.releases[ size_class ] += 1;                            \
+        }                                                                     \
+    }
+
 #endif
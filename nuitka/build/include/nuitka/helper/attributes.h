@@ -129,128 +129,235 @@ static PyObject *LOOKUP_INSTANCE( PyObject *source, PyObject *attr_name )
 }
 #endif
 
-NUITKA_MAY_BE_UNUSED static PyObject *LOOKUP_ATTRIBUTE( PyObject *source, PyObject *attr_name )
+// Cache for attribute lookups and assignments of one access site. The
+// result of the type lookup stays valid for as long as the type keeps the
+// same version tag, as any change to the type or its bases changes that.
+struct Nuitka_AttributeCache
 {
-    /* Note: There are 2 specializations of this function, that need to be
-     * updated in line with this: LOOKUP_ATTRIBUTE_[DICT|CLASS]_SLOT
-     */
+    PyTypeObject *type;
+    unsigned int version_tag;
 
-    CHECK_OBJECT( source );
-    CHECK_OBJECT( attr_name );
+    // Borrowed reference, the type dictionary owns it, NULL if not found.
+    PyObject *descr;
 
-    PyTypeObject *type = Py_TYPE( source );
+#if PYTHON_VERSION >= 360
+    // Entry index of the attribute in split table instance dictionaries
+    // that use these shared keys.
+    PyDictKeysObject *keys;
+    Py_ssize_t index;
+#endif
+};
 
-    if ( type->tp_getattro == PyObject_GenericGetAttr )
+static inline bool HAS_ATTRIBUTE_CACHE_ENTRY( struct Nuitka_AttributeCache const *cache, PyTypeObject *type )
+{
+    return
+        cache->type == type &&
+        PyType_HasFeature( type, Py_TPFLAGS_VALID_VERSION_TAG ) &&
+        cache->version_tag == type->tp_version_tag;
+}
+
+static PyObject *LOOKUP_ATTRIBUTE_TYPE_CACHED( PyTypeObject *type, PyObject *attr_name, struct Nuitka_AttributeCache *cache )
+{
+    if ( likely( cache != NULL && HAS_ATTRIBUTE_CACHE_ENTRY( cache, type ) ) )
     {
-        // Unfortunately this is required, although of cause rarely necessary.
-        if (unlikely( type->tp_dict == NULL ))
-        {
-            if (unlikely( PyType_Ready( type ) < 0 ))
-            {
-                return NULL;
-            }
-        }
+        return cache->descr;
+    }
 
-        PyObject *descr = _PyType_Lookup( type, attr_name );
-        descrgetfunc func = NULL;
+    PyObject *descr = _PyType_Lookup( type, attr_name );
 
-        if ( descr != NULL )
+    // The lookup gives the type a version tag, unless it cannot have one.
+    if ( cache != NULL )
+    {
+        if ( PyType_HasFeature( type, Py_TPFLAGS_VALID_VERSION_TAG ) )
         {
-            Py_INCREF( descr );
+            cache->type = type;
+            cache->version_tag = type->tp_version_tag;
+            cache->descr = descr;
+        }
+        else
+        {
+            cache->type = NULL;
+        }
+    }
 
-#if PYTHON_VERSION < 300
-            if ( PyType_HasFeature( Py_TYPE( descr ), Py_TPFLAGS_HAVE_CLASS ) )
-            {
-#endif
-                func = Py_TYPE( descr )->tp_descr_get;
+    return descr;
+}
 
-                if ( func != NULL && PyDescr_IsData( descr ) )
-                {
-                    PyObject *result = func( descr, source, (PyObject *)type );
-                    Py_DECREF( descr );
+static PyObject *GET_INSTANCE_DICT_VALUE( PyObject *dict, PyObject *attr_name, struct Nuitka_AttributeCache *cache )
+{
+#if PYTHON_VERSION >= 360
+    PyDictObject *mp = (PyDictObject *)dict;
 
-                    return result;
-                }
-#if PYTHON_VERSION < 300
-            }
-#endif
+    // For split tables, the value can be read by index, if the shared keys
+    // have the attribute name at the cached position.
+    if ( cache != NULL && mp->ma_values != NULL && PyDict_CheckExact( dict ) && PyUnicode_CheckExact( attr_name ) )
+    {
+        PyDictKeysObject *keys = mp->ma_keys;
+
+        if ( likely( cache->keys == keys && cache->index < keys->dk_nentries && DK_ENTRIES( keys )[ cache->index ].me_key == attr_name ) )
+        {
+            return mp->ma_values[ cache->index ];
         }
 
-        Py_ssize_t dictoffset = type->tp_dictoffset;
-        PyObject *dict = NULL;
+        Py_hash_t hash = ((PyASCIIObject *)attr_name)->hash;
 
-        if ( dictoffset != 0 )
+        if ( hash == -1 )
         {
-            // Negative dictionary offsets have special meaning.
-            if ( dictoffset < 0 )
-            {
-                Py_ssize_t tsize;
-                size_t size;
+            return PyDict_GetItem( dict, attr_name );
+        }
 
-                tsize = ((PyVarObject *)source)->ob_size;
-                if (tsize < 0)
-                    tsize = -tsize;
-                size = _PyObject_VAR_SIZE( type, tsize );
+        PyObject **value_addr;
+        Py_ssize_t index = keys->dk_lookup( mp, attr_name, hash, &value_addr, NULL );
 
-                dictoffset += (long)size;
-            }
+        if ( index < 0 )
+        {
+            return NULL;
+        }
 
-            PyObject **dictptr = (PyObject **) ((char *)source + dictoffset);
-            dict = *dictptr;
+        if ( DK_ENTRIES( keys )[ index ].me_key == attr_name )
+        {
+            cache->keys = keys;
+            cache->index = index;
         }
 
-        if ( dict != NULL )
+        return *value_addr;
+    }
+#endif
+
+    return PyDict_GetItem( dict, attr_name );
+}
+
+// Attribute lookup for types with generic attribute lookup, with an optional
+// cache for the access site.
+static PyObject *LOOKUP_ATTRIBUTE_GENERIC( PyObject *source, PyObject *attr_name, struct Nuitka_AttributeCache *cache )
+{
+    PyTypeObject *type = Py_TYPE( source );
+
+    // Unfortunately this is required, although of cause rarely necessary.
+    if (unlikely( type->tp_dict == NULL ))
+    {
+        if (unlikely( PyType_Ready( type ) < 0 ))
         {
-            CHECK_OBJECT( dict );
+            return NULL;
+        }
+    }
 
-            Py_INCREF( dict );
+    PyObject *descr = LOOKUP_ATTRIBUTE_TYPE_CACHED( type, attr_name, cache );
+    descrgetfunc func = NULL;
 
-            PyObject *result = PyDict_GetItem( dict, attr_name );
+    if ( descr != NULL )
+    {
+        Py_INCREF( descr );
 
-            if ( result != NULL )
+#if PYTHON_VERSION < 300
+        if ( PyType_HasFeature( Py_TYPE( descr ), Py_TPFLAGS_HAVE_CLASS ) )
+        {
+#endif
+            func = Py_TYPE( descr )->tp_descr_get;
+
+            if ( func != NULL && PyDescr_IsData( descr ) )
             {
-                Py_INCREF( result );
-                Py_XDECREF( descr );
-                Py_DECREF( dict );
+                PyObject *result = func( descr, source, (PyObject *)type );
+                Py_DECREF( descr );
 
-                CHECK_OBJECT( result );
                 return result;
             }
+#if PYTHON_VERSION < 300
+        }
+#endif
+    }
 
-            Py_DECREF( dict );
+    Py_ssize_t dictoffset = type->tp_dictoffset;
+    PyObject *dict = NULL;
+
+    if ( dictoffset != 0 )
+    {
+        // Negative dictionary offsets have special meaning.
+        if ( dictoffset < 0 )
+        {
+            Py_ssize_t tsize;
+            size_t size;
+
+            tsize = ((PyVarObject *)source)->ob_size;
+            if (tsize < 0)
+                tsize = -tsize;
+            size = _PyObject_VAR_SIZE( type, tsize );
+
+            dictoffset += (long)size;
         }
 
-        if ( func != NULL )
+        PyObject **dictptr = (PyObject **) ((char *)source + dictoffset);
+        dict = *dictptr;
+    }
+
+    if ( dict != NULL )
+    {
+        CHECK_OBJECT( dict );
+
+        Py_INCREF( dict );
+
+        PyObject *result = GET_INSTANCE_DICT_VALUE( dict, attr_name, cache );
+
+        if ( result != NULL )
         {
-            PyObject *result = func( descr, source, (PyObject *)type );
-            Py_DECREF( descr );
+            Py_INCREF( result );
+            Py_XDECREF( descr );
+            Py_DECREF( dict );
 
             CHECK_OBJECT( result );
             return result;
         }
 
-        if ( descr != NULL )
-        {
-            CHECK_OBJECT( descr );
-            return descr;
-        }
+        Py_DECREF( dict );
+    }
+
+    if ( func != NULL )
+    {
+        PyObject *result = func( descr, source, (PyObject *)type );
+        Py_DECREF( descr );
+
+        CHECK_OBJECT( result );
+        return result;
+    }
+
+    if ( descr != NULL )
+    {
+        CHECK_OBJECT( descr );
+        return descr;
+    }
 
 #if PYTHON_VERSION < 300
-        PyErr_Format(
-            PyExc_AttributeError,
-            "'%s' object has no attribute '%s'",
-            type->tp_name,
-            PyString_AS_STRING( attr_name )
-        );
+    PyErr_Format(
+        PyExc_AttributeError,
+        "'%s' object has no attribute '%s'",
+        type->tp_name,
+        PyString_AS_STRING( attr_name )
+    );
 #else
-        PyErr_Format(
-            PyExc_AttributeError,
-            "'%s' object has no attribute '%U'",
-            type->tp_name,
-            attr_name
-        );
+    PyErr_Format(
+        PyExc_AttributeError,
+        "'%s' object has no attribute '%U'",
+        type->tp_name,
+        attr_name
+    );
 #endif
-        return NULL;
+    return NULL;
+}
+
+NUITKA_MAY_BE_UNUSED static PyObject *LOOKUP_ATTRIBUTE( PyObject *source, PyObject *attr_name )
+{
+    /* Note: There are 2 specializations of this function, that need to be
+     * updated in line with this: LOOKUP_ATTRIBUTE_[DICT|CLASS]_SLOT
+     */
+
+    CHECK_OBJECT( source );
+    CHECK_OBJECT( attr_name );
+
+    PyTypeObject *type = Py_TYPE( source );
+
+    if ( type->tp_getattro == PyObject_GenericGetAttr )
+    {
+        return LOOKUP_ATTRIBUTE_GENERIC( source, attr_name, NULL );
     }
 #if PYTHON_VERSION < 300
     else if ( type->tp_getattro == PyInstance_Type.tp_getattro )
@@ -289,6 +396,20 @@ NUITKA_MAY_BE_UNUSED static PyObject *LOOKUP_ATTRIBUTE( PyObject *source, PyObje
     }
 }
 
+// Attribute lookup with a cache for the access site.
+NUITKA_MAY_BE_UNUSED static PyObject *LOOKUP_ATTRIBUTE_CACHED( PyObject *source, PyObject *attr_name, struct Nuitka_AttributeCache *cache )
+{
+    CHECK_OBJECT( source );
+    CHECK_OBJECT( attr_name );
+
+    if ( Py_TYPE( source )->tp_getattro == PyObject_GenericGetAttr )
+    {
+        return LOOKUP_ATTRIBUTE_GENERIC( source, attr_name, cache );
+    }
+
+    return LOOKUP_ATTRIBUTE( source, attr_name );
+}
+
 NUITKA_MAY_BE_UNUSED static PyObject *LOOKUP_ATTRIBUTE_DICT_SLOT( PyObject *source )
 {
     CHECK_OBJECT( source );
@@ -712,6 +833,59 @@ NUITKA_MAY_BE_UNUSED static bool SET_ATTRIBUTE( PyObject *target, PyObject *attr
     return true;
 }
 
+// Attribute assignment with a cache for the access site. For generic
+// attribute assignment, the type lookup for data descriptors is cached, and
+// otherwise the existing instance dictionary is assigned directly.
+NUITKA_MAY_BE_UNUSED static bool SET_ATTRIBUTE_CACHED( PyObject *target, PyObject *attr_name, PyObject *value, struct Nuitka_AttributeCache *cache )
+{
+    CHECK_OBJECT( target );
+    CHECK_OBJECT( attr_name );
+    CHECK_OBJECT( value );
+
+    PyTypeObject *type = Py_TYPE( target );
+
+    if ( type->tp_setattro == PyObject_GenericSetAttr && type->tp_dict != NULL )
+    {
+        PyObject *descr = LOOKUP_ATTRIBUTE_TYPE_CACHED( type, attr_name, cache );
+
+        if ( descr != NULL )
+        {
+            descrsetfunc func = NULL;
+
+#if PYTHON_VERSION < 300
+            if ( PyType_HasFeature( Py_TYPE( descr ), Py_TPFLAGS_HAVE_CLASS ) )
+#endif
+            {
+                func = Py_TYPE( descr )->tp_descr_set;
+            }
+
+            if ( func != NULL )
+            {
+                Py_INCREF( descr );
+                int status = func( descr, target, value );
+                Py_DECREF( descr );
+
+                return status == 0;
+            }
+        }
+
+        PyObject **dictptr = _PyObject_GetDictPtr( target );
+
+        if ( dictptr != NULL && *dictptr != NULL )
+        {
+            PyObject *dict = *dictptr;
+
+            Py_INCREF( dict );
+            int status = PyDict_SetItem( dict, attr_name, value );
+            Py_DECREF( dict );
+
+            return status == 0;
+        }
+    }
+
+    return SET_ATTRIBUTE( target, attr_name, value );
+}
+
 NUITKA_MAY_BE_UNUSED static bool SET_ATTRIBUTE_DICT_SLOT( PyObject *target, PyObject *value )
 {
     CHECK_OBJECT( target );
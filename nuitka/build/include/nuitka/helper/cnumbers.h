@@ -0,0 +1,35 @@
+//     Copyright 2018, Kay Hayen, mailto:kay.hayen@gmail.com
+//
+//     Part of "Nuitka", an optimizing Python compiler that is compatible and
+//     integrates with CPython, but also works on its own.
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+#ifndef __NUITKA_HELPER_CNUMBERS_H__
+#define __NUITKA_HELPER_CNUMBERS_H__
+
+// Unboxed values of local variables, these are only converted to objects when
+// used as such. The flag takes the role of the NULL pointer of objects.
+typedef struct
+{
+    long value;
+    bool assigned;
+} nuitka_clong;
+
+typedef struct
+{
+    double value;
+    bool assigned;
+} nuitka_cdouble;
+
+#endif
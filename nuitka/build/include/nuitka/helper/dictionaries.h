@@ -87,6 +87,34 @@ static PyObject *GET_STRING_DICT_VALUE( PyDictObject *dict, Nuitka_StringObject
     return GET_STRING_DICT_ENTRY( dict, key )->me_value;
 }
 
+// Cache for a string dictionary lookup at one access site. The entry is
+// valid while the dictionary keeps its table and the entry has the key.
+struct Nuitka_DictEntryCache
+{
+    PyDictEntry *table;
+    Py_ssize_t mask;
+    PyDictEntry *entry;
+};
+
+NUITKA_MAY_BE_UNUSED static PyObject *GET_STRING_DICT_VALUE_CACHED( PyDictObject *dict, Nuitka_StringObject *key, struct Nuitka_DictEntryCache *cache )
+{
+    if ( likely( cache->table == dict->ma_table && cache->mask == dict->ma_mask && cache->entry->me_key == (PyObject *)key ) )
+    {
+        return cache->entry->me_value;
+    }
+
+    PyDictEntry *entry = GET_STRING_DICT_ENTRY( dict, key );
+
+    if ( entry->me_value != NULL )
+    {
+        cache->table = dict->ma_table;
+        cache->mask = dict->ma_mask;
+        cache->entry = entry;
+    }
+
+    return entry->me_value;
+}
+
 #else
 
 // Python 3.3 or higher.
@@ -342,15 +370,12 @@ NUITKA_MAY_BE_UNUSED static PyObject *TO_DICT( PyObject *seq_obj, PyObject *dict
 
 NUITKA_MAY_BE_UNUSED static void UPDATE_STRING_DICT0( PyDictObject *dict, Nuitka_StringObject *key, PyObject *value )
 {
-    Nuitka_DictEntryHandle entry = GET_STRING_DICT_ENTRY( dict, key );
-
 #if PYTHON_VERSION >= 360
-    if ( entry == NULL )
-    {
-        DICT_SET_ITEM( (PyObject *)dict, (PyObject *)key, value );
-        return;
-    }
-#endif
+    // Assigning through the entry would not change the dictionary version,
+    // which the caches of module variable reads rely on.
+    DICT_SET_ITEM( (PyObject *)dict, (PyObject *)key, value );
+#else
+    Nuitka_DictEntryHandle entry = GET_STRING_DICT_ENTRY( dict, key );
 
     PyObject *old = GET_DICT_ENTRY_VALUE( entry );
 
@@ -369,21 +394,18 @@ NUITKA_MAY_BE_UNUSED static void UPDATE_STRING_DICT0( PyDictObject *dict, Nuitka
     {
         DICT_SET_ITEM( (PyObject *)dict, (PyObject *)key, value );
     }
+#endif
 }
 
 NUITKA_MAY_BE_UNUSED static void UPDATE_STRING_DICT1( PyDictObject *dict, Nuitka_StringObject *key, PyObject *value )
 {
-    Nuitka_DictEntryHandle entry = GET_STRING_DICT_ENTRY( dict, key );
-
 #if PYTHON_VERSION >= 360
-    if ( entry == NULL )
-    {
-        DICT_SET_ITEM( (PyObject *)dict, (PyObject *)key, value );
-
-        Py_DECREF( value );
-        return;
-    }
-#endif
+    // Assigning through the entry would not change the dictionary version,
+    // which the caches of module variable reads rely on.
+    DICT_SET_ITEM( (PyObject *)dict, (PyObject *)key, value );
+    Py_DECREF( value );
+#else
+    Nuitka_DictEntryHandle entry = GET_STRING_DICT_ENTRY( dict, key );
 
     PyObject *old = GET_DICT_ENTRY_VALUE( entry );
 
@@ -401,6 +423,7 @@ NUITKA_MAY_BE_UNUSED static void UPDATE_STRING_DICT1( PyDictObject *dict, Nuitka
 
         Py_DECREF( value );
     }
+#endif
 }
 
 #endif
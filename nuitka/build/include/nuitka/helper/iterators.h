@@ -307,5 +307,116 @@ NUITKA_MAY_BE_UNUSED static bool UNPACK_ITERATOR_CHECK( PyObject *iterator )
     }
 }
 
+// Unpacking of values in assignments like "a, b = value". For exact "tuple"
+// and "list" values, the items are read directly, without an iterator object,
+// otherwise the iterator is created and used. Either way, the behaviour is
+// that of iterating over the value, including the errors.
+typedef struct
+{
+    PyObject *iterator;
+    PyObject *sequence;
+} nuitka_unpack_iterator;
+
+NUITKA_MAY_BE_UNUSED static bool MAKE_UNPACK_ITERATOR( nuitka_unpack_iterator *iterator, PyObject *value )
+{
+    CHECK_OBJECT( value );
+
+    if ( PyTuple_CheckExact( value ) || PyList_CheckExact( value ) )
+    {
+        Py_INCREF( value );
+        iterator->sequence = value;
+
+        return true;
+    }
+
+    iterator->iterator = MAKE_ITERATOR( value );
+
+    return iterator->iterator != NULL;
+}
+
+NUITKA_MAY_BE_UNUSED static PyObject *UNPACK_ITERATOR_NEXT( nuitka_unpack_iterator *iterator, int seq_size_so_far, int expected )
+{
+    PyObject *sequence = iterator->sequence;
+
+    if (unlikely( sequence == NULL ))
+    {
+#if PYTHON_VERSION < 350
+        return UNPACK_NEXT( iterator->iterator, seq_size_so_far );
+#else
+        return UNPACK_NEXT( iterator->iterator, seq_size_so_far, expected );
+#endif
+    }
+
+    // Lists can change their size while being unpacked, so the size is not
+    // checked in advance.
+    if ( PyTuple_CheckExact( sequence ) )
+    {
+        if ( likely( seq_size_so_far < PyTuple_GET_SIZE( sequence ) ) )
+        {
+            PyObject *result = PyTuple_GET_ITEM( sequence, seq_size_so_far );
+            Py_INCREF( result );
+            return result;
+        }
+    }
+    else
+    {
+        if ( likely( seq_size_so_far < PyList_GET_SIZE( sequence ) ) )
+        {
+            PyObject *result = PyList_GET_ITEM( sequence, seq_size_so_far );
+            Py_INCREF( result );
+            return result;
+        }
+    }
+
+#if PYTHON_VERSION < 350
+    if ( seq_size_so_far == 1 )
+    {
+        PyErr_Format( PyExc_ValueError, "need more than 1 value to unpack" );
+    }
+    else
+    {
+        PyErr_Format( PyExc_ValueError, "need more than %d values to unpack", seq_size_so_far );
+    }
+#else
+    PyErr_Format( PyExc_ValueError, "not enough values to unpack (expected %d, got %d)", expected, seq_size_so_far );
+#endif
+
+    return NULL;
+}
+
+NUITKA_MAY_BE_UNUSED static bool UNPACK_ITERATOR_CHECK_REMAINING( nuitka_unpack_iterator *iterator, int expected )
+{
+    PyObject *sequence = iterator->sequence;
+
+    if (likely( sequence != NULL ))
+    {
+        Py_ssize_t size = PyTuple_CheckExact( sequence ) ? PyTuple_GET_SIZE( sequence ) : PyList_GET_SIZE( sequence );
+
+        if (likely( size <= expected ))
+        {
+            return true;
+        }
+    }
+    else
+    {
+        PyObject *attempt = (*Py_TYPE( iterator->iterator )->tp_iternext)( iterator->iterator );
+
+        if (likely( attempt == NULL ))
+        {
+            return CHECK_AND_CLEAR_STOP_ITERATION_OCCURRED();
+        }
+
+        Py_DECREF( attempt );
+    }
+
+#if PYTHON_VERSION < 300
+    PyErr_Format( PyExc_ValueError, "too many values to unpack" );
+#else
+    PyErr_Format( PyExc_ValueError, "too many values to unpack (expected %d)", expected );
+#endif
+
+    return false;
+}
+
 #endif
 
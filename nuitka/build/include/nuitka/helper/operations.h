@@ -83,13 +83,233 @@ NUITKA_MAY_BE_UNUSED static bool BINARY_OPERATION_INPLACE( binary_api api, PyObj
 }
 
 
+#if PYTHON_VERSION >= 300
+// Fast paths for "int" values of up to two digits, which all fit into a C
+// long long with room for the results of additions and subtractions. These
+// return false, if not applicable, and the generic code must be used, which
+// is also the one to raise all errors. Results in the range of the small
+// "int" cache come from it.
+
+NUITKA_MAY_BE_UNUSED static bool GET_SMALL_LONG_VALUE( PyObject *value, long long *result )
+{
+    if ( !PyLong_CheckExact( value ) )
+    {
+        return false;
+    }
+
+    digit const *digits = ((PyLongObject *)value)->ob_digit;
+
+    switch( Py_SIZE( value ) )
+    {
+        case 0:
+            *result = 0;
+            return true;
+        case 1:
+            *result = (long long)digits[0];
+            return true;
+        case -1:
+            *result = -(long long)digits[0];
+            return true;
+        case 2:
+            *result = (long long)( ( (unsigned long long)digits[1] << PyLong_SHIFT ) | digits[0] );
+            return true;
+        case -2:
+            *result = -(long long)( ( (unsigned long long)digits[1] << PyLong_SHIFT ) | digits[0] );
+            return true;
+        default:
+            return false;
+    }
+}
+
+NUITKA_MAY_BE_UNUSED static bool SMALL_LONG_ADD( PyObject *operand1, PyObject *operand2, PyObject **result )
+{
+    long long a, b;
+
+    if ( !GET_SMALL_LONG_VALUE( operand1, &a ) || !GET_SMALL_LONG_VALUE( operand2, &b ) )
+    {
+        return false;
+    }
+
+    *result = PyLong_FromLongLong( a + b );
+    return true;
+}
+
+NUITKA_MAY_BE_UNUSED static bool SMALL_LONG_SUB( PyObject *operand1, PyObject *operand2, PyObject **result )
+{
+    long long a, b;
+
+    if ( !GET_SMALL_LONG_VALUE( operand1, &a ) || !GET_SMALL_LONG_VALUE( operand2, &b ) )
+    {
+        return false;
+    }
+
+    *result = PyLong_FromLongLong( a - b );
+    return true;
+}
+
+NUITKA_MAY_BE_UNUSED static bool SMALL_LONG_MUL( PyObject *operand1, PyObject *operand2, PyObject **result )
+{
+    long long a, b;
+
+    if ( !GET_SMALL_LONG_VALUE( operand1, &a ) || !GET_SMALL_LONG_VALUE( operand2, &b ) )
+    {
+        return false;
+    }
+
+    // With 31 bits each, the product cannot overflow.
+    if ( a < -0x7fffffffLL || a > 0x7fffffffLL || b < -0x7fffffffLL || b > 0x7fffffffLL )
+    {
+        return false;
+    }
+
+    *result = PyLong_FromLongLong( a * b );
+    return true;
+}
+
+NUITKA_MAY_BE_UNUSED static bool SMALL_LONG_FLOORDIV( PyObject *operand1, PyObject *operand2, PyObject **result )
+{
+    long long a, b;
+
+    if ( !GET_SMALL_LONG_VALUE( operand1, &a ) || !GET_SMALL_LONG_VALUE( operand2, &b ) )
+    {
+        return false;
+    }
+
+    if ( b == 0 )
+    {
+        return false;
+    }
+
+    // C division truncates, Python rounds towards negative infinity.
+    long long q = a / b;
+
+    if ( ( a % b != 0 ) && ( ( a < 0 ) != ( b < 0 ) ) )
+    {
+        q -= 1;
+    }
+
+    *result = PyLong_FromLongLong( q );
+    return true;
+}
+
+NUITKA_MAY_BE_UNUSED static bool SMALL_LONG_MOD( PyObject *operand1, PyObject *operand2, PyObject **result )
+{
+    long long a, b;
+
+    if ( !GET_SMALL_LONG_VALUE( operand1, &a ) || !GET_SMALL_LONG_VALUE( operand2, &b ) )
+    {
+        return false;
+    }
+
+    if ( b == 0 )
+    {
+        return false;
+    }
+
+    // The remainder in Python has the sign of the divisor.
+    long long r = a % b;
+
+    if ( r != 0 && ( ( r < 0 ) != ( b < 0 ) ) )
+    {
+        r += b;
+    }
+
+    *result = PyLong_FromLongLong( r );
+    return true;
+}
+
+NUITKA_MAY_BE_UNUSED static bool SMALL_LONG_LSHIFT( PyObject *operand1, PyObject *operand2, PyObject **result )
+{
+    long long a, b;
+
+    if ( !GET_SMALL_LONG_VALUE( operand1, &a ) || !GET_SMALL_LONG_VALUE( operand2, &b ) )
+    {
+        return false;
+    }
+
+    if ( b < 0 || b >= 63 )
+    {
+        return false;
+    }
+
+    // Shift as unsigned, and detect overflow by shifting back.
+    long long r = (long long)( (unsigned long long)a << b );
+
+    if ( ( r >> b ) != a )
+    {
+        return false;
+    }
+
+    *result = PyLong_FromLongLong( r );
+    return true;
+}
+
+NUITKA_MAY_BE_UNUSED static bool SMALL_LONG_RSHIFT( PyObject *operand1, PyObject *operand2, PyObject **result )
+{
+    long long a, b;
+
+    if ( !GET_SMALL_LONG_VALUE( operand1, &a ) || !GET_SMALL_LONG_VALUE( operand2, &b ) )
+    {
+        return false;
+    }
+
+    if ( b < 0 )
+    {
+        return false;
+    }
+
+    // This relies on arithmetic shift for negative values, just like CPython.
+    *result = PyLong_FromLongLong( b >= 63 ? ( a < 0 ? -1 : 0 ) : a >> b );
+    return true;
+}
+
+NUITKA_MAY_BE_UNUSED static bool SMALL_LONG_BITAND( PyObject *operand1, PyObject *operand2, PyObject **result )
+{
+    long long a, b;
+
+    if ( !GET_SMALL_LONG_VALUE( operand1, &a ) || !GET_SMALL_LONG_VALUE( operand2, &b ) )
+    {
+        return false;
+    }
+
+    *result = PyLong_FromLongLong( a & b );
+    return true;
+}
+
+NUITKA_MAY_BE_UNUSED static bool SMALL_LONG_BITOR( PyObject *operand1, PyObject *operand2, PyObject **result )
+{
+    long long a, b;
+
+    if ( !GET_SMALL_LONG_VALUE( operand1, &a ) || !GET_SMALL_LONG_VALUE( operand2, &b ) )
+    {
+        return false;
+    }
+
+    *result = PyLong_FromLongLong( a | b );
+    return true;
+}
+
+NUITKA_MAY_BE_UNUSED static bool SMALL_LONG_BITXOR( PyObject *operand1, PyObject *operand2, PyObject **result )
+{
+    long long a, b;
+
+    if ( !GET_SMALL_LONG_VALUE( operand1, &a ) || !GET_SMALL_LONG_VALUE( operand2, &b ) )
+    {
+        return false;
+    }
+
+    *result = PyLong_FromLongLong( a ^ b );
+    return true;
+}
+
+#endif
+
 NUITKA_MAY_BE_UNUSED static PyObject *BINARY_OPERATION_ADD( PyObject *operand1, PyObject *operand2 )
 {
     CHECK_OBJECT( operand1 );
     CHECK_OBJECT( operand2 );
 
 #if PYTHON_VERSION < 300
-    // Something similar for Python3 should exist too.
     if ( PyInt_CheckExact( operand1 ) && PyInt_CheckExact( operand2 ) )
     {
         long a, b, i;
@@ -106,6 +326,13 @@ NUITKA_MAY_BE_UNUSED static PyObject *BINARY_OPERATION_ADD( PyObject *operand1,
             return PyInt_FromLong( i );
         }
     }
+#else
+    PyObject *small_long_result;
+
+    if ( SMALL_LONG_ADD( operand1, operand2, &small_long_result ) )
+    {
+        return small_long_result;
+    }
 #endif
 
     binaryfunc slot1 = NULL;
@@ -387,7 +614,6 @@ NUITKA_MAY_BE_UNUSED static bool BINARY_OPERATION_ADD_INPLACE( PyObject **operan
     CHECK_OBJECT( operand2 );
 
 #if PYTHON_VERSION < 300
-    // Something similar for Python3 should exist too.
     if ( PyInt_CheckExact( *operand1 ) && PyInt_CheckExact( operand2 ) )
     {
         long a, b, i;
@@ -410,6 +636,21 @@ NUITKA_MAY_BE_UNUSED static bool BINARY_OPERATION_ADD_INPLACE( PyObject **operan
             return true;
         }
     }
+#else
+    PyObject *small_long_result;
+
+    if ( SMALL_LONG_ADD( *operand1, operand2, &small_long_result ) )
+    {
+        if (unlikely( small_long_result == NULL ))
+        {
+            return false;
+        }
+
+        Py_DECREF( *operand1 );
+        *operand1 = small_long_result;
+
+        return true;
+    }
 #endif
 
 #if PYTHON_VERSION < 300
@@ -495,6 +736,23 @@ NUITKA_MAY_BE_UNUSED static bool BINARY_OPERATION_MUL_INPLACE( PyObject **operan
     CHECK_OBJECT( *operand1 );
     CHECK_OBJECT( operand2 );
 
+#if PYTHON_VERSION >= 300
+    PyObject *small_long_result;
+
+    if ( SMALL_LONG_MUL( *operand1, operand2, &small_long_result ) )
+    {
+        if (unlikely( small_long_result == NULL ))
+        {
+            return false;
+        }
+
+        Py_DECREF( *operand1 );
+        *operand1 = small_long_result;
+
+        return true;
+    }
+#endif
+
     if ( Py_REFCNT( *operand1 ) == 1 )
     {
         if ( PyFloat_CheckExact( *operand1 ) &&
@@ -588,6 +846,15 @@ NUITKA_MAY_BE_UNUSED static PyObject *BINARY_OPERATION_MUL( PyObject *operand1,
     CHECK_OBJECT( operand1 );
     CHECK_OBJECT( operand2 );
 
+#if PYTHON_VERSION >= 300
+    PyObject *small_long_result;
+
+    if ( SMALL_LONG_MUL( operand1, operand2, &small_long_result ) )
+    {
+        return small_long_result;
+    }
+#endif
+
     binaryfunc slot1 = NULL;
     binaryfunc slot2 = NULL;
 
@@ -734,6 +1001,15 @@ NUITKA_MAY_BE_UNUSED static PyObject *BINARY_OPERATION_SUB( PyObject *operand1,
     CHECK_OBJECT( operand1 );
     CHECK_OBJECT( operand2 );
 
+#if PYTHON_VERSION >= 300
+    PyObject *small_long_result;
+
+    if ( SMALL_LONG_SUB( operand1, operand2, &small_long_result ) )
+    {
+        return small_long_result;
+    }
+#endif
+
     binaryfunc slot1 = NULL;
     binaryfunc slot2 = NULL;
 
@@ -998,6 +1274,15 @@ NUITKA_MAY_BE_UNUSED static PyObject *BINARY_OPERATION_FLOORDIV( PyObject *opera
     CHECK_OBJECT( operand1 );
     CHECK_OBJECT( operand2 );
 
+#if PYTHON_VERSION >= 300
+    PyObject *small_long_result;
+
+    if ( SMALL_LONG_FLOORDIV( operand1, operand2, &small_long_result ) )
+    {
+        return small_long_result;
+    }
+#endif
+
     binaryfunc slot1 = NULL;
     binaryfunc slot2 = NULL;
 
@@ -1262,6 +1547,15 @@ NUITKA_MAY_BE_UNUSED static PyObject *BINARY_OPERATION_REMAINDER( PyObject *oper
     CHECK_OBJECT( operand1 );
     CHECK_OBJECT( operand2 );
 
+#if PYTHON_VERSION >= 300
+    PyObject *small_long_result;
+
+    if ( SMALL_LONG_MOD( operand1, operand2, &small_long_result ) )
+    {
+        return small_long_result;
+    }
+#endif
+
     binaryfunc slot1 = NULL;
     binaryfunc slot2 = NULL;
 
@@ -1433,4 +1727,102 @@ NUITKA_MAY_BE_UNUSED static bool POWER_OPERATION_INPLACE( PyObject **operand1, P
     return true;
 }
 
+#if PYTHON_VERSION >= 300
+typedef bool (small_long_api)( PyObject *, PyObject *, PyObject ** );
+
+NUITKA_MAY_BE_UNUSED static PyObject *SMALL_LONG_OR_GENERIC_OPERATION( small_long_api fast, binary_api api, PyObject *operand1, PyObject *operand2 )
+{
+    CHECK_OBJECT( operand1 );
+    CHECK_OBJECT( operand2 );
+
+    PyObject *result;
+
+    if ( fast( operand1, operand2, &result ) )
+    {
+        return result;
+    }
+
+    return api( operand1, operand2 );
+}
+
+// Operations without a specialized variant, that still get the fast paths for
+// small "int" values. The in-place ones are given to "BINARY_OPERATION" and
+// "BINARY_OPERATION_INPLACE" like the C/API functions they wrap.
+
+NUITKA_MAY_BE_UNUSED static PyObject *BINARY_OPERATION_LSHIFT( PyObject *operand1, PyObject *operand2 )
+{
+    return SMALL_LONG_OR_GENERIC_OPERATION( SMALL_LONG_LSHIFT, PyNumber_Lshift, operand1, operand2 );
+}
+
+NUITKA_MAY_BE_UNUSED static PyObject *BINARY_OPERATION_RSHIFT( PyObject *operand1, PyObject *operand2 )
+{
+    return SMALL_LONG_OR_GENERIC_OPERATION( SMALL_LONG_RSHIFT, PyNumber_Rshift, operand1, operand2 );
+}
+
+NUITKA_MAY_BE_UNUSED static PyObject *BINARY_OPERATION_BITAND( PyObject *operand1, PyObject *operand2 )
+{
+    return SMALL_LONG_OR_GENERIC_OPERATION( SMALL_LONG_BITAND, PyNumber_And, operand1, operand2 );
+}
+
+NUITKA_MAY_BE_UNUSED static PyObject *BINARY_OPERATION_BITOR( PyObject *operand1, PyObject *operand2 )
+{
+    return SMALL_LONG_OR_GENERIC_OPERATION( SMALL_LONG_BITOR, PyNumber_Or, operand1, operand2 );
+}
+
+NUITKA_MAY_BE_UNUSED static PyObject *BINARY_OPERATION_BITXOR( PyObject *operand1, PyObject *operand2 )
+{
+    return SMALL_LONG_OR_GENERIC_OPERATION( SMALL_LONG_BITXOR, PyNumber_Xor, operand1, operand2 );
+}
+
+NUITKA_MAY_BE_UNUSED static PyObject *INPLACE_OPERATION_ADD( PyObject *operand1, PyObject *operand2 )
+{
+    return SMALL_LONG_OR_GENERIC_OPERATION( SMALL_LONG_ADD, PyNumber_InPlaceAdd, operand1, operand2 );
+}
+
+NUITKA_MAY_BE_UNUSED static PyObject *INPLACE_OPERATION_SUB( PyObject *operand1, PyObject *operand2 )
+{
+    return SMALL_LONG_OR_GENERIC_OPERATION( SMALL_LONG_SUB, PyNumber_InPlaceSubtract, operand1, operand2 );
+}
+
+NUITKA_MAY_BE_UNUSED static PyObject *INPLACE_OPERATION_MUL( PyObject *operand1, PyObject *operand2 )
+{
+    return SMALL_LONG_OR_GENERIC_OPERATION( SMALL_LONG_MUL, PyNumber_InPlaceMultiply, operand1, operand2 );
+}
+
+NUITKA_MAY_BE_UNUSED static PyObject *INPLACE_OPERATION_FLOORDIV( PyObject *operand1, PyObject *operand2 )
+{
+    return SMALL_LONG_OR_GENERIC_OPERATION( SMALL_LONG_FLOORDIV, PyNumber_InPlaceFloorDivide, operand1, operand2 );
+}
+
+NUITKA_MAY_BE_UNUSED static PyObject *INPLACE_OPERATION_REMAINDER( PyObject *operand1, PyObject *operand2 )
+{
+    return SMALL_LONG_OR_GENERIC_OPERATION( SMALL_LONG_MOD, PyNumber_InPlaceRemainder, operand1, operand2 );
+}
+
+NUITKA_MAY_BE_UNUSED static PyObject *INPLACE_OPERATION_LSHIFT( PyObject *operand1, PyObject *operand2 )
+{
+    return SMALL_LONG_OR_GENERIC_OPERATION( SMALL_LONG_LSHIFT, PyNumber_InPlaceLshift, operand1, operand2 );
+}
+
+NUITKA_MAY_BE_UNUSED static PyObject *INPLACE_OPERATION_RSHIFT( PyObject *operand1, PyObject *operand2 )
+{
+    return SMALL_LONG_OR_GENERIC_OPERATION( SMALL_LONG_RSHIFT, PyNumber_InPlaceRshift, operand1, operand2 );
+}
+
+NUITKA_MAY_BE_UNUSED static PyObject *INPLACE_OPERATION_BITAND( PyObject *operand1, PyObject *operand2 )
+{
+    return SMALL_LONG_OR_GENERIC_OPERATION( SMALL_LONG_BITAND, PyNumber_InPlaceAnd, operand1, operand2 );
+}
+
+NUITKA_MAY_BE_UNUSED static PyObject *INPLACE_OPERATION_BITOR( PyObject *operand1, PyObject *operand2 )
+{
+    return SMALL_LONG_OR_GENERIC_OPERATION( SMALL_LONG_BITOR, PyNumber_InPlaceOr, operand1, operand2 );
+}
+
+NUITKA_MAY_BE_UNUSED static PyObject *INPLACE_OPERATION_BITXOR( PyObject *operand1, PyObject *operand2 )
+{
+    return SMALL_LONG_OR_GENERIC_OPERATION( SMALL_LONG_BITXOR, PyNumber_InPlaceXor, operand1, operand2 );
+}
+#endif
+
 #endif
@@ -30,6 +30,41 @@ extern PyObject *BUILTIN_XRANGE1( PyObject *high );
 extern PyObject *BUILTIN_XRANGE2( PyObject *low, PyObject *high );
 extern PyObject *BUILTIN_XRANGE3( PyObject *low, PyObject *high, PyObject *step );
 
+// Iteration of "range" and "xrange" values in loops, with the values in a C
+// long, so no range or iterator objects are created. If the arguments are not
+// suitable for that, the iterator object is created and used instead.
+typedef struct
+{
+    PyObject *iterator;
+
+    long current;
+    long step;
+    unsigned long remaining;
+} nuitka_range_iterator;
+
+extern bool MAKE_RANGE_ITERATOR( nuitka_range_iterator *iterator, PyObject *low, PyObject *high, PyObject *step, bool is_xrange );
+
+NUITKA_MAY_BE_UNUSED static PyObject *RANGE_ITERATOR_NEXT( nuitka_range_iterator *iterator )
+{
+    if (unlikely( iterator->iterator != NULL ))
+    {
+        return ITERATOR_NEXT( iterator->iterator );
+    }
+
+    if ( iterator->remaining == 0 )
+    {
+        return NULL;
+    }
+
+    long value = iterator->current;
+
+    // Overflow after the last value is possible, and not an issue.
+    iterator->current = (long)( (unsigned long)value + (unsigned long)iterator->step );
+    iterator->remaining -= 1;
+
+    return PyInt_FromLong( value );
+}
+
 #if PYTHON_VERSION >= 300
 
 /* Python3 range objects */
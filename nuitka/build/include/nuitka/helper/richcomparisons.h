@@ -33,8 +33,222 @@ static inline bool IS_SANE_TYPE( PyTypeObject *type )
 extern PyObject *MY_RICHCOMPARE( PyObject *v, PyObject *w, int op );
 extern PyObject *MY_RICHCOMPARE_NORECURSE( PyObject *v, PyObject *w, int op );
 
+// Comparisons of values with exactly known types. These are used by the code
+// generation when the shapes of both values are known, and by the generic
+// helpers after checking the types at run time. Only rare cases, which the
+// generic code handles, can fail.
+
+NUITKA_MAY_BE_UNUSED static inline int RICH_COMPARE_RESULT( int cmp, int op )
+{
+    switch( op )
+    {
+        case Py_LT: return cmp < 0;
+        case Py_LE: return cmp <= 0;
+        case Py_EQ: return cmp == 0;
+        case Py_NE: return cmp != 0;
+        case Py_GT: return cmp > 0;
+        case Py_GE: return cmp >= 0;
+    }
+
+    assert( false );
+    return 0;
+}
+
+// Fallback for values of these types that the C code does not handle.
+NUITKA_MAY_BE_UNUSED static int RICH_COMPARE_BOOL_GENERIC( PyObject *operand1, PyObject *operand2, int op )
+{
+    PyObject *rich_result = MY_RICHCOMPARE( operand1, operand2, op );
+
+    if (unlikely( rich_result == NULL ))
+    {
+        return -1;
+    }
+
+    int result = rich_result == Py_True;
+    Py_DECREF( rich_result );
+
+    return result;
+}
+
+NUITKA_MAY_BE_UNUSED static int RICH_COMPARE_BOOL_INT_INT( PyObject *operand1, PyObject *operand2, int op )
+{
+#if PYTHON_VERSION < 300
+    long a = PyInt_AS_LONG( operand1 );
+    long b = PyInt_AS_LONG( operand2 );
+
+    return RICH_COMPARE_RESULT( a < b ? -1 : ( a > b ? 1 : 0 ), op );
+#else
+    // Same as the comparison of "int" objects of CPython, by sign and size
+    // first, then by the highest differing digit.
+    Py_ssize_t size1 = Py_SIZE( operand1 );
+    Py_ssize_t size2 = Py_SIZE( operand2 );
+
+    int cmp;
+
+    if ( size1 != size2 )
+    {
+        cmp = size1 < size2 ? -1 : 1;
+    }
+    else
+    {
+        digit const *digits1 = ((PyLongObject *)operand1)->ob_digit;
+        digit const *digits2 = ((PyLongObject *)operand2)->ob_digit;
+
+        Py_ssize_t i = Py_ABS( size1 );
+
+        while ( --i >= 0 && digits1[ i ] == digits2[ i ] );
+
+        if ( i < 0 )
+        {
+            cmp = 0;
+        }
+        else
+        {
+            cmp = digits1[ i ] < digits2[ i ] ? -1 : 1;
+
+            if ( size1 < 0 )
+            {
+                cmp = -cmp;
+            }
+        }
+    }
+
+    return RICH_COMPARE_RESULT( cmp, op );
+#endif
+}
+
+NUITKA_MAY_BE_UNUSED static inline int RICH_COMPARE_DOUBLE_VALUES( double a, double b, int op )
+{
+    // No three way comparison here, "NaN" values compare false to anything.
+    switch( op )
+    {
+        case Py_LT: return a < b;
+        case Py_LE: return a <= b;
+        case Py_EQ: return a == b;
+        case Py_NE: return a != b;
+        case Py_GT: return a > b;
+        case Py_GE: return a >= b;
+    }
+
+    assert( false );
+    return 0;
+}
+
+NUITKA_MAY_BE_UNUSED static int RICH_COMPARE_BOOL_FLOAT_FLOAT( PyObject *operand1, PyObject *operand2, int op )
+{
+    return RICH_COMPARE_DOUBLE_VALUES( PyFloat_AS_DOUBLE( operand1 ), PyFloat_AS_DOUBLE( operand2 ), op );
+}
+
+// Not inline, the code is larger and would be duplicated for every use.
+extern int RICH_COMPARE_BOOL_STR_STR( PyObject *operand1, PyObject *operand2, int op );
+
+// For an "int" value that a "float" can hold exactly, the comparison can be
+// done with C doubles.
+NUITKA_MAY_BE_UNUSED static bool GET_EXACT_DOUBLE_VALUE( PyObject *value, double *result )
+{
+#if PYTHON_VERSION < 300
+    long a = PyInt_AS_LONG( value );
+#else
+    long long a;
+
+    if ( !GET_SMALL_LONG_VALUE( value, &a ) )
+    {
+        return false;
+    }
+#endif
+
+    if ( a < -(1LL << 53) || a > (1LL << 53) )
+    {
+        return false;
+    }
+
+    *result = (double)a;
+    return true;
+}
+
+// Other "int" values use the generic code, which is why the result can be an
+// error indicator here.
+NUITKA_MAY_BE_UNUSED static int RICH_COMPARE_BOOL_INT_FLOAT( PyObject *operand1, PyObject *operand2, int op )
+{
+    double a;
+
+    if ( likely( GET_EXACT_DOUBLE_VALUE( operand1, &a ) ) )
+    {
+        return RICH_COMPARE_DOUBLE_VALUES( a, PyFloat_AS_DOUBLE( operand2 ), op );
+    }
+
+    return RICH_COMPARE_BOOL_GENERIC( operand1, operand2, op );
+}
+
+// Check the types at run time for the above helpers. Returns false, if none
+// of them applies without the generic code.
+NUITKA_MAY_BE_UNUSED static bool RICH_COMPARE_BOOL_EXACT_TYPES( PyObject *operand1, PyObject *operand2, int op, int *result )
+{
+    PyTypeObject *type1 = Py_TYPE( operand1 );
+    PyTypeObject *type2 = Py_TYPE( operand2 );
+
+#if PYTHON_VERSION < 300
+    PyTypeObject *int_type = &PyInt_Type;
+    PyTypeObject *str_type = &PyString_Type;
+#else
+    PyTypeObject *int_type = &PyLong_Type;
+    PyTypeObject *str_type = &PyUnicode_Type;
+#endif
+
+    if ( type1 == type2 )
+    {
+        if ( type1 == int_type )
+        {
+            *result = RICH_COMPARE_BOOL_INT_INT( operand1, operand2, op );
+            return true;
+        }
+        else if ( type1 == &PyFloat_Type )
+        {
+            *result = RICH_COMPARE_BOOL_FLOAT_FLOAT( operand1, operand2, op );
+            return true;
+        }
+        else if ( type1 == str_type )
+        {
+#if PYTHON_VERSION >= 330
+            if (unlikely( !PyUnicode_IS_READY( operand1 ) || !PyUnicode_IS_READY( operand2 ) ))
+            {
+                return false;
+            }
+#endif
+            *result = RICH_COMPARE_BOOL_STR_STR( operand1, operand2, op );
+            return true;
+        }
+    }
+    else
+    {
+        double a;
+
+        if ( type1 == int_type && type2 == &PyFloat_Type && GET_EXACT_DOUBLE_VALUE( operand1, &a ) )
+        {
+            *result = RICH_COMPARE_DOUBLE_VALUES( a, PyFloat_AS_DOUBLE( operand2 ), op );
+            return true;
+        }
+        else if ( type1 == &PyFloat_Type && type2 == int_type && GET_EXACT_DOUBLE_VALUE( operand2, &a ) )
+        {
+            *result = RICH_COMPARE_DOUBLE_VALUES( PyFloat_AS_DOUBLE( operand1 ), a, op );
+            return true;
+        }
+    }
+
+    return false;
+}
+
 NUITKA_MAY_BE_UNUSED static PyObject *RICH_COMPARE_LT( PyObject *operand1, PyObject *operand2 )
 {
+    int fast_result;
+
+    if ( RICH_COMPARE_BOOL_EXACT_TYPES( operand1, operand2, Py_LT, &fast_result ) )
+    {
+        PyObject *result = BOOL_FROM( fast_result != 0 );
+        Py_INCREF( result );
+        return result;
+    }
+
     PyObject *result = MY_RICHCOMPARE( operand1, operand2, Py_LT );
 
     if (unlikely( result == NULL ))
@@ -54,6 +268,15 @@ NUITKA_MAY_BE_UNUSED static PyObject *RICH_COMPARE_LE( PyObject *operand1, PyObj
         return Py_True;
     }
 
+    int fast_result;
+
+    if ( RICH_COMPARE_BOOL_EXACT_TYPES( operand1, operand2, Py_LE, &fast_result ) )
+    {
+        PyObject *result = BOOL_FROM( fast_result != 0 );
+        Py_INCREF( result );
+        return result;
+    }
+
     PyObject *result = MY_RICHCOMPARE( operand1, operand2, Py_LE );
 
     if (unlikely( result == NULL ))
@@ -73,6 +296,15 @@ NUITKA_MAY_BE_UNUSED static PyObject *RICH_COMPARE_EQ( PyObject *operand1, PyObj
         return Py_True;
     }
 
+    int fast_result;
+
+    if ( RICH_COMPARE_BOOL_EXACT_TYPES( operand1, operand2, Py_EQ, &fast_result ) )
+    {
+        PyObject *result = BOOL_FROM( fast_result != 0 );
+        Py_INCREF( result );
+        return result;
+    }
+
     return MY_RICHCOMPARE( operand1, operand2, Py_EQ );
 }
 
@@ -85,6 +317,15 @@ NUITKA_MAY_BE_UNUSED static PyObject *RICH_COMPARE_EQ_NORECURSE( PyObject *opera
         return Py_True;
     }
 
+    int fast_result;
+
+    if ( RICH_COMPARE_BOOL_EXACT_TYPES( operand1, operand2, Py_EQ, &fast_result ) )
+    {
+        PyObject *result = BOOL_FROM( fast_result != 0 );
+        Py_INCREF( result );
+        return result;
+    }
+
     return MY_RICHCOMPARE_NORECURSE( operand1, operand2, Py_EQ );
 }
 
@@ -99,11 +340,29 @@ NUITKA_MAY_BE_UNUSED static PyObject *RICH_COMPARE_NE( PyObject *operand1, PyObj
         return Py_False;
     }
 
+    int fast_result;
+
+    if ( RICH_COMPARE_BOOL_EXACT_TYPES( operand1, operand2, Py_NE, &fast_result ) )
+    {
+        PyObject *result = BOOL_FROM( fast_result != 0 );
+        Py_INCREF( result );
+        return result;
+    }
+
     return MY_RICHCOMPARE( operand1, operand2, Py_NE );
 }
 
 NUITKA_MAY_BE_UNUSED static PyObject *RICH_COMPARE_GT( PyObject *operand1, PyObject *operand2 )
 {
+    int fast_result;
+
+    if ( RICH_COMPARE_BOOL_EXACT_TYPES( operand1, operand2, Py_GT, &fast_result ) )
+    {
+        PyObject *result = BOOL_FROM( fast_result != 0 );
+        Py_INCREF( result );
+        return result;
+    }
+
     return MY_RICHCOMPARE( operand1, operand2, Py_GT );
 }
 
@@ -116,11 +375,27 @@ NUITKA_MAY_BE_UNUSED static PyObject *RICH_COMPARE_GE( PyObject *operand1, PyObj
         return Py_True;
     }
 
+    int fast_result;
+
+    if ( RICH_COMPARE_BOOL_EXACT_TYPES( operand1, operand2, Py_GE, &fast_result ) )
+    {
+        PyObject *result = BOOL_FROM( fast_result != 0 );
+        Py_INCREF( result );
+        return result;
+    }
+
     return MY_RICHCOMPARE( operand1, operand2, Py_GE );
 }
 
 NUITKA_MAY_BE_UNUSED static int RICH_COMPARE_BOOL_LT( PyObject *operand1, PyObject *operand2 )
 {
+    int fast_result;
+
+    if ( RICH_COMPARE_BOOL_EXACT_TYPES( operand1, operand2, Py_LT, &fast_result ) )
+    {
+        return fast_result;
+    }
+
     PyObject *rich_result = MY_RICHCOMPARE( operand1, operand2, Py_LT );
 
     if (unlikely( rich_result == NULL ))
@@ -158,6 +433,13 @@ NUITKA_MAY_BE_UNUSED static int RICH_COMPARE_BOOL_LE( PyObject *operand1, PyObje
         return 1;
     }
 
+    int fast_result;
+
+    if ( RICH_COMPARE_BOOL_EXACT_TYPES( operand1, operand2, Py_LE, &fast_result ) )
+    {
+        return fast_result;
+    }
+
     PyObject *rich_result = MY_RICHCOMPARE( operand1, operand2, Py_LE );
 
     if (unlikely( rich_result == NULL ))
@@ -195,6 +477,13 @@ NUITKA_MAY_BE_UNUSED static int RICH_COMPARE_BOOL_EQ( PyObject *operand1, PyObje
         return 1;
     }
 
+    int fast_result;
+
+    if ( RICH_COMPARE_BOOL_EXACT_TYPES( operand1, operand2, Py_EQ, &fast_result ) )
+    {
+        return fast_result;
+    }
+
     PyObject *rich_result = MY_RICHCOMPARE( operand1, operand2, Py_EQ );
 
     if (unlikely( rich_result == NULL ))
@@ -232,6 +521,13 @@ NUITKA_MAY_BE_UNUSED static int RICH_COMPARE_BOOL_EQ_NORECURSE( PyObject *operan
         return 1;
     }
 
+    int fast_result;
+
+    if ( RICH_COMPARE_BOOL_EXACT_TYPES( operand1, operand2, Py_EQ, &fast_result ) )
+    {
+        return fast_result;
+    }
+
     PyObject *rich_result = MY_RICHCOMPARE_NORECURSE( operand1, operand2, Py_EQ );
 
     if (unlikely( rich_result == NULL ))
@@ -270,6 +566,13 @@ NUITKA_MAY_BE_UNUSED static int RICH_COMPARE_BOOL_NE( PyObject *operand1, PyObje
         return 0;
     }
 
+    int fast_result;
+
+    if ( RICH_COMPARE_BOOL_EXACT_TYPES( operand1, operand2, Py_NE, &fast_result ) )
+    {
+        return fast_result;
+    }
+
     PyObject *rich_result = MY_RICHCOMPARE( operand1, operand2, Py_NE );
 
     if (unlikely( rich_result == NULL ))
@@ -301,6 +604,13 @@ NUITKA_MAY_BE_UNUSED static int RICH_COMPARE_BOOL_NE( PyObject *operand1, PyObje
 
 NUITKA_MAY_BE_UNUSED static int RICH_COMPARE_BOOL_GT( PyObject *operand1, PyObject *operand2 )
 {
+    int fast_result;
+
+    if ( RICH_COMPARE_BOOL_EXACT_TYPES( operand1, operand2, Py_GT, &fast_result ) )
+    {
+        return fast_result;
+    }
+
     PyObject *rich_result = MY_RICHCOMPARE( operand1, operand2, Py_GT );
 
     if (unlikely( rich_result == NULL ))
@@ -338,6 +648,13 @@ NUITKA_MAY_BE_UNUSED static int RICH_COMPARE_BOOL_GE( PyObject *operand1, PyObje
         return 1;
     }
 
+    int fast_result;
+
+    if ( RICH_COMPARE_BOOL_EXACT_TYPES( operand1, operand2, Py_GE, &fast_result ) )
+    {
+        return fast_result;
+    }
+
     PyObject *rich_result = MY_RICHCOMPARE( operand1, operand2, Py_GE );
 
     if (unlikely( rich_result == NULL ))
@@ -20,119 +20,144 @@
 
 extern PyObject *STRING_FROM_CHAR( unsigned char c );
 
-NUITKA_MAY_BE_UNUSED static PyObject *LOOKUP_SUBSCRIPT_CONST( PyObject *source, PyObject *const_subscript, Py_ssize_t int_subscript )
+// Get the index value of an exact "int" object that fits into a C index,
+// returns false otherwise.
+NUITKA_MAY_BE_UNUSED static bool GET_SMALL_INDEX_VALUE( PyObject *subscript, Py_ssize_t *index )
 {
-    CHECK_OBJECT( source );
-    CHECK_OBJECT( const_subscript );
+#if PYTHON_VERSION < 300
+    if ( PyInt_CheckExact( subscript ) )
+    {
+        *index = PyInt_AS_LONG( subscript );
+        return true;
+    }
+#else
+    long long value;
 
-    PyTypeObject *type = Py_TYPE( source );
-    PyMappingMethods *mapping_methods = type->tp_as_mapping;
+    if ( GET_SMALL_LONG_VALUE( subscript, &value ) &&
+         value >= PY_SSIZE_T_MIN && value <= PY_SSIZE_T_MAX )
+    {
+        *index = (Py_ssize_t)value;
+        return true;
+    }
+#endif
 
-    PyObject *result;
+    return false;
+}
+
+// Index lookups on exact "list", "tuple" and "str" values, also "bytes" for
+// Python3, with the same errors as CPython. Returns false, if the type is
+// not covered, otherwise the result is set, NULL for an exception.
+NUITKA_MAY_BE_UNUSED static bool LOOKUP_SUBSCRIPT_INDEX_FAST( PyObject *source, Py_ssize_t index, PyObject **result )
+{
+    PyTypeObject *type = Py_TYPE( source );
 
-    if ( mapping_methods && mapping_methods->mp_subscript )
+    if ( type == &PyList_Type )
     {
-        if ( PyList_CheckExact( source ) )
+        Py_ssize_t size = PyList_GET_SIZE( source );
+
+        if ( index < 0 )
         {
-            Py_ssize_t list_size = PyList_GET_SIZE( source );
+            index += size;
+        }
 
-            if ( int_subscript < 0 )
-            {
-                if ( -int_subscript > list_size )
-                {
-                    PyErr_Format( PyExc_IndexError, "list index out of range" );
-                    return NULL;
-                }
+        if (unlikely( (size_t)index >= (size_t)size ))
+        {
+            PyErr_Format( PyExc_IndexError, "list index out of range" );
+            *result = NULL;
+            return true;
+        }
 
-                int_subscript += list_size;
-            }
-            else
-            {
-                if ( int_subscript >= list_size )
-                {
-                    PyErr_Format( PyExc_IndexError, "list index out of range" );
-                    return NULL;
-                }
-            }
+        *result = PyList_GET_ITEM( source, index );
+        Py_INCREF( *result );
+        return true;
+    }
+    else if ( type == &PyTuple_Type )
+    {
+        Py_ssize_t size = PyTuple_GET_SIZE( source );
 
-            result = ((PyListObject *)source)->ob_item[ int_subscript ];
+        if ( index < 0 )
+        {
+            index += size;
+        }
 
-            Py_INCREF( result );
-            return result;
+        if (unlikely( (size_t)index >= (size_t)size ))
+        {
+            PyErr_Format( PyExc_IndexError, "tuple index out of range" );
+            *result = NULL;
+            return true;
         }
+
+        *result = PyTuple_GET_ITEM( source, index );
+        Py_INCREF( *result );
+        return true;
+    }
 #if PYTHON_VERSION < 300
-        else if ( PyString_CheckExact( source ) )
+    else if ( type == &PyString_Type )
+    {
+        Py_ssize_t size = PyString_GET_SIZE( source );
+
+        if ( index < 0 )
         {
-            Py_ssize_t string_size = PyString_GET_SIZE( source );
+            index += size;
+        }
 
-            if ( int_subscript < 0 )
-            {
-                if ( -int_subscript > string_size )
-                {
-                    PyErr_Format( PyExc_IndexError, "string index out of range" );
-                    return NULL;
-                }
+        if (unlikely( (size_t)index >= (size_t)size ))
+        {
+            PyErr_Format( PyExc_IndexError, "string index out of range" );
+            *result = NULL;
+            return true;
+        }
 
-                int_subscript += string_size;
-            }
-            else
-            {
-                if ( int_subscript >= string_size )
-                {
-                    PyErr_Format( PyExc_IndexError, "string index out of range" );
-                    return NULL;
-                }
-            }
+        *result = STRING_FROM_CHAR( ((PyStringObject *)source)->ob_sval[ index ] );
+        return true;
+    }
+#else
+    else if ( type == &PyUnicode_Type )
+    {
+#if PYTHON_VERSION >= 330
+        if (unlikely( !PyUnicode_IS_READY( source ) ))
+        {
+            return false;
+        }
 
-            unsigned char c = ((PyStringObject *)source)->ob_sval[ int_subscript ];
-            return STRING_FROM_CHAR( c );
+        if ( index < 0 )
+        {
+            index += PyUnicode_GET_LENGTH( source );
         }
 #else
-        else if ( PyUnicode_CheckExact( source ) )
+        if ( index < 0 )
         {
-            if ( int_subscript < 0 )
-            {
-#if PYTHON_VERSION < 330
-                int_subscript += PyUnicode_GET_SIZE( source );
-#else
-                int_subscript += PyUnicode_GET_LENGTH( source );
+            index += PyUnicode_GET_SIZE( source );
+        }
 #endif
-            }
 
-            result = type->tp_as_sequence->sq_item( source, int_subscript );
+        // This gives the error for bad indexes, and shares the strings for
+        // the common characters.
+        *result = type->tp_as_sequence->sq_item( source, index );
+        return true;
+    }
+    else if ( type == &PyBytes_Type )
+    {
+        Py_ssize_t size = PyBytes_GET_SIZE( source );
+
+        if ( index < 0 )
+        {
+            index += size;
         }
-#endif
-        else
+
+        if (unlikely( (size_t)index >= (size_t)size ))
         {
-            result = mapping_methods->mp_subscript( source, const_subscript );
+            PyErr_Format( PyExc_IndexError, "index out of range" );
+            *result = NULL;
+            return true;
         }
-    }
-    else if ( type->tp_as_sequence )
-    {
-        result = PySequence_GetItem( source, int_subscript );
-    }
-    else
-    {
-        PyErr_Format(
-            PyExc_TypeError,
-#if PYTHON_VERSION < 270
-            "'%s' object is unsubscriptable",
-#elif PYTHON_VERSION >= 300 || PYTHON_VERSION <= 272
-            "'%s' object is not subscriptable",
-#else
-            "'%s' object has no attribute '__getitem__'",
-#endif
-            Py_TYPE( source )->tp_name
-        );
-        return NULL;
-    }
 
-    if (unlikely( result == NULL ))
-    {
-        return NULL;
+        *result = PyLong_FromLong( (unsigned char)PyBytes_AS_STRING( source )[ index ] );
+        return true;
     }
+#endif
 
-    return result;
+    return false;
 }
 
 NUITKA_MAY_BE_UNUSED static PyObject *LOOKUP_SUBSCRIPT( PyObject *source, PyObject *subscript )
@@ -140,11 +165,18 @@ NUITKA_MAY_BE_UNUSED static PyObject *LOOKUP_SUBSCRIPT( PyObject *source, PyObje
     CHECK_OBJECT( source );
     CHECK_OBJECT( subscript );
 
+    Py_ssize_t index;
+    PyObject *result;
+
+    if ( GET_SMALL_INDEX_VALUE( subscript, &index ) &&
+         LOOKUP_SUBSCRIPT_INDEX_FAST( source, index, &result ) )
+    {
+        return result;
+    }
+
     PyTypeObject *type = Py_TYPE( source );
     PyMappingMethods *mapping = type->tp_as_mapping;
 
-    PyObject *result;
-
     if ( mapping != NULL && mapping->mp_subscript != NULL )
     {
         result = mapping->mp_subscript( source, subscript );
@@ -208,103 +240,82 @@ NUITKA_MAY_BE_UNUSED static PyObject *LOOKUP_SUBSCRIPT( PyObject *source, PyObje
     return result;
 }
 
-NUITKA_MAY_BE_UNUSED static bool SET_SUBSCRIPT_CONST( PyObject *target, PyObject *subscript, Py_ssize_t int_subscript, PyObject *value )
+// For constant indexes, the C value is known at compile time.
+NUITKA_MAY_BE_UNUSED static PyObject *LOOKUP_SUBSCRIPT_CONST( PyObject *source, PyObject *const_subscript, Py_ssize_t int_subscript )
 {
-    CHECK_OBJECT( value );
-    CHECK_OBJECT( target );
-    CHECK_OBJECT( subscript );
+    CHECK_OBJECT( source );
+    CHECK_OBJECT( const_subscript );
 
-    PyMappingMethods *mapping_methods = Py_TYPE( target )->tp_as_mapping;
+    PyObject *result;
 
-    if ( mapping_methods != NULL && mapping_methods->mp_ass_subscript )
+    if ( LOOKUP_SUBSCRIPT_INDEX_FAST( source, int_subscript, &result ) )
     {
-        if ( PyList_CheckExact( target ) )
-        {
-            Py_ssize_t list_size = PyList_GET_SIZE( target );
+        return result;
+    }
 
-            if ( int_subscript < 0 )
-            {
-                if ( -int_subscript > list_size )
-                {
-                    PyErr_Format(
-                        PyExc_IndexError,
-                        "list assignment index out of range"
-                    );
+    return LOOKUP_SUBSCRIPT( source, const_subscript );
+}
 
-                    return false;
-                }
+// For indexes that are C values, the object is only created when needed.
+NUITKA_MAY_BE_UNUSED static PyObject *LOOKUP_SUBSCRIPT_INDEX( PyObject *source, Py_ssize_t index )
+{
+    CHECK_OBJECT( source );
 
-                int_subscript += list_size;
-            }
+    PyObject *result;
 
-            PyListObject *target_list = (PyListObject *)target;
+    if ( LOOKUP_SUBSCRIPT_INDEX_FAST( source, index, &result ) )
+    {
+        return result;
+    }
 
-            PyObject *old_value = target_list->ob_item[ int_subscript ];
-            Py_INCREF( value );
-            target_list->ob_item[ int_subscript ] = value;
-            Py_DECREF( old_value );
+#if PYTHON_VERSION < 300
+    PyObject *subscript = PyInt_FromSsize_t( index );
+#else
+    PyObject *subscript = PyLong_FromSsize_t( index );
+#endif
 
-            return true;
-        }
-        else
-        {
-            int res = mapping_methods->mp_ass_subscript( target, subscript, value );
+    if (unlikely( subscript == NULL ))
+    {
+        return NULL;
+    }
 
-            if (unlikely( res == -1 ))
-            {
-                return false;
-            }
+    result = LOOKUP_SUBSCRIPT( source, subscript );
 
-            return true;
-        }
-    }
-    else if ( Py_TYPE( target )->tp_as_sequence )
-    {
-        if ( PyIndex_Check( subscript ) )
-        {
-            Py_ssize_t key_value = PyNumber_AsSsize_t( subscript, PyExc_IndexError );
+    Py_DECREF( subscript );
 
-            if ( key_value == -1 )
-            {
-                if ( ERROR_OCCURRED() )
-                {
-                    return false;
-                }
-            }
+    return result;
+}
 
-            return SEQUENCE_SETITEM( target, key_value, value );
-        }
-        else if ( Py_TYPE( target )->tp_as_sequence->sq_ass_item )
-        {
-            PyErr_Format(
-                PyExc_TypeError,
-                "sequence index must be integer, not '%s'",
-                Py_TYPE( subscript )->tp_name
-            );
+// Index assignments on exact "list" values, with the same errors as CPython.
+// Returns false, if the type is not covered, otherwise the result is set.
+NUITKA_MAY_BE_UNUSED static bool SET_SUBSCRIPT_INDEX_FAST( PyObject *target, Py_ssize_t index, PyObject *value, bool *result )
+{
+    if ( PyList_CheckExact( target ) )
+    {
+        Py_ssize_t size = PyList_GET_SIZE( target );
 
-            return false;
-        }
-        else
+        if ( index < 0 )
         {
-            PyErr_Format(
-                PyExc_TypeError,
-                "'%s' object does not support item assignment",
-                Py_TYPE( target )->tp_name
-            );
+            index += size;
+        }
 
-            return false;
+        if (unlikely( (size_t)index >= (size_t)size ))
+        {
+            PyErr_Format( PyExc_IndexError, "list assignment index out of range" );
+            *result = false;
+            return true;
         }
-    }
-    else
-    {
-        PyErr_Format(
-            PyExc_TypeError,
-            "'%s' object does not support item assignment",
-            Py_TYPE( target )->tp_name
-        );
 
-        return false;
+        PyObject *old_value = PyList_GET_ITEM( target, index );
+        Py_INCREF( value );
+        PyList_SET_ITEM( target, index, value );
+        Py_DECREF( old_value );
+
+        *result = true;
+        return true;
     }
+
+    return false;
 }
 
 NUITKA_MAY_BE_UNUSED static bool SET_SUBSCRIPT( PyObject *target, PyObject *subscript, PyObject *value )
@@ -313,6 +324,15 @@ NUITKA_MAY_BE_UNUSED static bool SET_SUBSCRIPT( PyObject *target, PyObject *subs
     CHECK_OBJECT( target );
     CHECK_OBJECT( subscript );
 
+    Py_ssize_t index;
+    bool result;
+
+    if ( GET_SMALL_INDEX_VALUE( subscript, &index ) &&
+         SET_SUBSCRIPT_INDEX_FAST( target, index, value, &result ) )
+    {
+        return result;
+    }
+
     PyMappingMethods *mapping_methods = Py_TYPE( target )->tp_as_mapping;
 
     if ( mapping_methods != NULL && mapping_methods->mp_ass_subscript )
@@ -375,6 +395,52 @@ NUITKA_MAY_BE_UNUSED static bool SET_SUBSCRIPT( PyObject *target, PyObject *subs
     return true;
 }
 
+NUITKA_MAY_BE_UNUSED static bool SET_SUBSCRIPT_CONST( PyObject *target, PyObject *subscript, Py_ssize_t int_subscript, PyObject *value )
+{
+    CHECK_OBJECT( value );
+    CHECK_OBJECT( target );
+    CHECK_OBJECT( subscript );
+
+    bool result;
+
+    if ( SET_SUBSCRIPT_INDEX_FAST( target, int_subscript, value, &result ) )
+    {
+        return result;
+    }
+
+    return SET_SUBSCRIPT( target, subscript, value );
+}
+
+NUITKA_MAY_BE_UNUSED static bool SET_SUBSCRIPT_INDEX( PyObject *target, Py_ssize_t index, PyObject *value )
+{
+    CHECK_OBJECT( value );
+    CHECK_OBJECT( target );
+
+    bool result;
+
+    if ( SET_SUBSCRIPT_INDEX_FAST( target, index, value, &result ) )
+    {
+        return result;
+    }
+
+#if PYTHON_VERSION < 300
+    PyObject *subscript = PyInt_FromSsize_t( index );
+#else
+    PyObject *subscript = PyLong_FromSsize_t( index );
+#endif
+
+    if (unlikely( subscript == NULL ))
+    {
+        return false;
+    }
+
+    result = SET_SUBSCRIPT( target, subscript, value );
+
+    Py_DECREF( subscript );
+
+    return result;
+}
+
 NUITKA_MAY_BE_UNUSED static bool DEL_SUBSCRIPT( PyObject *target, PyObject *subscript )
 {
     CHECK_OBJECT( target );
@@ -67,6 +67,7 @@ extern void stopProfiling( void );
 
 
 #include "nuitka/helper/boolean.h"
+#include "nuitka/helper/cnumbers.h"
 #include "nuitka/helper/dictionaries.h"
 #include "nuitka/helper/mappings.h"
 
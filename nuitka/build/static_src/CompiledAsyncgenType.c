@@ -105,13 +105,13 @@ static void Nuitka_Asyncgen_release_closure( struct Nuitka_AsyncgenObject *async
 {
     for( Py_ssize_t i = 0; i < asyncgen->m_closure_given; i++ )
     {
-        CHECK_OBJECT( asyncgen->m_closure[ i ] );
-        Py_DECREF( asyncgen->m_closure[ i ] );
+        Nuitka_Cell_ReleaseClosure( (PyObject *)asyncgen, asyncgen->m_closure[ i ] );
     }
 
     asyncgen->m_closure_given = 0;
 }
 
+#ifndef _NUITKA_STACKLESS_GENERATORS
 #ifdef _NUITKA_MAKECONTEXT_INTS
 static void Nuitka_Asyncgen_entry_point( int address_1, int address_2 )
 {
@@ -132,6 +132,7 @@ static void Nuitka_Asyncgen_entry_point( struct Nuitka_AsyncgenObject *asyncgen
 
     swapFiber( &asyncgen->m_yielder_context, &asyncgen->m_caller_context );
 }
+#endif
 
 
 static PyObject *_Nuitka_Asyncgen_send( struct Nuitka_AsyncgenObject *asyncgen, PyObject *value, bool closing )
@@ -156,6 +157,7 @@ static PyObject *_Nuitka_Asyncgen_send( struct Nuitka_AsyncgenObject *asyncgen,
 
         if ( asyncgen->m_status == status_Unused )
         {
+#ifndef _NUITKA_STACKLESS_GENERATORS
             // Prepare the asyncgen context to run.
             int res = prepareFiber( &asyncgen->m_yielder_context, (void *)Nuitka_Asyncgen_entry_point, (uintptr_t)asyncgen );
 
@@ -164,12 +166,11 @@ static PyObject *_Nuitka_Asyncgen_send( struct Nuitka_AsyncgenObject *asyncgen,
                 PyErr_Format( PyExc_MemoryError, "async generator cannot be allocated" );
                 return NULL;
             }
+#endif
 
             asyncgen->m_status = status_Running;
         }
 
-        asyncgen->m_yielded = value;
-
         // Put the generator back on the frame stack.
         PyFrameObject *return_frame = thread_state->frame;
 #ifndef __NUITKA_NO_ASSERT__
@@ -197,7 +198,13 @@ static PyObject *_Nuitka_Asyncgen_send( struct Nuitka_AsyncgenObject *asyncgen,
         // Continue the yielder function while preventing recursion.
         asyncgen->m_running = true;
 
+#if _NUITKA_STACKLESS_GENERATORS
+        PyObject *yielded = ((asyncgen_code)asyncgen->m_code)( asyncgen, value );
+#else
+        asyncgen->m_yielded = value;
         swapFiber( &asyncgen->m_caller_context, &asyncgen->m_yielder_context );
+        PyObject *yielded = asyncgen->m_yielded;
+#endif
 
         asyncgen->m_running = false;
 
@@ -224,7 +231,7 @@ static PyObject *_Nuitka_Asyncgen_send( struct Nuitka_AsyncgenObject *asyncgen,
 
             return NULL;
         }
-        else if ( asyncgen->m_yielded == NULL )
+        else if ( yielded == NULL )
         {
             assert( ERROR_OCCURRED() );
 
@@ -289,7 +296,7 @@ static PyObject *_Nuitka_Asyncgen_send( struct Nuitka_AsyncgenObject *asyncgen,
         }
         else
         {
-            return asyncgen->m_yielded;
+            return yielded;
         }
     }
     else
@@ -357,35 +364,84 @@ static PyObject *_Nuitka_Asyncgen_throw2( struct Nuitka_AsyncgenObject *asyncgen
                 bool res = Nuitka_gen_close_iter( asyncgen->m_yieldfrom );
                 asyncgen->m_running = 0;
 
+#if _NUITKA_STACKLESS_GENERATORS
+                // The delegation is over either way, the exception of closing
+                // it or the "GeneratorExit" is then raised at the "await".
+                Py_CLEAR( asyncgen->m_yieldfrom );
+
+                if ( res == false )
+                {
+                    FETCH_ERROR_OCCURRED( &asyncgen->m_exception_type, &asyncgen->m_exception_value, &asyncgen->m_exception_tb );
+
+                    return _Nuitka_Asyncgen_send( asyncgen, Py_None, false );
+                }
+#else
                 if ( res == true )
                 {
                     return _Nuitka_Asyncgen_send( asyncgen, Py_None, false );
                 }
+#endif
 
                 goto throw_here;
             }
         }
 
-        PyObject *meth = PyObject_GetAttr( asyncgen->m_yieldfrom, const_str_plain_throw );
-        if (unlikely( meth == NULL ))
+        PyObject *ret;
+
+#if _NUITKA_STACKLESS_GENERATORS
+        // Awaited compiled coroutines and asyncgen get the exception directly.
+        if ( Nuitka_Coroutine_Check( asyncgen->m_yieldfrom ) )
+        {
+            asyncgen->m_running = 1;
+            ret = Nuitka_Coroutine_throwAwaited( (struct Nuitka_CoroutineObject *)asyncgen->m_yieldfrom, asyncgen->m_exception_type, asyncgen->m_exception_value, asyncgen->m_exception_tb );
+            asyncgen->m_running = 0;
+        }
+        else if ( Nuitka_Asyncgen_Check( asyncgen->m_yieldfrom ) )
+        {
+            asyncgen->m_running = 1;
+            ret = Nuitka_Asyncgen_throwAnext( (struct Nuitka_AsyncgenObject *)asyncgen->m_yieldfrom, asyncgen->m_exception_type, asyncgen->m_exception_value, asyncgen->m_exception_tb );
+            asyncgen->m_running = 0;
+        }
+        else
+#endif
         {
-            if ( !PyErr_ExceptionMatches( PyExc_AttributeError ) )
+            PyObject *meth = PyObject_GetAttr( asyncgen->m_yieldfrom, const_str_plain_throw );
+            if (unlikely( meth == NULL ))
             {
-                return NULL;
+                if ( !PyErr_ExceptionMatches( PyExc_AttributeError ) )
+                {
+#if _NUITKA_STACKLESS_GENERATORS
+                    asyncgen->m_exception_type = NULL;
+                    asyncgen->m_exception_value = NULL;
+                    asyncgen->m_exception_tb = NULL;
+#endif
+                    return NULL;
+                }
+                CLEAR_ERROR_OCCURRED();
+
+                goto throw_here;
             }
-            CLEAR_ERROR_OCCURRED();
 
-            goto throw_here;
-        }
+            asyncgen->m_running = 1;
+            ret = PyObject_CallFunctionObjArgs( meth, asyncgen->m_exception_type, asyncgen->m_exception_value, asyncgen->m_exception_tb, NULL );
+            asyncgen->m_running = 0;
 
-        asyncgen->m_running = 1;
-        PyObject *ret = PyObject_CallFunctionObjArgs( meth, asyncgen->m_exception_type, asyncgen->m_exception_value, asyncgen->m_exception_tb, NULL );
-        asyncgen->m_running = 0;
+            Py_DECREF( meth );
+        }
 
-        Py_DECREF( meth );
+#if _NUITKA_STACKLESS_GENERATORS
+        // The exception was only borrowed and went to the delegate.
+        asyncgen->m_exception_type = NULL;
+        asyncgen->m_exception_value = NULL;
+        asyncgen->m_exception_tb = NULL;
+#endif
 
         if (unlikely( ret == NULL ))
         {
+#if _NUITKA_STACKLESS_GENERATORS
+            Py_CLEAR( asyncgen->m_yieldfrom );
+#endif
+
             PyObject *val;
 
             if ( _PyGen_FetchStopIterationValue( &val ) == 0 )
@@ -395,6 +451,11 @@ static PyObject *_Nuitka_Asyncgen_throw2( struct Nuitka_AsyncgenObject *asyncgen
             }
             else
             {
+#if _NUITKA_STACKLESS_GENERATORS
+                // Raise the exception of the delegate at the "await".
+                FETCH_ERROR_OCCURRED( &asyncgen->m_exception_type, &asyncgen->m_exception_value, &asyncgen->m_exception_tb );
+#endif
+
                 ret = _Nuitka_Asyncgen_send( asyncgen, Py_None, false );
             }
         }
@@ -602,8 +663,7 @@ static PyObject *Nuitka_Asyncgen_athrow( struct Nuitka_AsyncgenObject *asyncgen,
 }
 
 #define MAX_ASYNCGEN_FREE_LIST_COUNT 100
-static struct Nuitka_AsyncgenObject *free_list_asyncgens = NULL;
-static int free_list_asyncgens_count = 0;
+static struct Nuitka_SizedFreeList free_list_asyncgens = NUITKA_SIZED_FREE_LIST( "asyncgens", MAX_ASYNCGEN_FREE_LIST_COUNT );
 
 // TODO: This might have to be finalize actually.
 static void Nuitka_Asyncgen_tp_dealloc( struct Nuitka_AsyncgenObject *asyncgen )
@@ -653,12 +713,19 @@ static void Nuitka_Asyncgen_tp_dealloc( struct Nuitka_AsyncgenObject *asyncgen )
 
     Nuitka_Asyncgen_release_closure( asyncgen );
 
+#if _NUITKA_STACKLESS_GENERATORS
+    // Only set if closing didn't finish the async generator.
+    Py_CLEAR( asyncgen->m_yieldfrom );
+#endif
+
     Py_XDECREF( asyncgen->m_frame );
 
     assert( Py_REFCNT( asyncgen ) == 1 );
     Py_REFCNT( asyncgen ) = 0;
 
+#ifndef _NUITKA_STACKLESS_GENERATORS
     releaseFiber( &asyncgen->m_yielder_context );
+#endif
 
     // Now it is safe to release references and memory for it.
     Nuitka_GC_UnTrack( asyncgen );
@@ -675,10 +742,9 @@ static void Nuitka_Asyncgen_tp_dealloc( struct Nuitka_AsyncgenObject *asyncgen )
     Py_DECREF( asyncgen->m_qualname );
 
     /* Put the object into freelist or release to GC */
-    releaseToFreeList(
+    releaseToSizedFreeList(
         free_list_asyncgens,
-        asyncgen,
-        MAX_ASYNCGEN_FREE_LIST_COUNT
+        asyncgen
     );
 
     RESTORE_ERROR_OCCURRED( save_exception_type, save_exception_value, save_exception_tb );
@@ -789,16 +855,20 @@ PyTypeObject Nuitka_Asyncgen_Type =
     0,                                                   /* tp_free */
 };
 
-PyObject *Nuitka_Asyncgen_New( asyncgen_code code, PyObject *name, PyObject *qualname, PyCodeObject *code_object, Py_ssize_t closure_given )
+PyObject *Nuitka_Asyncgen_New( asyncgen_code code, PyObject *name, PyObject *qualname, PyCodeObject *code_object, Py_ssize_t closure_given, Py_ssize_t closure_inline, Py_ssize_t heap_storage_size )
 {
     struct Nuitka_AsyncgenObject *result;
 
+    // The inline cells and then the heap storage follow the closure, in units
+    // of its items.
+    Py_ssize_t full_size = closure_given + NUITKA_INLINE_CELL_ITEMS( closure_inline ) + NUITKA_HEAP_STORAGE_ITEMS( heap_storage_size );
+
     // Macro to assign result memory from GC or free list.
-    allocateFromFreeList(
+    allocateFromSizedFreeList(
         free_list_asyncgens,
         struct Nuitka_AsyncgenObject,
         Nuitka_Asyncgen_Type,
-        closure_given
+        full_size
     );
 
     result->m_code = (void *)code;
@@ -812,7 +882,6 @@ PyObject *Nuitka_Asyncgen_New( asyncgen_code code, PyObject *name, PyObject *qua
     result->m_qualname = qualname;
     Py_INCREF( qualname );
 
-    // TODO: Makes no sense with asyncgens maybe?
     result->m_yieldfrom = NULL;
 
     // The m_closure is set from the outside.
@@ -828,7 +897,12 @@ PyObject *Nuitka_Asyncgen_New( asyncgen_code code, PyObject *name, PyObject *qua
     result->m_exception_value = NULL;
     result->m_exception_tb = NULL;
 
+#if _NUITKA_STACKLESS_GENERATORS
+    result->m_yield_return_index = 0;
+    result->m_heap_storage = &result->m_closure[ closure_given + NUITKA_INLINE_CELL_ITEMS( closure_inline ) ];
+#else
     result->m_yielded = NULL;
+#endif
 
     result->m_frame = NULL;
     result->m_code_object = code_object;
@@ -837,7 +911,9 @@ PyObject *Nuitka_Asyncgen_New( asyncgen_code code, PyObject *name, PyObject *qua
     result->m_hooks_init_done = false;
     result->m_closed = false;
 
+#ifndef _NUITKA_STACKLESS_GENERATORS
     initFiber( &result->m_yielder_context );
+#endif
 
     Nuitka_GC_Track( result );
     return (PyObject *)result;
@@ -1552,6 +1628,290 @@ extern PyObject *ERROR_GET_STOP_ITERATION_VALUE();
 extern PyObject *PyGen_Send( PyGenObject *gen, PyObject *arg );
 extern PyObject *const_str_plain_send, *const_str_plain_throw, *const_str_plain_close;
 
+#if _NUITKA_STACKLESS_GENERATORS
+
+bool ASYNCGEN_AWAIT_START( struct Nuitka_AsyncgenObject *asyncgen, PyObject *awaitable )
+{
+#if _DEBUG_ASYNCGEN
+    PRINT_STRING("ASYNCGEN_AWAIT_START entry:");
+    PRINT_ITEM( awaitable );
+    PRINT_NEW_LINE();
+#endif
+
+    assert( asyncgen->m_yieldfrom == NULL );
+
+    asyncgen->m_yieldfrom = MAKE_AWAIT_ITERATOR( awaitable );
+
+    if (unlikely( asyncgen->m_yieldfrom == NULL ))
+    {
+        return false;
+    }
+
+    asyncgen->m_awaiting = true;
+
+    return true;
+}
+
+bool ASYNCGEN_ASYNC_MAKE_ITERATOR_START( struct Nuitka_AsyncgenObject *asyncgen, PyObject *value )
+{
+    assert( asyncgen->m_yieldfrom == NULL );
+
+    asyncgen->m_yieldfrom = MAKE_ASYNC_ITERATOR_AWAITABLE( value );
+
+    return asyncgen->m_yieldfrom != NULL;
+}
+
+bool ASYNCGEN_ASYNC_ITERATOR_NEXT_START( struct Nuitka_AsyncgenObject *asyncgen, PyObject *value )
+{
+    assert( asyncgen->m_yieldfrom == NULL );
+
+    asyncgen->m_yieldfrom = MAKE_ASYNC_NEXT_DELEGATE( value );
+
+    return asyncgen->m_yieldfrom != NULL;
+}
+
+// For "async for" in compiled code, compiled asyncgen objects are delegated
+// to directly, doing what their "asend" object would, but without creating
+// it, and giving the value of an "async yield" without "StopIteration".
+bool Nuitka_Asyncgen_startAnext( struct Nuitka_AsyncgenObject *asyncgen )
+{
+    return Nuitka_Asyncgen_init_hooks( asyncgen ) == 0;
+}
+
+PyObject *Nuitka_Asyncgen_sendAnext( struct Nuitka_AsyncgenObject *asyncgen, PyObject *value, PyObject **returned )
+{
+    PyObject *result = _Nuitka_Asyncgen_send( asyncgen, value, false );
+
+    if ( result != NULL && Nuitka_AsyncgenWrappedValue_CheckExact( result ) )
+    {
+        *returned = ((struct Nuitka_AsyncgenWrappedValueObject *)result)->m_value;
+        Py_INCREF( *returned );
+
+        Py_DECREF( result );
+
+        return NULL;
+    }
+
+    return Nuitka_Asyncgen_unwrap_value( asyncgen, result );
+}
+
+PyObject *Nuitka_Asyncgen_throwAnext( struct Nuitka_AsyncgenObject *asyncgen, PyObject *exception_type, PyObject *exception_value, PyTracebackObject *exception_tb )
+{
+    assert( asyncgen->m_exception_type == NULL );
+    assert( asyncgen->m_exception_value == NULL );
+    assert( asyncgen->m_exception_tb == NULL );
+
+    CHECK_OBJECT( exception_type );
+
+    asyncgen->m_exception_type = exception_type;
+
+    // Like with the argument tuple, no traceback can be given without value.
+    if ( exception_value != NULL )
+    {
+        asyncgen->m_exception_value = exception_value;
+        asyncgen->m_exception_tb = exception_tb;
+    }
+
+    PyObject *result = _Nuitka_Asyncgen_throw2( asyncgen, true );
+
+    return Nuitka_Asyncgen_unwrap_value( asyncgen, result );
+}
+
+// The "await" is done, release the iterator and provide its result.
+static PyObject *Nuitka_Asyncgen_finishAwait( struct Nuitka_AsyncgenObject *asyncgen, PyObject *value, PyObject **result )
+{
+    Py_CLEAR( asyncgen->m_yieldfrom );
+    asyncgen->m_awaiting = false;
+
+    *result = value;
+    return NULL;
+}
+
+static PyObject *_ASYNCGEN_AWAIT_STEP( struct Nuitka_AsyncgenObject *asyncgen, PyObject *send_value, PyObject **result )
+{
+    PyObject *value = asyncgen->m_yieldfrom;
+
+    // The delegation was ended by "throw" already, and we get to raise its
+    // exception or to provide its value.
+    if ( value == NULL )
+    {
+        if ( asyncgen->m_exception_type )
+        {
+            RAISE_ASYNCGEN_EXCEPTION( asyncgen );
+
+            return Nuitka_Asyncgen_finishAwait( asyncgen, NULL, result );
+        }
+
+        Py_INCREF( send_value );
+        return Nuitka_Asyncgen_finishAwait( asyncgen, send_value, result );
+    }
+
+    CHECK_OBJECT( value );
+
+    // Send iteration value to the sub-generator, which may be a CPython
+    // generator object, something with an iterator next, or a send method,
+    // where the later is only required if values other than "None" need to
+    // be passed in.
+    PyObject *retval;
+
+    // Exception, was thrown into us, need to send that to sub-generator.
+    if ( asyncgen->m_exception_type )
+    {
+        // The yielding async generator is being closed, but we also are tasked to
+        // immediately close the currently running sub-generator.
+        if ( EXCEPTION_MATCH_BOOL_SINGLE( asyncgen->m_exception_type, PyExc_GeneratorExit ) )
+        {
+            if (unlikely( !Nuitka_gen_close_iter( value ) ))
+            {
+                Py_CLEAR( asyncgen->m_exception_type );
+                Py_CLEAR( asyncgen->m_exception_value );
+                Py_CLEAR( asyncgen->m_exception_tb );
+
+                return Nuitka_Asyncgen_finishAwait( asyncgen, NULL, result );
+            }
+
+            RAISE_ASYNCGEN_EXCEPTION( asyncgen );
+
+            return Nuitka_Asyncgen_finishAwait( asyncgen, NULL, result );
+        }
+
+        PyObject *throw_method = NULL;
+
+        if ( Nuitka_Coroutine_Check( value ) )
+        {
+            retval = Nuitka_Coroutine_throwAwaited( (struct Nuitka_CoroutineObject *)value, asyncgen->m_exception_type, asyncgen->m_exception_value, asyncgen->m_exception_tb );
+
+            Py_CLEAR( asyncgen->m_exception_type );
+            Py_CLEAR( asyncgen->m_exception_value );
+            Py_CLEAR( asyncgen->m_exception_tb );
+        }
+        else if ( Nuitka_Asyncgen_Check( value ) )
+        {
+            retval = Nuitka_Asyncgen_throwAnext( (struct Nuitka_AsyncgenObject *)value, asyncgen->m_exception_type, asyncgen->m_exception_value, asyncgen->m_exception_tb );
+
+            Py_CLEAR( asyncgen->m_exception_type );
+            Py_CLEAR( asyncgen->m_exception_value );
+            Py_CLEAR( asyncgen->m_exception_tb );
+        }
+        else if ( ( throw_method = PyObject_GetAttr( value, const_str_plain_throw ) ) )
+        {
+            retval = PyObject_CallFunctionObjArgs( throw_method, asyncgen->m_exception_type, asyncgen->m_exception_value, asyncgen->m_exception_tb, NULL );
+            Py_DECREF( throw_method );
+
+            Py_CLEAR( asyncgen->m_exception_type );
+            Py_CLEAR( asyncgen->m_exception_value );
+            Py_CLEAR( asyncgen->m_exception_tb );
+        }
+        else if ( EXCEPTION_MATCH_BOOL_SINGLE( GET_ERROR_OCCURRED(), PyExc_AttributeError ) )
+        {
+            CLEAR_ERROR_OCCURRED();
+
+            RAISE_ASYNCGEN_EXCEPTION( asyncgen );
+
+            return Nuitka_Asyncgen_finishAwait( asyncgen, NULL, result );
+        }
+        else
+        {
+            assert( ERROR_OCCURRED() );
+
+            Py_CLEAR( asyncgen->m_exception_type );
+            Py_CLEAR( asyncgen->m_exception_value );
+            Py_CLEAR( asyncgen->m_exception_tb );
+
+            return Nuitka_Asyncgen_finishAwait( asyncgen, NULL, result );
+        }
+    }
+    else if ( Nuitka_Coroutine_Check( value ) )
+    {
+        PyObject *returned = NULL;
+
+        retval = Nuitka_Coroutine_sendAwaited( (struct Nuitka_CoroutineObject *)value, send_value, &returned );
+
+        // The return value comes directly, no "StopIteration" is made for it.
+        if ( returned != NULL )
+        {
+            return Nuitka_Asyncgen_finishAwait( asyncgen, returned, result );
+        }
+    }
+    else if ( Nuitka_Asyncgen_Check( value ) )
+    {
+        PyObject *returned = NULL;
+
+        retval = Nuitka_Asyncgen_sendAnext( (struct Nuitka_AsyncgenObject *)value, send_value, &returned );
+
+        if ( returned != NULL )
+        {
+            return Nuitka_Asyncgen_finishAwait( asyncgen, returned, result );
+        }
+    }
+    else if ( PyGen_CheckExact( value ) || PyCoro_CheckExact( value ) )
+    {
+        retval = PyGen_Send( (PyGenObject *)value, send_value );
+    }
+    else if ( send_value == Py_None && Py_TYPE( value )->tp_iternext != NULL )
+    {
+        retval = Py_TYPE( value )->tp_iternext( value );
+    }
+    else
+    {
+        retval = PyObject_CallMethodObjArgs( value, const_str_plain_send, send_value, NULL );
+    }
+
+    // A value to yield, we will be called again with what is sent in then.
+    if ( retval != NULL )
+    {
+        return retval;
+    }
+
+    PyObject *error = GET_ERROR_OCCURRED();
+
+    // No exception we take it as stop iteration.
+    if ( error == NULL )
+    {
+        Py_INCREF( Py_None );
+        return Nuitka_Asyncgen_finishAwait( asyncgen, Py_None, result );
+    }
+
+    // The sub-generator has given an exception. In case of StopIteration, we
+    // need to check the value, as it is going to be the expression value of
+    // this "await", and we are done. All other errors, we need to raise.
+    if (likely( EXCEPTION_MATCH_BOOL_SINGLE( error, PyExc_StopIteration ) ))
+    {
+        return Nuitka_Asyncgen_finishAwait( asyncgen, ERROR_GET_STOP_ITERATION_VALUE(), result );
+    }
+
+    return Nuitka_Asyncgen_finishAwait( asyncgen, NULL, result );
+}
+
+PyObject *ASYNCGEN_AWAIT_STEP( struct Nuitka_AsyncgenObject *asyncgen, PyObject *send_value, PyObject **result )
+{
+    return _ASYNCGEN_AWAIT_STEP( asyncgen, send_value ? send_value : Py_None, result );
+}
+
+PyObject *ASYNCGEN_AWAIT_STEP_IN_HANDLER( struct Nuitka_AsyncgenObject *asyncgen, PyObject *send_value, PyObject **result )
+{
+    // When resuming, the exception of the handler is to be restored.
+    if ( send_value != NULL )
+    {
+        SWAP_FRAME_EXCEPTION();
+    }
+    else
+    {
+        send_value = Py_None;
+    }
+
+    PyObject *yielded = _ASYNCGEN_AWAIT_STEP( asyncgen, send_value, result );
+
+    if ( yielded != NULL )
+    {
+        SWAP_FRAME_EXCEPTION();
+    }
+
+    return yielded;
+}
+
+#else
+
 static PyObject *yieldFromAsyncgen( struct Nuitka_AsyncgenObject *asyncgen, PyObject *value )
 {
     // This is the value, propagated back and forth the sub-generator and the
@@ -2003,6 +2363,8 @@ PRINT_NEW_LINE();
     return retval;
 }
 
+#endif
+
 void _initCompiledAsyncgenTypes( void )
 {
     PyType_Ready( &Nuitka_Asyncgen_Type );
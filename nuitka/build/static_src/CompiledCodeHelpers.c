@@ -31,6 +31,11 @@
 #include "HelpersPathTools.c"
 #include "HelpersBuiltin.c"
 #include "HelpersStrings.c"
+#ifndef _NUITKA_STACKLESS_GENERATORS
+#include "HelpersFiberStacks.c"
+#endif
+#include "HelpersFreeLists.c"
+#include "HelpersRuntimeStatistics.c"
 
 
 #if PYTHON_VERSION < 300
@@ -663,6 +668,115 @@ PyObject *BUILTIN_XRANGE3( PyObject *low, PyObject *high, PyObject *step )
 #endif
 }
 
+static bool getRangeIteratorValue( PyObject *value, long *result )
+{
+#if PYTHON_VERSION < 300
+    if ( PyInt_CheckExact( value ) )
+    {
+        *result = PyInt_AS_LONG( value );
+        return true;
+    }
+#else
+    if ( PyLong_CheckExact( value ) )
+    {
+        int overflow;
+        *result = PyLong_AsLongAndOverflow( value, &overflow );
+
+        return overflow == 0;
+    }
+#endif
+
+    return false;
+}
+
+/* Start iteration of a "range" or "xrange" for a loop. */
+bool MAKE_RANGE_ITERATOR( nuitka_range_iterator *iterator, PyObject *low, PyObject *high, PyObject *step, bool is_xrange )
+{
+    iterator->iterator = NULL;
+
+    long start = 0;
+    long stop;
+    long step_long = 1;
+
+    // For exact int arguments, no exception can occur, so the values are
+    // all that is needed.
+    if ( getRangeIteratorValue( high, &stop ) &&
+         ( low == NULL || getRangeIteratorValue( low, &start ) ) &&
+         ( step == NULL || ( getRangeIteratorValue( step, &step_long ) && step_long != 0 ) ) )
+    {
+        unsigned long remaining;
+
+        if ( step_long > 0 && start < stop )
+        {
+            remaining = 1UL + ( (unsigned long)stop - 1UL - (unsigned long)start ) / (unsigned long)step_long;
+        }
+        else if ( step_long < 0 && start > stop )
+        {
+            remaining = 1UL + ( (unsigned long)start - 1UL - (unsigned long)stop ) / ( 0UL - (unsigned long)step_long );
+        }
+        else
+        {
+            remaining = 0;
+        }
+
+        // Lengths that do not fit, are errors with Python2, let that code
+        // report them.
+        if ( remaining <= LONG_MAX )
+        {
+            iterator->current = start;
+            iterator->step = step_long;
+            iterator->remaining = remaining;
+
+            return true;
+        }
+    }
+
+    PyObject *range;
+
+#if PYTHON_VERSION < 300
+    if ( is_xrange == false )
+    {
+        if ( low == NULL )
+        {
+            range = BUILTIN_RANGE( high );
+        }
+        else if ( step == NULL )
+        {
+            range = BUILTIN_RANGE2( low, high );
+        }
+        else
+        {
+            range = BUILTIN_RANGE3( low, high, step );
+        }
+    }
+    else
+#endif
+    {
+        if ( low == NULL )
+        {
+            range = BUILTIN_XRANGE1( high );
+        }
+        else if ( step == NULL )
+        {
+            range = BUILTIN_XRANGE2( low, high );
+        }
+        else
+        {
+            range = BUILTIN_XRANGE3( low, high, step );
+        }
+    }
+
+    if (unlikely( range == NULL ))
+    {
+        return false;
+    }
+
+    iterator->iterator = MAKE_ITERATOR( range );
+    Py_DECREF( range );
+
+    return iterator->iterator != NULL;
+}
+
 PyObject *BUILTIN_LEN( PyObject *value )
 {
     CHECK_OBJECT( value );
@@ -2501,6 +2615,8 @@ void _initBuiltinModule()
     assert( res == 0 );
 #endif
 
+    installRuntimeStatistics( (PyObject *)dict_builtin );
+
     // init Nuitka_BuiltinModule_Type, PyType_Ready wont copy all member from
     // base type, so we need copy all members from PyModule_Type manual for
     // safety.  PyType_Ready will change tp_flags, we need define it again. Set
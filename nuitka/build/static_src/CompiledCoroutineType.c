@@ -126,14 +126,13 @@ static void Nuitka_Coroutine_release_closure( struct Nuitka_CoroutineObject *cor
 {
     for( Py_ssize_t i = 0; i < coroutine->m_closure_given; i++ )
     {
-        CHECK_OBJECT( coroutine->m_closure[ i ] );
-        Py_DECREF( coroutine->m_closure[ i ] );
+        Nuitka_Cell_ReleaseClosure( (PyObject *)coroutine, coroutine->m_closure[ i ] );
     }
 
     coroutine->m_closure_given = 0;
 }
 
-
+#ifndef _NUITKA_STACKLESS_GENERATORS
 // For the coroutine object fiber entry point, we may need to follow what
 // "makecontext" will support and that is only a list of integers, but we will need
 // to push a pointer through it, and so it's two of them, which might be fully
@@ -159,8 +158,11 @@ static void Nuitka_Coroutine_entry_point( struct Nuitka_CoroutineObject *corouti
 
     swapFiber( &coroutine->m_yielder_context, &coroutine->m_caller_context );
 }
+#endif
 
-static PyObject *_Nuitka_Coroutine_send( struct Nuitka_CoroutineObject *coroutine, PyObject *value, bool closing )
+// Resume the coroutine, when "returned" is given, the return value goes there
+// and no "StopIteration" is raised for it.
+static PyObject *_Nuitka_Coroutine_sendEx( struct Nuitka_CoroutineObject *coroutine, PyObject *value, bool closing, PyObject **returned )
 {
     if ( coroutine->m_status == status_Unused && value != NULL && value != Py_None )
     {
@@ -180,6 +182,7 @@ static PyObject *_Nuitka_Coroutine_send( struct Nuitka_CoroutineObject *coroutin
 
         if ( coroutine->m_status == status_Unused )
         {
+#ifndef _NUITKA_STACKLESS_GENERATORS
             // Prepare the coroutine context to run.
             int res = prepareFiber( &coroutine->m_yielder_context, (void *)Nuitka_Coroutine_entry_point, (uintptr_t)coroutine );
 
@@ -188,12 +191,11 @@ static PyObject *_Nuitka_Coroutine_send( struct Nuitka_CoroutineObject *coroutin
                 PyErr_Format( PyExc_MemoryError, "coroutine cannot be allocated" );
                 return NULL;
             }
+#endif
 
             coroutine->m_status = status_Running;
         }
 
-        coroutine->m_yielded = value;
-
         // Put the coroutine back on the frame stack.
         PyFrameObject *return_frame = thread_state->frame;
 #ifndef __NUITKA_NO_ASSERT__
@@ -221,7 +223,15 @@ static PyObject *_Nuitka_Coroutine_send( struct Nuitka_CoroutineObject *coroutin
         // Continue the yielder function while preventing recursion.
         coroutine->m_running = true;
 
+#if _NUITKA_STACKLESS_GENERATORS
+        CHECK_OBJECT( value );
+
+        PyObject *yielded = ((coroutine_code)coroutine->m_code)( coroutine, value );
+#else
+        coroutine->m_yielded = value;
         swapFiber( &coroutine->m_caller_context, &coroutine->m_yielder_context );
+        PyObject *yielded = coroutine->m_yielded;
+#endif
 
         coroutine->m_running = false;
 
@@ -256,7 +266,11 @@ static PyObject *_Nuitka_Coroutine_send( struct Nuitka_CoroutineObject *coroutin
 
             PyObject *result = coroutine->m_returned;
 
-            if ( result == Py_None )
+            if ( returned != NULL )
+            {
+                *returned = result;
+            }
+            else if ( result == Py_None )
             {
                 PyErr_SetObject( PyExc_StopIteration, Py_None );
                 Py_DECREF( Py_None );
@@ -275,7 +289,7 @@ static PyObject *_Nuitka_Coroutine_send( struct Nuitka_CoroutineObject *coroutin
 
             return NULL;
         }
-        else if ( coroutine->m_yielded == NULL )
+        else if ( yielded == NULL )
         {
             assert( ERROR_OCCURRED() );
 
@@ -328,7 +342,7 @@ static PyObject *_Nuitka_Coroutine_send( struct Nuitka_CoroutineObject *coroutin
         }
         else
         {
-            return coroutine->m_yielded;
+            return yielded;
         }
     }
     else
@@ -354,6 +368,11 @@ static PyObject *_Nuitka_Coroutine_send( struct Nuitka_CoroutineObject *coroutin
     }
 }
 
+static PyObject *_Nuitka_Coroutine_send( struct Nuitka_CoroutineObject *coroutine, PyObject *value, bool closing )
+{
+    return _Nuitka_Coroutine_sendEx( coroutine, value, closing, NULL );
+}
+
 static PyObject *Nuitka_Coroutine_send( struct Nuitka_CoroutineObject *coroutine, PyObject *value )
 {
     return _Nuitka_Coroutine_send( coroutine, value, false );
@@ -402,36 +421,58 @@ PyObject *Nuitka_Coroutine_close( struct Nuitka_CoroutineObject *coroutine, PyOb
 
 extern PyObject *const_str_plain_close;
 
+extern PyObject *Nuitka_Generator_close( struct Nuitka_GeneratorObject *generator, PyObject *args );
+
 /* Also used for asyncgen. */
 bool Nuitka_gen_close_iter( PyObject *yieldfrom )
 {
-    PyObject *meth = PyObject_GetAttr( yieldfrom, const_str_plain_close );
+    PyObject *retval;
 
-    if (unlikely( meth == NULL ))
+    // Compiled delegates are closed directly, without the method lookup.
+    if ( Nuitka_Coroutine_Check( yieldfrom ) )
     {
-        if (unlikely( !PyErr_ExceptionMatches( PyExc_AttributeError )))
-        {
-            PyErr_WriteUnraisable( yieldfrom );
-        }
-
-        CLEAR_ERROR_OCCURRED();
-
+        retval = Nuitka_Coroutine_close( (struct Nuitka_CoroutineObject *)yieldfrom, NULL );
+    }
+    else if ( Nuitka_Generator_Check( yieldfrom ) )
+    {
+        retval = Nuitka_Generator_close( (struct Nuitka_GeneratorObject *)yieldfrom, NULL );
+    }
+#if PYTHON_VERSION >= 360 && _NUITKA_STACKLESS_GENERATORS
+    else if ( Nuitka_Asyncgen_Check( yieldfrom ) )
+    {
+        // This is "async for" next, closing its "asend" would not close the
+        // asyncgen either.
         return true;
     }
+#endif
     else
     {
-        PyObject *retval = CALL_FUNCTION_NO_ARGS( meth );
-        Py_DECREF( meth );
+        PyObject *meth = PyObject_GetAttr( yieldfrom, const_str_plain_close );
 
-        if (unlikely (retval == NULL))
+        if (unlikely( meth == NULL ))
         {
-            return false;
+            if (unlikely( !PyErr_ExceptionMatches( PyExc_AttributeError )))
+            {
+                PyErr_WriteUnraisable( yieldfrom );
+            }
+
+            CLEAR_ERROR_OCCURRED();
+
+            return true;
         }
 
-        Py_DECREF( retval );
+        retval = CALL_FUNCTION_NO_ARGS( meth );
+        Py_DECREF( meth );
+    }
 
-        return true;
+    if (unlikely( retval == NULL ))
+    {
+        return false;
     }
+
+    Py_DECREF( retval );
+
+    return true;
 }
 
 extern PyObject *const_str_plain_throw;
@@ -449,37 +490,88 @@ static PyObject *_Nuitka_Coroutine_throw2( struct Nuitka_CoroutineObject *corout
                 bool res = Nuitka_gen_close_iter( coroutine->m_yieldfrom );
                 coroutine->m_running = 0;
 
+#if _NUITKA_STACKLESS_GENERATORS
+                // The delegation is over either way, the exception of closing
+                // it or the "GeneratorExit" is then raised at the "await".
+                Py_CLEAR( coroutine->m_yieldfrom );
+
+                if ( res == false )
+                {
+                    FETCH_ERROR_OCCURRED( &coroutine->m_exception_type, &coroutine->m_exception_value, &coroutine->m_exception_tb );
+
+                    return _Nuitka_Coroutine_send( coroutine, Py_None, false );
+                }
+#else
                 if ( res == true )
                 {
                     return _Nuitka_Coroutine_send( coroutine, Py_None, false );
                 }
+#endif
 
                 goto throw_here;
             }
         }
 
-        PyObject *meth = PyObject_GetAttr( coroutine->m_yieldfrom, const_str_plain_throw );
-        if (unlikely( meth == NULL ))
+        PyObject *ret;
+
+#if _NUITKA_STACKLESS_GENERATORS
+        // Awaited compiled coroutines and asyncgen get the exception directly.
+        if ( Nuitka_Coroutine_Check( coroutine->m_yieldfrom ) )
+        {
+            coroutine->m_running = 1;
+            ret = Nuitka_Coroutine_throwAwaited( (struct Nuitka_CoroutineObject *)coroutine->m_yieldfrom, coroutine->m_exception_type, coroutine->m_exception_value, coroutine->m_exception_tb );
+            coroutine->m_running = 0;
+        }
+#if PYTHON_VERSION >= 360
+        else if ( Nuitka_Asyncgen_Check( coroutine->m_yieldfrom ) )
         {
-            if (!PyErr_ExceptionMatches(PyExc_AttributeError))
+            coroutine->m_running = 1;
+            ret = Nuitka_Asyncgen_throwAnext( (struct Nuitka_AsyncgenObject *)coroutine->m_yieldfrom, coroutine->m_exception_type, coroutine->m_exception_value, coroutine->m_exception_tb );
+            coroutine->m_running = 0;
+        }
+#endif
+        else
+#endif
+        {
+            PyObject *meth = PyObject_GetAttr( coroutine->m_yieldfrom, const_str_plain_throw );
+            if (unlikely( meth == NULL ))
             {
-                return NULL;
+                if (!PyErr_ExceptionMatches(PyExc_AttributeError))
+                {
+#if _NUITKA_STACKLESS_GENERATORS
+                    coroutine->m_exception_type = NULL;
+                    coroutine->m_exception_value = NULL;
+                    coroutine->m_exception_tb = NULL;
+#endif
+                    return NULL;
+                }
+
+                CLEAR_ERROR_OCCURRED();
+                goto throw_here;
             }
 
-            CLEAR_ERROR_OCCURRED();
-            goto throw_here;
-        }
+            coroutine->m_running = 1;
+            CHECK_OBJECT( coroutine->m_exception_type );
 
-        coroutine->m_running = 1;
-        CHECK_OBJECT( coroutine->m_exception_type );
+            ret = PyObject_CallFunctionObjArgs( meth, coroutine->m_exception_type, coroutine->m_exception_value, coroutine->m_exception_tb, NULL );
+            coroutine->m_running = 0;
 
-        PyObject *ret = PyObject_CallFunctionObjArgs( meth, coroutine->m_exception_type, coroutine->m_exception_value, coroutine->m_exception_tb, NULL );
-        coroutine->m_running = 0;
+            Py_DECREF( meth );
+        }
 
-        Py_DECREF( meth );
+#if _NUITKA_STACKLESS_GENERATORS
+        // The exception was only borrowed and went to the delegate.
+        coroutine->m_exception_type = NULL;
+        coroutine->m_exception_value = NULL;
+        coroutine->m_exception_tb = NULL;
+#endif
 
         if (unlikely( ret == NULL ))
         {
+#if _NUITKA_STACKLESS_GENERATORS
+            Py_CLEAR( coroutine->m_yieldfrom );
+#endif
+
             PyObject *val;
 
             if ( _PyGen_FetchStopIterationValue( &val ) == 0 )
@@ -490,6 +582,11 @@ static PyObject *_Nuitka_Coroutine_throw2( struct Nuitka_CoroutineObject *corout
             }
             else
             {
+#if _NUITKA_STACKLESS_GENERATORS
+                // Raise the exception of the delegate at the "await".
+                FETCH_ERROR_OCCURRED( &coroutine->m_exception_type, &coroutine->m_exception_value, &coroutine->m_exception_tb );
+#endif
+
                 ret = _Nuitka_Coroutine_send( coroutine, Py_None, false );
             }
         }
@@ -612,6 +709,33 @@ static PyObject *Nuitka_Coroutine_throw( struct Nuitka_CoroutineObject *coroutin
 
 }
 
+#if _NUITKA_STACKLESS_GENERATORS
+PyObject *Nuitka_Coroutine_sendAwaited( struct Nuitka_CoroutineObject *coroutine, PyObject *value, PyObject **returned )
+{
+    return _Nuitka_Coroutine_sendEx( coroutine, value, false, returned );
+}
+
+PyObject *Nuitka_Coroutine_throwAwaited( struct Nuitka_CoroutineObject *coroutine, PyObject *exception_type, PyObject *exception_value, PyTracebackObject *exception_tb )
+{
+    assert( coroutine->m_exception_type == NULL );
+    assert( coroutine->m_exception_value == NULL );
+    assert( coroutine->m_exception_tb == NULL );
+
+    CHECK_OBJECT( exception_type );
+
+    coroutine->m_exception_type = exception_type;
+
+    // Like with the argument tuple, no traceback can be given without value.
+    if ( exception_value != NULL )
+    {
+        coroutine->m_exception_value = exception_value;
+        coroutine->m_exception_tb = exception_tb;
+    }
+
+    return _Nuitka_Coroutine_throw2( coroutine, true );
+}
+#endif
+
 static void Nuitka_Coroutine_tp_del( struct Nuitka_CoroutineObject *coroutine )
 {
     if ( coroutine->m_status != status_Running )
@@ -692,8 +816,7 @@ static PyObject *Nuitka_Coroutine_await( struct Nuitka_CoroutineObject *coroutin
 }
 
 #define MAX_COROUTINE_FREE_LIST_COUNT 100
-static struct Nuitka_CoroutineObject *free_list_coros = NULL;
-static int free_list_coros_count = 0;
+static struct Nuitka_SizedFreeList free_list_coros = NUITKA_SIZED_FREE_LIST( "coroutines", MAX_COROUTINE_FREE_LIST_COUNT );
 
 static void Nuitka_Coroutine_tp_dealloc( struct Nuitka_CoroutineObject *coroutine )
 {
@@ -719,12 +842,19 @@ static void Nuitka_Coroutine_tp_dealloc( struct Nuitka_CoroutineObject *coroutin
 
     Nuitka_Coroutine_release_closure( coroutine );
 
+#if _NUITKA_STACKLESS_GENERATORS
+    // Only set if closing didn't finish the coroutine.
+    Py_CLEAR( coroutine->m_yieldfrom );
+#endif
+
     Py_XDECREF( coroutine->m_frame );
 
     assert( Py_REFCNT( coroutine ) == 1 );
     Py_REFCNT( coroutine ) = 0;
 
+#ifndef _NUITKA_STACKLESS_GENERATORS
     releaseFiber( &coroutine->m_yielder_context );
+#endif
 
     // Now it is safe to release references and memory for it.
     Nuitka_GC_UnTrack( coroutine );
@@ -739,10 +869,9 @@ static void Nuitka_Coroutine_tp_dealloc( struct Nuitka_CoroutineObject *coroutin
     Py_DECREF( coroutine->m_qualname );
 
     /* Put the object into freelist or release to GC */
-    releaseToFreeList(
+    releaseToSizedFreeList(
         free_list_coros,
-        coroutine,
-        MAX_COROUTINE_FREE_LIST_COUNT
+        coroutine
     );
 
     RESTORE_ERROR_OCCURRED( save_exception_type, save_exception_value, save_exception_tb );
@@ -933,16 +1062,20 @@ PyTypeObject Nuitka_CoroutineWrapper_Type =
     0,                                                 /* tp_free */
 };
 
-PyObject *Nuitka_Coroutine_New( coroutine_code code, PyObject *name, PyObject *qualname, PyCodeObject *code_object, Py_ssize_t closure_given )
+PyObject *Nuitka_Coroutine_New( coroutine_code code, PyObject *name, PyObject *qualname, PyCodeObject *code_object, Py_ssize_t closure_given, Py_ssize_t closure_inline, Py_ssize_t heap_storage_size )
 {
     struct Nuitka_CoroutineObject *result;
 
+    // The inline cells and then the heap storage follow the closure, in units
+    // of its items.
+    Py_ssize_t full_size = closure_given + NUITKA_INLINE_CELL_ITEMS( closure_inline ) + NUITKA_HEAP_STORAGE_ITEMS( heap_storage_size );
+
     // Macro to assign result memory from GC or free list.
-    allocateFromFreeList(
+    allocateFromSizedFreeList(
         free_list_coros,
         struct Nuitka_CoroutineObject,
         Nuitka_Coroutine_Type,
-        closure_given
+        full_size
     );
 
     result->m_code = (void *)code;
@@ -956,7 +1089,6 @@ PyObject *Nuitka_Coroutine_New( coroutine_code code, PyObject *name, PyObject *q
     result->m_qualname = qualname;
     Py_INCREF( qualname );
 
-    // TODO: Makes no sense with coroutines maybe?
     result->m_yieldfrom = NULL;
 
     // The m_closure is set from the outside.
@@ -972,13 +1104,19 @@ PyObject *Nuitka_Coroutine_New( coroutine_code code, PyObject *name, PyObject *q
     result->m_exception_value = NULL;
     result->m_exception_tb = NULL;
 
-    result->m_yielded = NULL;
     result->m_returned = NULL;
 
     result->m_frame = NULL;
     result->m_code_object = code_object;
 
+#if _NUITKA_STACKLESS_GENERATORS
+    result->m_yield_return_index = 0;
+    result->m_heap_storage = &result->m_closure[ closure_given + NUITKA_INLINE_CELL_ITEMS( closure_inline ) ];
+#else
+    result->m_yielded = NULL;
+
     initFiber( &result->m_yielder_context );
+#endif
 
     Nuitka_GC_Track( result );
     return (PyObject *)result;
@@ -1083,6 +1221,260 @@ extern PyObject *ERROR_GET_STOP_ITERATION_VALUE();
 
 extern PyObject *const_str_plain_send, *const_str_plain_throw, *const_str_plain_close;
 
+#if _NUITKA_STACKLESS_GENERATORS
+
+// Get the iterator to delegate to for an "await", asyncgen use it too.
+PyObject *MAKE_AWAIT_ITERATOR( PyObject *awaitable )
+{
+    // Compiled coroutines are delegated to directly, like CPython does for
+    // its own, the step functions resume them without a wrapper object.
+    if ( Nuitka_Coroutine_Check( awaitable ) )
+    {
+#if PYTHON_VERSION >= 352 || !defined(_NUITKA_FULL_COMPAT)
+        /* This check got added in Python 3.5.2 only. It's good to do it, but
+         * not fully compatible, therefore guard it.
+         */
+        struct Nuitka_CoroutineObject *awaited_coroutine = (struct Nuitka_CoroutineObject *)awaitable;
+
+        if ( awaited_coroutine->m_awaiting )
+        {
+            PyErr_Format(
+                PyExc_RuntimeError,
+                "coroutine is being awaited already"
+            );
+
+            return NULL;
+        }
+#endif
+
+        Py_INCREF( awaitable );
+        return awaitable;
+    }
+
+    return PyCoro_GetAwaitableIter( awaitable );
+}
+
+bool COROUTINE_AWAIT_START( struct Nuitka_CoroutineObject *coroutine, PyObject *awaitable )
+{
+#if _DEBUG_COROUTINE
+    PRINT_STRING("COROUTINE_AWAIT_START entry:");
+    PRINT_ITEM( awaitable );
+    PRINT_NEW_LINE();
+#endif
+
+    assert( coroutine->m_yieldfrom == NULL );
+
+    coroutine->m_yieldfrom = MAKE_AWAIT_ITERATOR( awaitable );
+
+    if (unlikely( coroutine->m_yieldfrom == NULL ))
+    {
+        return false;
+    }
+
+    coroutine->m_awaiting = true;
+
+    return true;
+}
+
+// The "await" is done, release the iterator and provide its result.
+static PyObject *Nuitka_Coroutine_finishAwait( struct Nuitka_CoroutineObject *coroutine, PyObject *value, PyObject **result )
+{
+    Py_CLEAR( coroutine->m_yieldfrom );
+    coroutine->m_awaiting = false;
+
+    *result = value;
+    return NULL;
+}
+
+static PyObject *_COROUTINE_AWAIT_STEP( struct Nuitka_CoroutineObject *coroutine, PyObject *send_value, PyObject **result )
+{
+    PyObject *value = coroutine->m_yieldfrom;
+
+    // The delegation was ended by "throw" already, and we get to raise its
+    // exception or to provide its value.
+    if ( value == NULL )
+    {
+        if ( coroutine->m_exception_type )
+        {
+            RAISE_COROUTINE_EXCEPTION( coroutine );
+
+            return Nuitka_Coroutine_finishAwait( coroutine, NULL, result );
+        }
+
+        Py_INCREF( send_value );
+        return Nuitka_Coroutine_finishAwait( coroutine, send_value, result );
+    }
+
+    CHECK_OBJECT( value );
+
+    // Send iteration value to the sub-generator, which may be a CPython
+    // generator object, something with an iterator next, or a send method,
+    // where the later is only required if values other than "None" need to
+    // be passed in.
+    PyObject *retval;
+
+    // Exception, was thrown into us, need to send that to sub-generator.
+    if ( coroutine->m_exception_type )
+    {
+        // The yielding coroutine is being closed, but we also are tasked to
+        // immediately close the currently running sub-generator.
+        if ( EXCEPTION_MATCH_BOOL_SINGLE( coroutine->m_exception_type, PyExc_GeneratorExit ) )
+        {
+            if (unlikely( !Nuitka_gen_close_iter( value ) ))
+            {
+                Py_CLEAR( coroutine->m_exception_type );
+                Py_CLEAR( coroutine->m_exception_value );
+                Py_CLEAR( coroutine->m_exception_tb );
+
+                return Nuitka_Coroutine_finishAwait( coroutine, NULL, result );
+            }
+
+            RAISE_COROUTINE_EXCEPTION( coroutine );
+
+            return Nuitka_Coroutine_finishAwait( coroutine, NULL, result );
+        }
+
+        PyObject *throw_method = NULL;
+
+        if ( Nuitka_Coroutine_Check( value ) )
+        {
+            retval = Nuitka_Coroutine_throwAwaited( (struct Nuitka_CoroutineObject *)value, coroutine->m_exception_type, coroutine->m_exception_value, coroutine->m_exception_tb );
+
+            Py_CLEAR( coroutine->m_exception_type );
+            Py_CLEAR( coroutine->m_exception_value );
+            Py_CLEAR( coroutine->m_exception_tb );
+        }
+#if PYTHON_VERSION >= 360
+        else if ( Nuitka_Asyncgen_Check( value ) )
+        {
+            retval = Nuitka_Asyncgen_throwAnext( (struct Nuitka_AsyncgenObject *)value, coroutine->m_exception_type, coroutine->m_exception_value, coroutine->m_exception_tb );
+
+            Py_CLEAR( coroutine->m_exception_type );
+            Py_CLEAR( coroutine->m_exception_value );
+            Py_CLEAR( coroutine->m_exception_tb );
+        }
+#endif
+        else if ( ( throw_method = PyObject_GetAttr( value, const_str_plain_throw ) ) )
+        {
+            retval = PyObject_CallFunctionObjArgs( throw_method, coroutine->m_exception_type, coroutine->m_exception_value, coroutine->m_exception_tb, NULL );
+            Py_DECREF( throw_method );
+
+            Py_CLEAR( coroutine->m_exception_type );
+            Py_CLEAR( coroutine->m_exception_value );
+            Py_CLEAR( coroutine->m_exception_tb );
+        }
+        else if ( EXCEPTION_MATCH_BOOL_SINGLE( GET_ERROR_OCCURRED(), PyExc_AttributeError ) )
+        {
+            CLEAR_ERROR_OCCURRED();
+
+            RAISE_COROUTINE_EXCEPTION( coroutine );
+
+            return Nuitka_Coroutine_finishAwait( coroutine, NULL, result );
+        }
+        else
+        {
+            assert( ERROR_OCCURRED() );
+
+            Py_CLEAR( coroutine->m_exception_type );
+            Py_CLEAR( coroutine->m_exception_value );
+            Py_CLEAR( coroutine->m_exception_tb );
+
+            return Nuitka_Coroutine_finishAwait( coroutine, NULL, result );
+        }
+    }
+    else if ( Nuitka_Coroutine_Check( value ) )
+    {
+        PyObject *returned = NULL;
+
+        retval = _Nuitka_Coroutine_sendEx( (struct Nuitka_CoroutineObject *)value, send_value, false, &returned );
+
+        // The return value comes directly, no "StopIteration" is made for it.
+        if ( returned != NULL )
+        {
+            return Nuitka_Coroutine_finishAwait( coroutine, returned, result );
+        }
+    }
+#if PYTHON_VERSION >= 360
+    else if ( Nuitka_Asyncgen_Check( value ) )
+    {
+        PyObject *returned = NULL;
+
+        retval = Nuitka_Asyncgen_sendAnext( (struct Nuitka_AsyncgenObject *)value, send_value, &returned );
+
+        if ( returned != NULL )
+        {
+            return Nuitka_Coroutine_finishAwait( coroutine, returned, result );
+        }
+    }
+#endif
+    else if ( PyGen_CheckExact( value ) || PyCoro_CheckExact( value ) )
+    {
+        retval = PyGen_Send( (PyGenObject *)value, send_value );
+    }
+    else if ( send_value == Py_None && Py_TYPE( value )->tp_iternext != NULL )
+    {
+        retval = Py_TYPE( value )->tp_iternext( value );
+    }
+    else
+    {
+        retval = PyObject_CallMethodObjArgs( value, const_str_plain_send, send_value, NULL );
+    }
+
+    // A value to yield, we will be called again with what is sent in then.
+    if ( retval != NULL )
+    {
+        return retval;
+    }
+
+    PyObject *error = GET_ERROR_OCCURRED();
+
+    // No exception we take it as stop iteration.
+    if ( error == NULL )
+    {
+        Py_INCREF( Py_None );
+        return Nuitka_Coroutine_finishAwait( coroutine, Py_None, result );
+    }
+
+    // The sub-generator has given an exception. In case of StopIteration, we
+    // need to check the value, as it is going to be the expression value of
+    // this "await", and we are done. All other errors, we need to raise.
+    if (likely( EXCEPTION_MATCH_BOOL_SINGLE( error, PyExc_StopIteration ) ))
+    {
+        return Nuitka_Coroutine_finishAwait( coroutine, ERROR_GET_STOP_ITERATION_VALUE(), result );
+    }
+
+    return Nuitka_Coroutine_finishAwait( coroutine, NULL, result );
+}
+
+PyObject *COROUTINE_AWAIT_STEP( struct Nuitka_CoroutineObject *coroutine, PyObject *send_value, PyObject **result )
+{
+    return _COROUTINE_AWAIT_STEP( coroutine, send_value ? send_value : Py_None, result );
+}
+
+PyObject *COROUTINE_AWAIT_STEP_IN_HANDLER( struct Nuitka_CoroutineObject *coroutine, PyObject *send_value, PyObject **result )
+{
+    // When resuming, the exception of the handler is to be restored.
+    if ( send_value != NULL )
+    {
+        SWAP_FRAME_EXCEPTION();
+    }
+    else
+    {
+        send_value = Py_None;
+    }
+
+    PyObject *yielded = _COROUTINE_AWAIT_STEP( coroutine, send_value, result );
+
+    if ( yielded != NULL )
+    {
+        SWAP_FRAME_EXCEPTION();
+    }
+
+    return yielded;
+}
+
+#else
+
 static PyObject *yieldFromCoroutine( struct Nuitka_CoroutineObject *coroutine, PyObject *value )
 {
     CHECK_OBJECT( value );
@@ -1408,6 +1800,8 @@ PyObject *COROUTINE_AWAIT_IN_HANDLER( struct Nuitka_CoroutineObject *coroutine,
     return retval;
 }
 
+#endif
+
 
 #if PYTHON_VERSION >= 352
 
@@ -1534,15 +1928,9 @@ PyObject *Nuitka_AIterWrapper_New( PyObject *aiter )
 
 #endif
 
-PyObject *COROUTINE_ASYNC_MAKE_ITERATOR( struct Nuitka_CoroutineObject *coroutine, PyObject *value )
+// Get the awaitable to delegate to for "async for" start, asyncgen use it too.
+PyObject *MAKE_ASYNC_ITERATOR_AWAITABLE( PyObject *value )
 {
-#if _DEBUG_COROUTINE
-    PRINT_STRING("AITER entry:");
-
-    PRINT_ITEM( value );
-    PRINT_NEW_LINE();
-#endif
-
     unaryfunc getter = NULL;
 
     if ( Py_TYPE( value )->tp_as_async )
@@ -1604,28 +1992,12 @@ PyObject *COROUTINE_ASYNC_MAKE_ITERATOR( struct Nuitka_CoroutineObject *coroutin
 
     Py_DECREF( iter );
 
-    PyObject *retval = yieldFromCoroutine( coroutine, awaitable_iter );
-
-    Py_DECREF( awaitable_iter );
-
-#if _DEBUG_COROUTINE
-    PRINT_STRING("AITER exit");
-    PRINT_ITEM( retval );
-    PRINT_NEW_LINE();
-#endif
-
-    return retval;
+    return awaitable_iter;
 }
 
-PyObject *COROUTINE_ASYNC_ITERATOR_NEXT( struct Nuitka_CoroutineObject *coroutine, PyObject *value )
+// Get the awaitable to delegate to for "async for" next, asyncgen use it too.
+PyObject *MAKE_ASYNC_NEXT_AWAITABLE( PyObject *value )
 {
-#if _DEBUG_COROUTINE
-    PRINT_STRING("ANEXT entry:");
-
-    PRINT_ITEM( value );
-    PRINT_NEW_LINE();
-#endif
-
     unaryfunc getter = NULL;
 
     if ( Py_TYPE( value )->tp_as_async )
@@ -1672,6 +2044,96 @@ PyObject *COROUTINE_ASYNC_ITERATOR_NEXT( struct Nuitka_CoroutineObject *coroutin
 
     Py_DECREF( next_value );
 
+    return awaitable_iter;
+}
+
+#if _NUITKA_STACKLESS_GENERATORS
+
+// Get the delegate for "async for" next, asyncgen use it too. Compiled asyncgen
+// objects are resumed directly by the step functions, no "asend" is needed.
+PyObject *MAKE_ASYNC_NEXT_DELEGATE( PyObject *value )
+{
+#if PYTHON_VERSION >= 360
+    if ( Nuitka_Asyncgen_Check( value ) )
+    {
+        if (unlikely( !Nuitka_Asyncgen_startAnext( (struct Nuitka_AsyncgenObject *)value ) ))
+        {
+            return NULL;
+        }
+
+        Py_INCREF( value );
+        return value;
+    }
+#endif
+
+    return MAKE_ASYNC_NEXT_AWAITABLE( value );
+}
+
+bool COROUTINE_ASYNC_MAKE_ITERATOR_START( struct Nuitka_CoroutineObject *coroutine, PyObject *value )
+{
+    assert( coroutine->m_yieldfrom == NULL );
+
+    coroutine->m_yieldfrom = MAKE_ASYNC_ITERATOR_AWAITABLE( value );
+
+    return coroutine->m_yieldfrom != NULL;
+}
+
+bool COROUTINE_ASYNC_ITERATOR_NEXT_START( struct Nuitka_CoroutineObject *coroutine, PyObject *value )
+{
+    assert( coroutine->m_yieldfrom == NULL );
+
+    coroutine->m_yieldfrom = MAKE_ASYNC_NEXT_DELEGATE( value );
+
+    return coroutine->m_yieldfrom != NULL;
+}
+
+#else
+
+PyObject *COROUTINE_ASYNC_MAKE_ITERATOR( struct Nuitka_CoroutineObject *coroutine, PyObject *value )
+{
+#if _DEBUG_COROUTINE
+    PRINT_STRING("AITER entry:");
+
+    PRINT_ITEM( value );
+    PRINT_NEW_LINE();
+#endif
+
+    PyObject *awaitable_iter = MAKE_ASYNC_ITERATOR_AWAITABLE( value );
+
+    if (unlikely( awaitable_iter == NULL ))
+    {
+        return NULL;
+    }
+
+    PyObject *retval = yieldFromCoroutine( coroutine, awaitable_iter );
+
+    Py_DECREF( awaitable_iter );
+
+#if _DEBUG_COROUTINE
+    PRINT_STRING("AITER exit");
+    PRINT_ITEM( retval );
+    PRINT_NEW_LINE();
+#endif
+
+    return retval;
+}
+
+PyObject *COROUTINE_ASYNC_ITERATOR_NEXT( struct Nuitka_CoroutineObject *coroutine, PyObject *value )
+{
+#if _DEBUG_COROUTINE
+    PRINT_STRING("ANEXT entry:");
+
+    PRINT_ITEM( value );
+    PRINT_NEW_LINE();
+#endif
+
+    PyObject *awaitable_iter = MAKE_ASYNC_NEXT_AWAITABLE( value );
+
+    if (unlikely( awaitable_iter == NULL ))
+    {
+        return NULL;
+    }
+
     PyObject *retval = yieldFromCoroutine( coroutine, awaitable_iter );
 
     Py_DECREF( awaitable_iter );
@@ -1685,6 +2147,8 @@ PRINT_NEW_LINE();
     return retval;
 }
 
+#endif
+
 void _initCompiledCoroutineTypes( void )
 {
     PyType_Ready( &Nuitka_Coroutine_Type );
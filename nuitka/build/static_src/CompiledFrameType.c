@@ -205,6 +205,38 @@ static PyObject *Nuitka_Frame_getlocals( struct Nuitka_FrameObject *frame, void
                     }
                     break;
                 }
+                case NUITKA_TYPE_DESCRIPTION_CLONG:
+                {
+                    nuitka_clong value;
+                    memcpy( &value, t, sizeof(value) );
+                    t += sizeof(value);
+
+                    if ( value.assigned )
+                    {
+#if PYTHON_VERSION < 300
+                        PyObject *object = PyInt_FromLong( value.value );
+#else
+                        PyObject *object = PyLong_FromLong( value.value );
+#endif
+                        PyDict_SetItem( result, *varnames, object );
+                        Py_DECREF( object );
+                    }
+                    break;
+                }
+                case NUITKA_TYPE_DESCRIPTION_CDOUBLE:
+                {
+                    nuitka_cdouble value;
+                    memcpy( &value, t, sizeof(value) );
+                    t += sizeof(value);
+
+                    if ( value.assigned )
+                    {
+                        PyObject *object = PyFloat_FromDouble( value.value );
+                        PyDict_SetItem( result, *varnames, object );
+                        Py_DECREF( object );
+                    }
+                    break;
+                }
                 default:
                     assert(false);
 
@@ -310,6 +342,18 @@ static void Nuitka_Frame_tp_clear( struct Nuitka_FrameObject *frame )
 
                     break;
                 }
+                case NUITKA_TYPE_DESCRIPTION_CLONG:
+                {
+                    t += sizeof(nuitka_clong);
+
+                    break;
+                }
+                case NUITKA_TYPE_DESCRIPTION_CDOUBLE:
+                {
+                    t += sizeof(nuitka_cdouble);
+
+                    break;
+                }
                 default:
                     assert(false);
 
@@ -328,8 +372,7 @@ void Nuitka_Frame_ReleaseLocals( struct Nuitka_FrameObject *frame )
 }
 
 #define MAX_FRAME_FREE_LIST_COUNT 100
-static struct Nuitka_FrameObject *free_list_frames = NULL;
-static int free_list_frames_count = 0;
+static struct Nuitka_SizedFreeList free_list_frames = NUITKA_SIZED_FREE_LIST( "frames", MAX_FRAME_FREE_LIST_COUNT );
 
 
 static void Nuitka_Frame_tp_dealloc( struct Nuitka_FrameObject *nuitka_frame )
@@ -356,10 +399,9 @@ static void Nuitka_Frame_tp_dealloc( struct Nuitka_FrameObject *nuitka_frame )
 
     Nuitka_Frame_tp_clear( nuitka_frame );
 
-    releaseToFreeList(
+    releaseToSizedFreeList(
         free_list_frames,
-        nuitka_frame,
-        MAX_FRAME_FREE_LIST_COUNT
+        nuitka_frame
     );
 
 #ifndef __NUITKA_NO_ASSERT__
@@ -514,7 +556,7 @@ static struct Nuitka_FrameObject *MAKE_FRAME( PyCodeObject *code, PyObject *modu
     struct Nuitka_FrameObject *result;
 
     // Macro to assign result memory from GC or free list.
-    allocateFromFreeList(
+    allocateFromSizedFreeList(
         free_list_frames,
         struct Nuitka_FrameObject,
         Nuitka_Frame_Type,
@@ -723,6 +765,20 @@ void Nuitka_Frame_AttachLocals( struct Nuitka_FrameObject *frame, char const *ty
                 t += sizeof(value);
                 break;
             }
+            case NUITKA_TYPE_DESCRIPTION_CLONG:
+            {
+                nuitka_clong value = va_arg( ap, nuitka_clong );
+                memcpy( t, &value, sizeof(value) );
+                t += sizeof(value);
+                break;
+            }
+            case NUITKA_TYPE_DESCRIPTION_CDOUBLE:
+            {
+                nuitka_cdouble value = va_arg( ap, nuitka_cdouble );
+                memcpy( t, &value, sizeof(value) );
+                t += sizeof(value);
+                break;
+            }
             default:
                 assert(false);
 
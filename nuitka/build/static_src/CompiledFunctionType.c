@@ -70,53 +70,11 @@ static PyObject *Nuitka_Function_tp_call( struct Nuitka_FunctionObject *function
 
     if ( kw == NULL )
     {
-        PyObject **args = &PyTuple_GET_ITEM( tuple_args, 0 );
-        Py_ssize_t args_size = PyTuple_GET_SIZE( tuple_args );
-
-        if ( function->m_args_simple && args_size == function->m_args_positional_count )
-        {
-            for( Py_ssize_t i = 0; i < args_size; i++ )
-            {
-                Py_INCREF( args[ i ] );
-            }
-
-            return function->m_c_code( function, args );
-        }
-        else if ( function->m_args_simple && args_size + function->m_defaults_given == function->m_args_positional_count )
-        {
-#ifdef _MSC_VER
-            PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
-#else
-            PyObject *python_pars[ function->m_args_overall_count ];
-#endif
-            memcpy( python_pars, args, args_size * sizeof(PyObject *) );
-            memcpy( python_pars + args_size, &PyTuple_GET_ITEM( function->m_defaults, 0 ), function->m_defaults_given * sizeof(PyObject *) );
-
-            for( Py_ssize_t i = 0; i < function->m_args_overall_count; i++ )
-            {
-                Py_INCREF( python_pars[ i ] );
-            }
-
-            return function->m_c_code( function, python_pars );
-        }
-        else
-        {
-#ifdef _MSC_VER
-            PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
-#else
-            PyObject *python_pars[ function->m_args_overall_count ];
-#endif
-            memset( python_pars, 0, function->m_args_overall_count * sizeof(PyObject *) );
-
-            if ( parseArgumentsPos( function, python_pars, args, args_size ))
-            {
-                return function->m_c_code( function, python_pars );
-            }
-            else
-            {
-                return NULL;
-            }
-        }
+        return Nuitka_CallFunctionVectorcall( function, &PyTuple_GET_ITEM( tuple_args, 0 ), PyTuple_GET_SIZE( tuple_args ), NULL );
+    }
+    else if ( function->m_c_parse != NULL )
+    {
+        return function->m_c_parse( function, &PyTuple_GET_ITEM( tuple_args, 0 ), PyTuple_GET_SIZE( tuple_args ), kw );
     }
     else
     {
@@ -132,7 +90,14 @@ static long Nuitka_Function_tp_traverse( struct Nuitka_FunctionObject *function,
 
     for( Py_ssize_t i = 0; i < function->m_closure_given; i++ )
     {
-        Py_VISIT( function->m_closure[i] );
+        if ( Nuitka_Cell_IsInline( (PyObject *)function, function->m_closure[i] ) )
+        {
+            Py_VISIT( function->m_closure[i]->ob_ref );
+        }
+        else
+        {
+            Py_VISIT( function->m_closure[i] );
+        }
     }
 
     return 0;
@@ -275,8 +240,20 @@ static PyObject *Nuitka_Function_get_closure( struct Nuitka_FunctionObject *obje
 
         for( Py_ssize_t i = 0; i < object->m_closure_given; i++ )
         {
-            PyTuple_SET_ITEM( result, i, (PyObject *)object->m_closure[i] );
-            Py_INCREF( (PyObject *)object->m_closure[i] );
+            struct Nuitka_CellObject *cell = object->m_closure[i];
+
+            // Inline cells must not leave the function, but their value cannot
+            // change, so a new cell with it is just as good.
+            if ( Nuitka_Cell_IsInline( (PyObject *)object, cell ) )
+            {
+                cell = PyCell_NEW0( cell->ob_ref );
+            }
+            else
+            {
+                Py_INCREF( cell );
+            }
+
+            PyTuple_SET_ITEM( result, i, (PyObject *)cell );
         }
 
         return result;
@@ -527,8 +504,7 @@ static PyObject *Nuitka_Function_reduce( struct Nuitka_FunctionObject *function
 
 
 #define MAX_FUNCTION_FREE_LIST_COUNT 100
-static struct Nuitka_FunctionObject *free_list_functions = NULL;
-static int free_list_functions_count = 0;
+static struct Nuitka_SizedFreeList free_list_functions = NUITKA_SIZED_FREE_LIST( "functions", MAX_FUNCTION_FREE_LIST_COUNT );
 
 static void Nuitka_Function_tp_dealloc( struct Nuitka_FunctionObject *function )
 {
@@ -565,15 +541,18 @@ static void Nuitka_Function_tp_dealloc( struct Nuitka_FunctionObject *function )
 
     for( Py_ssize_t i = 0; i < function->m_closure_given; i++ )
     {
-        assert( function->m_closure[i] );
-        Py_DECREF( function->m_closure[i] );
+        Nuitka_Cell_ReleaseClosure( (PyObject *)function, function->m_closure[i] );
+    }
+
+    if ( function->m_keywords_table != NULL )
+    {
+        PyMem_Free( function->m_keywords_table );
     }
 
     /* Put the object into freelist or release to GC */
-    releaseToFreeList(
+    releaseToSizedFreeList(
         free_list_functions,
-        function,
-        MAX_FUNCTION_FREE_LIST_COUNT
+        function
     );
 
 #ifndef __NUITKA_NO_ASSERT__
@@ -654,30 +633,100 @@ void _initCompiledFunctionType( void )
     PyType_Ready( &Nuitka_Function_Type );
 }
 
+// Functions with fewer argument names than this, just scan them linearly, that
+// is faster than hashing for these.
+#define MIN_KEYWORDS_TABLE_COUNT 8
+
+// Hash value of a string, taking the cached value directly if possible.
+static inline Py_hash_t getArgumentNameHash( PyObject *name )
+{
+#if PYTHON_VERSION < 300
+    if ( PyString_CheckExact( name ) && ((PyStringObject *)name)->ob_shash != -1 )
+    {
+        return ((PyStringObject *)name)->ob_shash;
+    }
+#elif PYTHON_VERSION >= 330
+    if ( PyUnicode_CheckExact( name ) && ((PyASCIIObject *)name)->hash != -1 )
+    {
+        return ((PyASCIIObject *)name)->hash;
+    }
+#endif
+
+    return PyObject_Hash( name );
+}
+
+static void makeKeywordsTable( struct Nuitka_FunctionObject *function )
+{
+    Py_ssize_t keywords_count = function->m_args_keywords_count;
+
+    if ( keywords_count < MIN_KEYWORDS_TABLE_COUNT )
+    {
+        function->m_keywords_table = NULL;
+        function->m_keywords_table_mask = 0;
+
+        return;
+    }
+
+    // Keep the table at most half full, so probe sequences are short.
+    Py_ssize_t size = 16;
+    while ( size < 2 * keywords_count ) size *= 2;
+
+    unsigned short *table = (unsigned short *)PyMem_Malloc( size * sizeof( unsigned short ) );
+
+    if (unlikely( table == NULL ))
+    {
+        // Not fatal, the linear lookup works without it.
+        function->m_keywords_table = NULL;
+        function->m_keywords_table_mask = 0;
+
+        return;
+    }
+
+    memset( table, 0, size * sizeof( unsigned short ) );
+
+    Py_ssize_t mask = size - 1;
+
+    for( Py_ssize_t i = 0; i < keywords_count; i++ )
+    {
+        size_t slot = (size_t)getArgumentNameHash( function->m_varnames[ i ] ) & mask;
+
+        while ( table[ slot ] != 0 )
+        {
+            slot = ( slot + 1 ) & mask;
+        }
+
+        table[ slot ] = (unsigned short)( i + 1 );
+    }
+
+    function->m_keywords_table = table;
+    function->m_keywords_table_mask = mask;
+}
+
 
 // Make a function with closure.
 #if PYTHON_VERSION < 300
-struct Nuitka_FunctionObject *Nuitka_Function_New( function_impl_code c_code, PyObject *name, PyCodeObject *code_object, PyObject *defaults, PyObject *module, PyObject *doc, Py_ssize_t closure_given )
+struct Nuitka_FunctionObject *Nuitka_Function_New( function_impl_code c_code, PyObject *name, PyCodeObject *code_object, PyObject *defaults, PyObject *module, PyObject *doc, Py_ssize_t closure_given, Py_ssize_t closure_inline )
 #elif PYTHON_VERSION < 330
-struct Nuitka_FunctionObject *Nuitka_Function_New( function_impl_code c_code, PyObject *name, PyCodeObject *code_object, PyObject *defaults, PyObject *kwdefaults, PyObject *annotations, PyObject *module, PyObject *doc, Py_ssize_t closure_given )
+struct Nuitka_FunctionObject *Nuitka_Function_New( function_impl_code c_code, PyObject *name, PyCodeObject *code_object, PyObject *defaults, PyObject *kwdefaults, PyObject *annotations, PyObject *module, PyObject *doc, Py_ssize_t closure_given, Py_ssize_t closure_inline )
 #else
-struct Nuitka_FunctionObject *Nuitka_Function_New( function_impl_code c_code, PyObject *name, PyObject *qualname, PyCodeObject *code_object, PyObject *defaults, PyObject *kwdefaults, PyObject *annotations, PyObject *module, PyObject *doc, Py_ssize_t closure_given )
+struct Nuitka_FunctionObject *Nuitka_Function_New( function_impl_code c_code, PyObject *name, PyObject *qualname, PyCodeObject *code_object, PyObject *defaults, PyObject *kwdefaults, PyObject *annotations, PyObject *module, PyObject *doc, Py_ssize_t closure_given, Py_ssize_t closure_inline )
 #endif
 {
     struct Nuitka_FunctionObject *result;
 
     // Macro to assign result memory from GC or free list.
-    allocateFromFreeList(
+    allocateFromSizedFreeList(
         free_list_functions,
         struct Nuitka_FunctionObject,
         Nuitka_Function_Type,
-        closure_given
+        closure_given + NUITKA_INLINE_CELL_ITEMS( closure_inline )
     );
 
     /* Closure is set externally after we return */
     result->m_closure_given = closure_given;
 
     result->m_c_code = c_code;
+    result->m_c_parse = NULL;
 
     Py_INCREF( name );
     result->m_name = name;
@@ -761,6 +810,8 @@ struct Nuitka_FunctionObject *Nuitka_Function_New( function_impl_code c_code, Py
 
     result->m_varnames = &PyTuple_GET_ITEM( code_object->co_varnames, 0 );
 
+    makeKeywordsTable( result );
+
     result->m_module = module;
 
     Py_INCREF( doc );
@@ -1205,14 +1256,70 @@ static void formatErrorTooFewKwOnlyArguments( struct Nuitka_FunctionObject const
 #endif
 
 
+// Find the index of the argument named by a keyword, or -1 if there is none.
+static Py_ssize_t findKeywordArgumentIndex( struct Nuitka_FunctionObject const *function, PyObject *key )
+{
+    PyObject **varnames = function->m_varnames;
+    Py_ssize_t keywords_count = function->m_args_keywords_count;
+
+    // For exact strings, the table is authoritative, and typically the names
+    // are interned and identical.
+#if PYTHON_VERSION < 300
+    if ( function->m_keywords_table != NULL && PyString_CheckExact( key ) )
+#else
+    if ( function->m_keywords_table != NULL && PyUnicode_CheckExact( key ) )
+#endif
+    {
+        Py_hash_t hash = getArgumentNameHash( key );
+        Py_ssize_t mask = function->m_keywords_table_mask;
+        size_t slot = (size_t)hash & mask;
+
+        while ( function->m_keywords_table[ slot ] != 0 )
+        {
+            Py_ssize_t index = function->m_keywords_table[ slot ] - 1;
+            PyObject *varname = varnames[ index ];
+
+            if ( varname == key )
+            {
+                return index;
+            }
+
+            if ( getArgumentNameHash( varname ) == hash && RICH_COMPARE_BOOL_EQ_NORECURSE( varname, key ) )
+            {
+                return index;
+            }
+
+            slot = ( slot + 1 ) & mask;
+        }
+
+        return -1;
+    }
+
+    for( Py_ssize_t i = 0; i < keywords_count; i++ )
+    {
+        if ( varnames[ i ] == key )
+        {
+            return i;
+        }
+    }
+
+    for( Py_ssize_t i = 0; i < keywords_count; i++ )
+    {
+        if ( RICH_COMPARE_BOOL_EQ_NORECURSE( varnames[ i ], key ) )
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
 #if PYTHON_VERSION < 300
 static Py_ssize_t handleKeywordArgs( struct Nuitka_FunctionObject const *function, PyObject **python_pars, PyObject *kw )
 #else
 static Py_ssize_t handleKeywordArgs( struct Nuitka_FunctionObject const *function, PyObject **python_pars, Py_ssize_t *kw_only_found, PyObject *kw )
 #endif
 {
-    Py_ssize_t keywords_count = function->m_args_keywords_count;
-
 #if PYTHON_VERSION >= 300
     Py_ssize_t keyword_after_index = function->m_args_positional_count;
 #endif
@@ -1239,55 +1346,13 @@ static Py_ssize_t handleKeywordArgs( struct Nuitka_FunctionObject const *functio
             return -1;
         }
 
-        NUITKA_MAY_BE_UNUSED bool found = false;
-
+        // Comparisons may run code for non-exact strings, hold references.
         Py_INCREF( key );
         Py_INCREF( value );
 
-        for( Py_ssize_t i = 0; i < keywords_count; i++ )
-        {
-            if ( function->m_varnames[ i ] == key )
-            {
-                assert( python_pars[ i ] == NULL );
-                python_pars[ i ] = value;
+        Py_ssize_t index = findKeywordArgumentIndex( function, key );
 
-#if PYTHON_VERSION >= 300
-                if ( i >= keyword_after_index )
-                {
-                    *kw_only_found += 1;
-                }
-#endif
-
-                found = true;
-                break;
-            }
-        }
-
-        if ( found == false )
-        {
-            PyObject **varnames = function->m_varnames;
-
-            for( Py_ssize_t i = 0; i < keywords_count; i++ )
-            {
-                if ( RICH_COMPARE_BOOL_EQ_NORECURSE( varnames[ i ], key ) )
-                {
-                    assert( python_pars[ i ] == NULL );
-                    python_pars[ i ] = value;
-
-#if PYTHON_VERSION >= 300
-                    if ( i >= keyword_after_index )
-                    {
-                        *kw_only_found += 1;
-                    }
-#endif
-
-                    found = true;
-                    break;
-                }
-            }
-        }
-
-        if (unlikely( found == false ))
+        if (unlikely( index == -1 ))
         {
             PyErr_Format(
                 PyExc_TypeError,
@@ -1304,6 +1369,16 @@ static Py_ssize_t handleKeywordArgs( struct Nuitka_FunctionObject const *functio
 
         Py_DECREF( key );
 
+        assert( python_pars[ index ] == NULL );
+        python_pars[ index ] = value;
+
+#if PYTHON_VERSION >= 300
+        if ( index >= keyword_after_index )
+        {
+            *kw_only_found += 1;
+        }
+#endif
+
         kw_found += 1;
     }
 
@@ -2449,6 +2524,181 @@ PyObject *Nuitka_CallMethodFunctionPosArgsKwArgs( struct Nuitka_FunctionObject c
     new_args[ 0 ] = object;
     memcpy( new_args + 1, args, args_size * sizeof( PyObject *) );
 
-    // TODO: Specialize implementation for massive gains.
-    return Nuitka_CallFunctionPosArgsKwArgs( function, new_args, args_size + 1, kw );
+    if ( function->m_c_parse != NULL )
+    {
+        return function->m_c_parse( function, new_args, args_size + 1, kw );
+    }
+    else
+    {
+        return Nuitka_CallFunctionPosArgsKwArgs( function, new_args, args_size + 1, kw );
+    }
+}
+
+static PyObject *MAKE_KW_NAMES_DICT( PyObject **kw_values, PyObject *kw_names )
+{
+    Py_ssize_t kw_size = PyTuple_GET_SIZE( kw_names );
+
+    PyObject *kw = _PyDict_NewPresized( kw_size );
+
+    if (unlikely( kw == NULL )) return NULL;
+
+    for( Py_ssize_t i = 0; i < kw_size; i++ )
+    {
+        if (unlikely( PyDict_SetItem( kw, PyTuple_GET_ITEM( kw_names, i ), kw_values[ i ] ) != 0 ))
+        {
+            Py_DECREF( kw );
+            return NULL;
+        }
+    }
+
+    return kw;
+}
+
+PyObject *Nuitka_CallFunctionVectorcall( struct Nuitka_FunctionObject const *function, PyObject **args, Py_ssize_t args_size, PyObject *kw_names )
+{
+    if ( kw_names == NULL || PyTuple_GET_SIZE( kw_names ) == 0 )
+    {
+        if ( function->m_c_parse != NULL )
+        {
+            return function->m_c_parse( function, args, args_size, NULL );
+        }
+        else if ( function->m_args_simple && args_size == function->m_args_positional_count )
+        {
+            for( Py_ssize_t i = 0; i < args_size; i++ )
+            {
+                Py_INCREF( args[ i ] );
+            }
+
+            return function->m_c_code( function, args );
+        }
+        else if ( function->m_args_simple && args_size + function->m_defaults_given == function->m_args_positional_count )
+        {
+#ifdef _MSC_VER
+            PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
+#else
+            PyObject *python_pars[ function->m_args_overall_count ];
+#endif
+            memcpy( python_pars, args, args_size * sizeof(PyObject *) );
+            memcpy( python_pars + args_size, &PyTuple_GET_ITEM( function->m_defaults, 0 ), function->m_defaults_given * sizeof(PyObject *) );
+
+            for( Py_ssize_t i = 0; i < function->m_args_overall_count; i++ )
+            {
+                Py_INCREF( python_pars[ i ] );
+            }
+
+            return function->m_c_code( function, python_pars );
+        }
+        else
+        {
+#ifdef _MSC_VER
+            PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
+#else
+            PyObject *python_pars[ function->m_args_overall_count ];
+#endif
+            memset( python_pars, 0, function->m_args_overall_count * sizeof(PyObject *) );
+
+            if ( parseArgumentsPos( function, python_pars, args, args_size ))
+            {
+                return function->m_c_code( function, python_pars );
+            }
+            else
+            {
+                return NULL;
+            }
+        }
+    }
+    else
+    {
+        PyObject *kw = MAKE_KW_NAMES_DICT( args + args_size, kw_names );
+
+        if (unlikely( kw == NULL )) return NULL;
+
+        PyObject *result;
+
+        if ( function->m_c_parse != NULL )
+        {
+            result = function->m_c_parse( function, args, args_size, kw );
+        }
+        else
+        {
+            result = Nuitka_CallFunctionPosArgsKwArgs( function, args, args_size, kw );
+        }
+
+        Py_DECREF( kw );
+
+        return result;
+    }
+}
+
+PyObject *Nuitka_CallMethodFunctionVectorcall( struct Nuitka_FunctionObject const *function, PyObject *object, PyObject **args, Py_ssize_t args_size, PyObject *kw_names )
+{
+    if ( kw_names == NULL || PyTuple_GET_SIZE( kw_names ) == 0 )
+    {
+        if ( function->m_args_simple && args_size + 1 == function->m_args_positional_count )
+        {
+#ifdef _MSC_VER
+            PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
+#else
+            PyObject *python_pars[ function->m_args_overall_count ];
+#endif
+            python_pars[ 0 ] = object;
+            Py_INCREF( object );
+
+            for( Py_ssize_t i = 0; i < args_size; i++ )
+            {
+                python_pars[ i + 1 ] = args[ i ];
+                Py_INCREF( args[ i ] );
+            }
+
+            return function->m_c_code( function, python_pars );
+        }
+        else if ( function->m_args_simple && args_size + 1 + function->m_defaults_given == function->m_args_positional_count )
+        {
+#ifdef _MSC_VER
+            PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
+#else
+            PyObject *python_pars[ function->m_args_overall_count ];
+#endif
+            python_pars[ 0 ] = object;
+            memcpy( python_pars + 1, args, args_size * sizeof(PyObject *) );
+            memcpy( python_pars + 1 + args_size, &PyTuple_GET_ITEM( function->m_defaults, 0 ), function->m_defaults_given * sizeof(PyObject *) );
+
+            for( Py_ssize_t i = 0; i < function->m_args_overall_count; i++ )
+            {
+                Py_INCREF( python_pars[ i ] );
+            }
+
+            return function->m_c_code( function, python_pars );
+        }
+        else
+        {
+#ifdef _MSC_VER
+            PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
+#else
+            PyObject *python_pars[ function->m_args_overall_count ];
+#endif
+            memset( python_pars, 0, function->m_args_overall_count * sizeof(PyObject *) );
+
+            if ( parseArgumentsMethodPos( function, python_pars, object, args, args_size ) )
+            {
+                return function->m_c_code( function, python_pars );
+            }
+            else
+            {
+                return NULL;
+            }
+        }
+    }
+    else
+    {
+        PyObject *kw = MAKE_KW_NAMES_DICT( args + args_size, kw_names );
+
+        if (unlikely( kw == NULL )) return NULL;
+
+        PyObject *result = Nuitka_CallMethodFunctionPosArgsKwArgs( function, object, args, args_size, kw );
+
+        Py_DECREF( kw );
+
+        return result;
+    }
 }
@@ -54,14 +54,13 @@ static void Nuitka_Generator_release_closure( struct Nuitka_GeneratorObject *gen
 {
     for( Py_ssize_t i = 0; i < generator->m_closure_given; i++ )
     {
-        CHECK_OBJECT( generator->m_closure[ i ] );
-        Py_DECREF( generator->m_closure[ i ] );
+        Nuitka_Cell_ReleaseClosure( (PyObject *)generator, generator->m_closure[ i ] );
     }
 
     generator->m_closure_given = 0;
 }
 
-#ifndef _NUITKA_EXPERIMENTAL_GENERATOR_GOTO
+#ifndef _NUITKA_STACKLESS_GENERATORS
 // For the generator object fiber entry point, we may need to follow what
 // "makecontext" will support and that is only a list of integers, but we will need
 // to push a pointer through it, and so it's two of them, which might be fully
@@ -119,7 +118,7 @@ static PyObject *Nuitka_Generator_send2( struct Nuitka_GeneratorObject *generato
 
         if ( generator->m_status == status_Unused )
         {
-#ifndef _NUITKA_EXPERIMENTAL_GENERATOR_GOTO
+#ifndef _NUITKA_STACKLESS_GENERATORS
 
             // Prepare the generator context to run.
             int res = prepareFiber( &generator->m_yielder_context, (void *)Nuitka_Generator_entry_point, (uintptr_t)generator );
@@ -161,7 +160,8 @@ static PyObject *Nuitka_Generator_send2( struct Nuitka_GeneratorObject *generato
         // Continue the yielder function while preventing recursion.
         generator->m_running = true;
 
-#if _NUITKA_EXPERIMENTAL_GENERATOR_GOTO
+#if _NUITKA_STACKLESS_GENERATORS
+        CHECK_OBJECT( value );
 
         PyObject *yielded = ((generator_code)generator->m_code)( generator, value );
 #else
@@ -417,23 +417,9 @@ PyObject *Nuitka_Generator_close( struct Nuitka_GeneratorObject *generator, PyOb
     return Py_None;
 }
 
-static PyObject *Nuitka_Generator_throw( struct Nuitka_GeneratorObject *generator, PyObject *args )
+// Throw an exception given as borrowed references into the generator.
+static PyObject *_Nuitka_Generator_throw2( struct Nuitka_GeneratorObject *generator )
 {
-    assert( generator->m_exception_type == NULL );
-    assert( generator->m_exception_value == NULL );
-    assert( generator->m_exception_tb == NULL );
-
-    int res = PyArg_UnpackTuple( args, "throw", 1, 3, &generator->m_exception_type, &generator->m_exception_value, (PyObject **)&generator->m_exception_tb );
-
-    if (unlikely( res == 0 ))
-    {
-        generator->m_exception_type = NULL;
-        generator->m_exception_value = NULL;
-        generator->m_exception_tb = NULL;
-
-        return NULL;
-    }
-
     if ( (PyObject *)generator->m_exception_tb == Py_None )
     {
         generator->m_exception_tb = NULL;
@@ -564,6 +550,50 @@ static PyObject *Nuitka_Generator_throw( struct Nuitka_GeneratorObject *generato
     }
 }
 
+#if _NUITKA_STACKLESS_GENERATORS && PYTHON_VERSION >= 330
+// Throw an exception into a compiled generator delegated to by "yield from",
+// without making an argument tuple for its "throw" method.
+static PyObject *Nuitka_Generator_throw3( struct Nuitka_GeneratorObject *generator, PyObject *exception_type, PyObject *exception_value, PyTracebackObject *exception_tb )
+{
+    assert( generator->m_exception_type == NULL );
+    assert( generator->m_exception_value == NULL );
+    assert( generator->m_exception_tb == NULL );
+
+    CHECK_OBJECT( exception_type );
+
+    generator->m_exception_type = exception_type;
+
+    // Like with the argument tuple, no traceback can be given without value.
+    if ( exception_value != NULL )
+    {
+        generator->m_exception_value = exception_value;
+        generator->m_exception_tb = exception_tb;
+    }
+
+    return _Nuitka_Generator_throw2( generator );
+}
+#endif
+
+static PyObject *Nuitka_Generator_throw( struct Nuitka_GeneratorObject *generator, PyObject *args )
+{
+    assert( generator->m_exception_type == NULL );
+    assert( generator->m_exception_value == NULL );
+    assert( generator->m_exception_tb == NULL );
+
+    int res = PyArg_UnpackTuple( args, "throw", 1, 3, &generator->m_exception_type, &generator->m_exception_value, (PyObject **)&generator->m_exception_tb );
+
+    if (unlikely( res == 0 ))
+    {
+        generator->m_exception_type = NULL;
+        generator->m_exception_value = NULL;
+        generator->m_exception_tb = NULL;
+
+        return NULL;
+    }
+
+    return _Nuitka_Generator_throw2( generator );
+}
+
 #if PYTHON_VERSION >= 340
 static void Nuitka_Generator_tp_del( struct Nuitka_GeneratorObject *generator )
 {
@@ -595,8 +625,7 @@ static void Nuitka_Generator_tp_del( struct Nuitka_GeneratorObject *generator )
 #endif
 
 #define MAX_GENERATOR_FREE_LIST_COUNT 100
-static struct Nuitka_GeneratorObject *free_list_generators = NULL;
-static int free_list_generators_count = 0;
+static struct Nuitka_SizedFreeList free_list_generators = NUITKA_SIZED_FREE_LIST( "generators", MAX_GENERATOR_FREE_LIST_COUNT );
 
 static void Nuitka_Generator_tp_dealloc( struct Nuitka_GeneratorObject *generator )
 {
@@ -625,12 +654,17 @@ static void Nuitka_Generator_tp_dealloc( struct Nuitka_GeneratorObject *generato
 
     Nuitka_Generator_release_closure( generator );
 
+#if _NUITKA_STACKLESS_GENERATORS && PYTHON_VERSION >= 330
+    // Only set if closing didn't finish the generator.
+    Py_CLEAR( generator->m_yieldfrom );
+#endif
+
     Py_XDECREF( generator->m_frame );
 
     assert( Py_REFCNT( generator ) == 1 );
     Py_REFCNT( generator ) = 0;
 
-#ifndef _NUITKA_EXPERIMENTAL_GENERATOR_GOTO
+#ifndef _NUITKA_STACKLESS_GENERATORS
     releaseFiber( &generator->m_yielder_context );
 #endif
 
@@ -650,10 +684,9 @@ static void Nuitka_Generator_tp_dealloc( struct Nuitka_GeneratorObject *generato
 #endif
 
     /* Put the object into freelist or release to GC */
-    releaseToFreeList(
+    releaseToSizedFreeList(
         free_list_generators,
-        generator,
-        MAX_GENERATOR_FREE_LIST_COUNT
+        generator
     );
 
     RESTORE_ERROR_OCCURRED( save_exception_type, save_exception_value, save_exception_tb );
@@ -869,25 +902,29 @@ void _initCompiledGeneratorType( void )
 }
 
 #if PYTHON_VERSION < 350
-PyObject *Nuitka_Generator_New( generator_code code, PyObject *module, PyObject *name, PyCodeObject *code_object, Py_ssize_t closure_given )
+PyObject *Nuitka_Generator_New( generator_code code, PyObject *module, PyObject *name, PyCodeObject *code_object, Py_ssize_t closure_given, Py_ssize_t closure_inline, Py_ssize_t heap_storage_size )
 #else
-PyObject *Nuitka_Generator_New( generator_code code, PyObject *module, PyObject *name, PyObject *qualname, PyCodeObject *code_object, Py_ssize_t closure_given )
+PyObject *Nuitka_Generator_New( generator_code code, PyObject *module, PyObject *name, PyObject *qualname, PyCodeObject *code_object, Py_ssize_t closure_given, Py_ssize_t closure_inline, Py_ssize_t heap_storage_size )
 #endif
 {
     struct Nuitka_GeneratorObject *result;
 
+    // The inline cells and then the heap storage follow the closure, in units
+    // of its items.
+    Py_ssize_t full_size = closure_given + NUITKA_INLINE_CELL_ITEMS( closure_inline ) + NUITKA_HEAP_STORAGE_ITEMS( heap_storage_size );
+
     // Macro to assign result memory from GC or free list.
-    allocateFromFreeList(
+    allocateFromSizedFreeList(
         free_list_generators,
         struct Nuitka_GeneratorObject,
         Nuitka_Generator_Type,
-        closure_given
+        full_size
     );
 
     assert( result != NULL );
     CHECK_OBJECT( result );
 
-    assert( Py_SIZE( result ) >= closure_given );
+    assert( Py_SIZE( result ) >= full_size );
 
     result->m_code = (void *)code;
 
@@ -903,7 +940,9 @@ PyObject *Nuitka_Generator_New( generator_code code, PyObject *module, PyObject
 
     result->m_qualname = qualname;
     Py_INCREF( qualname );
+#endif
 
+#if PYTHON_VERSION >= 330
     result->m_yieldfrom = NULL;
 #endif
 
@@ -919,16 +958,17 @@ PyObject *Nuitka_Generator_New( generator_code code, PyObject *module, PyObject
     result->m_exception_value = NULL;
     result->m_exception_tb = NULL;
 
-#ifndef _NUITKA_EXPERIMENTAL_GENERATOR_GOTO
+#ifndef _NUITKA_STACKLESS_GENERATORS
     result->m_yielded = NULL;
 #else
     result->m_yield_return_index = 0;
+    result->m_heap_storage = &result->m_closure[ closure_given + NUITKA_INLINE_CELL_ITEMS( closure_inline ) ];
 #endif
 
     result->m_frame = NULL;
     result->m_code_object = code_object;
 
-#ifndef _NUITKA_EXPERIMENTAL_GENERATOR_GOTO
+#ifndef _NUITKA_STACKLESS_GENERATORS
     initFiber( &result->m_yielder_context );
 #endif
 
@@ -1107,6 +1147,257 @@ extern PyObject *ERROR_GET_STOP_ITERATION_VALUE();
 
 extern PyObject *const_str_plain_send, *const_str_plain_throw, *const_str_plain_close;
 
+#if _NUITKA_STACKLESS_GENERATORS
+
+bool GENERATOR_YIELD_FROM_START( struct Nuitka_GeneratorObject *generator, PyObject *target )
+{
+    assert( generator->m_yieldfrom == NULL );
+
+#if PYTHON_VERSION >= 350
+    if ( PyCoro_CheckExact( target ) || Nuitka_Coroutine_Check( target ))
+    {
+        if (unlikely( (generator->m_code_object->co_flags & CO_ITERABLE_COROUTINE) == 0 ))
+        {
+            PyErr_SetString(
+                PyExc_TypeError,
+                "cannot 'yield from' a coroutine object in a non-coroutine generator"
+            );
+            return false;
+        }
+
+        Py_INCREF( target );
+        generator->m_yieldfrom = target;
+
+        return true;
+    }
+#endif
+
+    generator->m_yieldfrom = MAKE_ITERATOR( target );
+
+    return generator->m_yieldfrom != NULL;
+}
+
+// The "yield from" is done, release the iterator and provide its result.
+static PyObject *Nuitka_Generator_finishYieldFrom( struct Nuitka_GeneratorObject *generator, PyObject *value, PyObject **result )
+{
+    Py_CLEAR( generator->m_yieldfrom );
+
+    *result = value;
+    return NULL;
+}
+
+static PyObject *_GENERATOR_YIELD_FROM_STEP( struct Nuitka_GeneratorObject *generator, PyObject *send_value, PyObject **result )
+{
+    PyObject *value = generator->m_yieldfrom;
+    CHECK_OBJECT( value );
+
+    // Send iteration value to the sub-generator, which may be a CPython
+    // generator object, something with an iterator next, or a send method,
+    // where the later is only required if values other than "None" need to
+    // be passed in.
+    PyObject *retval;
+
+    // Exception, was thrown into us, need to send that to sub-generator.
+    if ( generator->m_exception_type )
+    {
+        // The yielding generator is being closed, but we also are tasked to
+        // immediately close the currently running sub-generator.
+        if ( EXCEPTION_MATCH_BOOL_SINGLE( generator->m_exception_type, PyExc_GeneratorExit ) )
+        {
+            PyObject *close_value;
+
+            if ( Nuitka_Generator_Check( value ) )
+            {
+                close_value = Nuitka_Generator_close( (struct Nuitka_GeneratorObject *)value, NULL );
+            }
+            else
+            {
+                PyObject *close_method = PyObject_GetAttr( value, const_str_plain_close );
+
+                if ( close_method )
+                {
+                    close_value = PyObject_Call( close_method, const_tuple_empty, NULL );
+                    Py_DECREF( close_method );
+                }
+                else
+                {
+                    PyObject *error = GET_ERROR_OCCURRED();
+
+                    if ( error != NULL && !EXCEPTION_MATCH_BOOL_SINGLE( error, PyExc_AttributeError ) )
+                    {
+                        PyErr_WriteUnraisable( (PyObject *)value );
+                    }
+
+                    CLEAR_ERROR_OCCURRED();
+
+                    close_value = Py_None;
+                    Py_INCREF( close_value );
+                }
+            }
+
+            if (unlikely( close_value == NULL ))
+            {
+                Py_CLEAR( generator->m_exception_type );
+                Py_CLEAR( generator->m_exception_value );
+                Py_CLEAR( generator->m_exception_tb );
+
+                return Nuitka_Generator_finishYieldFrom( generator, NULL, result );
+            }
+
+            Py_DECREF( close_value );
+
+            RAISE_GENERATOR_EXCEPTION( generator );
+
+            return Nuitka_Generator_finishYieldFrom( generator, NULL, result );
+        }
+
+        // Compiled generators get the exception directly, for others the
+        // "throw" method is used, if they have one.
+        PyObject *throw_method = NULL;
+
+        if ( Nuitka_Generator_Check( value ) )
+        {
+            retval = Nuitka_Generator_throw3( (struct Nuitka_GeneratorObject *)value, generator->m_exception_type, generator->m_exception_value, generator->m_exception_tb );
+
+            Py_CLEAR( generator->m_exception_type );
+            Py_CLEAR( generator->m_exception_value );
+            Py_CLEAR( generator->m_exception_tb );
+        }
+#if PYTHON_VERSION >= 350
+        else if ( Nuitka_Coroutine_Check( value ) )
+        {
+            retval = Nuitka_Coroutine_throwAwaited( (struct Nuitka_CoroutineObject *)value, generator->m_exception_type, generator->m_exception_value, generator->m_exception_tb );
+
+            Py_CLEAR( generator->m_exception_type );
+            Py_CLEAR( generator->m_exception_value );
+            Py_CLEAR( generator->m_exception_tb );
+        }
+#endif
+        else if ( ( throw_method = PyObject_GetAttr( value, const_str_plain_throw ) ) )
+        {
+            retval = PyObject_CallFunctionObjArgs( throw_method, generator->m_exception_type, generator->m_exception_value, generator->m_exception_tb, NULL );
+            Py_DECREF( throw_method );
+
+            Py_CLEAR( generator->m_exception_type );
+            Py_CLEAR( generator->m_exception_value );
+            Py_CLEAR( generator->m_exception_tb );
+        }
+        else if ( EXCEPTION_MATCH_BOOL_SINGLE( GET_ERROR_OCCURRED(), PyExc_AttributeError ) )
+        {
+            CLEAR_ERROR_OCCURRED();
+
+            RAISE_GENERATOR_EXCEPTION( generator );
+
+            return Nuitka_Generator_finishYieldFrom( generator, NULL, result );
+        }
+        else
+        {
+            assert( ERROR_OCCURRED() );
+
+            Py_CLEAR( generator->m_exception_type );
+            Py_CLEAR( generator->m_exception_value );
+            Py_CLEAR( generator->m_exception_tb );
+
+            return Nuitka_Generator_finishYieldFrom( generator, NULL, result );
+        }
+    }
+    else if ( Nuitka_Generator_Check( value ) )
+    {
+        retval = Nuitka_Generator_send( (struct Nuitka_GeneratorObject *)value, send_value );
+    }
+#if PYTHON_VERSION >= 350
+    else if ( Nuitka_Coroutine_Check( value ) )
+    {
+        PyObject *returned = NULL;
+
+        retval = Nuitka_Coroutine_sendAwaited( (struct Nuitka_CoroutineObject *)value, send_value, &returned );
+
+        // The return value comes directly, no "StopIteration" is made for it.
+        if ( returned != NULL )
+        {
+            return Nuitka_Generator_finishYieldFrom( generator, returned, result );
+        }
+    }
+#endif
+    else if ( PyGen_CheckExact( value ) )
+    {
+        retval = PyGen_Send( (PyGenObject *)value, send_value );
+    }
+#if PYTHON_VERSION >= 350
+    else if ( PyCoro_CheckExact( value ) )
+    {
+        retval = PyGen_Send( (PyGenObject *)value, send_value );
+    }
+#endif
+    else if ( send_value == Py_None && Py_TYPE( value )->tp_iternext != NULL )
+    {
+        retval = Py_TYPE( value )->tp_iternext( value );
+    }
+    else
+    {
+        // Bug compatibility here, before 3.3 tuples were unrolled in calls, which is what
+        // PyObject_CallMethod does.
+#if PYTHON_VERSION >= 340
+        retval = PyObject_CallMethodObjArgs( value, const_str_plain_send, send_value, NULL );
+#else
+        retval = PyObject_CallMethod( value, (char *)"send", (char *)"O", send_value );
+#endif
+    }
+
+    // A value to yield, we will be called again with what is sent in then.
+    if ( retval != NULL )
+    {
+        return retval;
+    }
+
+    PyObject *error = GET_ERROR_OCCURRED();
+
+    if ( error == NULL )
+    {
+        Py_INCREF( Py_None );
+        return Nuitka_Generator_finishYieldFrom( generator, Py_None, result );
+    }
+
+    // The sub-generator has given an exception. In case of StopIteration, we
+    // need to check the value, as it is going to be the expression value of
+    // this "yield from", and we are done. All other errors, we need to raise.
+    if (likely( EXCEPTION_MATCH_BOOL_SINGLE( error, PyExc_StopIteration ) ))
+    {
+        return Nuitka_Generator_finishYieldFrom( generator, ERROR_GET_STOP_ITERATION_VALUE(), result );
+    }
+
+    return Nuitka_Generator_finishYieldFrom( generator, NULL, result );
+}
+
+PyObject *GENERATOR_YIELD_FROM_STEP( struct Nuitka_GeneratorObject *generator, PyObject *send_value, PyObject **result )
+{
+    return _GENERATOR_YIELD_FROM_STEP( generator, send_value ? send_value : Py_None, result );
+}
+
+PyObject *GENERATOR_YIELD_FROM_STEP_IN_HANDLER( struct Nuitka_GeneratorObject *generator, PyObject *send_value, PyObject **result )
+{
+    // When resuming, the exception of the handler is to be restored.
+    if ( send_value != NULL )
+    {
+        SWAP_FRAME_EXCEPTION();
+    }
+    else
+    {
+        send_value = Py_None;
+    }
+
+    PyObject *yielded = _GENERATOR_YIELD_FROM_STEP( generator, send_value, result );
+
+    if ( yielded != NULL )
+    {
+        SWAP_FRAME_EXCEPTION();
+    }
+
+    return yielded;
+}
+
+#else
+
 static PyObject *_YIELD_FROM( struct Nuitka_GeneratorObject *generator, PyObject *value )
 {
     // This is the value, propagated back and forth the sub-generator and the
@@ -1527,3 +1818,5 @@ PyObject *GENERATOR_YIELD_FROM_IN_HANDLER( struct Nuitka_GeneratorObject *genera
 #endif
 
 #endif
+
+#endif
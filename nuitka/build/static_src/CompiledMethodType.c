@@ -263,6 +263,16 @@ static PyObject *Nuitka_Method_tp_call( struct Nuitka_MethodObject *method, PyOb
             (PyObject *)method->m_function, args, kw
         );
     }
+    else if ( kw == NULL )
+    {
+        return Nuitka_CallMethodFunctionVectorcall(
+            method->m_function,
+            method->m_object,
+            &PyTuple_GET_ITEM( args, 0 ),
+            arg_count,
+            NULL
+        );
+    }
     else
     {
         return Nuitka_CallMethodFunctionPosArgsKwArgs(
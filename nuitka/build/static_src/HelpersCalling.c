@@ -16,96 +16,145 @@
 //     limitations under the License.
 //
 
-PyObject *callPythonFunction( PyObject *func, PyObject **args, int count )
+// Fill the frame of a plain Python function from positional arguments, the
+// keyword arguments dictionary, the defaults and the closure. Returns false,
+// if that is not directly possible, e.g. for unknown or duplicate keywords,
+// and the generic code, which also gives the errors, must be used then.
+static bool fillPythonFunctionFrame( PyObject **fastlocals, PyObject *func, PyObject **args, int count, PyObject *kw )
 {
     PyCodeObject *co = (PyCodeObject *)PyFunction_GET_CODE( func );
-    PyObject *globals = PyFunction_GET_GLOBALS( func );
-    PyObject *argdefs = PyFunction_GET_DEFAULTS( func );
 
 #if PYTHON_VERSION >= 300
-    PyObject *kwdefs = PyFunction_GET_KW_DEFAULTS( func );
-
-    if ( kwdefs == NULL && argdefs == NULL && co->co_argcount == count &&
-        co->co_flags == ( CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE ))
+    int kw_count = co->co_argcount + co->co_kwonlyargcount;
 #else
-    if ( argdefs == NULL && co->co_argcount == count &&
-        co->co_flags == ( CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE ))
+    int kw_count = co->co_argcount;
 #endif
+
+    for ( int i = 0; i < count; i++ )
     {
-        PyThreadState *tstate = PyThreadState_GET();
-        CHECK_OBJECT( globals );
+        fastlocals[ i ] = args[ i ];
+        Py_INCREF( fastlocals[ i ] );
+    }
 
-        PyFrameObject *frame = PyFrame_New( tstate, co, globals, NULL );
+    if ( kw != NULL )
+    {
+        PyObject **varnames = &PyTuple_GET_ITEM( co->co_varnames, 0 );
 
-        if (unlikely( frame == NULL ))
-        {
-            return NULL;
-        };
+        Py_ssize_t pos = 0;
+        PyObject *key, *value;
 
-        for ( int i = 0; i < count; i++ )
+        while ( PyDict_Next( kw, &pos, &key, &value ) )
         {
-            frame->f_localsplus[i] = args[i];
-            Py_INCREF( frame->f_localsplus[i] );
-        }
+#if PYTHON_VERSION < 300
+            if (unlikely( !PyString_CheckExact( key ) ))
+#else
+            if (unlikely( !PyUnicode_CheckExact( key ) ))
+#endif
+            {
+                return false;
+            }
 
-        PyObject *result = PyEval_EvalFrameEx( frame, 0 );
+            int index;
 
-        // Frame release protects against recursion as it may lead to variable
-        // destruction.
-        ++tstate->recursion_depth;
-        Py_DECREF( frame );
-        --tstate->recursion_depth;
+            for ( index = 0; index < kw_count; index++ )
+            {
+                if ( varnames[ index ] == key )
+                {
+                    break;
+                }
+            }
 
-        return result;
+            if ( index == kw_count )
+            {
+                for ( index = 0; index < kw_count; index++ )
+                {
+                    if ( RICH_COMPARE_BOOL_EQ_NORECURSE( varnames[ index ], key ) )
+                    {
+                        break;
+                    }
+                }
+            }
+
+            if ( index == kw_count || fastlocals[ index ] != NULL )
+            {
+                return false;
+            }
+
+            fastlocals[ index ] = value;
+            Py_INCREF( value );
+        }
     }
 
-    PyObject **defaults = NULL;
-    int nd = 0;
+    PyObject *argdefs = PyFunction_GET_DEFAULTS( func );
+    int nd = argdefs != NULL ? (int)PyTuple_GET_SIZE( argdefs ) : 0;
+    int first_default = co->co_argcount - nd;
 
-    if ( argdefs != NULL )
+    for ( int i = count; i < co->co_argcount; i++ )
     {
-        defaults = &PyTuple_GET_ITEM( argdefs, 0 );
-        nd = (int)( Py_SIZE( argdefs ) );
+        if ( fastlocals[ i ] == NULL )
+        {
+            if ( i < first_default )
+            {
+                return false;
+            }
+
+            fastlocals[ i ] = PyTuple_GET_ITEM( argdefs, i - first_default );
+            Py_INCREF( fastlocals[ i ] );
+        }
     }
 
-    PyObject *result = PyEval_EvalCodeEx(
 #if PYTHON_VERSION >= 300
-        (PyObject *)co,
-#else
-        co,        // code object
-#endif
-        globals,   // globals
-        NULL,      // no locals
-        args,      // args
-        count,     // argcount
-        NULL,      // kwds
-        0,         // kwcount
-        defaults,  // defaults
-        nd,        // defcount
-#if PYTHON_VERSION >= 300
-        kwdefs,
+    PyObject *kwdefs = PyFunction_GET_KW_DEFAULTS( func );
+
+    for ( int i = co->co_argcount; i < kw_count; i++ )
+    {
+        if ( fastlocals[ i ] == NULL )
+        {
+            PyObject *value = kwdefs != NULL ? PyDict_GetItem( kwdefs, PyTuple_GET_ITEM( co->co_varnames, i ) ) : NULL;
+
+            if ( value == NULL )
+            {
+                return false;
+            }
+
+            fastlocals[ i ] = value;
+            Py_INCREF( value );
+        }
+    }
 #endif
-        PyFunction_GET_CLOSURE( func )
-    );
 
-    return result;
+    // Without cell variables, the free variables follow the locals directly.
+    PyObject *closure = PyFunction_GET_CLOSURE( func );
+
+    if ( closure != NULL )
+    {
+        PyObject **freevars = fastlocals + co->co_nlocals;
+
+        for ( Py_ssize_t i = 0; i < PyTuple_GET_SIZE( co->co_freevars ); i++ )
+        {
+            freevars[ i ] = PyTuple_GET_ITEM( closure, i );
+            Py_INCREF( freevars[ i ] );
+        }
+    }
+
+    return true;
 }
 
-static PyObject *_fast_function_noargs( PyObject *func )
+PyObject *callPythonFunctionPosArgsKwArgs( PyObject *func, PyObject **args, int count, PyObject *kw )
 {
     PyCodeObject *co = (PyCodeObject *)PyFunction_GET_CODE( func );
     PyObject *globals = PyFunction_GET_GLOBALS( func );
-    PyObject *argdefs = PyFunction_GET_DEFAULTS( func );
 
-#if PYTHON_VERSION >= 300
-    PyObject *kwdefs = PyFunction_GET_KW_DEFAULTS( func );
+    if ( kw != NULL && DICT_SIZE( kw ) == 0 )
+    {
+        kw = NULL;
+    }
 
-    if ( kwdefs == NULL && argdefs == NULL && co->co_argcount == 0 &&
-        co->co_flags == ( CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE ))
-#else
-    if ( argdefs == NULL && co->co_argcount == 0 &&
-        co->co_flags == ( CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE ))
-#endif
+    // Functions that are not generators, take no star arguments and have no
+    // cell variables, can have their frame filled directly.
+    if ( ( co->co_flags & ~( PyCF_MASK | CO_NOFREE | CO_NESTED ) ) == ( CO_OPTIMIZED | CO_NEWLOCALS ) &&
+         PyTuple_GET_SIZE( co->co_cellvars ) == 0 &&
+         count <= co->co_argcount )
     {
         PyThreadState *tstate = PyThreadState_GET();
         CHECK_OBJECT( globals );
@@ -117,7 +166,9 @@ static PyObject *_fast_function_noargs( PyObject *func )
             return NULL;
         };
 
-        PyObject *result = PyEval_EvalFrameEx( frame, 0 );
+        bool filled = fillPythonFunctionFrame( frame->f_localsplus, func, args, count, kw );
+
+        PyObject *result = filled ? PyEval_EvalFrameEx( frame, 0 ) : NULL;
 
         // Frame release protects against recursion as it may lead to variable
         // destruction.
@@ -125,9 +176,14 @@ static PyObject *_fast_function_noargs( PyObject *func )
         Py_DECREF( frame );
         --tstate->recursion_depth;
 
-        return result;
+        if ( filled )
+        {
+            return result;
+        }
     }
 
+    PyObject *argdefs = PyFunction_GET_DEFAULTS( func );
+
     PyObject **defaults = NULL;
     int nd = 0;
 
@@ -137,6 +193,27 @@ static PyObject *_fast_function_noargs( PyObject *func )
         nd = (int)( Py_SIZE( argdefs ) );
     }
 
+    int kw_count = kw != NULL ? (int)DICT_SIZE( kw ) : 0;
+
+#ifdef _MSC_VER
+    PyObject **kws = (PyObject **)_alloca( sizeof( PyObject * ) * ( 2 * kw_count + 1 ) );
+#else
+    PyObject *kws[ 2 * kw_count + 1 ];
+#endif
+
+    if ( kw != NULL )
+    {
+        Py_ssize_t pos = 0;
+        int i = 0;
+
+        while ( PyDict_Next( kw, &pos, &kws[ i ], &kws[ i + 1 ] ) )
+        {
+            i += 2;
+        }
+
+        kw_count = i / 2;
+    }
+
     PyObject *result = PyEval_EvalCodeEx(
 #if PYTHON_VERSION >= 300
         (PyObject *)co,
@@ -145,14 +222,14 @@ static PyObject *_fast_function_noargs( PyObject *func )
 #endif
         globals,   // globals
         NULL,      // no locals
-        NULL,      // args
-        0,         // argcount
-        NULL,      // kwds
-        0,         // kwcount
+        args,      // args
+        count,     // argcount
+        kws,       // kwds
+        kw_count,  // kwcount
         defaults,  // defaults
         nd,        // defcount
 #if PYTHON_VERSION >= 300
-        kwdefs,
+        PyFunction_GET_KW_DEFAULTS( func ),
 #endif
         PyFunction_GET_CLOSURE( func )
     );
@@ -160,6 +237,11 @@ static PyObject *_fast_function_noargs( PyObject *func )
     return result;
 }
 
+PyObject *callPythonFunction( PyObject *func, PyObject **args, int count )
+{
+    return callPythonFunctionPosArgsKwArgs( func, args, count, NULL );
+}
+
 PyObject *CALL_FUNCTION_NO_ARGS( PyObject *called )
 {
     CHECK_OBJECT( called );
@@ -263,7 +345,7 @@ PyObject *CALL_FUNCTION_NO_ARGS( PyObject *called )
     }
     else if ( PyFunction_Check( called ) )
     {
-        return _fast_function_noargs( called );
+        return callPythonFunction( called, NULL, 0 );
     }
 
     return CALL_FUNCTION(
@@ -273,6 +355,68 @@ PyObject *CALL_FUNCTION_NO_ARGS( PyObject *called )
     );
 }
 
+// Find a method the way "LOAD_METHOD" does. For objects with generic
+// attribute lookup, whose type has a compiled or a plain function for the
+// attribute, which is not overridden by the instance dictionary, that
+// function is returned, so the call doesn't need a bound method object.
+// Otherwise NULL is returned, without an exception, and the attribute must
+// be looked up normally.
+static PyObject *LOOKUP_UNBOUND_METHOD( PyObject *source, PyObject *attr_name )
+{
+    PyTypeObject *type = Py_TYPE( source );
+
+    if ( type->tp_getattro != PyObject_GenericGetAttr || type->tp_dict == NULL )
+    {
+        return NULL;
+    }
+
+    PyObject *descr = _PyType_Lookup( type, attr_name );
+
+    if ( descr == NULL )
+    {
+        return NULL;
+    }
+
+    descrgetfunc func = Py_TYPE( descr )->tp_descr_get;
+
+    if ( func != Nuitka_Function_Type.tp_descr_get && func != PyFunction_Type.tp_descr_get )
+    {
+        return NULL;
+    }
+
+    Py_INCREF( descr );
+
+    // These are not data descriptors, so the instance dictionary comes first.
+    Py_ssize_t dictoffset = type->tp_dictoffset;
+
+    if ( dictoffset != 0 )
+    {
+        // Negative dictionary offsets have special meaning.
+        if ( dictoffset < 0 )
+        {
+            Py_ssize_t tsize;
+            size_t size;
+
+            tsize = ((PyVarObject *)source)->ob_size;
+            if (tsize < 0)
+                tsize = -tsize;
+            size = _PyObject_VAR_SIZE( type, tsize );
+
+            dictoffset += (long)size;
+        }
+
+        PyObject *dict = *(PyObject **)((char *)source + dictoffset);
+
+        if ( dict != NULL && PyDict_GetItem( dict, attr_name ) != NULL )
+        {
+            Py_DECREF( descr );
+            return NULL;
+        }
+    }
+
+    return descr;
+}
+
 PyObject *CALL_METHOD_WITH_POSARGS( PyObject *source, PyObject *attribute, PyObject *positional_args )
 {
     CHECK_OBJECT( source );
@@ -400,6 +544,45 @@ PyObject *CALL_METHOD_WITH_POSARGS( PyObject *source, PyObject *attribute, PyObj
 
         PyTypeObject *type = Py_TYPE( source );
 
+        PyObject *method = LOOKUP_UNBOUND_METHOD( source, attribute );
+
+        if ( method != NULL )
+        {
+            PyObject *result;
+
+            if ( Nuitka_Function_Check( method ) )
+            {
+                result = Nuitka_CallMethodFunctionPosArgs(
+                    (struct Nuitka_FunctionObject const *)method,
+                    source,
+                    &PyTuple_GET_ITEM( positional_args, 0 ),
+                    PyTuple_GET_SIZE( positional_args )
+                );
+            }
+            else
+            {
+                Py_ssize_t args_size = PyTuple_GET_SIZE( positional_args );
+
+#ifdef _MSC_VER
+                PyObject **args = (PyObject **)_alloca( sizeof( PyObject * ) * ( args_size + 1 ) );
+#else
+                PyObject *args[ args_size + 1 ];
+#endif
+                args[ 0 ] = source;
+                memcpy( args + 1, &PyTuple_GET_ITEM( positional_args, 0 ), args_size * sizeof( PyObject * ) );
+
+                result = callPythonFunction(
+                    method,
+                    args,
+                    (int)( args_size + 1 )
+                );
+            }
+
+            Py_DECREF( method );
+
+            return result;
+        }
+
         if ( type->tp_getattro != NULL )
         {
             called_object = (*type->tp_getattro)( source, attribute );
@@ -538,6 +721,20 @@ PyObject *CALL_METHOD_NO_ARGS( PyObject *source, PyObject *attr_name )
 
                 return result;
             }
+            else if ( func == PyFunction_Type.tp_descr_get )
+            {
+                // Plain functions take the object as first argument, no need
+                // to create a bound method for that.
+                PyObject *result = callPythonFunction(
+                    descr,
+                    &source,
+                    1
+                );
+
+                Py_DECREF( descr );
+
+                return result;
+            }
             else
             {
                 PyObject *called_object = func( descr, source, (PyObject *)type );
@@ -0,0 +1,177 @@
+//     Copyright 2018, Kay Hayen, mailto:kay.hayen@gmail.com
+//
+//     Part of "Nuitka", an optimizing Python compiler that is compatible and
+//     integrates with CPython, but also works on its own.
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+/**
+ * Stacks for the fibers of generators, coroutines and asyncgen objects.
+ *
+ * These come from a pool shared by all of them, and are reused in LIFO order,
+ * so the most recently used, and therefore likely cached memory, is given out
+ * first. On POSIX systems, the stacks are mapped memory with a guard page at
+ * the bottom, so only touched pages take memory, and overflows crash instead
+ * of corrupting the heap.
+ *
+ * The stack size and pool size can be given at compile time with
+ * "_NUITKA_FIBER_STACK_SIZE" and "_NUITKA_FIBER_STACK_POOL_SIZE" defines, and
+ * at run time with "NUITKA_FIBER_STACK_SIZE" and "NUITKA_FIBER_STACK_POOL_SIZE"
+ * environment variables, both in bytes and counts respectively.
+ */
+
+#ifndef _NUITKA_FIBER_STACK_SIZE
+#define _NUITKA_FIBER_STACK_SIZE (1024*1024)
+#endif
+
+#ifndef _NUITKA_FIBER_STACK_POOL_SIZE
+#define _NUITKA_FIBER_STACK_POOL_SIZE 32
+#endif
+
+#if !defined( _WIN32 )
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if !defined( MAP_ANONYMOUS ) && defined( MAP_ANON )
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif
+
+static size_t fiber_stack_size = 0;
+
+#if !defined( _WIN32 )
+static size_t fiber_stack_guard_size = 0;
+
+static void **fiber_stack_pool = NULL;
+static int fiber_stack_pool_size = 0;
+static int fiber_stack_pool_count = 0;
+
+static unsigned long fiber_stack_pool_hits = 0;
+static unsigned long fiber_stack_pool_misses = 0;
+static unsigned long fiber_stack_pool_releases = 0;
+static unsigned long fiber_stack_pool_unmaps = 0;
+#endif
+
+static long getFiberStackEnvironmentValue( char const *name, long default_value )
+{
+    char const *value = getenv( name );
+
+    if ( value != NULL && *value != 0 )
+    {
+        long result = atol( value );
+
+        if ( result >= 0 )
+        {
+            return result;
+        }
+    }
+
+    return default_value;
+}
+
+static void initFiberStacks( void )
+{
+    size_t stack_size = (size_t)getFiberStackEnvironmentValue( "NUITKA_FIBER_STACK_SIZE", _NUITKA_FIBER_STACK_SIZE );
+
+#if !defined( _WIN32 )
+    long page_size = sysconf( _SC_PAGESIZE );
+    if ( page_size <= 0 ) page_size = 4096;
+
+    // Very small stacks are not going to work for any compiled code.
+    if ( stack_size < 16 * (size_t)page_size ) stack_size = 16 * (size_t)page_size;
+
+    // Round up to whole pages, so the guard page is all that is protected.
+    stack_size = ( stack_size + page_size - 1 ) & ~( (size_t)page_size - 1 );
+
+    fiber_stack_guard_size = (size_t)page_size;
+
+    fiber_stack_pool_size = (int)getFiberStackEnvironmentValue( "NUITKA_FIBER_STACK_POOL_SIZE", _NUITKA_FIBER_STACK_POOL_SIZE );
+
+    if ( fiber_stack_pool_size > 0 )
+    {
+        fiber_stack_pool = (void **)malloc( fiber_stack_pool_size * sizeof( void * ) );
+
+        if ( fiber_stack_pool == NULL ) fiber_stack_pool_size = 0;
+    }
+#endif
+
+    fiber_stack_size = stack_size;
+}
+
+size_t getFiberStackSize( void )
+{
+    if (unlikely( fiber_stack_size == 0 ))
+    {
+        initFiberStacks();
+    }
+
+    return fiber_stack_size;
+}
+
+#if !defined( _WIN32 )
+void *allocateFiberStack( void )
+{
+    size_t stack_size = getFiberStackSize();
+
+    if ( fiber_stack_pool_count > 0 )
+    {
+        fiber_stack_pool_hits += 1;
+
+        return fiber_stack_pool[ --fiber_stack_pool_count ];
+    }
+
+    fiber_stack_pool_misses += 1;
+
+    char *mapping = (char *)mmap(
+        NULL,
+        fiber_stack_guard_size + stack_size,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0
+    );
+
+    if (unlikely( mapping == MAP_FAILED ))
+    {
+        return NULL;
+    }
+
+    // Stacks grow downwards, make the lowest page inaccessible to catch
+    // overflows.
+    if (unlikely( mprotect( mapping, fiber_stack_guard_size, PROT_NONE ) != 0 ))
+    {
+        munmap( mapping, fiber_stack_guard_size + stack_size );
+        return NULL;
+    }
+
+    return mapping + fiber_stack_guard_size;
+}
+
+void releaseFiberStack( void *stack )
+{
+    assert( stack != NULL );
+
+    if ( fiber_stack_pool_count < fiber_stack_pool_size )
+    {
+        fiber_stack_pool_releases += 1;
+
+        fiber_stack_pool[ fiber_stack_pool_count++ ] = stack;
+    }
+    else
+    {
+        fiber_stack_pool_unmaps += 1;
+
+        munmap( (char *)stack - fiber_stack_guard_size, fiber_stack_guard_size + fiber_stack_size );
+    }
+}
+#endif
@@ -0,0 +1,68 @@
+//     Copyright 2018, Kay Hayen, mailto:kay.hayen@gmail.com
+//
+//     Part of "Nuitka", an optimizing Python compiler that is compatible and
+//     integrates with CPython, but also works on its own.
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+/**
+ * Free lists of variable size compiled objects, segregated by size class.
+ *
+ * The limit of objects kept per size class can be given at run time with the
+ * "NUITKA_FREE_LIST_LIMIT" environment variable for all types, and e.g. with
+ * "NUITKA_FREE_LIST_LIMIT_FRAMES" for one of them.
+ */
+
+#include "nuitka/freelists.h"
+
+#include <ctype.h>
+
+struct Nuitka_SizedFreeList *Nuitka_SizedFreeLists = NULL;
+
+static int getFreeListEnvironmentLimit( char const *name, int default_value )
+{
+    char const *value = getenv( name );
+
+    if ( value != NULL && *value != 0 )
+    {
+        int result = atoi( value );
+
+        if ( result >= 0 )
+        {
+            return result;
+        }
+    }
+
+    return default_value;
+}
+
+void initSizedFreeList( struct Nuitka_SizedFreeList *free_list )
+{
+    assert( free_list->limit < 0 );
+
+    char env_name[ 128 ];
+    int length = snprintf( env_name, sizeof( env_name ), "NUITKA_FREE_LIST_LIMIT_%s", free_list->name );
+
+    for ( int i = 0; i < length && env_name[ i ] != 0; i++ )
+    {
+        env_name[ i ] = (char)toupper( (unsigned char)env_name[ i ] );
+    }
+
+    free_list->limit = getFreeListEnvironmentLimit(
+        env_name,
+        getFreeListEnvironmentLimit( "NUITKA_FREE_LIST_LIMIT", free_list->default_limit )
+    );
+
+    free_list->next = Nuitka_SizedFreeLists;
+    Nuitka_SizedFreeLists = free_list;
+}
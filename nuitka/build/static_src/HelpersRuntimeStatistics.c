@@ -0,0 +1,128 @@
+//     Copyright 2018, Kay Hayen, mailto:kay.hayen@gmail.com
+//
+//     Part of "Nuitka", an optimizing Python compiler that is compatible and
+//     integrates with CPython, but also works on its own.
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+/**
+ * Counters of the run time, made available to Python code as the built-in
+ * "__nuitka_runtime_stats" function, which returns a dictionary of sections
+ * with their counters, for tuning e.g. pool sizes to a workload.
+ */
+
+NUITKA_MAY_BE_UNUSED static void setStatisticValue( PyObject *section, char const *name, Py_ssize_t value )
+{
+#if PYTHON_VERSION < 300
+    PyObject *item = PyInt_FromSsize_t( value );
+#else
+    PyObject *item = PyLong_FromSsize_t( value );
+#endif
+
+    PyDict_SetItemString( section, name, item );
+    Py_DECREF( item );
+}
+
+#ifndef _NUITKA_STACKLESS_GENERATORS
+static PyObject *getFiberStackStatistics( void )
+{
+    PyObject *result = PyDict_New();
+
+    setStatisticValue( result, "stack_size", (Py_ssize_t)getFiberStackSize() );
+
+#if !defined( _WIN32 )
+    setStatisticValue( result, "pool_size", fiber_stack_pool_size );
+    setStatisticValue( result, "pooled", fiber_stack_pool_count );
+    setStatisticValue( result, "hits", (Py_ssize_t)fiber_stack_pool_hits );
+    setStatisticValue( result, "misses", (Py_ssize_t)fiber_stack_pool_misses );
+    setStatisticValue( result, "releases", (Py_ssize_t)fiber_stack_pool_releases );
+    setStatisticValue( result, "unmaps", (Py_ssize_t)fiber_stack_pool_unmaps );
+#endif
+
+    return result;
+}
+#endif
+
+static PyObject *getFreeListStatistics( void )
+{
+    PyObject *result = PyDict_New();
+
+    for ( struct Nuitka_SizedFreeList *free_list = Nuitka_SizedFreeLists; free_list != NULL; free_list = free_list->next )
+    {
+        PyObject *section = PyDict_New();
+
+        setStatisticValue( section, "limit", free_list->limit );
+
+        PyObject *classes = PyList_New( _NUITKA_FREE_LIST_CLASSES );
+
+        for ( int i = 0; i < _NUITKA_FREE_LIST_CLASSES; i++ )
+        {
+            PyObject *size_class = PyDict_New();
+
+            // Smallest size of objects in the class.
+            setStatisticValue( size_class, "size", ( (Py_ssize_t)1 << i ) - 1 );
+            setStatisticValue( size_class, "pooled", free_list->counts[ i ] );
+            setStatisticValue( size_class, "hits", (Py_ssize_t)free_list->hits[ i ] );
+            setStatisticValue( size_class, "misses", (Py_ssize_t)free_list->misses[ i ] );
+            setStatisticValue( size_class, "resizes", (Py_ssize_t)free_list->resizes[ i ] );
+            setStatisticValue( size_class, "releases", (Py_ssize_t)free_list->releases[ i ] );
+            setStatisticValue( size_class, "frees", (Py_ssize_t)free_list->frees[ i ] );
+
+            PyList_SET_ITEM( classes, i, size_class );
+        }
+
+        PyDict_SetItemString( section, "classes", classes );
+        Py_DECREF( classes );
+
+        PyDict_SetItemString( result, free_list->name, section );
+        Py_DECREF( section );
+    }
+
+    return result;
+}
+
+static PyObject *_nuitka_runtime_stats( PyObject *self, PyObject *args )
+{
+    PyObject *result = PyDict_New();
+
+    PyObject *free_lists = getFreeListStatistics();
+    PyDict_SetItemString( result, "free_lists", free_lists );
+    Py_DECREF( free_lists );
+
+#ifndef _NUITKA_STACKLESS_GENERATORS
+    PyObject *section = getFiberStackStatistics();
+    PyDict_SetItemString( result, "fiber_stacks", section );
+    Py_DECREF( section );
+#endif
+
+    return result;
+}
+
+static PyMethodDef _method_def_nuitka_runtime_stats =
+{
+    "__nuitka_runtime_stats",
+    (PyCFunction)_nuitka_runtime_stats,
+    METH_NOARGS,
+    NULL
+};
+
+static void installRuntimeStatistics( PyObject *builtins_dict )
+{
+    PyObject *function = PyCFunction_New( &_method_def_nuitka_runtime_stats, NULL );
+    CHECK_OBJECT( function );
+
+    int res = PyDict_SetItemString( builtins_dict, "__nuitka_runtime_stats", function );
+    assert( res == 0 );
+
+    Py_DECREF( function );
+}
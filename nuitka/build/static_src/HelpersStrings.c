@@ -35,6 +35,60 @@ PyObject *STRING_FROM_CHAR( unsigned char c )
 #endif
 }
 
+// Rich comparison of two exact string values, see "richcomparisons.h".
+int RICH_COMPARE_BOOL_STR_STR( PyObject *operand1, PyObject *operand2, int op )
+{
+    if ( operand1 == operand2 )
+    {
+        return RICH_COMPARE_RESULT( 0, op );
+    }
+
+#if PYTHON_VERSION < 300
+    Py_ssize_t len1 = PyString_GET_SIZE( operand1 );
+    Py_ssize_t len2 = PyString_GET_SIZE( operand2 );
+
+    if ( op == Py_EQ || op == Py_NE )
+    {
+        bool equal = len1 == len2 && memcmp( PyString_AS_STRING( operand1 ), PyString_AS_STRING( operand2 ), len1 ) == 0;
+
+        return equal == ( op == Py_EQ );
+    }
+
+    int cmp = memcmp( PyString_AS_STRING( operand1 ), PyString_AS_STRING( operand2 ), len1 < len2 ? len1 : len2 );
+
+    if ( cmp == 0 )
+    {
+        cmp = len1 < len2 ? -1 : ( len1 > len2 ? 1 : 0 );
+    }
+
+    return RICH_COMPARE_RESULT( cmp, op );
+#elif PYTHON_VERSION < 330
+    return RICH_COMPARE_RESULT( PyUnicode_Compare( operand1, operand2 ), op );
+#else
+    // Strings from the deprecated API may not be ready yet, and making them
+    // so can fail.
+    if (unlikely( !PyUnicode_IS_READY( operand1 ) || !PyUnicode_IS_READY( operand2 ) ))
+    {
+        return RICH_COMPARE_BOOL_GENERIC( operand1, operand2, op );
+    }
+
+    if ( op == Py_EQ || op == Py_NE )
+    {
+        Py_ssize_t len = PyUnicode_GET_LENGTH( operand1 );
+
+        bool equal =
+            len == PyUnicode_GET_LENGTH( operand2 ) &&
+            PyUnicode_KIND( operand1 ) == PyUnicode_KIND( operand2 ) &&
+            memcmp( PyUnicode_DATA( operand1 ), PyUnicode_DATA( operand2 ), len * PyUnicode_KIND( operand1 ) ) == 0;
+
+        return equal == ( op == Py_EQ );
+    }
+
+    // For ready strings, this cannot fail.
+    return RICH_COMPARE_RESULT( PyUnicode_Compare( operand1, operand2 ), op );
+#endif
+}
+
 /* The "chr" built-in.
 
    This could also use a table for the interned single char strings, to be
@@ -64,12 +64,6 @@ void setmcontext( const mcontext_t *mcontext );
 
 void makecontext( ucontext_t *uc, void (*fn)(void), int argc, ... );
 
-#define STACK_SIZE (1024*1024)
-
-// Keep one stack around to avoid the overhead of repeated malloc/free in
-// case of frequent instantiations in a loop.
-static void *last_stack = NULL;
-
 void _initFiber( Fiber *to )
 {
     to->f_context.uc_stack.ss_sp = NULL;
@@ -85,11 +79,14 @@ int _prepareFiber( Fiber *to, void *code, uintptr_t arg )
         return 1;
     }
 
-    to->f_context.uc_stack.ss_size = STACK_SIZE;
-    to->f_context.uc_stack.ss_sp = last_stack ? last_stack : malloc( STACK_SIZE );
+    to->f_context.uc_stack.ss_size = getFiberStackSize();
+    to->f_context.uc_stack.ss_sp = (char *)allocateFiberStack();
+    if (unlikely( to->f_context.uc_stack.ss_sp == NULL ))
+    {
+        return 1;
+    }
     to->start_stack = to->f_context.uc_stack.ss_sp;
     to->f_context.uc_link = NULL;
-    last_stack = NULL;
 
     makecontext( &to->f_context, (void (*)())code, 1, (unsigned long)arg );
 
@@ -100,14 +97,7 @@ void _releaseFiber( Fiber *to )
 {
     if ( to->start_stack != NULL )
     {
-        if ( last_stack == NULL )
-        {
-            last_stack = to->start_stack;
-        }
-        else
-        {
-            free( to->start_stack );
-        }
+        releaseFiberStack( to->start_stack );
 
         to->start_stack = NULL;
     }
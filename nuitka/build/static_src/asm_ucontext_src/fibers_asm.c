@@ -0,0 +1,97 @@
+//     Copyright 2018, Kay Hayen, mailto:kay.hayen@gmail.com
+//
+//     Part of "Nuitka", an optimizing Python compiler that is compatible and
+//     integrates with CPython, but also works on its own.
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+// Implementation of process context switch with hand-written assembler code
+// for the switch itself, see "swapfiber_*.S" for the architectures supported.
+//
+// Unlike "swapcontext" this does not preserve the signal mask, so there is no
+// system call involved in switching. Only the callee saved registers and the
+// stack pointer are exchanged, the compiled code calling "swapFiber" takes
+// care of the rest as for any other function call.
+
+#include "nuitka/prelude.h"
+
+// Provided by the assembler code, this is where a new fiber starts, it will
+// call the code with its argument, both taken from callee saved registers.
+#ifdef __cplusplus
+extern "C" void _startFiber( void );
+#else
+extern void _startFiber( void );
+#endif
+
+void _initFiber( Fiber *to )
+{
+    to->sp = NULL;
+    to->start_stack = NULL;
+}
+
+int _prepareFiber( Fiber *to, void *code, uintptr_t arg )
+{
+    void *stack = allocateFiberStack();
+
+    if (unlikely( stack == NULL ))
+    {
+        return 1;
+    }
+
+    to->start_stack = stack;
+
+    // Stack grows downwards, make the top aligned as the ABIs demand.
+    uintptr_t *top = (uintptr_t *)( ( (uintptr_t)stack + getFiberStackSize() ) & ~(uintptr_t)15 );
+
+    // Initial register content that "_swapFiber" will restore, with return
+    // address pointing to the start code. The layout must match the order
+    // used in the assembler code.
+#if defined( __x86_64__ )
+    uintptr_t *frame = top - 8;
+
+    // MXCSR and x87 control word at their default values.
+    frame[0] = 0x1F80 | ( (uintptr_t)0x037F << 32 );
+    frame[1] = 0;                        // r15
+    frame[2] = 0;                        // r14
+    frame[3] = arg;                      // r13
+    frame[4] = (uintptr_t)code;          // r12
+    frame[5] = 0;                        // rbx
+    frame[6] = 0;                        // rbp
+    frame[7] = (uintptr_t)_startFiber;   // return address
+#elif defined( __aarch64__ )
+    uintptr_t *frame = top - 20;
+
+    memset( frame, 0, 20 * sizeof( uintptr_t ) );
+
+    frame[0] = (uintptr_t)code;          // x19
+    frame[1] = arg;                      // x20
+    frame[11] = (uintptr_t)_startFiber;  // x30, the link register
+#else
+#error "No assembler fiber implementation for this architecture."
+#endif
+
+    to->sp = frame;
+
+    return 0;
+}
+
+void _releaseFiber( Fiber *to )
+{
+    if ( to->start_stack != NULL )
+    {
+        releaseFiberStack( to->start_stack );
+
+        to->start_stack = NULL;
+        to->sp = NULL;
+    }
+}
@@ -19,13 +19,6 @@
 
 #include "nuitka/prelude.h"
 
-// TODO: Make stack size rational.
-#define STACK_SIZE (1024*1024)
-
-// Keep one stack around to avoid the overhead of repeated malloc/free in
-// case of frequent instantiations in a loop.
-static void *last_stack = NULL;
-
 void _initFiber( Fiber *to )
 {
     to->f_context.uc_stack.ss_sp = NULL;
@@ -41,11 +34,14 @@ int _prepareFiber( Fiber *to, void *code, uintptr_t arg )
         return 1;
     }
 
-    to->f_context.uc_stack.ss_size = STACK_SIZE;
-    to->f_context.uc_stack.ss_sp = last_stack ? (char *)last_stack : (char *)malloc( STACK_SIZE );
+    to->f_context.uc_stack.ss_size = getFiberStackSize();
+    to->f_context.uc_stack.ss_sp = (char *)allocateFiberStack();
+    if (unlikely( to->f_context.uc_stack.ss_sp == NULL ))
+    {
+        return 1;
+    }
     to->start_stack = to->f_context.uc_stack.ss_sp;
     to->f_context.uc_link = NULL;
-    last_stack = NULL;
 
     makecontext( &to->f_context, (void (*)())code, 1, (unsigned long)arg );
 
@@ -56,14 +52,7 @@ void _releaseFiber( Fiber *to )
 {
     if ( to->start_stack != NULL )
     {
-        if ( last_stack == NULL )
-        {
-            last_stack = to->start_stack;
-        }
-        else
-        {
-            free( to->start_stack );
-        }
+        releaseFiberStack( to->start_stack );
 
         to->start_stack = NULL;
     }
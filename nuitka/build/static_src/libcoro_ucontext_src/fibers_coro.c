@@ -28,13 +28,6 @@ extern "C" {
 #endif
 
 
-// TODO: Make stack size rational.
-#define STACK_SIZE (1024*1024)
-
-// Keep one stack around to avoid the overhead of repeated malloc/free in
-// case of frequent instantiations in a loop.
-static void *last_stack = NULL;
-
 void _initFiber( Fiber *to )
 {
     /* Not much to do. */
@@ -44,8 +37,13 @@ void _initFiber( Fiber *to )
 int _prepareFiber( Fiber *to, void *code, uintptr_t arg )
 {
     /* Need to allocate stack manually. */
-    to->sptr = last_stack ? (char *)last_stack : (char *)malloc( STACK_SIZE );
-    coro_create( &to->coro_ctx, (coro_func)code, (void *)arg, to->sptr, STACK_SIZE );
+    to->sptr = allocateFiberStack();
+    if (unlikely( to->sptr == NULL ))
+    {
+        return 1;
+    }
+
+    coro_create( &to->coro_ctx, (coro_func)code, (void *)arg, to->sptr, getFiberStackSize() );
 
     return 0;
 }
@@ -54,14 +52,7 @@ void _releaseFiber( Fiber *to )
 {
     if ( to->sptr != NULL )
     {
-        if ( last_stack == NULL && false )
-        {
-            last_stack = to->sptr;
-        }
-        else
-        {
-            free( to->sptr );
-        }
+        releaseFiberStack( to->sptr );
 
         to->sptr = NULL;
     }
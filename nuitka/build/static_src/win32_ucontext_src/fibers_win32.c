@@ -19,11 +19,12 @@
 
 #include "nuitka/prelude.h"
 
-// Less than 1MB is ignored on Win32 apparently.
+// Less than 1MB is ignored on Win32 apparently, and stacks are allocated by
+// the fiber API itself, so only the configured size applies.
 #ifdef MS_WIN64
-#define STACK_SIZE 2*(1024*1024)
+#define MIN_STACK_SIZE 2*(1024*1024)
 #else
-#define STACK_SIZE (1024*1024)
+#define MIN_STACK_SIZE (1024*1024)
 #endif
 
 void _initFiber( Fiber *to )
@@ -35,7 +36,10 @@ void _initFiber( Fiber *to )
 
 int _prepareFiber( Fiber *to, void *code, uintptr_t arg )
 {
-    to->fiber = CreateFiber( STACK_SIZE, (LPFIBER_START_ROUTINE)code, (LPVOID)arg );
+    size_t stack_size = getFiberStackSize();
+    if ( stack_size < MIN_STACK_SIZE ) stack_size = MIN_STACK_SIZE;
+
+    to->fiber = CreateFiber( stack_size, (LPFIBER_START_ROUTINE)code, (LPVOID)arg );
     return to->fiber != NULL ? 0 : 1;
 }
 
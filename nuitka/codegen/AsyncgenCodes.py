@@ -19,13 +19,15 @@
 
 """
 
+from nuitka import Options
+
 from .CodeHelpers import generateStatementSequenceCode
 from .Emission import SourceCodeCollector
 from .FunctionCodes import (
     finalizeFunctionLocalVariables,
     setupFunctionLocalVariables
 )
-from .GeneratorCodes import getClosureCopyCode
+from .GeneratorCodes import getClosureCopyCode, getHeapLocalsCode
 from .Indentation import indented
 from .templates.CodeTemplatesAsyncgens import (
     template_asyncgen_exception_exit,
@@ -80,9 +82,20 @@ def getAsyncgenObjectCode(context, function_identifier, closure_variables,
     if needs_generator_return:
         generator_exit += template_asyncgen_return_exit % {}
 
+    function_body = function_codes.codes
+
+    if not Options.shallUseFiberGenerators():
+        function_locals, function_body, generator_exit = getHeapLocalsCode(
+            context             = context,
+            function_identifier = function_identifier,
+            function_locals     = function_locals,
+            function_body       = function_body,
+            function_exit       = generator_exit
+        )
+
     return template_asyncgen_object_body_template % {
         "function_identifier" : function_identifier,
-        "function_body"       : indented(function_codes.codes),
+        "function_body"       : indented(function_body),
         "function_var_inits"  : indented(function_locals),
         "asyncgen_exit"      : generator_exit
     }
@@ -93,7 +106,7 @@ def generateMakeAsyncgenObjectCode(to_name, expression, emit, context):
 
     closure_variables = expression.getClosureVariableVersions()
 
-    closure_copy = getClosureCopyCode(
+    closure_copy, closure_inline = getClosureCopyCode(
         to_name           = to_name,
         closure_type      = "struct Nuitka_AsyncgenObject *",
         closure_variables = closure_variables,
@@ -114,7 +127,8 @@ def generateMakeAsyncgenObjectCode(to_name, expression, emit, context):
             "code_identifier"       : context.getCodeObjectHandle(
                 code_object = expression.getCodeObject(),
             ),
-            "closure_count"         : len(closure_variables)
+            "closure_count"         : len(closure_variables),
+            "closure_inline"        : closure_inline
         }
     )
 
@@ -156,12 +156,13 @@ def getAttributeLookupCode(to_name, source_name, attribute_name, needs_check,
         )
     else:
         emit(
-            "%s = LOOKUP_ATTRIBUTE( %s, %s );" % (
+            "%s = LOOKUP_ATTRIBUTE_CACHED( %s, %s, %s );" % (
                 to_name,
                 source_name,
                 context.getConstantCode(
                     constant = attribute_name
-                )
+                ),
+                context.allocateAttributeCache()
             )
         )
 
@@ -213,11 +214,12 @@ def getAttributeAssignmentCode(target_name, attribute_name, value_name, emit,
     res_name = context.getBoolResName()
 
     emit(
-        "%s = SET_ATTRIBUTE( %s, %s, %s );" % (
+        "%s = SET_ATTRIBUTE_CACHED( %s, %s, %s, %s );" % (
             res_name,
             target_name,
             attribute_name,
-            value_name
+            value_name,
+            context.allocateAttributeCache()
         )
     )
 
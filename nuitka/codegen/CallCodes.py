@@ -26,6 +26,8 @@ able to execute them without creating the argument dictionary at all.
 from .CodeHelpers import generateChildExpressionCode, generateExpressionCode
 from .ConstantCodes import getConstantAccess
 from .ErrorCodes import getErrorExitCode, getReleaseCode, getReleaseCodes
+from .FunctionCodes import hasFunctionParser
+from .Indentation import indented
 from .LineNumberCodes import emitLineNumberUpdateCode
 from .templates.CodeTemplatesCalls import (
     template_call_function_with_args_decl,
@@ -40,7 +42,7 @@ from .templates.CodeTemplatesModules import (
 
 
 def _generateCallCodePosOnly(to_name, expression, called_name, called_attribute_name,
-                             emit, context):
+                             called_function_body, emit, context):
     # We have many variants for this to deal with, pylint: disable=too-many-branches
 
     assert called_name is not None
@@ -78,12 +80,13 @@ def _generateCallCodePosOnly(to_name, expression, called_name, called_attribute_
 
             if called_attribute_name is None:
                 getCallCodePosArgsQuick(
-                    to_name     = to_name,
-                    called_name = called_name,
-                    arg_names   = call_arg_names,
-                    needs_check = expression.mayRaiseException(BaseException),
-                    emit        = emit,
-                    context     = context
+                    to_name              = to_name,
+                    called_name          = called_name,
+                    arg_names            = call_arg_names,
+                    needs_check          = expression.mayRaiseException(BaseException),
+                    emit                 = emit,
+                    context              = context,
+                    called_function_body = called_function_body
                 )
             else:
                 getInstanceCallCodePosArgsQuick(
@@ -124,11 +127,12 @@ def _generateCallCodePosOnly(to_name, expression, called_name, called_attribute_
         else:
             if called_attribute_name is None:
                 getCallCodeNoArgs(
-                    to_name     = to_name,
-                    called_name = called_name,
-                    needs_check = expression.mayRaiseException(BaseException),
-                    emit        = emit,
-                    context     = context
+                    to_name              = to_name,
+                    called_name          = called_name,
+                    needs_check          = expression.mayRaiseException(BaseException),
+                    emit                 = emit,
+                    context              = context,
+                    called_function_body = called_function_body
                 )
             else:
                 getInstanceCallCodeNoArgs(
@@ -158,12 +162,13 @@ def _generateCallCodePosOnly(to_name, expression, called_name, called_attribute_
 
         if called_attribute_name is None:
             getCallCodePosArgsQuick(
-                to_name     = to_name,
-                called_name = called_name,
-                arg_names   = call_arg_names,
-                needs_check = expression.mayRaiseException(BaseException),
-                emit        = emit,
-                context     = context
+                to_name              = to_name,
+                called_name          = called_name,
+                arg_names            = call_arg_names,
+                needs_check          = expression.mayRaiseException(BaseException),
+                emit                 = emit,
+                context              = context,
+                called_function_body = called_function_body
             )
         else:
             getInstanceCallCodePosArgsQuick(
@@ -232,6 +237,46 @@ def _generateCallCodeKwOnly(to_name, expression, call_kw, called_name,
     )
 
 
+def _getCalledModuleFunctionBody(called, context):
+    """ Function body of this module, that a called module variable holds.
+
+        This is only a hint, the module variable may be changed from the
+        outside, so the generated code checks it at run time. The function
+        must have a specialized argument parser to be useful for direct calls.
+    """
+
+    if not called.isExpressionVariableRef():
+        return None
+
+    variable = called.getVariable()
+
+    if not variable.isModuleVariable():
+        return None
+
+    result = None
+
+    for variable_trace in variable.traces:
+        if variable_trace.isAssignTrace():
+            assign_source = variable_trace.getAssignNode().getAssignSource()
+
+            if not assign_source.isExpressionFunctionCreation():
+                return None
+
+            function_body = assign_source.getFunctionRef().getFunctionBody()
+
+            if result is not None and result is not function_body:
+                return None
+
+            result = function_body
+
+    if result is None or \
+       result.getParentModule() is not context.getOwner().getParentModule() or \
+       not hasFunctionParser(result.getParameters()):
+        return None
+
+    return result
+
+
 def generateCallCode(to_name, expression, emit, context):
     # There is a whole lot of different cases, for each of which, we create
     # optimized code, constant, with and without positional or keyword arguments
@@ -279,6 +324,10 @@ def generateCallCode(to_name, expression, emit, context):
             to_name               = to_name,
             called_name           = called_name,
             called_attribute_name = called_attribute_name,
+            called_function_body  = _getCalledModuleFunctionBody(
+                called  = called,
+                context = context
+            ),
             expression            = expression,
             emit                  = emit,
             context               = context
@@ -325,15 +374,52 @@ def generateCallCode(to_name, expression, emit, context):
             )
 
 
-def getCallCodeNoArgs(to_name, called_name, needs_check, emit, context):
+def _getDirectModuleFunctionCallCode(to_name, called_name, function_body,
+                                     args_name, arg_size, generic_call):
+    function_identifier = function_body.getCodeName()
+
+    return """\
+if ( Nuitka_Function_Check( %(called_name)s ) && ((struct Nuitka_FunctionObject *)%(called_name)s)->m_c_code == impl_%(function_identifier)s )
+{
+    %(to_name)s = Nuitka_CallFunctionParsed( parse_%(function_identifier)s, %(called_name)s, %(args_name)s, %(arg_size)d );
+}
+else
+{
+    %(to_name)s = %(generic_call)s;
+}""" % {
+        "to_name"             : to_name,
+        "called_name"         : called_name,
+        "function_identifier" : function_identifier,
+        "args_name"           : args_name,
+        "arg_size"            : arg_size,
+        "generic_call"        : generic_call
+    }
+
+
+def getCallCodeNoArgs(to_name, called_name, needs_check, emit, context,
+                      called_function_body = None):
     emitLineNumberUpdateCode(emit, context)
 
-    emit(
-        "%s = CALL_FUNCTION_NO_ARGS( %s );" % (
-            to_name,
-            called_name
+    generic_call = "CALL_FUNCTION_NO_ARGS( %s )" % called_name
+
+    if called_function_body is not None:
+        emit(
+            _getDirectModuleFunctionCallCode(
+                to_name       = to_name,
+                called_name   = called_name,
+                function_body = called_function_body,
+                args_name     = "NULL",
+                arg_size      = 0,
+                generic_call  = generic_call
+            )
+        )
+    else:
+        emit(
+            "%s = %s;" % (
+                to_name,
+                generic_call
+            )
         )
-    )
 
     getReleaseCode(
         release_name = called_name,
@@ -429,7 +515,7 @@ def getInstanceCallCodePosArgsQuick(to_name, called_name, called_attribute_name,
 
 
 def getCallCodePosArgsQuick(to_name, called_name, arg_names, needs_check,
-                            emit, context):
+                            emit, context, called_function_body = None):
 
     arg_size = len(arg_names)
     quick_calls_used.add(arg_size)
@@ -439,17 +525,35 @@ def getCallCodePosArgsQuick(to_name, called_name, arg_names, needs_check,
 
     emitLineNumberUpdateCode(emit, context)
 
+    generic_call = "CALL_FUNCTION_WITH_ARGS%d( %s, call_args )" % (
+        arg_size,
+        called_name
+    )
+
+    if called_function_body is not None:
+        call_code = _getDirectModuleFunctionCallCode(
+            to_name       = to_name,
+            called_name   = called_name,
+            function_body = called_function_body,
+            args_name     = "call_args",
+            arg_size      = arg_size,
+            generic_call  = generic_call
+        )
+    else:
+        call_code = "%s = %s;" % (
+            to_name,
+            generic_call
+        )
+
     emit(
         """\
 {
     PyObject *call_args[] = { %s };
-    %s = CALL_FUNCTION_WITH_ARGS%d( %s, call_args );
+%s
 }
 """ % (
             ", ".join(arg_names),
-            to_name,
-            arg_size,
-            called_name,
+            indented(call_code)
         )
     )
 
@@ -21,6 +21,12 @@ Rich comparisons, "in", and "not in", also "is", and "is not", and the
 "isinstance" check as used in conditions, as well as exception matching.
 """
 
+from nuitka.nodes.shapes.BuiltinTypeShapes import (
+    ShapeTypeFloat,
+    ShapeTypeInt,
+    ShapeTypeStr
+)
+
 from . import OperatorCodes
 from .CodeHelpers import generateExpressionCode
 from .ErrorCodes import (
@@ -31,6 +37,45 @@ from .ErrorCodes import (
 )
 from .LabelCodes import getBranchingCode
 
+# Rich comparisons of values with these shapes have helpers that work on the
+# values directly, for mixed "int" and "float" with the operands in that order.
+_typed_comparison_helpers = {
+    (ShapeTypeInt, ShapeTypeInt)     : "RICH_COMPARE_BOOL_INT_INT",
+    (ShapeTypeFloat, ShapeTypeFloat) : "RICH_COMPARE_BOOL_FLOAT_FLOAT",
+    (ShapeTypeStr, ShapeTypeStr)     : "RICH_COMPARE_BOOL_STR_STR",
+    (ShapeTypeInt, ShapeTypeFloat)   : "RICH_COMPARE_BOOL_INT_FLOAT",
+}
+
+_swapped_comparators = {
+    "Lt"    : "Gt",
+    "LtE"   : "GtE",
+    "Eq"    : "Eq",
+    "NotEq" : "NotEq",
+    "Gt"    : "Lt",
+    "GtE"   : "LtE"
+}
+
+
+def _getTypedComparisonCall(comparator, left_shape, right_shape, left_name,
+                            right_name):
+    key = left_shape, right_shape
+
+    if key not in _typed_comparison_helpers:
+        key = right_shape, left_shape
+
+        if key not in _typed_comparison_helpers:
+            return None
+
+        comparator = _swapped_comparators[comparator]
+        left_name, right_name = right_name, left_name
+
+    return "%s( %s, %s, Py_%s )" % (
+        _typed_comparison_helpers[key],
+        left_name,
+        right_name,
+        OperatorCodes.rich_comparison_codes[comparator]
+    )
+
 
 def generateComparisonExpressionCode(to_name, expression, emit, context):
     left_name = context.allocateTempName("compexpr_left")
@@ -51,6 +96,17 @@ def generateComparisonExpressionCode(to_name, expression, emit, context):
 
     comparator  = expression.getComparator()
 
+    if comparator in OperatorCodes.rich_comparison_codes:
+        typed_call = _getTypedComparisonCall(
+            comparator  = comparator,
+            left_shape  = expression.getLeft().getTypeShape(),
+            right_shape = expression.getRight().getTypeShape(),
+            left_name   = left_name,
+            right_name  = right_name
+        )
+    else:
+        typed_call = None
+
     if comparator in OperatorCodes.normal_comparison_codes:
         needs_check = expression.getRight().mayRaiseExceptionIn(
             BaseException,
@@ -86,6 +142,37 @@ def generateComparisonExpressionCode(to_name, expression, emit, context):
             emit        = emit,
             context     = context
         )
+    elif typed_call is not None:
+        needs_check = expression.mayRaiseExceptionBool(BaseException)
+
+        operator_res_name = context.allocateTempName("cmp_" + comparator, "int")
+
+        emit(
+            "%s = %s;" % (
+                operator_res_name,
+                typed_call
+            )
+        )
+
+        getReleaseCodes(
+            release_names = (left_name, right_name),
+            emit          = emit,
+            context       = context
+        )
+
+        getErrorExitBoolCode(
+            condition   = "%s == -1" % operator_res_name,
+            needs_check = needs_check,
+            emit        = emit,
+            context     = context
+        )
+
+        emit(
+            "%s = BOOL_FROM( %s != 0 );" % (
+                to_name,
+                operator_res_name
+            )
+        )
     elif comparator in OperatorCodes.rich_comparison_codes:
         needs_check = expression.mayRaiseExceptionBool(BaseException)
 
@@ -180,8 +267,8 @@ def generateComparisonExpressionCode(to_name, expression, emit, context):
         assert False, comparator
 
 
-def getComparisonExpressionBoolCode(comparator, left_name, right_name, needs_check,
-                                    emit, context):
+def getComparisonExpressionBoolCode(comparator, left_name, right_name, left_shape,
+                                    right_shape, needs_check, emit, context):
     if comparator in OperatorCodes.normal_comparison_codes:
         operator_res_name = context.allocateTempName("cmp_" + comparator, "int")
 
@@ -207,18 +294,34 @@ def getComparisonExpressionBoolCode(comparator, left_name, right_name, needs_che
     elif comparator in OperatorCodes.rich_comparison_codes:
         operator_res_name = context.allocateTempName("cmp_" + comparator, "int")
 
-        helper = OperatorCodes.rich_comparison_codes[comparator]
-        if not context.mayRecurse() and comparator == "Eq":
-            helper += "_NORECURSE"
+        typed_call = _getTypedComparisonCall(
+            comparator  = comparator,
+            left_shape  = left_shape,
+            right_shape = right_shape,
+            left_name   = left_name,
+            right_name  = right_name
+        )
 
-        emit(
-             "%s = RICH_COMPARE_BOOL_%s( %s, %s );" % (
-                operator_res_name,
-                helper,
-                left_name,
-                right_name
+        if typed_call is not None:
+            emit(
+                "%s = %s;" % (
+                    operator_res_name,
+                    typed_call
+                )
+            )
+        else:
+            helper = OperatorCodes.rich_comparison_codes[comparator]
+            if not context.mayRecurse() and comparator == "Eq":
+                helper += "_NORECURSE"
+
+            emit(
+                 "%s = RICH_COMPARE_BOOL_%s( %s, %s );" % (
+                    operator_res_name,
+                    helper,
+                    left_name,
+                    right_name
+                )
             )
-        )
 
         getErrorExitBoolCode(
             condition   = "%s == -1" % operator_res_name,
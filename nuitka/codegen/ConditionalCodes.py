@@ -61,6 +61,8 @@ def generateConditionCode(condition, emit, context):
             comparator  = condition.getComparator(),
             left_name   = left_name,
             right_name  = right_name,
+            left_shape  = condition.getLeft().getTypeShape(),
+            right_shape = condition.getRight().getTypeShape(),
             needs_check = condition.mayRaiseExceptionBool(BaseException),
             emit        = emit,
             context     = context
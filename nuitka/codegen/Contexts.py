@@ -361,6 +361,14 @@ class PythonContextBase(ContextMetaClassBase):
     def addDeclaration(self, key, code):
         pass
 
+    @abstractmethod
+    def allocateAttributeCache(self):
+        pass
+
+    @abstractmethod
+    def allocateModuleVariableCache(self):
+        pass
+
     @abstractmethod
     def pushFrameVariables(self, frame_variables):
         pass
@@ -529,6 +537,12 @@ class PythonChildContextBase(PythonContextBase):
     def addDeclaration(self, key, code):
         self.parent.addDeclaration(key, code)
 
+    def allocateAttributeCache(self):
+        return self.parent.allocateAttributeCache()
+
+    def allocateModuleVariableCache(self):
+        return self.parent.allocateModuleVariableCache()
+
     def pushFrameVariables(self, frame_variables):
         return self.parent.pushFrameVariables(frame_variables)
 
@@ -979,6 +993,8 @@ class PythonModuleContext(TempMixin, CodeObjectsMixin,
         self.declaration_codes = {}
         self.helper_codes = {}
 
+        self.site_cache_count = 0
+
         self.constants = set()
 
         self.frame_handle = None
@@ -1035,6 +1051,37 @@ class PythonModuleContext(TempMixin, CodeObjectsMixin,
     def getDeclarations(self):
         return self.declaration_codes
 
+    def _allocateSiteCache(self, cache_name, cache_type):
+        self.site_cache_count += 1
+
+        cache_identifier = "%s_cache_%d" % (cache_name, self.site_cache_count)
+
+        self.addDeclaration(
+            cache_identifier,
+            "static struct %s %s;" % (cache_type, cache_identifier)
+        )
+
+        return '&' + cache_identifier
+
+    def allocateAttributeCache(self):
+        """ Allocate a cache for one attribute access site of the module.
+
+            Returns the pointer to pass to the cached attribute helpers.
+        """
+
+        return self._allocateSiteCache("attribute", "Nuitka_AttributeCache")
+
+    def allocateModuleVariableCache(self):
+        """ Allocate a cache for one module variable read of the module.
+
+            Returns the pointer to pass to the cached module variable helper.
+        """
+
+        return self._allocateSiteCache(
+            "module_variable",
+            "Nuitka_ModuleVariableCache"
+        )
+
     def mayRecurse(self):
         return False
 
@@ -1247,6 +1294,9 @@ class PythonFunctionOutlineContext(ReturnReleaseModeMixin,
     def popFrameHandle(self):
         return self.parent.popFrameHandle()
 
+    def getFramesCount(self):
+        return self.parent.getFramesCount()
+
     def getExceptionKeeperVariables(self):
         return self.parent.getExceptionKeeperVariables()
 
@@ -19,6 +19,8 @@
 
 """
 
+from nuitka import Options
+
 from .CodeHelpers import (
     generateChildExpressionsCode,
     generateStatementSequenceCode
@@ -29,10 +31,11 @@ from .FunctionCodes import (
     finalizeFunctionLocalVariables,
     setupFunctionLocalVariables
 )
-from .GeneratorCodes import getClosureCopyCode
+from .GeneratorCodes import getClosureCopyCode, getHeapLocalsCode
 from .Indentation import indented
 from .LineNumberCodes import emitLineNumberUpdateCode
 from .PythonAPICodes import getReferenceExportCode
+from .YieldCodes import getYieldDelegationCode
 from .templates.CodeTemplatesCoroutines import (
     template_coroutine_exception_exit,
     template_coroutine_noexception_exit,
@@ -86,9 +89,20 @@ def getCoroutineObjectCode(context, function_identifier, closure_variables,
     if needs_generator_return:
         generator_exit += template_coroutine_return_exit % {}
 
+    function_body = function_codes.codes
+
+    if not Options.shallUseFiberGenerators():
+        function_locals, function_body, generator_exit = getHeapLocalsCode(
+            context             = context,
+            function_identifier = function_identifier,
+            function_locals     = function_locals,
+            function_body       = function_body,
+            function_exit       = generator_exit
+        )
+
     return template_coroutine_object_body_template % {
         "function_identifier" : function_identifier,
-        "function_body"       : indented(function_codes.codes),
+        "function_body"       : indented(function_body),
         "function_var_inits"  : indented(function_locals),
         "coroutine_exit"      : generator_exit
     }
@@ -99,7 +113,7 @@ def generateMakeCoroutineObjectCode(to_name, expression, emit, context):
 
     closure_variables = expression.getClosureVariableVersions()
 
-    closure_copy = getClosureCopyCode(
+    closure_copy, closure_inline = getClosureCopyCode(
         to_name           = to_name,
         closure_type      = "struct Nuitka_CoroutineObject *",
         closure_variables = closure_variables,
@@ -114,7 +128,8 @@ def generateMakeCoroutineObjectCode(to_name, expression, emit, context):
             "code_identifier"      : context.getCodeObjectHandle(
                 code_object = expression.getCodeObject(),
             ),
-            "closure_count"        : len(closure_variables)
+            "closure_count"        : len(closure_variables),
+            "closure_inline"       : closure_inline
         }
     )
 
@@ -133,21 +148,28 @@ def generateAsyncWaitCode(to_name, expression, emit, context):
     # In handlers, we must preserve/restore the exception.
     preserve_exception = expression.isExceptionPreserving()
 
-    context_identifier = context.getContextObjectName()
+    context_identifier = context.getContextObjectName().upper()
 
     # This produces AWAIT_COROUTINE or AWAIT_ASYNCGEN calls.
     getReferenceExportCode(value_name, emit, context)
 
-    emit(
-        "%s = %s_%s( %s, %s );" % (
-            to_name,
-            context_identifier.upper(),
-            "AWAIT"
-              if not preserve_exception else
-            "AWAIT_IN_HANDLER",
-            context_identifier,
-            value_name
-        )
+    if not Options.shallUseFiberGenerators():
+        start_name = context_identifier + "_AWAIT_START"
+        step_name = context_identifier + "_AWAIT_STEP"
+    else:
+        start_name = None
+        step_name = context_identifier + "_AWAIT"
+
+    if preserve_exception:
+        step_name += "_IN_HANDLER"
+
+    getYieldDelegationCode(
+        to_name    = to_name,
+        start_name = start_name,
+        step_name  = step_name,
+        value_name = value_name,
+        emit       = emit,
+        context    = context
     )
 
     if not context.needsCleanup(value_name):
@@ -168,6 +190,28 @@ def generateAsyncWaitCode(to_name, expression, emit, context):
     context.addCleanupTempName(to_name)
 
 
+def getAsyncDelegationCode(to_name, helper, value_name, emit, context):
+    context_identifier = context.getContextObjectName().upper()
+
+    # Stackless code starts with the helper, and then steps the awaitable it
+    # made like for "await".
+    if not Options.shallUseFiberGenerators():
+        start_name = "%s_%s_START" % (context_identifier, helper)
+        step_name = context_identifier + "_AWAIT_STEP"
+    else:
+        start_name = None
+        step_name = "%s_%s" % (context_identifier, helper)
+
+    getYieldDelegationCode(
+        to_name    = to_name,
+        start_name = start_name,
+        step_name  = step_name,
+        value_name = value_name,
+        emit       = emit,
+        context    = context
+    )
+
+
 def generateAsyncIterCode(to_name, expression, emit, context):
     value_name, = generateChildExpressionsCode(
         expression = expression,
@@ -175,13 +219,12 @@ def generateAsyncIterCode(to_name, expression, emit, context):
         context    = context
     )
 
-    emit(
-        "%s = %s_ASYNC_MAKE_ITERATOR( %s, %s );" % (
-            to_name,
-            context.getContextObjectName().upper(),
-            context.getContextObjectName(),
-            value_name
-        )
+    getAsyncDelegationCode(
+        to_name    = to_name,
+        helper     = "ASYNC_MAKE_ITERATOR",
+        value_name = value_name,
+        emit       = emit,
+        context    = context
     )
 
     getReleaseCode(
@@ -206,13 +249,12 @@ def generateAsyncNextCode(to_name, expression, emit, context):
         context    = context
     )
 
-    emit(
-        "%s = %s_ASYNC_ITERATOR_NEXT( %s, %s );" % (
-            to_name,
-            context.getContextObjectName().upper(),
-            context.getContextObjectName(),
-            value_name,
-        )
+    getAsyncDelegationCode(
+        to_name    = to_name,
+        helper     = "ASYNC_ITERATOR_NEXT",
+        value_name = value_name,
+        emit       = emit,
+        context    = context
     )
 
     getReleaseCode(
@@ -300,12 +300,14 @@ def getMustNotGetHereCode(reason, context, emit):
         }
     )
 
-    if provider.isExpressionGeneratorObjectBody():
-        emit("return;")
-    elif provider.isExpressionCoroutineObjectBody():
-        emit("return;")
-    elif provider.isExpressionAsyncgenObjectBody():
-        emit("return;")
+    if provider.isExpressionGeneratorObjectBody() or \
+       provider.isExpressionCoroutineObjectBody() or \
+       provider.isExpressionAsyncgenObjectBody():
+        # Stackless code returns the values it yields.
+        if Options.shallUseFiberGenerators():
+            emit("return;")
+        else:
+            emit("return NULL;")
     elif provider.isCompiledPythonModule():
         emit("return MOD_RETURN_VALUE( NULL );")
     else:
@@ -21,6 +21,7 @@ This is about frame stacks and their management. There are different kinds
 of frames for different uses.
 """
 
+from nuitka.Options import isExperimental
 from nuitka.PythonVersions import python_version
 
 from . import Emission
@@ -33,6 +34,7 @@ from .ModuleCodes import getModuleAccessCode
 from .templates.CodeTemplatesFrames import (
     template_frame_attach_locals,
     template_frame_guard_cache_decl,
+    template_frame_guard_depth_cache_decl,
     template_frame_guard_frame_decl,
     template_frame_guard_full_block,
     template_frame_guard_full_exception_handler,
@@ -40,6 +42,9 @@ from .templates.CodeTemplatesFrames import (
     template_frame_guard_generator,
     template_frame_guard_generator_exception_handler,
     template_frame_guard_generator_return_handler,
+    template_frame_guard_lazy_block,
+    template_frame_guard_lazy_exception_handler,
+    template_frame_guard_lazy_return_handler,
     template_frame_guard_once
 )
 
@@ -69,6 +74,9 @@ def getFrameLocalsStorageSize(type_descriptions):
     return result
 
 
+enable_lazy_frames = isExperimental("lazy_frames")
+enable_lazy_line_numbers = isExperimental("lazy_line_numbers")
+
 def generateStatementsFrameCode(statement_sequence, emit, context):
     # This is a wrapper that provides also handling of frames, which got a
     # lot of variants and details, therefore lots of branches and details.
@@ -99,6 +107,7 @@ def generateStatementsFrameCode(statement_sequence, emit, context):
     frame_identifier = context.pushFrameHandle(
         frame_identifier
     )
+    frames_count = context.getFramesCount()
 
     context.setExceptionEscape(
         context.allocateLabel("frame_exception_exit")
@@ -172,6 +181,22 @@ def generateStatementsFrameCode(statement_sequence, emit, context):
             emit                  = emit,
             context               = context
         )
+    elif guard_mode == "full" and enable_lazy_frames and \
+         not needs_preserve and \
+         context.getFramesCount() == frames_count and \
+         not _isFrameHandleUsed(frame_identifier, local_emit.codes):
+        getFrameGuardLazyCode(
+            frame_identifier      = frame_identifier,
+            code_identifier       = code_identifier,
+            type_descriptions     = type_descriptions,
+            parent_exception_exit = parent_exception_exit,
+            parent_return_exit    = parent_return_exit,
+            frame_exception_exit  = frame_exception_exit,
+            frame_return_exit     = frame_return_exit,
+            codes                 = local_emit.codes,
+            emit                  = emit,
+            context               = context
+        )
     elif guard_mode == "full":
         getFrameGuardHeavyCode(
             frame_identifier      = context.getFrameHandle(),
@@ -230,6 +255,10 @@ def getTypeSizeOf(type_indicator):
         return "sizeof(void *)"
     elif type_indicator == 'b':
         return "sizeof(nuitka_bool)"
+    elif type_indicator == 'l':
+        return "sizeof(nuitka_clong)"
+    elif type_indicator == 'd':
+        return "sizeof(nuitka_cdouble)"
     else:
         assert False, type_indicator
 
@@ -257,7 +286,7 @@ def getFrameGuardHeavyCode(frame_identifier, code_identifier, codes,
     no_exception_exit = context.allocateLabel("frame_no_exception")
 
     context.addFrameDeclaration(
-        template_frame_guard_cache_decl % {
+        template_frame_guard_depth_cache_decl % {
             "frame_identifier" : frame_identifier,
         }
     )
@@ -302,6 +331,66 @@ def getFrameGuardHeavyCode(frame_identifier, code_identifier, codes,
                 "frame_exception_exit"  : frame_exception_exit,
                 "attach_locals"         : getFrameAttachLocalsCode(context, frame_identifier),
                 "needs_preserve"        : 1 if needs_preserve else 0,
+                "lazy_line_numbers"     : 1 if enable_lazy_line_numbers else 0,
+            }
+        )
+
+    emit("%s:;\n" % no_exception_exit)
+
+
+def _isFrameHandleUsed(frame_identifier, codes):
+    # Line numbers for calls, published exceptions and the like all refer to
+    # the frame by name, which the framed code otherwise has no need for.
+    return any(
+        frame_identifier in code
+        for code in
+        codes
+    )
+
+
+def getFrameGuardLazyCode(frame_identifier, code_identifier, codes,
+                          type_descriptions, parent_exception_exit,
+                          parent_return_exit, frame_exception_exit,
+                          frame_return_exit, emit, context):
+    # We really need this many parameters here.
+
+    no_exception_exit = context.allocateLabel("frame_no_exception")
+
+    context.addFrameDeclaration(
+        template_frame_guard_frame_decl % {
+            "frame_identifier" : frame_identifier,
+        }
+    )
+
+    emit(
+        template_frame_guard_lazy_block % {
+            "codes"             : indented(codes, 0),
+            "no_exception_exit" : no_exception_exit,
+        }
+    )
+
+    if frame_return_exit is not None:
+        emit(
+            template_frame_guard_lazy_return_handler % {
+                "return_exit"       : parent_return_exit,
+                "frame_return_exit" : frame_return_exit,
+            }
+        )
+
+    if frame_exception_exit is not None:
+        emit(
+            template_frame_guard_lazy_exception_handler % {
+                "frame_identifier"      : frame_identifier,
+                "code_identifier"       : code_identifier,
+                "locals_size"           : getFrameLocalsStorageSize(type_descriptions),
+                "module_identifier"     : getModuleAccessCode(context),
+                "tb_making"             : getTracebackMakingIdentifier(
+                                              context     = context,
+                                              lineno_name = "exception_lineno"
+                                          ),
+                "parent_exception_exit" : parent_exception_exit,
+                "frame_exception_exit"  : frame_exception_exit,
+                "attach_locals"         : getFrameAttachLocalsCode(context, frame_identifier),
             }
         )
 
@@ -395,7 +484,8 @@ def getFrameGuardLightCode(code_identifier, codes, parent_exception_exit,
                     getFrameAttachLocalsCode(context, frame_identifier)
                 ),
                 "frame_exception_exit"   : frame_exception_exit,
-                "parent_exception_exit"  : parent_exception_exit
+                "parent_exception_exit"  : parent_exception_exit,
+                "lazy_line_numbers"      : 1 if enable_lazy_line_numbers else 0,
             }
         )
 
@@ -21,7 +21,11 @@
 
 from nuitka.PythonVersions import python_version
 
-from .c_types.CTypePyObjectPtrs import CTypeCellObject, CTypePyObjectPtrPtr
+from .c_types.CTypePyObjectPtrs import (
+    CTypeCellObject,
+    CTypePyObjectPtr,
+    CTypePyObjectPtrPtr
+)
 from .CodeHelpers import generateExpressionCode, generateStatementSequenceCode
 from .Contexts import PythonFunctionOutlineContext
 from .Emission import SourceCodeCollector
@@ -44,6 +48,9 @@ from .templates.CodeTemplatesFunction import (
     template_function_direct_declaration,
     template_function_exception_exit,
     template_function_make_declaration,
+    template_function_parse_arguments,
+    template_function_parse_declaration,
+    template_function_parse_keyword_match,
     template_function_return_exit,
     template_make_function_template
 )
@@ -51,8 +58,8 @@ from .TupleCodes import getTupleCreationCode
 from .VariableCodes import (
     getLocalVariableCodeType,
     getLocalVariableInitCode,
-    getVariableCode,
-    getVariableCodeName
+    getVariableCodeName,
+    isClosureTakenByValue
 )
 
 
@@ -60,14 +67,21 @@ def getClosureVariableProvisionCode(context, closure_variables):
     result = []
 
     for variable, version, _trace in closure_variables:
-        result.append(
-            getVariableCode(
-                context  = context,
-                variable = variable,
-                version  = version
-            )
+        variable_code_name, variable_c_type = getLocalVariableCodeType(
+            context  = context,
+            variable = variable,
+            version  = version
         )
 
+        if isClosureTakenByValue(variable):
+            result.append(
+                variable_c_type.getLocalVariableObjectAccessCode(
+                    variable_code_name
+                )
+            )
+        else:
+            result.append(variable_code_name)
+
     return result
 
 
@@ -85,8 +99,13 @@ def _getFunctionCreationArgs(defaults_name, kw_defaults_name,
         result.append("PyObject *annotations")
 
     for closure_variable in closure_variables:
+        if isClosureTakenByValue(closure_variable):
+            arg_template = "PyObject *%s"
+        else:
+            arg_template = "struct Nuitka_CellObject *%s"
+
         result.append(
-            "struct Nuitka_CellObject *%s" % (
+            arg_template % (
                 getVariableCodeName(
                     variable   = closure_variable,
                     in_context = True
@@ -98,7 +117,7 @@ def _getFunctionCreationArgs(defaults_name, kw_defaults_name,
 
 
 def getFunctionMakerDecl(function_identifier, defaults_name, kw_defaults_name,
-                         annotations_name, closure_variables):
+                         annotations_name, closure_variables, parameters):
 
     function_creation_arg_spec = _getFunctionCreationArgs(
         defaults_name     = defaults_name,
@@ -107,22 +126,82 @@ def getFunctionMakerDecl(function_identifier, defaults_name, kw_defaults_name,
         closure_variables = closure_variables
     )
 
-    return template_function_make_declaration % {
+    result = template_function_make_declaration % {
         "function_identifier"        : function_identifier,
         "function_creation_arg_spec" : ", ".join(
             function_creation_arg_spec
         )
     }
 
+    # Calls of module functions may use the parser directly, declare it and
+    # the implementation it is guarded by.
+    if hasFunctionParser(parameters):
+        result += template_function_parse_declaration % {
+            "function_identifier" : function_identifier
+        }
+
+    return result
+
 
 def getFunctionEntryPointIdentifier(function_identifier):
     return "impl_" + function_identifier
 
 
+# Functions with more parameters than this use the generic parser only, there
+# is little gain to be had, and code size would grow.
+_max_parser_parameter_count = 8
+
+def hasFunctionParser(parameters):
+    """ Decide if a specialized argument parser is generated for a function.
+
+        Only plain parameters, i.e. without star arguments and keyword only
+        arguments, are handled.
+    """
+
+    if parameters is None or \
+       parameters.getStarListArgumentName() is not None or \
+       parameters.getStarDictArgumentName() is not None or \
+       parameters.getKwOnlyParameterCount() > 0:
+        return False
+
+    return 0 < parameters.getArgumentCount() <= _max_parser_parameter_count
+
+
+def getFunctionParserCode(function_identifier, parameters, context):
+    """ Specialized argument parser for the function, if one is possible. """
+
+    if not hasFunctionParser(parameters):
+        return None
+
+    parameter_names = parameters.getArgumentNames()
+
+    keyword_matches = []
+
+    for count, parameter_name in enumerate(parameter_names):
+        keyword_matches.append(
+            template_function_parse_keyword_match % {
+                "else"               : "else " if count else "",
+                "parameter_name_obj" : context.getConstantCode(
+                    constant = parameter_name
+                ),
+                "parameter_index"    : count
+            }
+        )
+
+    return template_function_parse_arguments % {
+        "function_identifier"      : function_identifier,
+        "function_impl_identifier" : getFunctionEntryPointIdentifier(
+            function_identifier = function_identifier,
+        ),
+        "parameter_count"          : len(parameter_names),
+        "keyword_matches"          : "\n".join(keyword_matches)
+    }
+
+
 def getFunctionMakerCode(function_name, function_qualname, function_identifier,
                          code_identifier, closure_variables, defaults_name,
                          kw_defaults_name, annotations_name, function_doc,
-                         context):
+                         parameters, context):
     # We really need this many parameters here and functions have many details,
     # that we express as variables, pylint: disable=too-many-locals
     function_creation_args = _getFunctionCreationArgs(
@@ -140,8 +219,26 @@ def getFunctionMakerCode(function_name, function_qualname, function_identifier,
         )
 
     closure_copy = []
+    closure_inline = 0
 
     for count, closure_variable in enumerate(closure_variables):
+        if isClosureTakenByValue(closure_variable):
+            closure_copy.append(
+                "result->m_closure[%d] = Nuitka_Cell_NewInline( result->m_closure, %d, %d, %s );" % (
+                    count,
+                    len(closure_variables),
+                    closure_inline,
+                    getVariableCodeName(
+                        True,
+                        closure_variable
+                    )
+                )
+            )
+
+            closure_inline += 1
+
+            continue
+
         closure_copy.append(
             "result->m_closure[%d] = %s;" % (
 
@@ -156,6 +253,17 @@ def getFunctionMakerCode(function_name, function_qualname, function_identifier,
             "Py_INCREF( result->m_closure[%d] );" %count
         )
 
+    parser_code = getFunctionParserCode(
+        function_identifier = function_identifier,
+        parameters          = parameters,
+        context             = context
+    )
+
+    if parser_code is not None:
+        parser_setup = "    result->m_c_parse = parse_%s;\n" % function_identifier
+    else:
+        parser_setup = ""
+
     result = template_make_function_template % {
         "function_name_obj"          : context.getConstantCode(
             constant = function_name
@@ -170,6 +278,7 @@ def getFunctionMakerCode(function_name, function_qualname, function_identifier,
         ),
         "code_identifier"            : code_identifier,
         "closure_copy"               : indented(closure_copy, 0, True),
+        "parser_setup"               : parser_setup,
         "function_doc"               : context.getConstantCode(
             constant = function_doc
         ),
@@ -183,11 +292,15 @@ def getFunctionMakerCode(function_name, function_qualname, function_identifier,
                                          if annotations_name else
                                        context.getConstantCode({}),
         "closure_count"              : len(closure_variables),
+        "closure_inline"             : closure_inline,
         "module_identifier"          : getModuleAccessCode(
             context = context
         ),
     }
 
+    if parser_code is not None:
+        result = parser_code + result
+
     return result
 
 
@@ -272,6 +385,7 @@ def generateFunctionCreationCode(to_name, expression, emit, context):
             kw_defaults_name    = kw_defaults_name,
             annotations_name    = annotations_name,
             function_doc        = function_body.getDoc(),
+            parameters          = function_body.getParameters(),
             context             = context
         )
 
@@ -282,7 +396,8 @@ def generateFunctionCreationCode(to_name, expression, emit, context):
             defaults_name       = defaults_name,
             kw_defaults_name    = kw_defaults_name,
             annotations_name    = annotations_name,
-            closure_variables   = function_body.getClosureVariables()
+            closure_variables   = function_body.getClosureVariables(),
+            parameters          = function_body.getParameters()
         )
 
         context.addDeclaration(function_identifier, function_decl)
@@ -486,7 +601,16 @@ def setupFunctionLocalVariables(context, parameters, closure_variables,
             version  = 0
         )
 
-        if variable_c_type in (CTypeCellObject, CTypePyObjectPtrPtr):
+        if variable_c_type is CTypeCellObject and \
+           isClosureTakenByValue(closure_variable):
+            # Inline cells must not be attached to frames, as these may
+            # outlive them, attach the value instead.
+            context.setVariableType(
+                closure_variable,
+                variable_c_type.getLocalVariableObjectAccessCode(variable_code_name),
+                CTypePyObjectPtr
+            )
+        elif variable_c_type in (CTypeCellObject, CTypePyObjectPtrPtr):
             context.setVariableType(closure_variable, variable_code_name, variable_c_type)
         else:
             assert False, (variable_code_name, variable_c_type)
@@ -19,6 +19,8 @@
 
 """
 
+import re
+
 from nuitka import Options
 from nuitka.PythonVersions import python_version
 
@@ -32,13 +34,15 @@ from .Indentation import indented
 from .ModuleCodes import getModuleAccessCode
 from .templates.CodeTemplatesGeneratorFunction import (
     template_generator_exception_exit,
+    template_generator_heap_locals_decl,
+    template_generator_heap_locals_pointer,
     template_generator_making,
     template_generator_noexception_exit,
     template_generator_return_exit,
     template_genfunc_yielder_body_template,
     template_genfunc_yielder_decl_template
 )
-from .VariableCodes import getLocalVariableCodeType
+from .VariableCodes import getLocalVariableCodeType, isClosureTakenByValue
 
 
 def getGeneratorObjectDeclCode(function_identifier):
@@ -51,8 +55,6 @@ def getGeneratorObjectCode(context, function_identifier, closure_variables,
                            user_variables, outline_variables,
                            temp_variables, needs_exception_exit,
                            needs_generator_return):
-    # Due to the current experimental code, pylint: disable=too-many-locals
-
     function_locals, function_cleanup = setupFunctionLocalVariables(
         context           = context,
         parameters        = None,
@@ -84,67 +86,168 @@ def getGeneratorObjectCode(context, function_identifier, closure_variables,
     if needs_generator_return:
         generator_exit += template_generator_return_exit % {}
 
-    function_dispatch = [
-        "case %(index)d: goto yield_return_%(index)d;" % {
-            "index" : yield_index
-        }
-        for yield_index in
-        range(context.getLabelCount("yield_return"), 0, -1)
-    ]
+    function_body = function_codes.codes
+
+    if not Options.shallUseFiberGenerators():
+        function_locals, function_body, generator_exit = getHeapLocalsCode(
+            context             = context,
+            function_identifier = function_identifier,
+            function_locals     = function_locals,
+            function_body       = function_body,
+            function_exit       = generator_exit
+        )
 
-    if function_dispatch:
-        function_dispatch.insert(0, "switch(generator->m_yield_return_index) {")
-        function_dispatch.append('}')
+    return template_genfunc_yielder_body_template % {
+        "function_identifier" : function_identifier,
+        "function_body"       : indented(function_body),
+        "function_var_inits"  : indented(function_locals),
+        "generator_exit"      : generator_exit
+    }
 
-    local_type_decl = []
-    local_type_init = []
-    local_reals = []
+
+_local_decl_re = re.compile(
+    r"^(?:NUITKA_MAY_BE_UNUSED )?(?P<type>.*?[ *])(?P<name>[\w$]+)(?: = (?P<init>.*))?;$",
+    re.S
+)
+_local_assign_re = re.compile(r"^(?P<name>[\w$]+) = (?P<init>.*);$", re.S)
+
+
+def getHeapLocalsCode(context, function_identifier, function_locals,
+                      function_body, function_exit):
+    """ Move the local variables of a stackless context to its heap storage.
+
+    Generators, coroutines and asyncgens return to their caller for every
+    suspension, so their variables must live in a struct behind the closure
+    instead, and uses are renamed to go through a pointer to it. Only static
+    variables and scratch values that never cross a suspension stay C locals.
+
+    This also adds the dispatch to the label of the last suspension, and
+    declares the struct, which the object creation needs the size of.
+    """
+
+    context_identifier = context.getContextObjectName()
+    heap_identifier = context_identifier + "_heap"
+
+    heap_decls = []
+    heap_inits = []
+    heap_names = []
+    c_locals = []
 
     for decl in function_locals:
-        if decl.startswith("NUITKA_MAY_BE_UNUSED "):
-            decl = decl[21:]
+        decl = decl.strip()
 
-        if decl.startswith("static"):
-            local_reals.append(decl)
+        if decl.startswith("static ") or \
+           decl == "NUITKA_MAY_BE_UNUSED PyObject *tmp_unused;":
+            c_locals.append(decl)
             continue
 
-        if decl in ("char const *type_description;", "PyObject *tmp_unused;"):
-            local_reals.append(decl)
-            continue
+        # Initializations for variables declared earlier.
+        match = _local_assign_re.match(decl)
+
+        if match is None:
+            match = _local_decl_re.match(decl)
+            assert match, decl
 
-        parts = decl.split('=')
+            heap_decls.append(
+                "%s%s;" % (match.group("type"), match.group("name"))
+            )
+            heap_names.append(match.group("name"))
+
+        init = match.group("init")
+
+        if init is not None and init.startswith('{'):
+            # Aggregate initializers are only allowed in declarations.
+            heap_inits.append(
+                "{ %sinit_value = %s; %s->%s = init_value; }" % (
+                    match.group("type"),
+                    init,
+                    heap_identifier,
+                    match.group("name")
+                )
+            )
+        elif init is not None:
+            heap_inits.append(
+                "%s->%s = %s;" % (
+                    heap_identifier,
+                    match.group("name"),
+                    init
+                )
+            )
 
-        if len(parts) == 1:
-            local_type_decl.append(decl)
-        else:
-            type_decl = parts[0].strip()
-            var_name = type_decl.split('*')[-1]
-            var_name = var_name.split(' ')[-1]
+    # Empty structs are not allowed in C.
+    if not heap_decls:
+        heap_decls.append("char m_unused;")
+
+    context.addDeclaration(
+        function_identifier + "_locals",
+        template_generator_heap_locals_decl % {
+            "function_identifier" : function_identifier,
+            "heap_decls"          : indented(heap_decls)
+        }
+    )
 
-            local_type_decl.append(type_decl)
-            local_type_init.append(
-                "local_variables->" + var_name + " =" + parts[1]
+    if heap_names:
+        # Names may contain "$", which is not a word character, and struct
+        # members of the same name must be left alone.
+        heap_names_re = re.compile(
+            r"(?<![\w$.])(?<!->)(%s)(?![\w$])" % '|'.join(
+                re.escape(heap_name)
+                for heap_name in
+                heap_names
             )
+        )
 
-    if Options.isExperimental("generator_goto"):
-        function_locals = local_reals + local_type_init
+        def renameHeapLocals(code):
+            return heap_names_re.sub(heap_identifier + r"->\1", code)
+
+        function_body = [
+            renameHeapLocals(line)
+            for line in
+            function_body
+        ]
+        function_exit = renameHeapLocals(function_exit)
+
+    c_locals.insert(
+        0,
+        template_generator_heap_locals_pointer % {
+            "function_identifier" : function_identifier,
+            "heap_identifier"     : heap_identifier,
+            "context_identifier"  : context_identifier
+        }
+    )
 
-    return template_genfunc_yielder_body_template % {
-        "function_identifier"  : function_identifier,
-        "function_body"        : indented(function_codes.codes),
-        "function_local_types" : indented(local_type_decl),
-        "function_var_inits"   : indented(function_locals),
-        "function_dispatch"    : indented(function_dispatch),
-        "generator_exit"       : generator_exit
-    }
+    yield_count = context.getLabelCount("yield_return")
+
+    if yield_count:
+        c_locals.append("")
+        c_locals.append("// Dispatch to yield based on return label index:")
+        c_locals.append("switch( %s->m_yield_return_index )" % context_identifier)
+        c_locals.append('{')
+        c_locals += [
+            "case %(index)d: goto yield_return_%(index)d;" % {
+                "index" : yield_index
+            }
+            for yield_index in
+            range(1, yield_count + 1)
+        ]
+        c_locals.append('}')
+
+    if heap_inits:
+        c_locals.append("")
+        c_locals.append("// Heap access initialization, when first entered.")
+        c_locals += heap_inits
+
+    return c_locals, function_body, function_exit
 
 
 def getClosureCopyCode(to_name, closure_variables, closure_type, context):
     """ Get code to copy closure variables storage.
 
     This gets used by generator/coroutine/asyncgen with varying "closure_type".
+    Returns the code and the number of inline cells to allocate for it.
     """
     closure_copy = []
+    closure_inline = 0
 
     for count, (variable, version, _variable_trace) in enumerate(closure_variables):
         variable_code_name, variable_c_type = getLocalVariableCodeType(context, variable, version)
@@ -155,6 +258,24 @@ def getClosureCopyCode(to_name, closure_variables, closure_type, context):
             count
         )
 
+        if isClosureTakenByValue(variable):
+            closure_copy.append(
+                "%s = Nuitka_Cell_NewInline( ((%s)%s)->m_closure, %d, %d, %s );" % (
+                    target_cell_code,
+                    closure_type,
+                    to_name,
+                    len(closure_variables),
+                    closure_inline,
+                    variable_c_type.getLocalVariableObjectAccessCode(
+                        variable_code_name
+                    )
+                )
+            )
+
+            closure_inline += 1
+
+            continue
+
         variable_c_type.getCellObjectAssignmentCode(
             target_cell_code   = target_cell_code,
             variable_code_name = variable_code_name,
@@ -168,7 +289,7 @@ def getClosureCopyCode(to_name, closure_variables, closure_type, context):
         )
     )
 
-    return closure_copy
+    return closure_copy, closure_inline
 
 
 def generateMakeGeneratorObjectCode(to_name, expression, emit, context):
@@ -187,7 +308,7 @@ def generateMakeGeneratorObjectCode(to_name, expression, emit, context):
 
     closure_variables = expression.getClosureVariableVersions()
 
-    closure_copy = getClosureCopyCode(
+    closure_copy, closure_inline = getClosureCopyCode(
         to_name           = to_name,
         closure_type      = "struct Nuitka_GeneratorObject *",
         closure_variables = closure_variables,
@@ -205,7 +326,8 @@ def generateMakeGeneratorObjectCode(to_name, expression, emit, context):
             "code_identifier"        : context.getCodeObjectHandle(
                 code_object = expression.getCodeObject()
             ),
-            "closure_count"          : len(closure_variables)
+            "closure_count"          : len(closure_variables),
+            "closure_inline"         : closure_inline
         }
     )
 
@@ -22,8 +22,11 @@ Next variants and unpacking with related checks.
 
 from nuitka.PythonVersions import python_version
 
+from .c_types.CTypeNuitkaRangeIterators import CTypeNuitkaRangeIterator
+from .c_types.CTypeNuitkaUnpackIterators import CTypeNuitkaUnpackIterator
 from .CodeHelpers import generateChildExpressionsCode, generateExpressionCode
 from .ErrorCodes import (
+    getErrorExitBoolCode,
     getErrorExitCode,
     getErrorExitReleaseCode,
     getFrameVariableTypeDescriptionCode,
@@ -36,27 +39,44 @@ from .templates.CodeTemplatesIterators import (
     template_iterator_check,
     template_loop_break_next
 )
+from .VariableCodes import (
+    getRangeIteratorVariableCode,
+    getUnpackIteratorVariableCode
+)
 
 
 def generateBuiltinNext1Code(to_name, expression, emit, context):
-    value_name, = generateChildExpressionsCode(
-        expression = expression,
-        emit       = emit,
+    range_iterator_name = getRangeIteratorVariableCode(
+        expression = expression.getValue(),
         context    = context
     )
 
-    emit(
-        "%s = %s;" % (
-            to_name,
-            "ITERATOR_NEXT( %s )" % value_name,
+    if range_iterator_name is not None:
+        emit(
+            "%s = %s;" % (
+                to_name,
+                CTypeNuitkaRangeIterator.getIteratorNextCode(range_iterator_name)
+            )
+        )
+    else:
+        value_name, = generateChildExpressionsCode(
+            expression = expression,
+            emit       = emit,
+            context    = context
         )
-    )
 
-    getReleaseCode(
-        release_name = value_name,
-        emit         = emit,
-        context      = context
-    )
+        emit(
+            "%s = %s;" % (
+                to_name,
+                "ITERATOR_NEXT( %s )" % value_name,
+            )
+        )
+
+        getReleaseCode(
+            release_name = value_name,
+            emit         = emit,
+            context      = context
+        )
 
     getErrorExitCode(
         check_name      = to_name,
@@ -69,18 +89,42 @@ def generateBuiltinNext1Code(to_name, expression, emit, context):
 
 
 def getBuiltinLoopBreakNextCode(to_name, value, emit, context):
-    emit(
-        "%s = %s;" % (
-            to_name,
-            "ITERATOR_NEXT( %s )" % value,
-        )
+    # The value expression gives the iterator, unless it reads a range
+    # iterator variable, which is not an object.
+    range_iterator_name = getRangeIteratorVariableCode(
+        expression = value,
+        context    = context
     )
 
-    getReleaseCode(
-        release_name = value,
-        emit         = emit,
-        context      = context
-    )
+    if range_iterator_name is not None:
+        emit(
+            "%s = %s;" % (
+                to_name,
+                CTypeNuitkaRangeIterator.getIteratorNextCode(range_iterator_name)
+            )
+        )
+    else:
+        value_name = context.allocateTempName("next_source")
+
+        generateExpressionCode(
+            expression = value,
+            to_name    = value_name,
+            emit       = emit,
+            context    = context
+        )
+
+        emit(
+            "%s = %s;" % (
+                to_name,
+                "ITERATOR_NEXT( %s )" % value_name,
+            )
+        )
+
+        getReleaseCode(
+            release_name = value_name,
+            emit         = emit,
+            context      = context
+        )
 
     break_target = context.getLoopBreakTarget()
     if type(break_target) is tuple:
@@ -149,6 +193,34 @@ def getUnpackNextCode(to_name, value, expected, count, emit, context):
 
 
 def generateSpecialUnpackCode(to_name, expression, emit, context):
+    unpack_iterator_name = getUnpackIteratorVariableCode(
+        expression = expression.getValue(),
+        context    = context
+    )
+
+    if unpack_iterator_name is not None:
+        emit(
+            "%s = %s;" % (
+                to_name,
+                CTypeNuitkaUnpackIterator.getUnpackNextCode(
+                    variable_code_name = unpack_iterator_name,
+                    count              = expression.getCount(),
+                    expected           = expression.getExpected()
+                )
+            )
+        )
+
+        getErrorExitCode(
+            check_name      = to_name,
+            quick_exception = "StopIteration",
+            emit            = emit,
+            context         = context
+        )
+
+        context.addCleanupTempName(to_name)
+
+        return
+
     value_name = context.allocateTempName("unpack")
 
     generateExpressionCode(
@@ -169,6 +241,38 @@ def generateSpecialUnpackCode(to_name, expression, emit, context):
 
 
 def generateUnpackCheckCode(statement, emit, context):
+    unpack_iterator_name = getUnpackIteratorVariableCode(
+        expression = statement.getIterator(),
+        context    = context
+    )
+
+    if unpack_iterator_name is not None:
+        res_name = context.getBoolResName()
+
+        old_source_ref = context.setCurrentSourceCodeReference(
+            statement.getSourceReference()
+        )
+
+        emit(
+            "%s = %s;" % (
+                res_name,
+                CTypeNuitkaUnpackIterator.getUnpackCheckCode(
+                    variable_code_name = unpack_iterator_name,
+                    count              = statement.getCount()
+                )
+            )
+        )
+
+        getErrorExitBoolCode(
+            condition = "%s == false" % res_name,
+            emit      = emit,
+            context   = context
+        )
+
+        context.setCurrentSourceCodeReference(old_source_ref)
+
+        return
+
     iterator_name  = context.allocateTempName("iterator_name")
 
     generateExpressionCode(
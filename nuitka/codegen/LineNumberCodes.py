@@ -19,6 +19,12 @@
 
 """
 
+from nuitka.Options import isExperimental
+
+# Only give line numbers to exceptions, but not to running frames.
+enable_lazy_line_numbers = isExperimental("lazy_line_numbers")
+
+
 def getCurrentLineNumberCode(context):
     frame_handle = context.getFrameHandle()
 
@@ -33,6 +39,9 @@ def getCurrentLineNumberCode(context):
             return str(source_ref.getLineNumber())
 
 def getLineNumberUpdateCode(context):
+    if enable_lazy_line_numbers:
+        return ""
+
     lineno_value = getCurrentLineNumberCode(context)
 
     if lineno_value:
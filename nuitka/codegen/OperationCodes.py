@@ -39,6 +39,10 @@ def generateOperationBinaryCode(to_name, expression, emit, context):
     assert not inplace or not expression.getLeft().isCompileTimeConstant(),  \
         expression
 
+    # In-place works on the variable value only, not on objects made for it.
+    if inplace and context.needsCleanup(left_arg_name):
+        inplace = False
+
     getOperationCode(
         to_name   = to_name,
         operator  = expression.getOperator(),
@@ -60,6 +60,29 @@ binary_operator_codes = {
     "IBitXor"   : "PyNumber_InPlaceXor",
 }
 
+# For Python3, these have fast paths for small "int" values, with the C/API
+# function as the fallback.
+if python_version >= 300:
+    binary_operator_codes.update(
+        {
+            "LShift"    : "BINARY_OPERATION_LSHIFT",
+            "RShift"    : "BINARY_OPERATION_RSHIFT",
+            "BitAnd"    : "BINARY_OPERATION_BITAND",
+            "BitOr"     : "BINARY_OPERATION_BITOR",
+            "BitXor"    : "BINARY_OPERATION_BITXOR",
+            "IAdd"      : "INPLACE_OPERATION_ADD",
+            "ISub"      : "INPLACE_OPERATION_SUB",
+            "IMult"     : "INPLACE_OPERATION_MUL",
+            "IFloorDiv" : "INPLACE_OPERATION_FLOORDIV",
+            "IMod"      : "INPLACE_OPERATION_REMAINDER",
+            "ILShift"   : "INPLACE_OPERATION_LSHIFT",
+            "IRShift"   : "INPLACE_OPERATION_RSHIFT",
+            "IBitAnd"   : "INPLACE_OPERATION_BITAND",
+            "IBitOr"    : "INPLACE_OPERATION_BITOR",
+            "IBitXor"   : "INPLACE_OPERATION_BITXOR",
+        }
+    )
+
 # Python 3.5 only operator
 if python_version >= 350:
     binary_operator_codes["MatMult"] = "PyNumber_MatrixMultiply"
@@ -25,19 +25,15 @@ from nuitka import Options
 from nuitka.Constants import isIndexConstant
 
 from .CodeHelpers import (
-    generateChildExpressionsCode,
+    generateChildExpressionCode,
     generateExpressionCode,
     generateExpressionsCode
 )
 from .ErrorCodes import getErrorExitBoolCode, getErrorExitCode, getReleaseCodes
+from .VariableCodes import getCLongValueCode
 
 
-def generateAssignmentSubscriptCode(statement, emit, context):
-    subscribed      = statement.getSubscribed()
-    subscript       = statement.getSubscript()
-    value           = statement.getAssignSource()
-
-    integer_subscript = False
+def _getIntegerSubscriptValue(subscript):
     if subscript.isExpressionConstantRef():
         constant = subscript.getConstant()
 
@@ -45,7 +41,17 @@ def generateAssignmentSubscriptCode(statement, emit, context):
             constant_value = int(constant)
 
             if abs(constant_value) < 2**31:
-                integer_subscript = True
+                return constant_value
+
+    return None
+
+
+def generateAssignmentSubscriptCode(statement, emit, context):
+    subscribed      = statement.getSubscribed()
+    subscript       = statement.getSubscript()
+    value           = statement.getAssignSource()
+
+    constant_value = _getIntegerSubscriptValue(subscript)
 
     value_name = context.allocateTempName("ass_subvalue")
 
@@ -65,22 +71,38 @@ def generateAssignmentSubscriptCode(statement, emit, context):
     )
 
 
-    subscript_name = context.allocateTempName("ass_subscript")
-
-    generateExpressionCode(
-        to_name    = subscript_name,
+    # Indexes from C long variables need no object.
+    index_name = getCLongValueCode(
         expression = subscript,
         emit       = emit,
         context    = context
     )
 
+    if index_name is None:
+        subscript_name = context.allocateTempName("ass_subscript")
+
+        generateExpressionCode(
+            to_name    = subscript_name,
+            expression = subscript,
+            emit       = emit,
+            context    = context
+        )
+
     old_source_ref = context.setCurrentSourceCodeReference(
         value.getSourceReference()
            if Options.isFullCompat() else
         statement.getSourceReference()
     )
 
-    if integer_subscript:
+    if index_name is not None:
+        getIndexSubscriptAssignmentCode(
+            subscribed_name = subscribed_name,
+            index_name      = index_name,
+            value_name      = value_name,
+            emit            = emit,
+            context         = context
+        )
+    elif constant_value is not None:
         getIntegerSubscriptAssignmentCode(
             subscribed_name = subscribed_name,
             subscript_name  = subscript_name,
@@ -128,20 +150,58 @@ def generateDelSubscriptCode(statement, emit, context):
 
 
 def generateSubscriptLookupCode(to_name, expression, emit, context):
-    subscribed_name, subscript_name = generateChildExpressionsCode(
-        expression = expression,
+    subscribed_name = generateChildExpressionCode(
+        expression = expression.getLookupSource(),
+        child_name = "subscribed",
         emit       = emit,
         context    = context
     )
 
-    return getSubscriptLookupCode(
-        to_name         = to_name,
-        subscribed_name = subscribed_name,
-        subscript_name  = subscript_name,
-        emit            = emit,
-        context         = context
+    subscript = expression.getSubscript()
+
+    # Indexes from C long variables need no object.
+    index_name = getCLongValueCode(
+        expression = subscript,
+        emit       = emit,
+        context    = context
     )
 
+    if index_name is not None:
+        return getIndexSubscriptLookupCode(
+            to_name         = to_name,
+            subscribed_name = subscribed_name,
+            index_name      = index_name,
+            emit            = emit,
+            context         = context
+        )
+
+    subscript_name = generateChildExpressionCode(
+        expression = subscript,
+        child_name = "subscript",
+        emit       = emit,
+        context    = context
+    )
+
+    constant_value = _getIntegerSubscriptValue(subscript)
+
+    if constant_value is not None:
+        return getIntegerSubscriptLookupCode(
+            to_name         = to_name,
+            target_name     = subscribed_name,
+            subscript_name  = subscript_name,
+            subscript_value = constant_value,
+            emit            = emit,
+            context         = context
+        )
+    else:
+        return getSubscriptLookupCode(
+            to_name         = to_name,
+            subscribed_name = subscribed_name,
+            subscript_name  = subscript_name,
+            emit            = emit,
+            context         = context
+        )
+
 
 def getIntegerSubscriptLookupCode(to_name, target_name, subscript_name,
                                   subscript_value, emit, context):
@@ -169,6 +229,31 @@ def getIntegerSubscriptLookupCode(to_name, target_name, subscript_name,
     context.addCleanupTempName(to_name)
 
 
+def getIndexSubscriptLookupCode(to_name, subscribed_name, index_name, emit,
+                                context):
+    emit(
+        "%s = LOOKUP_SUBSCRIPT_INDEX( %s, %s );" % (
+            to_name,
+            subscribed_name,
+            index_name
+        )
+    )
+
+    getReleaseCodes(
+        release_names = (subscribed_name,),
+        emit          = emit,
+        context       = context
+    )
+
+    getErrorExitCode(
+        check_name = to_name,
+        emit       = emit,
+        context    = context
+    )
+
+    context.addCleanupTempName(to_name)
+
+
 def getSubscriptLookupCode(to_name, subscript_name, subscribed_name, emit,
                            context):
     emit(
@@ -224,6 +309,32 @@ def getIntegerSubscriptAssignmentCode(subscribed_name, subscript_name,
     )
 
 
+def getIndexSubscriptAssignmentCode(subscribed_name, index_name, value_name,
+                                    emit, context):
+    res_name = context.getBoolResName()
+
+    emit(
+        "%s = SET_SUBSCRIPT_INDEX( %s, %s, %s );" % (
+            res_name,
+            subscribed_name,
+            index_name,
+            value_name
+        )
+    )
+
+    getReleaseCodes(
+        release_names = (subscribed_name, value_name),
+        emit          = emit,
+        context       = context
+    )
+
+    getErrorExitBoolCode(
+        condition = "%s == false" % res_name,
+        emit      = emit,
+        context   = context
+    )
+
+
 def getSubscriptAssignmentCode(target_name, subscript_name, value_name,
                                emit, context):
     res_name = context.getBoolResName()
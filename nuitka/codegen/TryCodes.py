@@ -24,7 +24,7 @@ structure used, where exception handling and everything is made explicit.
 
 from nuitka import Options
 
-from .CodeHelpers import generateExpressionCode, generateStatementSequenceCode
+from .CodeHelpers import generateStatementSequenceCode
 from .ErrorCodes import getMustNotGetHereCode
 from .ExceptionCodes import getExceptionUnpublishedReleaseCode
 from .IteratorCodes import getBuiltinLoopBreakNextCode
@@ -294,15 +294,6 @@ def generateTryNextExceptStopIterationCode(statement, emit, context):
        not no_statements[0].isStatementReraiseException():
         return False
 
-    tmp_name = context.allocateTempName("next_source")
-
-    generateExpressionCode(
-        expression = assign_source.getValue(),
-        to_name    = tmp_name,
-        emit       = emit,
-        context    = context
-    )
-
     tmp_name2 = context.allocateTempName("assign_source")
 
     old_source_ref = context.setCurrentSourceCodeReference(
@@ -313,7 +304,7 @@ def generateTryNextExceptStopIterationCode(statement, emit, context):
 
     getBuiltinLoopBreakNextCode(
         to_name = tmp_name2,
-        value   = tmp_name,
+        value   = assign_source.getValue(),
         emit    = emit,
         context = context
     )
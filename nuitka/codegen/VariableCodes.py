@@ -19,15 +19,28 @@
 
 """
 
+from nuitka.nodes.shapes.BuiltinTypeShapes import ShapeTypeFloat, ShapeTypeInt
+from nuitka.optimizations.ValueTraces import ValueTraceLoopMerge
 from nuitka.Options import isExperimental
+from nuitka.PythonVersions import python_version
+from nuitka.tree.Operations import VisitorNoopMixin, visitTree
 
+from .c_types.CTypeCNumbers import CTypeCDouble, CTypeCLong
+from .c_types.CTypeNuitkaRangeIterators import CTypeNuitkaRangeIterator
+from .c_types.CTypeNuitkaUnpackIterators import CTypeNuitkaUnpackIterator
 from .c_types.CTypePyObjectPtrs import (
     CTypeCellObject,
     CTypePyObjectPtr,
     CTypePyObjectPtrPtr
 )
-from .CodeHelpers import generateExpressionCode
-from .ErrorCodes import getCheckObjectCode, getNameReferenceErrorCode
+from .CodeHelpers import generateChildExpressionsCode, generateExpressionCode
+from .ErrorCodes import (
+    getCheckObjectCode,
+    getErrorExitBoolCode,
+    getNameReferenceErrorCode,
+    getReleaseCode,
+    getReleaseCodes
+)
 from .templates.CodeTemplatesVariables import (
     template_del_global_unclear,
     template_read_mvar_unclear
@@ -35,6 +48,60 @@ from .templates.CodeTemplatesVariables import (
 
 
 def generateAssignmentVariableCode(statement, emit, context):
+    variable = statement.getVariable()
+
+    if variable.isTempVariable():
+        variable_code_name, variable_c_type = getLocalVariableCodeType(
+            context  = context,
+            variable = variable,
+            version  = statement.getVariableVersion()
+        )
+
+        if variable_c_type is CTypeNuitkaRangeIterator:
+            _generateRangeIteratorAssignmentCode(
+                statement          = statement,
+                variable_code_name = variable_code_name,
+                emit               = emit,
+                context            = context
+            )
+
+            return
+        elif variable_c_type is CTypeNuitkaUnpackIterator:
+            _generateUnpackIteratorAssignmentCode(
+                statement          = statement,
+                variable_code_name = variable_code_name,
+                emit               = emit,
+                context            = context
+            )
+
+            return
+
+    if enable_c_number_ctypes and variable.isLocalVariable():
+        variable_code_name, variable_c_type = getLocalVariableCodeType(
+            context  = context,
+            variable = variable,
+            version  = statement.getVariableVersion()
+        )
+
+        if variable_c_type in (CTypeCLong, CTypeCDouble):
+            value_name = _getCNumberValueCode(
+                expression = statement.getAssignSource(),
+                c_type     = variable_c_type,
+                emit       = emit,
+                context    = context
+            )
+
+            context.setVariableType(variable, variable_code_name, variable_c_type)
+
+            emit(
+                variable_c_type.getLocalVariableValueAssignCode(
+                    variable_code_name = variable_code_name,
+                    value_name         = value_name
+                )
+            )
+
+            return
+
     tmp_name = context.allocateTempName("assign_source")
 
     generateExpressionCode(
@@ -80,7 +147,8 @@ def generateDelVariableCode(statement, emit, context):
 def generateVariableReleaseCode(statement, emit, context):
     variable = statement.getVariable()
 
-    if variable.isSharedTechnically():
+    if variable.isSharedTechnically() and \
+       not isClosureTakenByValue(variable):
         # TODO: We might start to not allocate the cell object, then a check
         # would be due. But currently we always allocate it.
         needs_check = False
@@ -119,6 +187,620 @@ def getVariableCodeName(in_context, variable):
         return "var_" + variable.getCodeName()
 
 enable_bool_ctype = isExperimental("enable_bool_ctype")
+enable_c_number_ctypes = isExperimental("enable_c_number_ctypes")
+
+
+class _LocalsUsageVisitor(VisitorNoopMixin):
+    def __init__(self):
+        self.uses_locals = False
+
+    def onEnterNode(self, node):
+        if node.kind.startswith("EXPRESSION_BUILTIN_LOCALS"):
+            self.uses_locals = True
+
+
+def _isCNumberExpression(expression, c_type, variables):
+    if expression.isExpressionVariableRef():
+        return expression.getVariable() in variables
+
+    if expression.isExpressionOperationBinary() and \
+       expression.getOperator() in c_type.native_operators:
+        left = expression.getLeft()
+        right = expression.getRight()
+
+        # Integer constants only go with an operand of the type.
+        if left.isCompileTimeConstant() and \
+           c_type.getConstantValueCode(left.getCompileTimeConstant()) is not None:
+            return _isCNumberExpression(right, c_type, variables)
+        if right.isCompileTimeConstant() and \
+           c_type.getConstantValueCode(right.getCompileTimeConstant()) is not None:
+            return _isCNumberExpression(left, c_type, variables)
+
+        return _isCNumberExpression(left, c_type, variables) and \
+               _isCNumberExpression(right, c_type, variables)
+
+    if c_type is CTypeCDouble:
+        return expression.getTypeShape() is ShapeTypeFloat
+    else:
+        return expression.getTypeShape() is ShapeTypeInt
+
+
+def _hasCNumberTraces(variable, c_type, variables):
+    for trace in variable.traces:
+        if trace.isAssignTrace():
+            assign_source = trace.getAssignNode().getAssignSource()
+
+            if not _isCNumberExpression(assign_source, c_type, variables):
+                return False
+        elif trace.isUninitTrace() or trace.isMergeTrace():
+            pass
+        elif trace.isUnknownTrace() and trace.previous is not None:
+            # Escaping control flow cannot change variables that are not
+            # shared, the value is still the one of the previous trace.
+            pass
+        else:
+            return False
+
+    return True
+
+
+_c_number_variables = {}
+
+def _getCNumberVariables(owner):
+    """ Local variables of a function that only get values of C number types.
+
+    The values must come from expressions of the shape, from operations with
+    native C implementation, or from variables of the same kind, which makes
+    it a fixed point over the candidate variables.
+    """
+
+    if owner in _c_number_variables:
+        return _c_number_variables[owner]
+
+    result = {}
+
+    candidates = [
+        variable
+        for variable in
+        owner.getVariables()
+        if variable.isLocalVariable()
+        if not variable.isParameterVariable()
+        if not variable.isSharedTechnically()
+        if variable.getOwner() is owner
+    ]
+
+    # Values of "locals()" are read as objects without references, and "exec"
+    # code writes to the variables as objects.
+    if candidates and owner.isExpressionFunctionBody() and \
+       not owner.isUnoptimized():
+        visitor = _LocalsUsageVisitor()
+        visitTree(owner, visitor)
+
+        if visitor.uses_locals:
+            candidates = []
+    else:
+        candidates = []
+
+    # For Python3, "int" is unbounded, so there is no C type for it.
+    if python_version < 300:
+        c_types = (CTypeCLong, CTypeCDouble)
+    else:
+        c_types = (CTypeCDouble,)
+
+    for c_type in c_types:
+        variables = set(candidates)
+
+        changed = True
+        while changed:
+            changed = False
+
+            for variable in tuple(variables):
+                if not _hasCNumberTraces(variable, c_type, variables):
+                    variables.remove(variable)
+                    changed = True
+
+        for variable in variables:
+            result[variable] = c_type
+
+    _c_number_variables[owner] = result
+
+    return result
+
+
+def _getCNumberValueCode(expression, c_type, emit, context):
+    """ Get the C value of an expression into a temporary variable.
+
+    Proven variable values and operations are used natively, for all other
+    expressions the object is created and the value taken from it.
+    """
+
+    old_source_ref = context.setCurrentSourceCodeReference(
+        expression.getSourceReference()
+    )
+
+    value_name = _getCNumberValueCodeNoRef(expression, c_type, emit, context)
+
+    context.setCurrentSourceCodeReference(old_source_ref)
+
+    return value_name
+
+
+def _getCNumberValueCodeNoRef(expression, c_type, emit, context):
+    value_name = context.allocateTempName(
+        base_name = "%s_value" % c_type.c_value_type,
+        type_name = c_type.c_value_type
+    )
+
+    if expression.isExpressionVariableRef() and \
+       expression.getVariable().isLocalVariable():
+        variable = expression.getVariable()
+
+        variable_code_name, variable_c_type = getLocalVariableCodeType(
+            context  = context,
+            variable = variable,
+            version  = expression.getVariableVersion()
+        )
+
+        if variable_c_type is c_type:
+            c_type.getVariableValueAccessCode(
+                to_name            = value_name,
+                needs_check        = expression.mayRaiseException(BaseException),
+                variable_code_name = variable_code_name,
+                variable           = variable,
+                emit               = emit,
+                context            = context
+            )
+
+            return value_name
+
+    if expression.isCompileTimeConstant():
+        constant_code = c_type.getConstantValueCode(
+            expression.getCompileTimeConstant()
+        )
+
+        if constant_code is not None:
+            emit(
+                "%s = %s;" % (
+                    value_name,
+                    constant_code
+                )
+            )
+
+            return value_name
+
+    if expression.isExpressionOperationBinary() and \
+       expression.getOperator() in c_type.native_operators:
+        left_name = _getCNumberValueCode(
+            expression = expression.getLeft(),
+            c_type     = c_type,
+            emit       = emit,
+            context    = context
+        )
+        right_name = _getCNumberValueCode(
+            expression = expression.getRight(),
+            c_type     = c_type,
+            emit       = emit,
+            context    = context
+        )
+
+        c_type.getOperationValueCode(
+            to_name    = value_name,
+            operator   = expression.getOperator(),
+            left_name  = left_name,
+            right_name = right_name,
+            emit       = emit,
+            context    = context
+        )
+
+        return value_name
+
+    object_name = context.allocateTempName("%s_object" % c_type.c_value_type)
+
+    generateExpressionCode(
+        expression = expression,
+        to_name    = object_name,
+        emit       = emit,
+        context    = context
+    )
+
+    c_type.getValueFromObjectCode(
+        to_name     = value_name,
+        object_name = object_name,
+        emit        = emit,
+        context     = context
+    )
+
+    return value_name
+
+
+def getCLongValueCode(expression, emit, context):
+    """ Get the C value of a reference to a local variable of C long type.
+
+    For other expressions, nothing is done and None is returned, they need
+    the object.
+    """
+
+    if not expression.isExpressionVariableRef() or \
+       not expression.getVariable().isLocalVariable():
+        return None
+
+    _variable_code_name, variable_c_type = getLocalVariableCodeType(
+        context  = context,
+        variable = expression.getVariable(),
+        version  = expression.getVariableVersion()
+    )
+
+    if variable_c_type is not CTypeCLong:
+        return None
+
+    return _getCNumberValueCode(
+        expression = expression,
+        c_type     = CTypeCLong,
+        emit       = emit,
+        context    = context
+    )
+
+
+_range_kinds = frozenset(
+    (
+        "EXPRESSION_BUILTIN_RANGE1",
+        "EXPRESSION_BUILTIN_RANGE2",
+        "EXPRESSION_BUILTIN_RANGE3",
+        "EXPRESSION_BUILTIN_XRANGE1",
+        "EXPRESSION_BUILTIN_XRANGE2",
+        "EXPRESSION_BUILTIN_XRANGE3",
+        "EXPRESSION_CONSTANT_XRANGE_REF"
+    )
+)
+
+
+class _RangeIteratorVisitor(VisitorNoopMixin):
+    def __init__(self):
+        self.candidates = set()
+        self.excluded = set()
+
+    def onEnterNode(self, node):
+        if node.isStatementAssignmentVariable():
+            variable = node.getVariable()
+
+            if variable.isTempVariable():
+                assign_source = node.getAssignSource()
+
+                # Iterators given to generator expressions and contractions
+                # are used outside, and must remain objects.
+                if assign_source.isExpressionBuiltinIter1() and \
+                   assign_source.getValue().kind in _range_kinds and \
+                   variable.hasAccessesOutsideOf(variable.getOwner()) is False:
+                    self.candidates.add(variable)
+                else:
+                    self.excluded.add(variable)
+        elif node.isStatementDelVariable():
+            self.excluded.add(node.getVariable())
+        elif node.isExpressionTempVariableRef():
+            if not node.getParent().isExpressionBuiltinNext1():
+                self.excluded.add(node.getVariable())
+
+
+_range_iterator_variables = {}
+
+def _getRangeIteratorVariables(entry_point):
+    """ Temporary variables that are only iterators over "range" values.
+
+    These are created by "for" loops over "range" and "xrange" calls, and
+    only used to get the next value, so they can count with C values.
+    """
+
+    if entry_point not in _range_iterator_variables:
+        visitor = _RangeIteratorVisitor()
+        visitTree(entry_point, visitor)
+
+        _range_iterator_variables[entry_point] = visitor.candidates - visitor.excluded
+
+    return _range_iterator_variables[entry_point]
+
+
+class _UnpackIteratorVisitor(VisitorNoopMixin):
+    def __init__(self):
+        self.candidates = set()
+        self.excluded = set()
+
+    def onEnterNode(self, node):
+        if node.isStatementAssignmentVariable():
+            variable = node.getVariable()
+
+            if variable.isTempVariable():
+                if node.getAssignSource().isExpressionBuiltinIter1() and \
+                   variable.hasAccessesOutsideOf(variable.getOwner()) is False:
+                    self.candidates.add(variable)
+                else:
+                    self.excluded.add(variable)
+        elif node.isStatementDelVariable():
+            self.excluded.add(node.getVariable())
+        elif node.isExpressionTempVariableRef():
+            parent = node.getParent()
+
+            if not parent.isExpressionSpecialUnpack() and \
+               not parent.isStatementSpecialUnpackCheck():
+                self.excluded.add(node.getVariable())
+
+
+_unpack_iterator_variables = {}
+
+def _getUnpackIteratorVariables(entry_point):
+    """ Temporary variables that are only iterators for unpacking.
+
+    These are created by assignments like "a, b = value", and only used to
+    get the values and check that there are no more, which can be done
+    without an iterator object for "tuple" and "list" values.
+    """
+
+    if entry_point not in _unpack_iterator_variables:
+        visitor = _UnpackIteratorVisitor()
+        visitTree(entry_point, visitor)
+
+        _unpack_iterator_variables[entry_point] = visitor.candidates - visitor.excluded
+
+    return _unpack_iterator_variables[entry_point]
+
+
+def _getConstantRangeArgs(constant):
+    if python_version >= 300:
+        return constant.start, constant.stop, constant.step
+
+    # Python2 "xrange" objects have no attributes for their arguments.
+    if len(constant) == 0:
+        return 0, 0, 1
+
+    step = constant[1] - constant[0] if len(constant) > 1 else 1
+
+    return constant[0], constant[0] + len(constant) * step, step
+
+
+def _generateRangeIteratorAssignmentCode(statement, variable_code_name,
+                                         emit, context):
+    range_node = statement.getAssignSource().getValue()
+
+    if range_node.isExpressionConstantXrangeRef():
+        arg_names = [
+            context.getConstantCode(value)
+            for value in
+            _getConstantRangeArgs(range_node.getConstant())
+        ]
+        release_names = ()
+    else:
+        arg_names = generateChildExpressionsCode(
+            expression = range_node,
+            emit       = emit,
+            context    = context
+        )
+        release_names = arg_names
+
+    if len(arg_names) == 1:
+        low_name, high_name, step_name = None, arg_names[0], None
+    elif len(arg_names) == 2:
+        (low_name, high_name), step_name = arg_names, None
+    else:
+        low_name, high_name, step_name = arg_names
+
+    if statement.needsReleasePreviousValue() is not False:
+        CTypeNuitkaRangeIterator.getReleaseCode(
+            variable_code_name = variable_code_name,
+            needs_check        = True,
+            emit               = emit
+        )
+
+    res_name = context.getBoolResName()
+
+    old_source_ref = context.setCurrentSourceCodeReference(
+        range_node.getCompatibleSourceReference()
+    )
+
+    emit(
+        "%s = %s;" % (
+            res_name,
+            CTypeNuitkaRangeIterator.getRangeIteratorMakeCode(
+                variable_code_name = variable_code_name,
+                low_name           = low_name,
+                high_name          = high_name,
+                step_name          = step_name,
+                is_xrange          = not range_node.kind.startswith(
+                    "EXPRESSION_BUILTIN_RANGE"
+                )
+            )
+        )
+    )
+
+    getReleaseCodes(
+        release_names = release_names,
+        emit          = emit,
+        context       = context
+    )
+
+    getErrorExitBoolCode(
+        condition = "%s == false" % res_name,
+        emit      = emit,
+        context   = context
+    )
+
+    context.setCurrentSourceCodeReference(old_source_ref)
+
+
+def _generateUnpackIteratorAssignmentCode(statement, variable_code_name,
+                                          emit, context):
+    iter_node = statement.getAssignSource()
+
+    value_name, = generateChildExpressionsCode(
+        expression = iter_node,
+        emit       = emit,
+        context    = context
+    )
+
+    if statement.needsReleasePreviousValue() is not False:
+        CTypeNuitkaUnpackIterator.getReleaseCode(
+            variable_code_name = variable_code_name,
+            needs_check        = True,
+            emit               = emit
+        )
+
+    res_name = context.getBoolResName()
+
+    old_source_ref = context.setCurrentSourceCodeReference(
+        iter_node.getCompatibleSourceReference()
+    )
+
+    emit(
+        "%s = %s;" % (
+            res_name,
+            CTypeNuitkaUnpackIterator.getUnpackIteratorMakeCode(
+                variable_code_name = variable_code_name,
+                value_name         = value_name
+            )
+        )
+    )
+
+    getReleaseCode(
+        release_name = value_name,
+        emit         = emit,
+        context      = context
+    )
+
+    getErrorExitBoolCode(
+        condition = "%s == false" % res_name,
+        emit      = emit,
+        context   = context
+    )
+
+    context.setCurrentSourceCodeReference(old_source_ref)
+
+
+def getRangeIteratorVariableCode(expression, context):
+    """ Code name of a range iterator variable, if the expression reads one. """
+
+    if expression.isExpressionTempVariableRef():
+        variable_code_name, variable_c_type = getLocalVariableCodeType(
+            context  = context,
+            variable = expression.getVariable(),
+            version  = expression.getVariableVersion()
+        )
+
+        if variable_c_type is CTypeNuitkaRangeIterator:
+            return variable_code_name
+
+    return None
+
+
+def getUnpackIteratorVariableCode(expression, context):
+    """ Code name of an unpack iterator variable, if the expression reads one. """
+
+    if expression.isExpressionTempVariableRef():
+        variable_code_name, variable_c_type = getLocalVariableCodeType(
+            context  = context,
+            variable = expression.getVariable(),
+            version  = expression.getVariableVersion()
+        )
+
+        if variable_c_type is CTypeNuitkaUnpackIterator:
+            return variable_code_name
+
+    return None
+
+
+def _getClosureScope(function):
+    """ Get the function whose closure or locals provide variables.
+
+    Functions that are only directly called, and class bodies, use the
+    variables of their provider, so these are skipped.
+    """
+
+    function = function.getEntryPoint()
+
+    while (function.isExpressionFunctionBody() and not function.needsCreation()) or \
+          function.isExpressionClassBody():
+        function = function.getParentVariableProvider().getEntryPoint()
+
+    return function
+
+
+def _isAssignedTrace(trace):
+    # Unknown traces of the owner only result from escapes, which cannot
+    # write the variable, as it has only one write.
+    while trace.isUnknownTrace():
+        trace = trace.getPrevious()
+
+        if trace is None:
+            return False
+
+    if trace.isAssignTrace() or trace.isInitTrace():
+        return True
+
+    if trace.isMergeTrace():
+        return all(
+            _isAssignedTrace(previous)
+            for previous in
+            trace.getPrevious()
+        )
+
+    return False
+
+
+def _isClosureTakenByValue(variable):
+    if not variable.isLocalVariable() or not variable.isSharedTechnically():
+        return False
+
+    owner = variable.getEntryPoint()
+
+    if owner.isUnoptimized():
+        return False
+
+    writes = 0
+
+    for trace in variable.traces:
+        if trace.isAssignTrace():
+            writes += 1
+        elif trace.isInitTrace():
+            if trace.getOwner().getEntryPoint() is owner:
+                writes += 1
+        elif trace.isUninitTrace():
+            if trace.getPrevious() is not None:
+                return False
+        elif isinstance(trace, ValueTraceLoopMerge):
+            return False
+
+    if writes != 1:
+        return False
+
+    for trace in variable.traces:
+        if not trace.closure_usages:
+            continue
+
+        user = trace.getOwner().getEntryPoint()
+
+        if user is owner:
+            if not _isAssignedTrace(trace):
+                return False
+        elif _getClosureScope(user) is owner:
+            # Directly called functions may take closures at any time.
+            return False
+
+    return True
+
+
+_closure_value_variables = {}
+
+def isClosureTakenByValue(variable):
+    """ Decide if closures take the value of a variable instead of its cell.
+
+    For variables assigned exactly once, and never deleted, with all closures
+    taken after the assignment, the value cannot change anymore. Then the owner
+    needs no cell, and closures can use cells of their own, inlined into the
+    object taking the closure.
+    """
+
+    if variable not in _closure_value_variables:
+        _closure_value_variables[variable] = _isClosureTakenByValue(variable)
+
+    return _closure_value_variables[variable]
+
 
 def getPickedCType(variable, version, context):
     """ Return type to use for specific context. """
@@ -127,9 +809,25 @@ def getPickedCType(variable, version, context):
     owner = variable.getEntryPoint()
 
     if owner is user:
-        if variable.isSharedTechnically():
+        if isClosureTakenByValue(variable):
+            result = CTypePyObjectPtr
+        elif variable.isSharedTechnically():
             result = CTypeCellObject
         else:
+            if variable.isTempVariable() and \
+               variable in _getRangeIteratorVariables(owner):
+                return CTypeNuitkaRangeIterator
+
+            if variable.isTempVariable() and \
+               variable in _getUnpackIteratorVariables(owner):
+                return CTypeNuitkaUnpackIterator
+
+            if enable_c_number_ctypes:
+                c_number_variables = _getCNumberVariables(variable.getOwner())
+
+                if variable in c_number_variables:
+                    return c_number_variables[variable]
+
             if enable_bool_ctype:
                 shapes = variable.getTypeShapes()
 
@@ -143,7 +841,13 @@ def getPickedCType(variable, version, context):
             else:
                 return CTypePyObjectPtr
     elif context.isForDirectCall():
-        if variable.isSharedTechnically():
+        if isClosureTakenByValue(variable):
+            # Directly called from the owner, or from inside a closure.
+            if _getClosureScope(user) is owner:
+                result = CTypePyObjectPtrPtr
+            else:
+                result = CTypeCellObject
+        elif variable.isSharedTechnically():
             result = CTypeCellObject
         else:
             result = CTypePyObjectPtrPtr
@@ -153,6 +857,29 @@ def getPickedCType(variable, version, context):
     return result
 
 
+def _getClosureCellCode(user, object_name, variable):
+    closure_index = user.getClosureVariableIndex(variable)
+
+    if isClosureTakenByValue(variable):
+        # Inline cells are at a fixed offset, no need to load their pointer.
+        closure_variables = user.getClosureVariables()
+
+        return "NUITKA_INLINE_CELL( %s->m_closure, %d, %d )" % (
+            object_name,
+            len(closure_variables),
+            len(
+                [
+                    closure_variable
+                    for closure_variable in
+                    closure_variables[:closure_index]
+                    if isClosureTakenByValue(closure_variable)
+                ]
+            )
+        )
+
+    return "%s->m_closure[%d]" % (object_name, closure_index)
+
+
 def getLocalVariableCodeType(context, variable, version):
     # Now must be local or temporary variable.
 
@@ -181,17 +908,11 @@ def getLocalVariableCodeType(context, variable, version):
     elif context.isForDirectCall():
 
         if user.isExpressionGeneratorObjectBody():
-            closure_index = user.getClosureVariableIndex(variable)
-
-            result = "generator->m_closure[%d]" % closure_index
+            result = _getClosureCellCode(user, "generator", variable)
         elif user.isExpressionCoroutineObjectBody():
-            closure_index = user.getClosureVariableIndex(variable)
-
-            result = "coroutine->m_closure[%d]" % closure_index
+            result = _getClosureCellCode(user, "coroutine", variable)
         elif user.isExpressionAsyncgenObjectBody():
-            closure_index = user.getClosureVariableIndex(variable)
-
-            result = "asyncgen->m_closure[%d]" % closure_index
+            result = _getClosureCellCode(user, "asyncgen", variable)
         else:
             result = getVariableCodeName(
                 in_context = True,
@@ -200,19 +921,17 @@ def getLocalVariableCodeType(context, variable, version):
 
             result = prefix + result
     else:
-        closure_index = user.getClosureVariableIndex(variable)
-
         if user.isExpressionGeneratorObjectBody():
-            result = "generator->m_closure[%d]" % closure_index
+            result = _getClosureCellCode(user, "generator", variable)
         elif user.isExpressionCoroutineObjectBody():
-            result = "coroutine->m_closure[%d]" % closure_index
+            result = _getClosureCellCode(user, "coroutine", variable)
         elif user.isExpressionAsyncgenObjectBody():
-            result = "asyncgen->m_closure[%d]" % closure_index
+            result = _getClosureCellCode(user, "asyncgen", variable)
         else:
             # TODO: If this were context.getContextObjectName() this would be
             # a one liner.
 
-            result = "self->m_closure[%d]" % closure_index
+            result = _getClosureCellCode(user, "self", variable)
 
     return result, c_type
 
@@ -294,7 +1013,8 @@ def generateModuleVariableAccessCode(to_name, variable_name, needs_check,
             "tmp_name"          : to_name,
             "var_name"          : context.getConstantCode(
                 constant = variable_name
-            )
+            ),
+            "cache_name"        : context.allocateModuleVariableCache()
         }
     )
     if needs_check:
@@ -25,6 +25,10 @@ from nuitka import Options
 from .CodeHelpers import generateChildExpressionsCode
 from .ErrorCodes import getErrorExitCode, getReleaseCode
 from .PythonAPICodes import getReferenceExportCode
+from .templates.CodeTemplatesGeneratorFunction import (
+    template_yield_delegation_stackless,
+    template_yield_stackless
+)
 
 
 def generateYieldCode(to_name, expression, emit, context):
@@ -40,35 +44,34 @@ def generateYieldCode(to_name, expression, emit, context):
     # This will produce GENERATOR_YIELD, COROUTINE_YIELD or ASYNCGEN_YIELD.
     getReferenceExportCode(value_name, emit, context)
 
-    if Options.isExperimental("generator_goto"):
-        yield_return_label = context.allocateLabel("yield_return")
-        yield_return_index = yield_return_label.split('_')[-1]
+    context_identifier = context.getContextObjectName()
+
+    yield_name = "%s_%s" % (
+        context_identifier.upper(),
+        "YIELD"
+          if not preserve_exception else
+        "YIELD_IN_HANDLER"
+    )
 
+    if not Options.shallUseFiberGenerators():
+        yield_return_label = context.allocateLabel("yield_return")
 
         emit(
-            """
-%(context_object_name)s->m_yield_return_index = %(yield_return_index)s;
-return %(yielded_value)s;
-%(yield_return_label)s:
-%(to_name)s = yield_return_value;
-""" % {
-                "context_object_name" : context.getContextObjectName(),
-                "yield_return_index"  : yield_return_index,
-                "yielded_value"       : value_name,
-                "yield_return_label"  : yield_return_label,
-                "to_name"             : to_name
-    }
+            template_yield_stackless % {
+                "context_identifier" : context_identifier,
+                "yield_return_index" : yield_return_label.split('_')[-1],
+                "yield_return_label" : yield_return_label,
+                "yield_name"         : yield_name,
+                "yielded_value"      : value_name,
+                "to_name"            : to_name
+            }
         )
-
     else:
         emit(
-            "%s = %s_%s( %s, %s );" % (
+            "%s = %s( %s, %s );" % (
                 to_name,
-                context.getContextObjectName().upper(),
-                "YIELD"
-                  if not preserve_exception else
-                "YIELD_IN_HANDLER",
-                context.getContextObjectName(),
+                yield_name,
+                context_identifier,
                 value_name
             )
         )
@@ -86,6 +89,42 @@ return %(yielded_value)s;
     # context.addCleanupTempName(to_name)
 
 
+def getYieldDelegationCode(to_name, start_name, step_name, value_name, emit,
+                           context):
+    """ Delegate to an iterator, for "yield from" and "await" alike.
+
+    With fibers, this is a single call that switches back for every value
+    yielded. Stackless code instead returns every value to the caller, and
+    continues stepping the delegate when it's resumed at the label.
+    """
+
+    context_identifier = context.getContextObjectName()
+
+    if not Options.shallUseFiberGenerators():
+        yield_return_label = context.allocateLabel("yield_return")
+
+        emit(
+            template_yield_delegation_stackless % {
+                "context_identifier" : context_identifier,
+                "yield_return_index" : yield_return_label.split('_')[-1],
+                "yield_return_label" : yield_return_label,
+                "start_name"         : start_name,
+                "step_name"          : step_name,
+                "value_name"         : value_name,
+                "to_name"            : to_name
+            }
+        )
+    else:
+        emit(
+            "%s = %s( %s, %s );" % (
+                to_name,
+                step_name,
+                context_identifier,
+                value_name
+            )
+        )
+
+
 def generateYieldFromCode(to_name, expression, emit, context):
     value_name, = generateChildExpressionsCode(
         expression = expression,
@@ -100,16 +139,25 @@ def generateYieldFromCode(to_name, expression, emit, context):
     # ASYNCGEN_YIELD_FROM.
     getReferenceExportCode(value_name, emit, context)
 
-    emit(
-        "%s = %s_%s( %s, %s );" % (
-            to_name,
-            context.getContextObjectName().upper(),
-            "YIELD_FROM"
-              if not preserve_exception else
-            "YIELD_FROM_IN_HANDLER",
-            context.getContextObjectName(),
-            value_name
-        )
+    context_identifier = context.getContextObjectName().upper()
+
+    if not Options.shallUseFiberGenerators():
+        start_name = context_identifier + "_YIELD_FROM_START"
+        step_name = context_identifier + "_YIELD_FROM_STEP"
+    else:
+        start_name = None
+        step_name = context_identifier + "_YIELD_FROM"
+
+    if preserve_exception:
+        step_name += "_IN_HANDLER"
+
+    getYieldDelegationCode(
+        to_name    = to_name,
+        start_name = start_name,
+        step_name  = step_name,
+        value_name = value_name,
+        emit       = emit,
+        context    = context
     )
 
     if not context.needsCleanup(value_name):
@@ -25,7 +25,9 @@ type_indicators = {
     "PyObject *" : 'o',
     "PyObject **" : 'O',
     "struct Nuitka_CellObject *" : 'c',
-    "nuitka_bool" : 'b'
+    "nuitka_bool" : 'b',
+    "nuitka_clong" : 'l',
+    "nuitka_cdouble" : 'd'
 }
 
 class CTypeBase(object):
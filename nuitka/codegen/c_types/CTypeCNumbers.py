@@ -0,0 +1,300 @@
+#     Copyright 2018, Kay Hayen, mailto:kay.hayen@gmail.com
+#
+#     Part of "Nuitka", an optimizing Python compiler that is compatible and
+#     integrates with CPython, but also works on its own.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+""" CType classes for nuitka_clong and nuitka_cdouble, unboxed C numbers.
+
+These hold the C value together with a flag for being assigned. Python objects
+are only created from them, when the value is used as an object.
+"""
+
+import math
+
+from nuitka.codegen.ErrorCodes import (
+    getAssertionCode,
+    getErrorExitCode,
+    getErrorFormatExitBoolCode,
+    getLocalVariableReferenceErrorCode,
+    getReleaseCode
+)
+from nuitka.PythonVersions import python_version
+
+from .CTypeBases import CTypeBase
+
+
+class CTypeCNumberBase(CTypeBase):
+    # For overload, the C type of the value, and the C API to convert from and
+    # to objects.
+    c_value_type = None
+    c_box_function = None
+    c_unbox_function = None
+    c_check_function = None
+
+    # Python operators that have a native C implementation.
+    native_operators = {}
+
+    @classmethod
+    def getInitValue(cls, init_from):
+        if init_from is None:
+            return "{ 0, false }"
+        else:
+            assert False, init_from
+            return init_from
+
+    @classmethod
+    def getLocalVariableInitTestCode(cls, variable_code_name):
+        return "%s.assigned" % variable_code_name
+
+    @classmethod
+    def getLocalVariableAssignCode(cls, variable_code_name, needs_release,
+                                   tmp_name, ref_count, in_place):
+        # No reference is kept, so there is no release of the old value, and
+        # in-place operations are never done on the boxed values.
+        assert not in_place
+
+        result = """\
+assert( %(check_function)s( %(tmp_name)s ) );
+%(variable_code_name)s.value = %(unbox_function)s( %(tmp_name)s );
+%(variable_code_name)s.assigned = true;""" % {
+            "variable_code_name" : variable_code_name,
+            "tmp_name"           : tmp_name,
+            "check_function"     : cls.c_check_function,
+            "unbox_function"     : cls.c_unbox_function
+        }
+
+        if ref_count:
+            result += "\nPy_DECREF( %s );" % tmp_name
+
+        return result
+
+    @classmethod
+    def getLocalVariableValueAssignCode(cls, variable_code_name, value_name):
+        return """\
+%(variable_code_name)s.value = %(value_name)s;
+%(variable_code_name)s.assigned = true;""" % {
+            "variable_code_name" : variable_code_name,
+            "value_name"         : value_name
+        }
+
+    @classmethod
+    def getVariableObjectAccessCode(cls, to_name, needs_check, variable_code_name,
+                                    variable, emit, context):
+        if needs_check:
+            getLocalVariableReferenceErrorCode(
+                variable  = variable,
+                condition = "!%s.assigned" % variable_code_name,
+                emit      = emit,
+                context   = context
+            )
+
+        emit(
+            "%s = %s( %s.value );" % (
+                to_name,
+                cls.c_box_function,
+                variable_code_name
+            )
+        )
+
+        getErrorExitCode(
+            check_name = to_name,
+            emit       = emit,
+            context    = context
+        )
+
+        context.addCleanupTempName(to_name)
+
+    @classmethod
+    def getVariableValueAccessCode(cls, to_name, needs_check, variable_code_name,
+                                   variable, emit, context):
+        if needs_check:
+            getLocalVariableReferenceErrorCode(
+                variable  = variable,
+                condition = "!%s.assigned" % variable_code_name,
+                emit      = emit,
+                context   = context
+            )
+
+        emit(
+            "%s = %s.value;" % (
+                to_name,
+                variable_code_name
+            )
+        )
+
+    @classmethod
+    def getValueFromObjectCode(cls, to_name, object_name, emit, context):
+        emit(
+            """\
+assert( %(check_function)s( %(object_name)s ) );
+%(to_name)s = %(unbox_function)s( %(object_name)s );""" % {
+                "to_name"        : to_name,
+                "object_name"    : object_name,
+                "check_function" : cls.c_check_function,
+                "unbox_function" : cls.c_unbox_function
+            }
+        )
+
+        getReleaseCode(
+            release_name = object_name,
+            emit         = emit,
+            context      = context
+        )
+
+    @classmethod
+    def getConstantValueCode(cls, constant):
+        """ C literal for a constant, None if there is none. """
+
+        # Need to overload this for each type it is used for, pylint: disable=unused-argument
+        assert False, cls.c_type
+
+    @classmethod
+    def getOperationValueCode(cls, to_name, operator, left_name, right_name,
+                              emit, context):
+        # Operation is checked by the caller, pylint: disable=unused-argument
+        emit(
+            "%s = %s %s %s;" % (
+                to_name,
+                left_name,
+                cls.native_operators[operator],
+                right_name
+            )
+        )
+
+    @classmethod
+    def getReleaseCode(cls, variable_code_name, needs_check, emit):
+        # Nothing to release for C values.
+        pass
+
+    @classmethod
+    def getDeleteObjectCode(cls, variable_code_name, needs_check, tolerant,
+                            variable, emit, context):
+        if not needs_check or tolerant:
+            emit(
+                "%s.assigned = false;" % variable_code_name
+            )
+        else:
+            res_name = context.getBoolResName()
+
+            emit(
+                "%s = %s.assigned;" % (
+                    res_name,
+                    variable_code_name,
+                )
+            )
+            emit(
+                "%s.assigned = false;" % variable_code_name
+            )
+
+            if variable.isLocalVariable():
+                getLocalVariableReferenceErrorCode(
+                    variable  = variable,
+                    condition = "%s == false" % res_name,
+                    emit      = emit,
+                    context   = context
+                )
+            else:
+                getAssertionCode(
+                    check = "%s != false" % res_name,
+                    emit  = emit
+                )
+
+
+class CTypeCLong(CTypeCNumberBase):
+    """ C long for Python2 "int" values, which cannot overflow it.
+
+        Arithmetic on these may give "long" values, so there are no native
+        operations for it.
+    """
+
+    c_type = "nuitka_clong"
+    c_value_type = "long"
+
+    if python_version < 300:
+        c_box_function = "PyInt_FromLong"
+        c_unbox_function = "PyInt_AS_LONG"
+        c_check_function = "PyInt_CheckExact"
+
+    @classmethod
+    def getConstantValueCode(cls, constant):
+        # Avoid the ones that do not fit into 32 bits C literals.
+        if type(constant) is int and -2**31 < constant < 2**31:
+            return "%dL" % constant
+        else:
+            return None
+
+
+class CTypeCDouble(CTypeCNumberBase):
+    """ C double for "float" values.
+
+        These are the same as in CPython, so arithmetic can be done natively,
+        only division needs to check for zero.
+    """
+
+    c_type = "nuitka_cdouble"
+    c_value_type = "double"
+
+    c_box_function = "PyFloat_FromDouble"
+    c_unbox_function = "PyFloat_AS_DOUBLE"
+    c_check_function = "PyFloat_Check"
+
+    native_operators = {
+        "Add"      : '+',
+        "Sub"      : '-',
+        "Mult"     : '*',
+        "TrueDiv"  : '/',
+        "IAdd"     : '+',
+        "ISub"     : '-',
+        "IMult"    : '*',
+        "ITrueDiv" : '/',
+    }
+
+    if python_version < 300:
+        native_operators["Div"] = '/'
+        native_operators["IDiv"] = '/'
+
+    @classmethod
+    def getConstantValueCode(cls, constant):
+        # Integer constants are only used with a float operand, and are then
+        # converted to float without loss.
+        if type(constant) is int and -2**53 < constant < 2**53:
+            constant = float(constant)
+
+        if type(constant) is float and \
+           not math.isinf(constant) and not math.isnan(constant):
+            return "(%r)" % constant
+        else:
+            return None
+
+    @classmethod
+    def getOperationValueCode(cls, to_name, operator, left_name, right_name,
+                              emit, context):
+        if cls.native_operators[operator] == '/':
+            getErrorFormatExitBoolCode(
+                condition = "%s == 0.0" % right_name,
+                exception = "PyExc_ZeroDivisionError",
+                args      = ("float division by zero",),
+                emit      = emit,
+                context   = context
+            )
+
+        super(CTypeCDouble, cls).getOperationValueCode(
+            to_name    = to_name,
+            operator   = operator,
+            left_name  = left_name,
+            right_name = right_name,
+            emit       = emit,
+            context    = context
+        )
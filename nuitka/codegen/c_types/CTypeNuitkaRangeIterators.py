@@ -0,0 +1,61 @@
+#     Copyright 2018, Kay Hayen, mailto:kay.hayen@gmail.com
+#
+#     Part of "Nuitka", an optimizing Python compiler that is compatible and
+#     integrates with CPython, but also works on its own.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+""" CType class for nuitka_range_iterator, loops over "range" without objects.
+
+This is used for the iterator of "for" loops over "range" and "xrange" calls.
+The values are counted in a C long, and only the values produced are objects.
+"""
+
+from .CTypeBases import CTypeBase
+
+
+class CTypeNuitkaRangeIterator(CTypeBase):
+    c_type = "nuitka_range_iterator"
+
+    @classmethod
+    def getInitValue(cls, init_from):
+        assert init_from is None
+
+        return "{ NULL, 0, 0, 0 }"
+
+    @classmethod
+    def getRangeIteratorMakeCode(cls, variable_code_name, low_name, high_name,
+                                 step_name, is_xrange):
+        return "MAKE_RANGE_ITERATOR( &%s, %s, %s, %s, %s )" % (
+            variable_code_name,
+            low_name or "NULL",
+            high_name,
+            step_name or "NULL",
+            "true" if is_xrange else "false"
+        )
+
+    @classmethod
+    def getIteratorNextCode(cls, variable_code_name):
+        return "RANGE_ITERATOR_NEXT( &%s )" % variable_code_name
+
+    @classmethod
+    def getReleaseCode(cls, variable_code_name, needs_check, emit):
+        # The iterator object is only there, if the values were not suitable
+        # for counting, pylint: disable=unused-argument
+        emit(
+            """\
+Py_XDECREF( %(variable_code_name)s.iterator );
+%(variable_code_name)s.iterator = NULL;""" % {
+                "variable_code_name" : variable_code_name
+            }
+        )
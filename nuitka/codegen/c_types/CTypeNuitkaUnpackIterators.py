@@ -0,0 +1,70 @@
+#     Copyright 2018, Kay Hayen, mailto:kay.hayen@gmail.com
+#
+#     Part of "Nuitka", an optimizing Python compiler that is compatible and
+#     integrates with CPython, but also works on its own.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+""" CType class for nuitka_unpack_iterator, unpacking without iterator objects.
+
+This is used for the iterator of tuple unpacking assignments. Exact "tuple"
+and "list" values have their items read directly, other values get the
+iterator object.
+"""
+
+from .CTypeBases import CTypeBase
+
+
+class CTypeNuitkaUnpackIterator(CTypeBase):
+    c_type = "nuitka_unpack_iterator"
+
+    @classmethod
+    def getInitValue(cls, init_from):
+        assert init_from is None
+
+        return "{ NULL, NULL }"
+
+    @classmethod
+    def getUnpackIteratorMakeCode(cls, variable_code_name, value_name):
+        return "MAKE_UNPACK_ITERATOR( &%s, %s )" % (
+            variable_code_name,
+            value_name
+        )
+
+    @classmethod
+    def getUnpackNextCode(cls, variable_code_name, count, expected):
+        return "UNPACK_ITERATOR_NEXT( &%s, %d, %d )" % (
+            variable_code_name,
+            count - 1,
+            expected
+        )
+
+    @classmethod
+    def getUnpackCheckCode(cls, variable_code_name, count):
+        return "UNPACK_ITERATOR_CHECK_REMAINING( &%s, %d )" % (
+            variable_code_name,
+            count
+        )
+
+    @classmethod
+    def getReleaseCode(cls, variable_code_name, needs_check, emit):
+        # Only one of these is set, pylint: disable=unused-argument
+        emit(
+            """\
+Py_XDECREF( %(variable_code_name)s.iterator );
+%(variable_code_name)s.iterator = NULL;
+Py_XDECREF( %(variable_code_name)s.sequence );
+%(variable_code_name)s.sequence = NULL;""" % {
+                "variable_code_name" : variable_code_name
+            }
+        )
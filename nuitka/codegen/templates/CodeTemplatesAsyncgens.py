@@ -20,11 +20,19 @@
 """
 
 template_asyncgen_object_decl_template = """\
+#if _NUITKA_STACKLESS_GENERATORS
+static PyObject *%(function_identifier)s( struct Nuitka_AsyncgenObject *asyncgen, PyObject *yield_return_value );
+#else
 static void %(function_identifier)s( struct Nuitka_AsyncgenObject *asyncgen );
+#endif
 """
 
 template_asyncgen_object_body_template = """
+#if _NUITKA_STACKLESS_GENERATORS
+static PyObject *%(function_identifier)s( struct Nuitka_AsyncgenObject *asyncgen, PyObject *yield_return_value )
+#else
 static void %(function_identifier)s( struct Nuitka_AsyncgenObject *asyncgen )
+#endif
 {
     CHECK_OBJECT( (PyObject *)asyncgen );
     assert( Nuitka_Asyncgen_Check( (PyObject *)asyncgen ) );
@@ -47,8 +55,12 @@ template_asyncgen_exception_exit = """\
 %(function_cleanup)s\
     assert( exception_type );
     RESTORE_ERROR_OCCURRED( exception_type, exception_value, exception_tb );
+#if _NUITKA_STACKLESS_GENERATORS
+    return NULL;
+#else
     asyncgen->m_yielded = NULL;
     return;
+#endif
 """
 
 template_asyncgen_noexception_exit = """\
@@ -56,15 +68,23 @@ template_asyncgen_noexception_exit = """\
     NUITKA_CANNOT_GET_HERE( %(function_identifier)s );
 
 %(function_cleanup)s\
+#if _NUITKA_STACKLESS_GENERATORS
+    return NULL;
+#else
     asyncgen->m_yielded = NULL;
     return;
+#endif
 """
 
 template_asyncgen_return_exit = """\
     function_return_exit:;
-    asyncgen->m_yielded = NULL;
     asyncgen->m_status = status_Finished;
+#if _NUITKA_STACKLESS_GENERATORS
+    return NULL;
+#else
+    asyncgen->m_yielded = NULL;
     return;
+#endif
 """
 
 
@@ -74,7 +94,13 @@ template_make_asyncgen_template = """
     %(asyncgen_name_obj)s,
     %(asyncgen_qualname_obj)s,
     %(code_identifier)s,
-    %(closure_count)d
+    %(closure_count)d,
+    %(closure_inline)d,
+#if _NUITKA_STACKLESS_GENERATORS
+    sizeof(struct %(asyncgen_identifier)s_locals)
+#else
+    0
+#endif
 );
 %(closure_copy)s
 """
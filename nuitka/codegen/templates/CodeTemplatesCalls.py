@@ -43,53 +43,12 @@ PyObject *CALL_FUNCTION_WITH_ARGS%(args_count)d( PyObject *called, PyObject **ar
             return NULL;
         }
 
-        struct Nuitka_FunctionObject *function = (struct Nuitka_FunctionObject *)called;
-        PyObject *result;
-
-        if ( function->m_args_simple && %(args_count)d == function->m_args_positional_count )
-        {
-            for( Py_ssize_t i = 0; i < %(args_count)d; i++ )
-            {
-                Py_INCREF( args[ i ] );
-            }
-
-            result = function->m_c_code( function, args );
-        }
-        else if ( function->m_args_simple && %(args_count)d + function->m_defaults_given == function->m_args_positional_count )
-        {
-#ifdef _MSC_VER
-            PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_positional_count );
-#else
-            PyObject *python_pars[ function->m_args_positional_count ];
-#endif
-            memcpy( python_pars, args, %(args_count)d * sizeof(PyObject *) );
-            memcpy( python_pars + %(args_count)d, &PyTuple_GET_ITEM( function->m_defaults, 0 ), function->m_defaults_given * sizeof(PyObject *) );
-
-            for( Py_ssize_t i = 0; i < function->m_args_positional_count; i++ )
-            {
-                Py_INCREF( python_pars[ i ] );
-            }
-
-            result = function->m_c_code( function, python_pars );
-        }
-        else
-        {
-#ifdef _MSC_VER
-            PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
-#else
-            PyObject *python_pars[ function->m_args_overall_count ];
-#endif
-            memset( python_pars, 0, function->m_args_overall_count * sizeof(PyObject *) );
-
-            if ( parseArgumentsPos( function, python_pars, args, %(args_count)d ))
-            {
-                result = function->m_c_code( function, python_pars );
-            }
-            else
-            {
-                result = NULL;
-            }
-        }
+        PyObject *result = Nuitka_CallFunctionVectorcall(
+            (struct Nuitka_FunctionObject *)called,
+            args,
+            %(args_count)d,
+            NULL
+        );
 
         Py_LeaveRecursiveCall();
 
@@ -107,66 +66,13 @@ PyObject *CALL_FUNCTION_WITH_ARGS%(args_count)d( PyObject *called, PyObject **ar
                 return NULL;
             }
 
-            struct Nuitka_FunctionObject *function = method->m_function;
-
-            PyObject *result;
-
-            if ( function->m_args_simple && %(args_count)d + 1 == function->m_args_positional_count )
-            {
-#ifdef _MSC_VER
-                PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_positional_count );
-#else
-                PyObject *python_pars[ function->m_args_positional_count ];
-#endif
-                python_pars[ 0 ] = method->m_object;
-                Py_INCREF( method->m_object );
-
-                for( Py_ssize_t i = 0; i < %(args_count)d; i++ )
-                {
-                    python_pars[ i + 1 ] = args[ i ];
-                    Py_INCREF( args[ i ] );
-                }
-
-                result = function->m_c_code( function, python_pars );
-            }
-            else if ( function->m_args_simple && %(args_count)d + 1 + function->m_defaults_given == function->m_args_positional_count )
-            {
-#ifdef _MSC_VER
-                PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_positional_count );
-#else
-                PyObject *python_pars[ function->m_args_positional_count ];
-#endif
-                python_pars[ 0 ] = method->m_object;
-                Py_INCREF( method->m_object );
-
-                memcpy( python_pars+1, args, %(args_count)d * sizeof(PyObject *) );
-                memcpy( python_pars+1 + %(args_count)d, &PyTuple_GET_ITEM( function->m_defaults, 0 ), function->m_defaults_given * sizeof(PyObject *) );
-
-                for( Py_ssize_t i = 1; i < function->m_args_overall_count; i++ )
-                {
-                    Py_INCREF( python_pars[ i ] );
-                }
-
-                result = function->m_c_code( function, python_pars );
-            }
-            else
-            {
-#ifdef _MSC_VER
-                PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
-#else
-                PyObject *python_pars[ function->m_args_overall_count ];
-#endif
-                memset( python_pars, 0, function->m_args_overall_count * sizeof(PyObject *) );
-
-                if ( parseArgumentsMethodPos( function, python_pars, method->m_object, args, %(args_count)d ) )
-                {
-                    result = function->m_c_code( function, python_pars );
-                }
-                else
-                {
-                    result = NULL;
-                }
-            }
+            PyObject *result = Nuitka_CallMethodFunctionVectorcall(
+                method->m_function,
+                method->m_object,
+                args,
+                %(args_count)d,
+                NULL
+            );
 
             Py_LeaveRecursiveCall();
 
@@ -501,6 +407,24 @@ PyObject *CALL_METHOD_WITH_ARGS%(args_count)d( PyObject *source, PyObject *attr_
 
                 return result;
             }
+            else if ( func == PyFunction_Type.tp_descr_get )
+            {
+                // Plain functions take the object as first argument, no need
+                // to create a bound method for that.
+                PyObject *method_args[ %(args_count)d + 1 ];
+                method_args[ 0 ] = source;
+                memcpy( method_args + 1, args, %(args_count)d * sizeof( PyObject * ) );
+
+                PyObject *result = callPythonFunction(
+                    descr,
+                    method_args,
+                    %(args_count)d + 1
+                );
+
+                Py_DECREF( descr );
+
+                return result;
+            }
             else
             {
                 PyObject *called_object = func( descr, source, (PyObject *)type );
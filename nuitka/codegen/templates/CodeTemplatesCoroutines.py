@@ -20,11 +20,19 @@
 """
 
 template_coroutine_object_decl_template = """\
+#if _NUITKA_STACKLESS_GENERATORS
+static PyObject *%(function_identifier)s( struct Nuitka_CoroutineObject *coroutine, PyObject *yield_return_value );
+#else
 static void %(function_identifier)s( struct Nuitka_CoroutineObject *coroutine );
+#endif
 """
 
 template_coroutine_object_body_template = """
+#if _NUITKA_STACKLESS_GENERATORS
+static PyObject *%(function_identifier)s( struct Nuitka_CoroutineObject *coroutine, PyObject *yield_return_value )
+#else
 static void %(function_identifier)s( struct Nuitka_CoroutineObject *coroutine )
+#endif
 {
     CHECK_OBJECT( (PyObject *)coroutine );
     assert( Nuitka_Coroutine_Check( (PyObject *)coroutine ) );
@@ -47,8 +55,12 @@ template_coroutine_exception_exit = """\
 %(function_cleanup)s\
     assert( exception_type );
     RESTORE_ERROR_OCCURRED( exception_type, exception_value, exception_tb );
+#if _NUITKA_STACKLESS_GENERATORS
+    return NULL;
+#else
     coroutine->m_yielded = NULL;
     return;
+#endif
 """
 
 template_coroutine_noexception_exit = """\
@@ -56,15 +68,23 @@ template_coroutine_noexception_exit = """\
     NUITKA_CANNOT_GET_HERE( %(function_identifier)s );
 
 %(function_cleanup)s\
+#if _NUITKA_STACKLESS_GENERATORS
+    return NULL;
+#else
     coroutine->m_yielded = NULL;
     return;
+#endif
 """
 
 template_coroutine_return_exit = """\
     function_return_exit:;
-    coroutine->m_yielded = NULL;
     coroutine->m_returned = tmp_return_value;
+#if _NUITKA_STACKLESS_GENERATORS
+    return NULL;
+#else
+    coroutine->m_yielded = NULL;
     return;
+#endif
 """
 
 
@@ -74,7 +94,13 @@ template_make_coroutine_template = """
     self->m_name,
     self->m_qualname,
     %(code_identifier)s,
-    %(closure_count)d
+    %(closure_count)d,
+    %(closure_inline)d,
+#if _NUITKA_STACKLESS_GENERATORS
+    sizeof(struct %(coroutine_identifier)s_locals)
+#else
+    0
+#endif
 );
 %(closure_copy)s
 """
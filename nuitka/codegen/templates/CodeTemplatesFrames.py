@@ -23,14 +23,21 @@ template_frame_guard_cache_decl = """\
 static struct Nuitka_FrameObject *cache_%(frame_identifier)s = NULL;
 """
 
+template_frame_guard_depth_cache_decl = """\
+static struct Nuitka_FrameObject *cache_%(frame_identifier)s[ _NUITKA_FRAME_CACHE_DEPTH ];
+static int cache_depth_%(frame_identifier)s = 0;
+int depth_%(frame_identifier)s;
+"""
+
 template_frame_guard_frame_decl = """\
 struct Nuitka_FrameObject *%(frame_identifier)s;
 """
 
 # Frame in a function
 template_frame_guard_full_block = """\
-MAKE_OR_REUSE_FRAME( cache_%(frame_identifier)s, %(code_identifier)s, %(module_identifier)s, %(locals_size)s );
-%(frame_identifier)s = cache_%(frame_identifier)s;
+depth_%(frame_identifier)s = cache_depth_%(frame_identifier)s++;
+MAKE_OR_REUSE_FRAME( FRAME_CACHE_SLOT( cache_%(frame_identifier)s, depth_%(frame_identifier)s ), %(code_identifier)s, %(module_identifier)s, %(locals_size)s );
+%(frame_identifier)s = FRAME_CACHE_SLOT( cache_%(frame_identifier)s, depth_%(frame_identifier)s );
 
 // Push the new frame as the currently active one.
 pushFrameStack( %(frame_identifier)s );
@@ -47,6 +54,7 @@ RESTORE_FRAME_EXCEPTION( %(frame_identifier)s );
 
 // Put the previous frame back on top.
 popFrameStack();
+cache_depth_%(frame_identifier)s = depth_%(frame_identifier)s;
 
 goto %(no_exception_exit)s;
 """
@@ -59,6 +67,7 @@ RESTORE_FRAME_EXCEPTION( %(frame_identifier)s );
 
 // Put the previous frame back on top.
 popFrameStack();
+cache_depth_%(frame_identifier)s = depth_%(frame_identifier)s;
 
 goto %(return_exit)s;
 """
@@ -86,20 +95,66 @@ else if ( exception_tb->tb_frame != &%(frame_identifier)s->m_frame )
     exception_tb = ADD_TRACEBACK( exception_tb, %(frame_identifier)s, exception_lineno );
 }
 
+#if %(lazy_line_numbers)d
+// The line is not updated while running, the traceback has it.
+%(frame_identifier)s->m_frame.f_lineno = exception_lineno;
+#endif
+
 // Attachs locals to frame if any.
 %(attach_locals)s
 
 // Release cached frame.
-if ( %(frame_identifier)s == cache_%(frame_identifier)s )
+if ( %(frame_identifier)s == FRAME_CACHE_SLOT( cache_%(frame_identifier)s, depth_%(frame_identifier)s ) )
 {
     Py_DECREF( %(frame_identifier)s );
+    FRAME_CACHE_SLOT( cache_%(frame_identifier)s, depth_%(frame_identifier)s ) = NULL;
 }
-cache_%(frame_identifier)s = NULL;
 
 assertFrameObject( %(frame_identifier)s );
 
 // Put the previous frame back on top.
 popFrameStack();
+cache_depth_%(frame_identifier)s = depth_%(frame_identifier)s;
+
+// Return the error.
+goto %(parent_exception_exit)s;
+"""
+
+# Frame in a function, where the framed code has no use for it, and it is only
+# created when an exception leaves it.
+template_frame_guard_lazy_block = """\
+// Framed code, the frame is created only if an exception leaves it:
+%(codes)s
+
+goto %(no_exception_exit)s;
+"""
+
+template_frame_guard_lazy_return_handler = """\
+%(frame_return_exit)s:;
+goto %(return_exit)s;
+"""
+
+template_frame_guard_lazy_exception_handler = """\
+%(frame_exception_exit)s:;
+
+// Create the frame now, it is no longer running, so it is not linked.
+%(frame_identifier)s = MAKE_FUNCTION_FRAME( %(code_identifier)s, %(module_identifier)s, %(locals_size)s );
+%(frame_identifier)s->m_frame.f_lineno = exception_lineno;
+
+if ( exception_tb == NULL )
+{
+    exception_tb = %(tb_making)s;
+}
+else
+{
+    exception_tb = ADD_TRACEBACK( exception_tb, %(frame_identifier)s, exception_lineno );
+}
+
+// Attachs locals to frame if any.
+%(attach_locals)s
+
+// The traceback keeps the frame alive.
+Py_DECREF( %(frame_identifier)s );
 
 // Return the error.
 goto %(parent_exception_exit)s;
@@ -175,16 +230,17 @@ Nuitka_Frame_MarkAsExecuting( %(context_identifier)s->m_frame );
 #if PYTHON_VERSION >= 300
 // Accept currently existing exception as the one to publish again when we
 // yield or yield from.
-
-PyThreadState *thread_state = PyThreadState_GET();
-
-%(context_identifier)s->m_frame->m_frame.f_exc_type = thread_state->exc_type;
-if ( %(context_identifier)s->m_frame->m_frame.f_exc_type == Py_None ) %(context_identifier)s->m_frame->m_frame.f_exc_type = NULL;
-Py_XINCREF( %(context_identifier)s->m_frame->m_frame.f_exc_type );
-%(context_identifier)s->m_frame->m_frame.f_exc_value = thread_state->exc_value;
-Py_XINCREF( %(context_identifier)s->m_frame->m_frame.f_exc_value );
-%(context_identifier)s->m_frame->m_frame.f_exc_traceback = thread_state->exc_traceback;
-Py_XINCREF( %(context_identifier)s->m_frame->m_frame.f_exc_traceback );
+{
+    PyThreadState *thread_state = PyThreadState_GET();
+
+    %(context_identifier)s->m_frame->m_frame.f_exc_type = thread_state->exc_type;
+    if ( %(context_identifier)s->m_frame->m_frame.f_exc_type == Py_None ) %(context_identifier)s->m_frame->m_frame.f_exc_type = NULL;
+    Py_XINCREF( %(context_identifier)s->m_frame->m_frame.f_exc_type );
+    %(context_identifier)s->m_frame->m_frame.f_exc_value = thread_state->exc_value;
+    Py_XINCREF( %(context_identifier)s->m_frame->m_frame.f_exc_value );
+    %(context_identifier)s->m_frame->m_frame.f_exc_traceback = thread_state->exc_traceback;
+    Py_XINCREF( %(context_identifier)s->m_frame->m_frame.f_exc_traceback );
+}
 #endif
 
 // Framed code:
@@ -235,6 +291,11 @@ if ( !EXCEPTION_MATCH_GENERATOR( exception_type ) )
         exception_tb = ADD_TRACEBACK( exception_tb, %(frame_identifier)s, exception_lineno );
     }
 
+#if %(lazy_line_numbers)d
+    // The line is not updated while running, the traceback has it.
+    %(frame_identifier)s->m_frame.f_lineno = exception_lineno;
+#endif
+
 %(attach_locals)s
 
     // Release cached frame.
@@ -23,10 +23,84 @@ template_function_make_declaration = """\
 static PyObject *MAKE_FUNCTION_%(function_identifier)s( %(function_creation_arg_spec)s );
 """
 
+template_function_parse_declaration = """\
+static PyObject *impl_%(function_identifier)s( struct Nuitka_FunctionObject const *self, PyObject **python_pars );
+static PyObject *parse_%(function_identifier)s( struct Nuitka_FunctionObject const *function, PyObject **args, Py_ssize_t args_size, PyObject *kw );
+"""
+
 template_function_direct_declaration = """\
 %(file_scope)s PyObject *impl_%(function_identifier)s( %(direct_call_arg_spec)s );
 """
 
+template_function_parse_arguments = """
+// Argument parser specialized to the parameters of the function. It handles
+// the common cases and gives up on everything else, notably all errors, for
+// which the generic parser is used.
+static PyObject *parse_%(function_identifier)s( struct Nuitka_FunctionObject const *function, PyObject **args, Py_ssize_t args_size, PyObject *kw )
+{
+    PyObject *python_pars[ %(parameter_count)d ];
+    Py_ssize_t defaults_start;
+
+    if (unlikely( args_size > %(parameter_count)d ))
+    {
+        goto generic;
+    }
+
+    memcpy( python_pars, args, args_size * sizeof(PyObject *) );
+    memset( python_pars + args_size, 0, ( %(parameter_count)d - args_size ) * sizeof(PyObject *) );
+
+    if ( kw != NULL )
+    {
+        Py_ssize_t ppos = 0;
+        PyObject *key, *value;
+
+        while( PyDict_Next( kw, &ppos, &key, &value ) )
+        {
+%(keyword_matches)s
+            else
+            {
+                goto generic;
+            }
+        }
+    }
+
+    defaults_start = %(parameter_count)d - function->m_defaults_given;
+
+    for( Py_ssize_t i = args_size; i < %(parameter_count)d; i++ )
+    {
+        if ( python_pars[ i ] == NULL )
+        {
+            if (unlikely( i < defaults_start ))
+            {
+                goto generic;
+            }
+
+            python_pars[ i ] = PyTuple_GET_ITEM( function->m_defaults, i - defaults_start );
+        }
+    }
+
+    for( Py_ssize_t i = 0; i < %(parameter_count)d; i++ )
+    {
+        Py_INCREF( python_pars[ i ] );
+    }
+
+    return %(function_impl_identifier)s( function, python_pars );
+
+generic:
+    return Nuitka_CallFunctionPosArgsKwArgs( function, args, args_size, kw );
+}
+"""
+
+template_function_parse_keyword_match = """            %(else)sif ( key == %(parameter_name_obj)s )
+            {
+                if (unlikely( python_pars[ %(parameter_index)d ] != NULL ))
+                {
+                    goto generic;
+                }
+
+                python_pars[ %(parameter_index)d ] = value;
+            }"""
+
 template_make_function_template = """
 static PyObject *MAKE_FUNCTION_%(function_identifier)s( %(function_creation_args)s )
 {
@@ -44,9 +118,10 @@ static PyObject *MAKE_FUNCTION_%(function_identifier)s( %(function_creation_args
 #endif
         %(module_identifier)s,
         %(function_doc)s,
-        %(closure_count)d
+        %(closure_count)d,
+        %(closure_inline)d
     );
-%(closure_copy)s
+%(closure_copy)s%(parser_setup)s
     return (PyObject *)result;
 }
 """
@@ -20,7 +20,7 @@
 """
 
 template_genfunc_yielder_decl_template = """\
-#if _NUITKA_EXPERIMENTAL_GENERATOR_GOTO
+#if _NUITKA_STACKLESS_GENERATORS
 static PyObject *%(function_identifier)s_context( struct Nuitka_GeneratorObject *generator, PyObject *yield_return_value );
 #else
 static void %(function_identifier)s_context( struct Nuitka_GeneratorObject *generator );
@@ -28,13 +28,7 @@ static void %(function_identifier)s_context( struct Nuitka_GeneratorObject *gene
 """
 
 template_genfunc_yielder_body_template = """
-#if _NUITKA_EXPERIMENTAL_GENERATOR_GOTO
-struct %(function_identifier)s_locals {
-%(function_local_types)s
-};
-#endif
-
-#if _NUITKA_EXPERIMENTAL_GENERATOR_GOTO
+#if _NUITKA_STACKLESS_GENERATORS
 static PyObject *%(function_identifier)s_context( struct Nuitka_GeneratorObject *generator, PyObject *yield_return_value )
 #else
 static void %(function_identifier)s_context( struct Nuitka_GeneratorObject *generator )
@@ -46,9 +40,6 @@ static void %(function_identifier)s_context( struct Nuitka_GeneratorObject *gene
     // Local variable initialization
 %(function_var_inits)s
 
-    // Dispatch to yield based on return label index:
-%(function_dispatch)s
-
     // Actual function code.
 %(function_body)s
 
@@ -56,9 +47,21 @@ static void %(function_identifier)s_context( struct Nuitka_GeneratorObject *gene
 }
 """
 
+# Variables of stackless generators, coroutines and asyncgens, kept in the
+# object, behind the closure.
+template_generator_heap_locals_decl = """\
+struct %(function_identifier)s_locals {
+%(heap_decls)s
+};
+"""
+
+template_generator_heap_locals_pointer = """\
+struct %(function_identifier)s_locals *%(heap_identifier)s = \
+(struct %(function_identifier)s_locals *)%(context_identifier)s->m_heap_storage;"""
+
 template_generator_exception_exit = """\
 %(function_cleanup)s\
-#if _NUITKA_EXPERIMENTAL_GENERATOR_GOTO
+#if _NUITKA_STACKLESS_GENERATORS
     return NULL;
 #else
     generator->m_yielded = NULL;
@@ -70,7 +73,7 @@ template_generator_exception_exit = """\
     assert( exception_type );
     RESTORE_ERROR_OCCURRED( exception_type, exception_value, exception_tb );
 
-#if _NUITKA_EXPERIMENTAL_GENERATOR_GOTO
+#if _NUITKA_STACKLESS_GENERATORS
     return NULL;
 #else
     generator->m_yielded = NULL;
@@ -82,7 +85,7 @@ template_generator_noexception_exit = """\
     // Return statement need not be present.
 %(function_cleanup)s\
 
-#if _NUITKA_EXPERIMENTAL_GENERATOR_GOTO
+#if _NUITKA_STACKLESS_GENERATORS
     return NULL;
 #else
     generator->m_yielded = NULL;
@@ -94,7 +97,11 @@ template_generator_return_exit = """\
     // The above won't return, but we need to make it clear to the compiler
     // as well, or else it will complain and/or generate inferior code.
     assert(false);
+#if _NUITKA_STACKLESS_GENERATORS
+    return NULL;
+#else
     return;
+#endif
 
     function_return_exit:
 #if PYTHON_VERSION >= 330
@@ -111,7 +118,7 @@ template_generator_return_exit = """\
     }
 #endif
 
-#if _NUITKA_EXPERIMENTAL_GENERATOR_GOTO
+#if _NUITKA_STACKLESS_GENERATORS
     return NULL;
 #else
     generator->m_yielded = NULL;
@@ -119,6 +126,33 @@ template_generator_return_exit = """\
 #endif
 """
 
+template_yield_stackless = """\
+%(context_identifier)s->m_yield_return_index = %(yield_return_index)s;
+return %(yield_name)s_SUSPEND( %(context_identifier)s, %(yielded_value)s );
+%(yield_return_label)s:
+%(to_name)s = %(yield_name)s_RESUME( %(context_identifier)s, yield_return_value );
+"""
+
+template_yield_delegation_stackless = """\
+if (likely( %(start_name)s( %(context_identifier)s, %(value_name)s ) ))
+{
+    yield_return_value = NULL;
+
+    %(yield_return_label)s:
+    yield_return_value = %(step_name)s( %(context_identifier)s, yield_return_value, &%(to_name)s );
+
+    if ( yield_return_value != NULL )
+    {
+        %(context_identifier)s->m_yield_return_index = %(yield_return_index)s;
+        return yield_return_value;
+    }
+}
+else
+{
+    %(to_name)s = NULL;
+}
+"""
+
 template_generator_making = """\
 %(to_name)s = Nuitka_Generator_New(
     %(generator_identifier)s_context,
@@ -128,7 +162,13 @@ template_generator_making = """\
     %(generator_qualname_obj)s,
 #endif
     %(code_identifier)s,
-    %(closure_count)d
+    %(closure_count)d,
+    %(closure_inline)d,
+#if _NUITKA_STACKLESS_GENERATORS
+    sizeof(struct %(generator_identifier)s_locals)
+#else
+    0
+#endif
 );
 %(closure_copy)s
 """
@@ -182,18 +182,13 @@ template_read_shared_known = """\
 """
 
 # For module variable values, need to lookup in module dictionary or in
-# built-in dictionary.
+# built-in dictionary, the helper caches the result for the access site.
 
 # TODO: Only provide fallback for known actually possible values. Do this
 # by keeping track of things that were added by "site.py" mechanisms. Then
 # we can avoid the second call entirely for most cases.
 template_read_mvar_unclear = """\
-%(tmp_name)s = GET_STRING_DICT_VALUE( moduledict_%(module_identifier)s, (Nuitka_StringObject *)%(var_name)s );
-
-if (unlikely( %(tmp_name)s == NULL ))
-{
-    %(tmp_name)s = GET_STRING_DICT_VALUE( dict_builtin, (Nuitka_StringObject *)%(var_name)s );
-}
+%(tmp_name)s = GET_MODULE_VARIABLE_VALUE_CACHED( moduledict_%(module_identifier)s, %(var_name)s, %(cache_name)s );
 """
 
 template_read_locals_dict_with_fallback = """\
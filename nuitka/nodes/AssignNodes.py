@@ -512,8 +512,6 @@ class StatementDelVariable(NodeBase):
         return self.variable
 
     def setVariable(self, variable):
-        assert self.variable_version is None
-
         self.variable = variable
         self.variable_version = variable.allocateTargetNumber()
 
@@ -62,6 +62,9 @@ class StatementListOperationAppend(StatementChildrenHavingBase):
 
         return self, None, None
 
+    def mayRaiseException(self, exception_type):
+        return self.getValue().mayRaiseException(exception_type)
+
 
 class ExpressionListOperationExtend(ExpressionChildrenHavingBase):
     kind = "EXPRESSION_LIST_OPERATION_EXTEND"
@@ -162,6 +165,9 @@ class StatementSetOperationAdd(StatementChildrenHavingBase):
 
         trace_collection.removeKnowledge(self.getSet())
 
+        # Hashing the value can raise, e.g. for unhashable types.
+        trace_collection.onExceptionRaiseExit(BaseException)
+
         return self, None, None
 
 
@@ -128,6 +128,11 @@ class ExpressionVariableRefBase(ExpressionBase):
     def getVariableTrace(self):
         return self.variable_trace
 
+    def setVariable(self, variable):
+        assert isinstance(variable, Variables.Variable), repr(variable)
+
+        self.variable = variable
+
 
 class ExpressionVariableRef(ExpressionVariableRefBase):
     kind = "EXPRESSION_VARIABLE_REF"
@@ -182,11 +187,6 @@ class ExpressionVariableRef(ExpressionVariableRefBase):
     def getVariable(self):
         return self.variable
 
-    def setVariable(self, variable):
-        assert isinstance(variable, Variables.Variable), repr(variable)
-
-        self.variable = variable
-
     def getTypeShape(self):
         if self.variable_trace.isAssignTrace():
             return self.variable_trace.getAssignNode().getAssignSource().getTypeShape()
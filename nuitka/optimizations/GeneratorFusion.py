@@ -0,0 +1,662 @@
+#     Copyright 2018, Kay Hayen, mailto:kay.hayen@gmail.com
+#
+#     Part of "Nuitka", an optimizing Python compiler that is compatible and
+#     integrates with CPython, but also works on its own.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+""" Fusion of generator expressions into the built-in calls consuming them.
+
+For "sum", "any", "all", "min", "max", "list", "tuple" and "set" called with
+nothing but a generator expression, there is no need to create a generator
+object, and to resume it for every value. Instead, the generator body becomes
+an outline function, in which the "yield" is replaced with what the built-in
+would have done with the value.
+"""
+
+from nuitka.__past__ import long  # pylint: disable=I0021,redefined-builtin
+from nuitka.nodes.AssignNodes import (
+    StatementAssignmentVariable,
+    StatementReleaseVariable
+)
+from nuitka.nodes.BuiltinRefNodes import ExpressionBuiltinExceptionRef
+from nuitka.nodes.BuiltinTypeNodes import ExpressionBuiltinTuple
+from nuitka.nodes.CodeObjectSpecs import CodeObjectSpec
+from nuitka.nodes.ConditionalNodes import StatementConditional
+from nuitka.nodes.ConstantRefNodes import makeConstantRefNode
+from nuitka.nodes.ContainerOperationNodes import (
+    StatementListOperationAppend,
+    StatementSetOperationAdd
+)
+from nuitka.nodes.ExceptionNodes import (
+    ExpressionBuiltinMakeException,
+    ExpressionCaughtExceptionValueRef,
+    StatementRaiseException
+)
+from nuitka.nodes.FrameNodes import StatementsFrameFunction
+from nuitka.nodes.NodeMakingHelpers import makeComparisonNode
+from nuitka.nodes.OperatorNodes import (
+    ExpressionOperationBinaryAdd,
+    ExpressionOperationNOT
+)
+from nuitka.nodes.OutlineNodes import ExpressionOutlineFunction
+from nuitka.nodes.ReturnNodes import StatementReturn
+from nuitka.nodes.VariableRefNodes import ExpressionTempVariableRef
+from nuitka.tree.Extractions import updateVariableUsage
+from nuitka.tree.Operations import VisitorNoopMixin, visitTree
+from nuitka.tree.ReformulationTryExceptStatements import (
+    makeTryExceptSingleHandlerNode
+)
+from nuitka.tree.ReformulationTryFinallyStatements import (
+    makeTryFinallyStatement
+)
+from nuitka.tree.TreeHelpers import (
+    makeReraiseExceptionStatement,
+    makeStatementsSequence,
+    makeStatementsSequenceFromStatement,
+    makeStatementsSequenceFromStatements
+)
+
+fusable_builtin_names = (
+    "sum", "any", "all", "min", "max", "list", "tuple", "set"
+)
+
+
+class GeneratorExpressionBodyInspector(VisitorNoopMixin):
+    """ Find the yields, frames and returns of a generator expression body.
+
+    """
+    def __init__(self):
+        self.yields = []
+        self.frames = []
+        self.returns = []
+
+        self.fusable = True
+
+    def onEnterNode(self, node):
+        if node.isExpressionYield():
+            if node.parent.isStatementExpressionOnly():
+                self.yields.append(node)
+            else:
+                self.fusable = False
+        elif node.isStatementsFrameGenerator():
+            self.frames.append(node)
+        elif node.isStatementReturn():
+            # Returns from "finally" handlers pass on what is being returned
+            # already, these need not be looked at.
+            if not node.getExpression().isExpressionReturnedValueRef():
+                self.returns.append(node)
+        elif node.isExpressionYieldFrom() or \
+             node.isStatementGeneratorReturn() or \
+             node.isStatementGeneratorReturnNone():
+            self.fusable = False
+        elif getattr(node, "locals_scope", None) is not None:
+            # Working with a locals dictionary, these are not for us.
+            self.fusable = False
+
+
+def _inspectTree(node):
+    visitor = GeneratorExpressionBodyInspector()
+    visitTree(node, visitor)
+
+    return visitor
+
+
+def _getFusableGeneratorExpression(builtin_name, call_node):
+    """ Get the generator expression outline and its creation, if fusable.
+
+    """
+
+    # Only positional arguments, and exactly what we expect.
+    if call_node.getCallKw() is not None:
+        return None
+
+    call_args = call_node.getCallArgs()
+
+    if call_args is None or not call_args.isExpressionMakeTuple():
+        return None
+
+    elements = call_args.getElements()
+
+    if len(elements) == 2 and builtin_name == "sum":
+        # The start value is checked for strings by "sum" before iterating, only
+        # accept values, where that cannot be the case.
+        start = elements[1]
+
+        if not start.isCompileTimeConstant() or \
+           type(start.getCompileTimeConstant()) not in (int, long, float, complex):
+            return None
+    elif len(elements) != 1:
+        return None
+
+    outline = elements[0]
+
+    if not outline.isExpressionOutlineBody():
+        return None
+
+    provider = call_node.getParentVariableProvider()
+
+    # Class bodies and exec using functions have their own idea of variables.
+    entry_point = provider.getEntryPoint()
+
+    if entry_point.isExpressionClassBody() or entry_point.isUnoptimized():
+        return None
+
+    outline_inspector = _inspectTree(outline.getBody())
+
+    if len(outline_inspector.returns) != 1:
+        return None
+
+    creation_return = outline_inspector.returns[0]
+    creation = creation_return.getExpression()
+
+    # Asyncgen expressions need not apply.
+    if not creation.isExpressionMakeGeneratorObject():
+        return None
+
+    generator_body = creation.getGeneratorRef().getFunctionBody()
+
+    if generator_body.isUnoptimized():
+        return None
+
+    generator_inspector = _inspectTree(generator_body.getBody())
+
+    if not generator_inspector.fusable or \
+       not generator_inspector.yields or \
+       generator_inspector.returns:
+        return None
+
+    for variable in generator_body.getLocalVariables():
+        # Nested scopes using the variables would need updates of their own.
+        if variable.getOwner() is generator_body and \
+           variable.isSharedAmongScopes():
+            return None
+
+    # The creation is protected by releasing the iterator, with a "finally"
+    # that has no exception handling, as it cannot raise. That is what we will
+    # replace, and we need it to be in the expected form.
+    creation_statement = creation_return.parent.parent
+
+    if creation_statement.isStatementTry():
+        if creation_statement.getBlockTry().getStatements() != (creation_return,) or \
+           creation_statement.getBlockReturnHandler() is None:
+            return None
+
+        if creation_statement.parent.parent is not outline:
+            return None
+    elif creation_statement is outline:
+        creation_statement = creation_return
+    else:
+        return None
+
+    return outline, creation_statement, creation_return, generator_body
+
+
+def _makeTempRef(variable, source_ref):
+    return ExpressionTempVariableRef(
+        variable   = variable,
+        source_ref = source_ref
+    )
+
+
+def _makeAccumulation(builtin_name, result_variable, value_variable,
+                      first_variable, source_ref):
+    value_ref = _makeTempRef(value_variable, source_ref)
+
+    if builtin_name in ("list", "tuple"):
+        return StatementListOperationAppend(
+            list_arg   = _makeTempRef(result_variable, source_ref),
+            value      = value_ref,
+            source_ref = source_ref
+        )
+    elif builtin_name == "set":
+        return StatementSetOperationAdd(
+            set_arg    = _makeTempRef(result_variable, source_ref),
+            value      = value_ref,
+            source_ref = source_ref
+        )
+    elif builtin_name == "sum":
+        return StatementAssignmentVariable(
+            variable   = result_variable,
+            source     = ExpressionOperationBinaryAdd(
+                left       = _makeTempRef(result_variable, source_ref),
+                right      = value_ref,
+                source_ref = source_ref
+            ),
+            source_ref = source_ref
+        )
+    elif builtin_name in ("any", "all"):
+        if builtin_name == "all":
+            value_ref = ExpressionOperationNOT(
+                operand    = value_ref,
+                source_ref = source_ref
+            )
+
+        return StatementConditional(
+            condition  = value_ref,
+            yes_branch = makeStatementsSequenceFromStatement(
+                statement = StatementReturn(
+                    expression = makeConstantRefNode(
+                        constant   = builtin_name == "any",
+                        source_ref = source_ref
+                    ),
+                    source_ref = source_ref
+                )
+            ),
+            no_branch  = None,
+            source_ref = source_ref
+        )
+    else:
+        assert builtin_name in ("min", "max"), builtin_name
+
+        # The first value is taken, later ones only if they compare as
+        # requested against the current one.
+        return StatementConditional(
+            condition  = _makeTempRef(first_variable, source_ref),
+            yes_branch = makeStatementsSequenceFromStatements(
+                StatementAssignmentVariable(
+                    variable   = result_variable,
+                    source     = _makeTempRef(value_variable, source_ref),
+                    source_ref = source_ref
+                ),
+                StatementAssignmentVariable(
+                    variable   = first_variable,
+                    source     = makeConstantRefNode(
+                        constant   = False,
+                        source_ref = source_ref
+                    ),
+                    source_ref = source_ref
+                )
+            ),
+            no_branch  = makeStatementsSequenceFromStatement(
+                statement = StatementConditional(
+                    condition  = makeComparisonNode(
+                        left       = value_ref,
+                        right      = _makeTempRef(result_variable, source_ref),
+                        comparator = "Lt" if builtin_name == "min" else "Gt",
+                        source_ref = source_ref
+                    ),
+                    yes_branch = makeStatementsSequenceFromStatement(
+                        statement = StatementAssignmentVariable(
+                            variable   = result_variable,
+                            source     = _makeTempRef(value_variable, source_ref),
+                            source_ref = source_ref
+                        )
+                    ),
+                    no_branch  = None,
+                    source_ref = source_ref
+                )
+            ),
+            source_ref = source_ref
+        )
+
+
+def _makeResultStatements(builtin_name, result_variable, first_variable,
+                          source_ref):
+    if builtin_name in ("any", "all"):
+        result = makeConstantRefNode(
+            constant   = builtin_name == "all",
+            source_ref = source_ref
+        )
+    elif builtin_name == "tuple":
+        result = ExpressionBuiltinTuple(
+            value      = _makeTempRef(result_variable, source_ref),
+            source_ref = source_ref
+        )
+    else:
+        result = _makeTempRef(result_variable, source_ref)
+
+    statements = [
+        StatementReturn(
+            expression = result,
+            source_ref = source_ref
+        )
+    ]
+
+    if builtin_name in ("min", "max"):
+        statements.insert(
+            0,
+            StatementConditional(
+                condition  = _makeTempRef(first_variable, source_ref),
+                yes_branch = makeStatementsSequenceFromStatement(
+                    statement = StatementRaiseException(
+                        exception_type  = ExpressionBuiltinExceptionRef(
+                            exception_name = "ValueError",
+                            source_ref     = source_ref
+                        ),
+                        exception_value = makeConstantRefNode(
+                            constant   = "%s() arg is an empty sequence" % builtin_name,
+                            source_ref = source_ref
+                        ),
+                        exception_trace = None,
+                        exception_cause = None,
+                        source_ref      = source_ref
+                    )
+                ),
+                no_branch  = None,
+                source_ref = source_ref
+            )
+        )
+
+    return makeStatementsSequence(
+        statements = statements,
+        allow_none = False,
+        source_ref = source_ref
+    )
+
+
+def _makeStopIterationHandling(code_object, escaped_variable, result_statements,
+                               source_ref):
+    """ What a "StopIteration" raised by the generator expression code does.
+
+    Unless "generator_stop" is active, it ends the generator silently. Ones
+    raised by the accumulation are to be raised though, and only these set the
+    escaped indicator.
+    """
+
+    if code_object.getFutureSpec().isGeneratorStop():
+        result = makeStatementsSequenceFromStatement(
+            statement = StatementRaiseException(
+                exception_type  = ExpressionBuiltinMakeException(
+                    exception_name = "RuntimeError",
+                    args           = (
+                        makeConstantRefNode(
+                            constant   = "generator raised StopIteration",
+                            source_ref = source_ref
+                        ),
+                    ),
+                    source_ref     = source_ref
+                ),
+                exception_value = None,
+                exception_trace = None,
+                exception_cause = ExpressionCaughtExceptionValueRef(
+                    source_ref = source_ref
+                ),
+                source_ref      = source_ref
+            )
+        )
+    else:
+        result = result_statements
+
+    if escaped_variable is not None:
+        result = makeStatementsSequenceFromStatement(
+            statement = StatementConditional(
+                condition  = _makeTempRef(escaped_variable, source_ref),
+                yes_branch = makeReraiseExceptionStatement(
+                    source_ref = source_ref
+                ),
+                no_branch  = result,
+                source_ref = source_ref
+            )
+        )
+
+    return result
+
+
+def _replaceStatement(statement, replacements):
+    statement_sequence = statement.parent
+    assert statement_sequence.isStatementsSequence(), statement_sequence
+
+    statements = list(statement_sequence.getStatements())
+    index = statements.index(statement)
+
+    statements[index:index+1] = replacements
+
+    statement_sequence.setStatements(statements)
+
+
+def _makeFunctionCodeObject(code_object):
+    result = CodeObjectSpec(
+        co_name           = code_object.getCodeObjectName(),
+        co_kind           = "Function",
+        co_varnames       = code_object.getVarNames(),
+        co_argcount       = code_object.getArgumentCount(),
+        co_kwonlyargcount = code_object.getKwOnlyParameterCount(),
+        co_has_starlist   = code_object.hasStarListArg(),
+        co_has_stardict   = code_object.hasStarDictArg(),
+        co_filename       = code_object.getFilename(),
+        co_lineno         = code_object.getLineNumber(),
+        future_spec       = code_object.getFutureSpec(),
+        co_new_locals     = code_object.getFlagNewLocalsValue(),
+        co_has_closure    = code_object.getFlagHasClosureValue(),
+        co_is_optimized   = code_object.getFlagIsOptimizedValue()
+    )
+
+    return result
+
+
+def fuseGeneratorExpressionCall(builtin_name, call_node):
+    """ Replace a built-in call with a generator expression with a loop.
+
+    Returns the outline function to use instead of the call, or None if that
+    is not possible.
+    """
+
+    # Many details to take care of, pylint: disable=too-many-locals
+
+    fusable = _getFusableGeneratorExpression(builtin_name, call_node)
+
+    if fusable is None:
+        return None
+
+    outline, creation_statement, creation_return, generator_body = fusable
+
+    body = generator_body.getBody().makeClone()
+    inspector = _inspectTree(body)
+
+    provider = call_node.getParentVariableProvider()
+    source_ref = call_node.getSourceReference()
+
+    result = ExpressionOutlineFunction(
+        provider   = provider,
+        name       = "genexpr_fusion",
+        source_ref = source_ref
+    )
+
+    # The variables of the generator become ours.
+    for variable in generator_body.getLocalVariables():
+        if variable.getOwner() is generator_body:
+            updateVariableUsage(
+                body,
+                old_variable = variable,
+                new_variable = result.getProvidedVariable(variable.getName())
+            )
+
+    for variable in generator_body.getTempVariables():
+        updateVariableUsage(
+            body,
+            old_variable = variable,
+            new_variable = result.allocateTempVariable(
+                temp_scope = None,
+                name       = variable.getName()
+            )
+        )
+
+    result_variable = result.allocateTempVariable(
+        temp_scope = None,
+        name       = "result"
+    )
+    value_variable = result.allocateTempVariable(
+        temp_scope = None,
+        name       = "value"
+    )
+
+    if builtin_name in ("min", "max"):
+        first_variable = result.allocateTempVariable(
+            temp_scope = None,
+            name       = "first"
+        )
+    else:
+        first_variable = None
+
+    escaped_variable = None
+
+    for yield_node in inspector.yields:
+        yield_source_ref = yield_node.getSourceReference()
+
+        accumulation = _makeAccumulation(
+            builtin_name    = builtin_name,
+            result_variable = result_variable,
+            value_variable  = value_variable,
+            first_variable  = first_variable,
+            source_ref      = yield_source_ref
+        )
+
+        # Exceptions from the accumulation are the built-in's and not to be
+        # confused with the generator ending.
+        if accumulation.mayRaiseException(StopIteration):
+            if escaped_variable is None:
+                escaped_variable = result.allocateTempVariable(
+                    temp_scope = None,
+                    name       = "escaped"
+                )
+
+            accumulation = makeTryExceptSingleHandlerNode(
+                tried          = accumulation,
+                exception_name = "StopIteration",
+                handler_body   = makeStatementsSequenceFromStatements(
+                    StatementAssignmentVariable(
+                        variable   = escaped_variable,
+                        source     = makeConstantRefNode(
+                            constant   = True,
+                            source_ref = yield_source_ref
+                        ),
+                        source_ref = yield_source_ref
+                    ),
+                    makeReraiseExceptionStatement(
+                        source_ref = yield_source_ref
+                    )
+                ),
+                source_ref     = yield_source_ref
+            )
+
+        _replaceStatement(
+            statement    = yield_node.parent,
+            replacements = (
+                StatementAssignmentVariable(
+                    variable   = value_variable,
+                    source     = yield_node.getExpression(),
+                    source_ref = yield_source_ref
+                ),
+                accumulation
+            )
+        )
+
+    for frame in inspector.frames:
+        frame.replaceWith(
+            StatementsFrameFunction(
+                statements  = frame.getStatements(),
+                code_object = _makeFunctionCodeObject(frame.getCodeObject()),
+                source_ref  = frame.getSourceReference()
+            )
+        )
+
+    if builtin_name in ("list", "tuple"):
+        start_value = []
+    elif builtin_name == "set":
+        start_value = set()
+    elif builtin_name == "sum":
+        call_args = call_node.getCallArgs().getElements()
+
+        start_value = call_args[1].getCompileTimeConstant() if len(call_args) == 2 else 0
+    else:
+        start_value = None
+
+    init_statements = []
+
+    if start_value is not None:
+        init_statements.append(
+            StatementAssignmentVariable(
+                variable   = result_variable,
+                source     = makeConstantRefNode(
+                    constant   = start_value,
+                    source_ref = source_ref
+                ),
+                source_ref = source_ref
+            )
+        )
+
+    for indicator_variable, value in ((first_variable, True),
+                                      (escaped_variable, False)):
+        if indicator_variable is not None:
+            init_statements.append(
+                StatementAssignmentVariable(
+                    variable   = indicator_variable,
+                    source     = makeConstantRefNode(
+                        constant   = value,
+                        source_ref = source_ref
+                    ),
+                    source_ref = source_ref
+                )
+            )
+
+    code_object = creation_return.getExpression().getCodeObject()
+
+    # Releases of the iterator done by the creation, we do them too, but also
+    # for exceptions, the generator creation could not have raised any.
+    if creation_statement.isStatementTry():
+        final_statements = [
+            statement.makeClone()
+            for statement in
+            creation_statement.getBlockReturnHandler().getStatements()
+            if statement.isStatementReleaseVariable()
+        ]
+    else:
+        final_statements = []
+
+    fused_statements = makeTryFinallyStatement(
+        provider   = result,
+        tried      = init_statements + [
+            makeTryExceptSingleHandlerNode(
+                tried          = body,
+                exception_name = "StopIteration",
+                handler_body   = _makeStopIterationHandling(
+                    code_object       = code_object,
+                    escaped_variable  = escaped_variable,
+                    result_statements = _makeResultStatements(
+                        builtin_name    = builtin_name,
+                        result_variable = result_variable,
+                        first_variable  = first_variable,
+                        source_ref      = source_ref
+                    ),
+                    source_ref        = source_ref
+                ),
+                source_ref     = source_ref
+            ),
+            _makeResultStatements(
+                builtin_name    = builtin_name,
+                result_variable = result_variable,
+                first_variable  = first_variable,
+                source_ref      = source_ref
+            )
+        ],
+        final      = [
+            StatementReleaseVariable(
+                variable   = variable,
+                source_ref = source_ref
+            )
+            for variable in
+            (result_variable, value_variable, first_variable, escaped_variable)
+            if variable is not None
+        ] + final_statements,
+        source_ref = source_ref
+    )
+
+    # The iterator creation of the generator expression remains as it is, only
+    # the creation of the generator object is replaced.
+    outline_body = outline.getBody()
+    creation_statement.replaceWith(fused_statements)
+
+    result.setBody(outline_body)
+
+    return result
@@ -150,6 +150,10 @@ from nuitka.tree.TreeHelpers import (
 )
 
 from . import BuiltinOptimization
+from .GeneratorFusion import (
+    fusable_builtin_names,
+    fuseGeneratorExpressionCall
+)
 
 
 def dir_extractor(node):
@@ -1469,6 +1473,18 @@ Replaced call to built-in '%s' with constant value.""" % builtin_name
 
 
 def computeBuiltinCall(builtin_name, call_node):
+    # Generator expressions consumed right away by a built-in, can become a
+    # loop, without a generator object being created.
+    if builtin_name in fusable_builtin_names:
+        new_node = fuseGeneratorExpressionCall(builtin_name, call_node)
+
+        if new_node is not None:
+            return (
+                new_node,
+                "new_expression",
+                "Fused generator expression into built-in '%s' call." % builtin_name
+            )
+
     # There is some dispatching for how to output various types of changes,
     # with lots of cases.
     if builtin_name in _dispatch_dict:
@@ -56,7 +56,9 @@ class VariableUsageUpdater(VisitorNoopMixin):
     def onEnterNode(self, node):
         if node.isStatementAssignmentVariable() or \
            node.isStatementDelVariable() or \
-           node.isStatementReleaseVariable():
+           node.isStatementReleaseVariable() or \
+           node.isExpressionVariableRef() or \
+           node.isExpressionTempVariableRef():
             if node.getVariable() is self.old_variable:
                 node.setVariable(self.new_variable)
 
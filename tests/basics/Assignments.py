@@ -252,6 +252,24 @@ def globalErrors():
     except NameError as e:
         print("Del on unassigned global gives", repr(e))
 
+def sequenceUnpacking():
+    class ReversedList(list):
+        def __iter__(self):
+            return reversed(self[:])
+
+    for value in ((1, 2), [3, 4], (5,), [6, 7, 8], ReversedList([9, 10]), "ab", iter((11, 12))):
+        try:
+            a, b = value
+            print("Unpacking", type(value).__name__, "gives", a, b)
+        except ValueError as e:
+            print("Unpacking", type(value).__name__, "gives", repr(e))
+
+    for k, v in [(1, 2), [3, 4]]:
+        print("Unpacking in loop", k, v)
+
+    for k, v in {1 : 2}.items():
+        print("Unpacking dictionary items", k, v)
+
 
 someFunction()
 varargsFunction(1,2,3,4)
@@ -264,3 +282,4 @@ optimizeableTargets()
 complexDel()
 sliceDel()
 globalErrors()
+sequenceUnpacking()
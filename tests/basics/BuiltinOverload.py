@@ -30,3 +30,44 @@ def len(x):  # @ReservedAssignment
     return _len(x)
 
 print("Calling built-in len", len(range(9)))
+
+try:
+    import __builtin__ as builtins_module
+except ImportError:
+    import builtins as builtins_module
+
+module_value = 1
+
+def readModuleAndBuiltinValues():
+    # The same read sites see changes of module and built-in values.
+    return module_value, added_value, min  # @UndefinedVariable
+
+def changeModuleValues():
+    global module_value
+    module_value = 2
+
+builtins_module.added_value = "built-in value"
+results = [readModuleAndBuiltinValues()]
+
+changeModuleValues()
+results.append(readModuleAndBuiltinValues())
+
+globals()["added_value"] = "module value"
+results.append(readModuleAndBuiltinValues())
+
+del globals()["added_value"]
+results.append(readModuleAndBuiltinValues())
+
+original_min = builtins_module.min
+builtins_module.min = "changed built-in min"
+results.append(readModuleAndBuiltinValues())
+builtins_module.min = original_min
+
+import sys
+setattr(sys.modules[__name__], "module_value", 3)
+results.append(readModuleAndBuiltinValues())
+
+del builtins_module.added_value
+
+for result in results:
+    print("Module and built-in values", result[0], result[1], result[2] is original_min or result[2])
@@ -196,3 +196,72 @@ class ClassWithModuleVariableCollisionMain():
             self.attr = secondary
 
 print ClassWithModuleVariableCollisionMain, ClassWithModuleVariableCollisionMain().value
+
+class ClassWithUncompiledMethods(object):
+    # Methods that are not compiled functions, these are called without
+    # creating bound methods too.
+    getNone = eval("lambda self: (self.__class__.__name__, None)")
+    getSum = eval("lambda self, a, b = 2: (self.__class__.__name__, a + b)")
+
+    def getCompiled(self, a, b = 3):
+        return self.__class__.__name__, a, b
+
+instance = ClassWithUncompiledMethods()
+print "Uncompiled methods:",
+print instance.getNone(), instance.getSum(1), instance.getSum(1, 3),
+print instance.getCompiled(1), instance.getCompiled(1, 2)
+
+def getStarArgs():
+    return 1, 5
+
+star_args = getStarArgs()
+print "Uncompiled methods with star args:",
+print instance.getSum(*star_args), instance.getCompiled(*star_args)
+
+instance.getSum = lambda *args: ("instance dict wins", args)
+instance.getCompiled = lambda *args: ("instance dict wins", args)
+print "Shadowed methods:",
+print instance.getSum(1), instance.getSum(1, 3),
+print instance.getCompiled(1), instance.getCompiled(1, 2)
+print instance.getSum(*star_args), instance.getCompiled(*star_args)
+
+def getAttributeValues(instances):
+    # The same lookup and assignment sites see different types and changes
+    # to the types and instances here.
+    result = []
+
+    for instance in instances:
+        try:
+            result.append(instance.value)
+        except AttributeError as e:
+            result.append(repr(e))
+
+        instance.other = len(result)
+
+    return result
+
+class ClassWithValueAttribute(object):
+    value = "class value"
+
+class ClassWithValueProperty(object):
+    @property
+    def value(self):
+        return "property value"
+
+instance1 = ClassWithValueAttribute()
+instance2 = ClassWithValueAttribute()
+instance2.value = "instance value"
+instance3 = ClassWithValueProperty()
+
+print "Attribute values:", getAttributeValues([instance1, instance2, instance3, instance1])
+
+ClassWithValueAttribute.value = "changed class value"
+print "Changed class attribute:", getAttributeValues([instance1, instance2])
+
+del instance2.value
+del ClassWithValueAttribute.value
+instance1.value = "new instance value"
+print "Deleted attributes:", getAttributeValues([instance1, instance2])
+
+ClassWithValueAttribute.value = property(lambda self: "late property value")
+print "Late property:", getAttributeValues([instance1, instance2]), instance1.other
@@ -170,3 +170,42 @@ b = A('b',1)
 c = A('c',0)
 
 print(a < b < c)
+
+print("Comparisons of values with exact types:")
+
+def allComparisons(a, b):
+    return [a < b, a <= b, a == b, a != b, a > b, a >= b]
+
+numbers = (
+    0, 1, -1, 2**15, 2**30, -2**30, 2**62, 2**53 + 1, -2**53 - 1, 2**100,
+    0.5, -0.0, 1.0, 2.0**53, 2.0**100, float("nan"), float("inf")
+)
+
+for a in numbers:
+    for b in numbers:
+        print(repr(a), repr(b), allComparisons(a, b))
+
+strings = ("", "a", "ab", "b", "a\0", "\xe4", "\u20ac", "\U0001f600")
+
+for i, a in enumerate(strings):
+    for j, b in enumerate(strings):
+        print(i, j, allComparisons(a, b))
+
+def shapedComparisons(x):
+    result = []
+
+    if len(x) == 3:
+        result.append("len is 3")
+
+    if float(len(x)) < 3.5:
+        result.append("float of len less than 3.5")
+
+    if str(len(x)) >= "3":
+        result.append("str of len at least '3'")
+
+    if 2.5 < len(x):
+        result.append("len more than 2.5")
+
+    return result, len(x) != 3, 1.5 > float(len(x))
+
+print(shapedComparisons("abc"), shapedComparisons(range(7)))
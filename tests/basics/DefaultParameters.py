@@ -65,3 +65,16 @@ defaultValueTest6.func_defaults = ([1,2,3],)
 print(defaultValueTest6.__defaults__)
 
 print(defaultValueTest6(1))
+
+def defaultValueTest7(a, b, c = 3, d = 4):
+    return a, b, c, d
+
+print(defaultValueTest7(1, b = 2), defaultValueTest7(d = 1, c = 2, b = 3, a = 4))
+
+defaultValueTest7.__defaults__ = (5, 6)
+print(defaultValueTest7(1, 2), defaultValueTest7(1, b = 2, c = 7))
+
+try:
+    defaultValueTest7(1, c = 2)
+except TypeError as e:
+    print("Defaulted function without required argument gives", repr(e))
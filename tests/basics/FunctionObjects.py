@@ -50,3 +50,33 @@ def func2(arg1, arg2 = "default_arg2", arg3 = "default_arg3"):
 print("func __defaults__", func2.__defaults__)
 
 print("function varnames", func2.__code__.co_varnames)
+
+def closureValues(a):
+    b = a * 2
+
+    def getter():
+        return a, b
+
+    def generator():
+        yield a
+        yield b
+
+    return getter, generator
+
+getter, generator = closureValues(21)
+print("Closure values:", getter(), list(generator()))
+
+closure = getter.__closure__ if str is not bytes else getter.func_closure
+print("Closure cell contents:", [cell.cell_contents for cell in closure])
+
+del closureValues
+print("Closure values after owner is gone:", getter(), list(generator()))
+
+def closureReassigned():
+    c = 1
+    getter = lambda: c
+    c = 2
+
+    return getter
+
+print("Closure of reassigned variable:", closureReassigned()())
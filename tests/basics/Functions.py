@@ -472,6 +472,107 @@ d = { "other" : 7, 'c' : 3 }
 
 print("Dual star args consuming function", posDoubleStarArgsFunction(1,  *l, **d))
 
+class CallbackClass:
+    def plainMethod(self, a, b):
+        return a, b
+
+    def defaultMethod(self, a, b = 2, c = 3):
+        return a, b, c
+
+    def starMethod(self, *args):
+        return args
+
+callback_object = CallbackClass()
+
+print("Bound methods called from built-ins", list(map(callback_object.plainMethod, [1, 2], [3, 4])))
+print("Bound methods with defaults called from built-ins", list(map(callback_object.defaultMethod, [1, 2])))
+print("Bound methods with star list called from built-ins", list(map(callback_object.starMethod, [1, 2])))
+
+try:
+    list(map(callback_object.plainMethod, [1]))
+except TypeError as e:
+    print("Bound method called with too few arguments gives", repr(e))
+
+print("Functions called from built-ins", list(map(posDoubleStarArgsFunction, [1], [2], [3], [4])))
+
+def manyKeywordsFunction(a1 = 1, a2 = 2, a3 = 3, a4 = 4, a5 = 5, a6 = 6, a7 = 7,
+                         a8 = 8, a9 = 9, a10 = 10, a11 = 11, a12 = 12):
+    return a1, a5, a9, a12
+
+print("Many keywords", manyKeywordsFunction(a12 = "x", a1 = "y"))
+
+class KeywordString(str):
+    pass
+
+keywords = {
+    "".join(["a", "9"]) : "computed",
+    KeywordString("a5") : "subclass"
+}
+print("Many keywords from computed names", manyKeywordsFunction(**keywords))
+
+try:
+    manyKeywordsFunction(a13 = 1)
+except TypeError as e:
+    print("Many keywords with unknown one gives", repr(e))
+
+try:
+    manyKeywordsFunction(1, a1 = 1)
+except TypeError as e:
+    print("Many keywords with one given twice gives", repr(e))
+
+def moduleLevelHelper(a, b = 2):
+    return a, b
+
+def moduleLevelHelperUser():
+    return moduleLevelHelper(1), moduleLevelHelper(1, 3), moduleLevelHelper(b = 4, a = 5)
+
+print("Module level function called", moduleLevelHelperUser())
+
+saved_helper = moduleLevelHelper
+globals()["moduleLevelHelper"] = lambda a, b = 7: ("replaced", a, b)
+print("Module level function replaced", moduleLevelHelperUser())
+globals()["moduleLevelHelper"] = saved_helper
+
+try:
+    moduleLevelHelper()
+except TypeError as e:
+    print("Module level function without argument gives", repr(e))
+
+exec("""
+def uncompiledDefaults(a, b = 2, c = 3):
+    return a, b, c
+
+def uncompiledClosure(x):
+    def uncompiledInner(a, b = 5):
+        return x, a, b
+
+    return uncompiledInner
+""")
+
+def uncompiledUser():
+    closure = uncompiledClosure(7)
+
+    return (
+        uncompiledDefaults(1),
+        uncompiledDefaults(1, c = 4),
+        uncompiledDefaults(c = 5, b = 6, a = 7),
+        closure(1),
+        closure(b = 2, a = 3)
+    )
+
+print("Uncompiled functions called", uncompiledUser())
+
+for kw in ({"d" : 1}, {"a" : 1}):
+    try:
+        uncompiledDefaults(1, **kw)
+    except TypeError as e:
+        print("Uncompiled function with keywords", sorted(kw), "gives", repr(e))
+
+try:
+    uncompiledDefaults(b = 1)
+except TypeError as e:
+    print("Uncompiled function without argument gives", repr(e))
+
 import inspect, sys
 
 for value in sorted(dir()):
@@ -150,3 +150,18 @@ def deletingClosureVariable():
         return repr(e)
 
 print("Using deleted non-local variable:", deletingClosureVariable())
+
+exec("""
+def uncompiledKeywordOnly(a, *, b, c = 3):
+    return a, b, c
+""")
+
+def uncompiledKeywordOnlyUser():
+    return uncompiledKeywordOnly(1, b = 2), uncompiledKeywordOnly(c = 4, b = 5, a = 6)
+
+print("Uncompiled keyword only function called", uncompiledKeywordOnlyUser())
+
+try:
+    uncompiledKeywordOnly(1)
+except TypeError as e:
+    print("Uncompiled keyword only function without argument gives", repr(e))
@@ -228,3 +228,41 @@ def strangeLambdaGeneratorExpression():
     print(list(x))
 
 strangeLambdaGeneratorExpression()
+
+def builtinConsumers():
+    # Generator expressions given to these built-ins directly, get compiled as
+    # loops, without creating a generator object.
+
+    a = 3
+
+    print("sum", sum(x*a for x in range(10)), sum((x for x in range(4)), 10))
+    print("any", any(x > a for x in range(5)), any(x > 5 for x in range(5)))
+    print("all", all(x < a for x in range(5)), all(x < 5 for x in range(5)))
+    print("min", min(x for x in range(a, 9)), min(-x for x in range(4)))
+    print("max", max(x for x in range(a, 9)), max(x % 3 for x in range(4)))
+    print("list", list(x+y for x in range(3) if x != 1 for y in range(2)))
+    print("tuple", tuple(x for x in "abc"))
+    print("set", sorted(set(x % a for x in range(10))))
+
+    try:
+        min(x for x in ())
+    except ValueError as e:
+        print("min empty", e)
+
+    try:
+        max(x for x in range(3) if x > 5)
+    except ValueError as e:
+        print("max empty", e)
+
+    class AddStopIteration:
+        def __add__(self, other):
+            raise StopIteration
+
+        __radd__ = __add__
+
+    try:
+        sum(AddStopIteration() for x in range(3))
+    except StopIteration:
+        print("StopIteration from sum escaped the generator expression.")
+
+builtinConsumers()
@@ -0,0 +1 @@
+/root/repo/nuitka/build/static_src/CompiledAsyncgenType.c
\ No newline at end of file
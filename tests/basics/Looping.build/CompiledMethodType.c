@@ -0,0 +1 @@
+/root/repo/nuitka/build/static_src/CompiledMethodType.c
\ No newline at end of file
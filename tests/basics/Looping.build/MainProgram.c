@@ -0,0 +1 @@
+/root/repo/nuitka/build/static_src/MainProgram.c
\ No newline at end of file
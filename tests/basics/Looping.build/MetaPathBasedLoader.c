@@ -0,0 +1 @@
+/root/repo/nuitka/build/static_src/MetaPathBasedLoader.c
\ No newline at end of file
@@ -0,0 +1,10855 @@
+/* Generated code for Python source for module '__main__'
+ * created by Nuitka version 0.5.31rc1
+ *
+ * This code is in part copyright 2018 Kay Hayen.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nuitka/prelude.h"
+
+#include "__helpers.h"
+
+/* The _module___main__ is a Python object pointer of module type. */
+
+/* Note: For full compatibility with CPython, every module variable access
+ * needs to go through it except for cases where the module cannot possibly
+ * have changed in the mean time.
+ */
+
+PyObject *module___main__;
+PyDictObject *moduledict___main__;
+
+/* The module constants used, if any. */
+static PyObject *const_str_plain_OK;
+static PyObject *const_str_digest_ea9e46aaa77eee8d9efc490f40f00045;
+static PyObject *const_str_plain_result;
+static PyObject *const_tuple_int_pos_5_tuple;
+static PyObject *const_tuple_str_digest_37caecb2e1c4a0533584667453af65ce_tuple;
+static PyObject *const_tuple_str_plain_u_str_plain_v_tuple;
+extern PyObject *const_dict_empty;
+static PyObject *const_str_digest_458a092cc4447f5af6ed4602fc1aa978;
+static PyObject *const_int_pos_9;
+extern PyObject *const_str_plain___file__;
+static PyObject *const_tuple_str_plain_oki_tuple;
+static PyObject *const_str_digest_d0029e2577ed0f543eb463df46a3802c;
+static PyObject *const_tuple_str_plain_Okey_tuple;
+static PyObject *const_str_angle_listcontraction;
+static PyObject *const_tuple_int_pos_3_int_pos_5_tuple;
+static PyObject *const_str_plain_a;
+extern PyObject *const_str_plain_site;
+static PyObject *const_int_neg_1;
+static PyObject *const_int_pos_1180591620717411303426;
+static PyObject *const_str_plain_loopingFunction;
+static PyObject *const_tuple_str_digest_d0029e2577ed0f543eb463df46a3802c_tuple;
+static PyObject *const_str_plain_m;
+static PyObject *const_str_plain_Okey;
+static PyObject *const_tuple_str_plain_else_tuple;
+static PyObject *const_str_plain_os;
+static PyObject *const_int_pos_6;
+extern PyObject *const_str_plain_end;
+static PyObject *const_int_pos_5;
+static PyObject *const_tuple_str_digest_458a092cc4447f5af6ed4602fc1aa978_tuple;
+static PyObject *const_str_digest_73b7b1f333ded478224c044b51fa2532;
+static PyObject *const_tuple_str_digest_8fce46a6ae4b5a4efc2bd40e08df4154_tuple;
+static PyObject *const_tuple_xrange_0_8_tuple;
+static PyObject *const_tuple_int_0_int_0_tuple;
+static PyObject *const_tuple_str_plain_n_str_plain_x_tuple;
+static PyObject *const_str_digest_cdd84bdb4119608cb49b60eb9efdb07f;
+static PyObject *const_xrange_0_8;
+static PyObject *const_tuple_str_digest_73b7b1f333ded478224c044b51fa2532_tuple;
+extern PyObject *const_str_plain___doc__;
+static PyObject *const_tuple_str_plain_l_tuple;
+static PyObject *const_tuple_str_plain_n_str_plain_result_str_plain_x_str_plain_y_tuple;
+static PyObject *const_str_plain_oki;
+static PyObject *const_str_plain_high;
+static PyObject *const_tuple_int_pos_4_tuple;
+static PyObject *const_str_plain_n;
+static PyObject *const_int_neg_2;
+static PyObject *const_tuple_str_digest_bf8b58b3a2e74fe51be4b0f231744143_tuple;
+static PyObject *const_float_2_0;
+static PyObject *const_str_digest_0dbf11a4c874ec83ccac34718f8f9c87;
+static PyObject *const_str_plain_else;
+static PyObject *const_str_plain_e;
+static PyObject *const_int_pos_8;
+static PyObject *const_str_plain_low;
+static PyObject *const_str_plain_l;
+extern PyObject *const_tuple_empty;
+static PyObject *const_str_space;
+static PyObject *const_str_plain_cond;
+static PyObject *const_str_plain_append;
+static PyObject *const_str_plain_no;
+static PyObject *const_str_plain_rangeLoopFunction;
+static PyObject *const_int_pos_10;
+static PyObject *const_str_digest_8fce46a6ae4b5a4efc2bd40e08df4154;
+static PyObject *const_str_digest_6ad00f07e7481631c8484b17c838ff75;
+static PyObject *const_str_plain_b;
+static PyObject *const_tuple_dd64385d1ed5861620ea2e66d3a6245e_tuple;
+static PyObject *const_tuple_int_0_tuple;
+static PyObject *const_str_digest_dc4c724c6114d6a52a82036cea6d31fd;
+static PyObject *const_tuple_6e2deb619fb07f382e732de5c08a192a_tuple;
+static PyObject *const_str_plain_f;
+extern PyObject *const_int_0;
+static PyObject *const_tuple_8f202f740d5c5973363678b255a3a811_tuple;
+static PyObject *const_str_digest_e6facc1cff9058d9f8a1254c5bb3f915;
+static PyObject *const_str_plain_ok;
+static PyObject *const_str_plain_yes;
+static PyObject *const_tuple_str_plain_m_tuple;
+static PyObject *const_tuple_int_pos_2_tuple;
+static PyObject *const_tuple_str_digest_ea9e46aaa77eee8d9efc490f40f00045_tuple;
+static PyObject *const_str_plain_x;
+static PyObject *const_str_plain_c;
+static PyObject *const_str_digest_56d22133bded4bbb34438c584317dc82;
+static PyObject *const_str_digest_37caecb2e1c4a0533584667453af65ce;
+static PyObject *const_str_plain_rangeLoopGenerator;
+static PyObject *const_int_pos_4;
+extern PyObject *const_str_plain___main__;
+static PyObject *const_tuple_str_digest_0dbf11a4c874ec83ccac34718f8f9c87_tuple;
+static PyObject *const_str_digest_12ae0b962f942fea309297ef66f3b7a5;
+static PyObject *const_str_digest_bf8b58b3a2e74fe51be4b0f231744143;
+static PyObject *const_str_plain_d;
+extern PyObject *const_str_plain___cached__;
+static PyObject *const_str_plain_v;
+static PyObject *const_str_plain_print_function;
+static PyObject *const_str_plain_to;
+static PyObject *const_int_pos_1180591620717411303424;
+static PyObject *const_str_plain_z;
+static PyObject *const_tuple_str_digest_186e3b3dbfd8bbccfc71bbfc4554a7bf_tuple;
+static PyObject *const_xrange_0_5;
+extern PyObject *const_int_pos_1;
+static PyObject *const_tuple_str_digest_0a035ad313f4791687148b94278fefa3_tuple;
+static PyObject *const_str_plain_y;
+static PyObject *const_tuple_str_plain_ok_tuple;
+static PyObject *const_xrange_0_9;
+static PyObject *const_str_digest_7e46d1b7a02aaa71f443543dcea4d327;
+static PyObject *const_str_digest_fbc60986c47bdb27eaa03b762df73ad4;
+static PyObject *const_str_digest_0a035ad313f4791687148b94278fefa3;
+extern PyObject *const_str_plain_print;
+static PyObject *const_int_pos_3;
+static PyObject *const_tuple_str_digest_18b7780adb5fb4b80b0d19ba5d462b03_tuple;
+static PyObject *const_tuple_str_plain_OK_tuple;
+static PyObject *const_tuple_int_0_float_2_0_tuple;
+static PyObject *const_str_digest_18b7780adb5fb4b80b0d19ba5d462b03;
+static PyObject *const_str_angle_module;
+static PyObject *const_int_pos_7;
+static PyObject *const_tuple_str_plain_u_tuple;
+static PyObject *const_str_plain_u;
+static PyObject *const_tuple_str_plain_f_tuple;
+static PyObject *const_tuple_str_digest_56d22133bded4bbb34438c584317dc82_tuple;
+static PyObject *const_tuple_str_digest_cdd84bdb4119608cb49b60eb9efdb07f_tuple;
+static PyObject *const_str_digest_fb48e7be2dff5ce44baabe61d2eb0a4e;
+static PyObject *const_int_pos_2;
+static PyObject *const_str_plain_gave;
+static PyObject *const_str_digest_704ba592b4c1ed4866f4cb0cd4e22bea;
+static PyObject *const_str_digest_186e3b3dbfd8bbccfc71bbfc4554a7bf;
+static PyObject *const_dict_fb4ddbadafbecbaef28aef989e4b600e;
+static PyObject *const_str_plain___annotations__;
+static PyObject *module_filename_obj;
+
+static bool constants_created = false;
+
+static void createModuleConstants( void )
+{
+    const_str_plain_OK = UNSTREAM_STRING( &constant_bin[ 0 ], 2, 1 );
+    const_str_digest_ea9e46aaa77eee8d9efc490f40f00045 = UNSTREAM_STRING( &constant_bin[ 2 ], 19, 0 );
+    const_str_plain_result = UNSTREAM_STRING( &constant_bin[ 21 ], 6, 1 );
+    const_tuple_int_pos_5_tuple = PyTuple_New( 1 );
+    const_int_pos_5 = PyLong_FromUnsignedLong( 5ul );
+    PyTuple_SET_ITEM( const_tuple_int_pos_5_tuple, 0, const_int_pos_5 ); Py_INCREF( const_int_pos_5 );
+    const_tuple_str_digest_37caecb2e1c4a0533584667453af65ce_tuple = PyTuple_New( 1 );
+    const_str_digest_37caecb2e1c4a0533584667453af65ce = UNSTREAM_STRING( &constant_bin[ 27 ], 10, 0 );
+    PyTuple_SET_ITEM( const_tuple_str_digest_37caecb2e1c4a0533584667453af65ce_tuple, 0, const_str_digest_37caecb2e1c4a0533584667453af65ce ); Py_INCREF( const_str_digest_37caecb2e1c4a0533584667453af65ce );
+    const_tuple_str_plain_u_str_plain_v_tuple = PyTuple_New( 2 );
+    const_str_plain_u = UNSTREAM_STRING( &constant_bin[ 24 ], 1, 1 );
+    PyTuple_SET_ITEM( const_tuple_str_plain_u_str_plain_v_tuple, 0, const_str_plain_u ); Py_INCREF( const_str_plain_u );
+    const_str_plain_v = UNSTREAM_STRING( &constant_bin[ 37 ], 1, 1 );
+    PyTuple_SET_ITEM( const_tuple_str_plain_u_str_plain_v_tuple, 1, const_str_plain_v ); Py_INCREF( const_str_plain_v );
+    const_str_digest_458a092cc4447f5af6ed4602fc1aa978 = UNSTREAM_STRING( &constant_bin[ 38 ], 48, 0 );
+    const_int_pos_9 = PyLong_FromUnsignedLong( 9ul );
+    const_tuple_str_plain_oki_tuple = PyTuple_New( 1 );
+    const_str_plain_oki = UNSTREAM_STRING( &constant_bin[ 86 ], 3, 1 );
+    PyTuple_SET_ITEM( const_tuple_str_plain_oki_tuple, 0, const_str_plain_oki ); Py_INCREF( const_str_plain_oki );
+    const_str_digest_d0029e2577ed0f543eb463df46a3802c = UNSTREAM_STRING( &constant_bin[ 89 ], 31, 0 );
+    const_tuple_str_plain_Okey_tuple = PyTuple_New( 1 );
+    const_str_plain_Okey = UNSTREAM_STRING( &constant_bin[ 120 ], 4, 1 );
+    PyTuple_SET_ITEM( const_tuple_str_plain_Okey_tuple, 0, const_str_plain_Okey ); Py_INCREF( const_str_plain_Okey );
+    const_str_angle_listcontraction = UNSTREAM_STRING( &constant_bin[ 124 ], 17, 0 );
+    const_tuple_int_pos_3_int_pos_5_tuple = PyTuple_New( 2 );
+    const_int_pos_3 = PyLong_FromUnsignedLong( 3ul );
+    PyTuple_SET_ITEM( const_tuple_int_pos_3_int_pos_5_tuple, 0, const_int_pos_3 ); Py_INCREF( const_int_pos_3 );
+    PyTuple_SET_ITEM( const_tuple_int_pos_3_int_pos_5_tuple, 1, const_int_pos_5 ); Py_INCREF( const_int_pos_5 );
+    const_str_plain_a = UNSTREAM_STRING( &constant_bin[ 18 ], 1, 1 );
+    const_int_neg_1 = PyLong_FromLong( -1l );
+    const_int_pos_1180591620717411303426 = PyMarshal_ReadObjectFromString( (char *)&constant_bin[ 141 ], 15 );
+    const_str_plain_loopingFunction = UNSTREAM_STRING( &constant_bin[ 156 ], 15, 1 );
+    const_tuple_str_digest_d0029e2577ed0f543eb463df46a3802c_tuple = PyTuple_New( 1 );
+    PyTuple_SET_ITEM( const_tuple_str_digest_d0029e2577ed0f543eb463df46a3802c_tuple, 0, const_str_digest_d0029e2577ed0f543eb463df46a3802c ); Py_INCREF( const_str_digest_d0029e2577ed0f543eb463df46a3802c );
+    const_str_plain_m = UNSTREAM_STRING( &constant_bin[ 171 ], 1, 1 );
+    const_tuple_str_plain_else_tuple = PyTuple_New( 1 );
+    const_str_plain_else = UNSTREAM_STRING( &constant_bin[ 33 ], 4, 1 );
+    PyTuple_SET_ITEM( const_tuple_str_plain_else_tuple, 0, const_str_plain_else ); Py_INCREF( const_str_plain_else );
+    const_str_plain_os = UNSTREAM_STRING( &constant_bin[ 172 ], 2, 1 );
+    const_int_pos_6 = PyLong_FromUnsignedLong( 6ul );
+    const_tuple_str_digest_458a092cc4447f5af6ed4602fc1aa978_tuple = PyTuple_New( 1 );
+    PyTuple_SET_ITEM( const_tuple_str_digest_458a092cc4447f5af6ed4602fc1aa978_tuple, 0, const_str_digest_458a092cc4447f5af6ed4602fc1aa978 ); Py_INCREF( const_str_digest_458a092cc4447f5af6ed4602fc1aa978 );
+    const_str_digest_73b7b1f333ded478224c044b51fa2532 = UNSTREAM_STRING( &constant_bin[ 174 ], 30, 0 );
+    const_tuple_str_digest_8fce46a6ae4b5a4efc2bd40e08df4154_tuple = PyTuple_New( 1 );
+    const_str_digest_8fce46a6ae4b5a4efc2bd40e08df4154 = UNSTREAM_STRING( &constant_bin[ 204 ], 15, 0 );
+    PyTuple_SET_ITEM( const_tuple_str_digest_8fce46a6ae4b5a4efc2bd40e08df4154_tuple, 0, const_str_digest_8fce46a6ae4b5a4efc2bd40e08df4154 ); Py_INCREF( const_str_digest_8fce46a6ae4b5a4efc2bd40e08df4154 );
+    const_tuple_xrange_0_8_tuple = PyTuple_New( 1 );
+    const_int_pos_8 = PyLong_FromUnsignedLong( 8ul );
+    const_xrange_0_8 = BUILTIN_XRANGE3( const_int_0, const_int_pos_8, const_int_pos_1 );
+    PyTuple_SET_ITEM( const_tuple_xrange_0_8_tuple, 0, const_xrange_0_8 ); Py_INCREF( const_xrange_0_8 );
+    const_tuple_int_0_int_0_tuple = PyTuple_New( 2 );
+    PyTuple_SET_ITEM( const_tuple_int_0_int_0_tuple, 0, const_int_0 ); Py_INCREF( const_int_0 );
+    PyTuple_SET_ITEM( const_tuple_int_0_int_0_tuple, 1, const_int_0 ); Py_INCREF( const_int_0 );
+    const_tuple_str_plain_n_str_plain_x_tuple = PyTuple_New( 2 );
+    const_str_plain_n = UNSTREAM_STRING( &constant_bin[ 12 ], 1, 1 );
+    PyTuple_SET_ITEM( const_tuple_str_plain_n_str_plain_x_tuple, 0, const_str_plain_n ); Py_INCREF( const_str_plain_n );
+    const_str_plain_x = UNSTREAM_STRING( &constant_bin[ 39 ], 1, 1 );
+    PyTuple_SET_ITEM( const_tuple_str_plain_n_str_plain_x_tuple, 1, const_str_plain_x ); Py_INCREF( const_str_plain_x );
+    const_str_digest_cdd84bdb4119608cb49b60eb9efdb07f = UNSTREAM_STRING( &constant_bin[ 219 ], 16, 0 );
+    const_tuple_str_digest_73b7b1f333ded478224c044b51fa2532_tuple = PyTuple_New( 1 );
+    PyTuple_SET_ITEM( const_tuple_str_digest_73b7b1f333ded478224c044b51fa2532_tuple, 0, const_str_digest_73b7b1f333ded478224c044b51fa2532 ); Py_INCREF( const_str_digest_73b7b1f333ded478224c044b51fa2532 );
+    const_tuple_str_plain_l_tuple = PyTuple_New( 1 );
+    const_str_plain_l = UNSTREAM_STRING( &constant_bin[ 25 ], 1, 1 );
+    PyTuple_SET_ITEM( const_tuple_str_plain_l_tuple, 0, const_str_plain_l ); Py_INCREF( const_str_plain_l );
+    const_tuple_str_plain_n_str_plain_result_str_plain_x_str_plain_y_tuple = PyTuple_New( 4 );
+    PyTuple_SET_ITEM( const_tuple_str_plain_n_str_plain_result_str_plain_x_str_plain_y_tuple, 0, const_str_plain_n ); Py_INCREF( const_str_plain_n );
+    PyTuple_SET_ITEM( const_tuple_str_plain_n_str_plain_result_str_plain_x_str_plain_y_tuple, 1, const_str_plain_result ); Py_INCREF( const_str_plain_result );
+    PyTuple_SET_ITEM( const_tuple_str_plain_n_str_plain_result_str_plain_x_str_plain_y_tuple, 2, const_str_plain_x ); Py_INCREF( const_str_plain_x );
+    const_str_plain_y = UNSTREAM_STRING( &constant_bin[ 123 ], 1, 1 );
+    PyTuple_SET_ITEM( const_tuple_str_plain_n_str_plain_result_str_plain_x_str_plain_y_tuple, 3, const_str_plain_y ); Py_INCREF( const_str_plain_y );
+    const_str_plain_high = UNSTREAM_STRING( &constant_bin[ 235 ], 4, 1 );
+    const_tuple_int_pos_4_tuple = PyTuple_New( 1 );
+    const_int_pos_4 = PyLong_FromUnsignedLong( 4ul );
+    PyTuple_SET_ITEM( const_tuple_int_pos_4_tuple, 0, const_int_pos_4 ); Py_INCREF( const_int_pos_4 );
+    const_int_neg_2 = PyLong_FromLong( -2l );
+    const_tuple_str_digest_bf8b58b3a2e74fe51be4b0f231744143_tuple = PyTuple_New( 1 );
+    const_str_digest_bf8b58b3a2e74fe51be4b0f231744143 = UNSTREAM_STRING( &constant_bin[ 239 ], 46, 0 );
+    PyTuple_SET_ITEM( const_tuple_str_digest_bf8b58b3a2e74fe51be4b0f231744143_tuple, 0, const_str_digest_bf8b58b3a2e74fe51be4b0f231744143 ); Py_INCREF( const_str_digest_bf8b58b3a2e74fe51be4b0f231744143 );
+    const_float_2_0 = UNSTREAM_FLOAT( &constant_bin[ 285 ] );
+    const_str_digest_0dbf11a4c874ec83ccac34718f8f9c87 = UNSTREAM_STRING( &constant_bin[ 293 ], 29, 0 );
+    const_str_plain_e = UNSTREAM_STRING( &constant_bin[ 3 ], 1, 1 );
+    const_str_plain_low = UNSTREAM_STRING( &constant_bin[ 322 ], 3, 1 );
+    const_str_space = UNSTREAM_STRING( &constant_bin[ 8 ], 1, 0 );
+    const_str_plain_cond = UNSTREAM_STRING( &constant_bin[ 325 ], 4, 1 );
+    const_str_plain_append = UNSTREAM_STRING( &constant_bin[ 329 ], 6, 1 );
+    const_str_plain_no = UNSTREAM_STRING( &constant_bin[ 12 ], 2, 1 );
+    const_str_plain_rangeLoopFunction = UNSTREAM_STRING( &constant_bin[ 335 ], 17, 1 );
+    const_int_pos_10 = PyLong_FromUnsignedLong( 10ul );
+    const_str_digest_6ad00f07e7481631c8484b17c838ff75 = UNSTREAM_STRING( &constant_bin[ 352 ], 15, 0 );
+    const_str_plain_b = UNSTREAM_STRING( &constant_bin[ 52 ], 1, 1 );
+    const_tuple_dd64385d1ed5861620ea2e66d3a6245e_tuple = PyTuple_New( 10 );
+    PyTuple_SET_ITEM( const_tuple_dd64385d1ed5861620ea2e66d3a6245e_tuple, 0, const_str_plain_a ); Py_INCREF( const_str_plain_a );
+    const_str_plain_c = UNSTREAM_STRING( &constant_bin[ 16 ], 1, 1 );
+    PyTuple_SET_ITEM( const_tuple_dd64385d1ed5861620ea2e66d3a6245e_tuple, 1, const_str_plain_c ); Py_INCREF( const_str_plain_c );
+    const_str_plain_f = UNSTREAM_STRING( &constant_bin[ 10 ], 1, 1 );
+    PyTuple_SET_ITEM( const_tuple_dd64385d1ed5861620ea2e66d3a6245e_tuple, 2, const_str_plain_f ); Py_INCREF( const_str_plain_f );
+    PyTuple_SET_ITEM( const_tuple_dd64385d1ed5861620ea2e66d3a6245e_tuple, 3, const_str_plain_b ); Py_INCREF( const_str_plain_b );
+    const_str_plain_z = UNSTREAM_STRING( &constant_bin[ 367 ], 1, 1 );
+    PyTuple_SET_ITEM( const_tuple_dd64385d1ed5861620ea2e66d3a6245e_tuple, 4, const_str_plain_z ); Py_INCREF( const_str_plain_z );
+    PyTuple_SET_ITEM( const_tuple_dd64385d1ed5861620ea2e66d3a6245e_tuple, 5, const_str_plain_m ); Py_INCREF( const_str_plain_m );
+    PyTuple_SET_ITEM( const_tuple_dd64385d1ed5861620ea2e66d3a6245e_tuple, 6, const_str_plain_x ); Py_INCREF( const_str_plain_x );
+    PyTuple_SET_ITEM( const_tuple_dd64385d1ed5861620ea2e66d3a6245e_tuple, 7, const_str_plain_y ); Py_INCREF( const_str_plain_y );
+    PyTuple_SET_ITEM( const_tuple_dd64385d1ed5861620ea2e66d3a6245e_tuple, 8, const_str_plain_l ); Py_INCREF( const_str_plain_l );
+    const_str_plain_d = UNSTREAM_STRING( &constant_bin[ 7 ], 1, 1 );
+    PyTuple_SET_ITEM( const_tuple_dd64385d1ed5861620ea2e66d3a6245e_tuple, 9, const_str_plain_d ); Py_INCREF( const_str_plain_d );
+    const_tuple_int_0_tuple = PyTuple_New( 1 );
+    PyTuple_SET_ITEM( const_tuple_int_0_tuple, 0, const_int_0 ); Py_INCREF( const_int_0 );
+    const_str_digest_dc4c724c6114d6a52a82036cea6d31fd = UNSTREAM_STRING( &constant_bin[ 368 ], 2, 0 );
+    const_tuple_6e2deb619fb07f382e732de5c08a192a_tuple = PyTuple_New( 2 );
+    const_int_pos_1180591620717411303424 = PyMarshal_ReadObjectFromString( (char *)&constant_bin[ 370 ], 15 );
+    PyTuple_SET_ITEM( const_tuple_6e2deb619fb07f382e732de5c08a192a_tuple, 0, const_int_pos_1180591620717411303424 ); Py_INCREF( const_int_pos_1180591620717411303424 );
+    PyTuple_SET_ITEM( const_tuple_6e2deb619fb07f382e732de5c08a192a_tuple, 1, const_int_pos_1180591620717411303426 ); Py_INCREF( const_int_pos_1180591620717411303426 );
+    const_tuple_8f202f740d5c5973363678b255a3a811_tuple = PyTuple_New( 4 );
+    const_tuple_int_0_float_2_0_tuple = PyTuple_New( 2 );
+    PyTuple_SET_ITEM( const_tuple_int_0_float_2_0_tuple, 0, const_int_0 ); Py_INCREF( const_int_0 );
+    PyTuple_SET_ITEM( const_tuple_int_0_float_2_0_tuple, 1, const_float_2_0 ); Py_INCREF( const_float_2_0 );
+    PyTuple_SET_ITEM( const_tuple_8f202f740d5c5973363678b255a3a811_tuple, 0, const_tuple_int_0_float_2_0_tuple ); Py_INCREF( const_tuple_int_0_float_2_0_tuple );
+    PyTuple_SET_ITEM( const_tuple_8f202f740d5c5973363678b255a3a811_tuple, 1, const_tuple_6e2deb619fb07f382e732de5c08a192a_tuple ); Py_INCREF( const_tuple_6e2deb619fb07f382e732de5c08a192a_tuple );
+    PyTuple_SET_ITEM( const_tuple_8f202f740d5c5973363678b255a3a811_tuple, 2, const_tuple_int_0_int_0_tuple ); Py_INCREF( const_tuple_int_0_int_0_tuple );
+    PyTuple_SET_ITEM( const_tuple_8f202f740d5c5973363678b255a3a811_tuple, 3, const_tuple_int_pos_3_int_pos_5_tuple ); Py_INCREF( const_tuple_int_pos_3_int_pos_5_tuple );
+    const_str_digest_e6facc1cff9058d9f8a1254c5bb3f915 = UNSTREAM_STRING( &constant_bin[ 385 ], 2, 0 );
+    const_str_plain_ok = UNSTREAM_STRING( &constant_bin[ 86 ], 2, 1 );
+    const_str_plain_yes = UNSTREAM_STRING( &constant_bin[ 387 ], 3, 1 );
+    const_tuple_str_plain_m_tuple = PyTuple_New( 1 );
+    PyTuple_SET_ITEM( const_tuple_str_plain_m_tuple, 0, const_str_plain_m ); Py_INCREF( const_str_plain_m );
+    const_tuple_int_pos_2_tuple = PyTuple_New( 1 );
+    const_int_pos_2 = PyLong_FromUnsignedLong( 2ul );
+    PyTuple_SET_ITEM( const_tuple_int_pos_2_tuple, 0, const_int_pos_2 ); Py_INCREF( const_int_pos_2 );
+    const_tuple_str_digest_ea9e46aaa77eee8d9efc490f40f00045_tuple = PyTuple_New( 1 );
+    PyTuple_SET_ITEM( const_tuple_str_digest_ea9e46aaa77eee8d9efc490f40f00045_tuple, 0, const_str_digest_ea9e46aaa77eee8d9efc490f40f00045 ); Py_INCREF( const_str_digest_ea9e46aaa77eee8d9efc490f40f00045 );
+    const_str_digest_56d22133bded4bbb34438c584317dc82 = UNSTREAM_STRING( &constant_bin[ 390 ], 8, 0 );
+    const_str_plain_rangeLoopGenerator = UNSTREAM_STRING( &constant_bin[ 398 ], 18, 1 );
+    const_tuple_str_digest_0dbf11a4c874ec83ccac34718f8f9c87_tuple = PyTuple_New( 1 );
+    PyTuple_SET_ITEM( const_tuple_str_digest_0dbf11a4c874ec83ccac34718f8f9c87_tuple, 0, const_str_digest_0dbf11a4c874ec83ccac34718f8f9c87 ); Py_INCREF( const_str_digest_0dbf11a4c874ec83ccac34718f8f9c87 );
+    const_str_digest_12ae0b962f942fea309297ef66f3b7a5 = UNSTREAM_STRING( &constant_bin[ 416 ], 12, 0 );
+    const_str_plain_print_function = UNSTREAM_STRING( &constant_bin[ 428 ], 14, 1 );
+    const_str_plain_to = UNSTREAM_STRING( &constant_bin[ 26 ], 2, 1 );
+    const_tuple_str_digest_186e3b3dbfd8bbccfc71bbfc4554a7bf_tuple = PyTuple_New( 1 );
+    const_str_digest_186e3b3dbfd8bbccfc71bbfc4554a7bf = UNSTREAM_STRING( &constant_bin[ 442 ], 11, 0 );
+    PyTuple_SET_ITEM( const_tuple_str_digest_186e3b3dbfd8bbccfc71bbfc4554a7bf_tuple, 0, const_str_digest_186e3b3dbfd8bbccfc71bbfc4554a7bf ); Py_INCREF( const_str_digest_186e3b3dbfd8bbccfc71bbfc4554a7bf );
+    const_xrange_0_5 = BUILTIN_XRANGE3( const_int_0, const_int_pos_5, const_int_pos_1 );
+    const_tuple_str_digest_0a035ad313f4791687148b94278fefa3_tuple = PyTuple_New( 1 );
+    const_str_digest_0a035ad313f4791687148b94278fefa3 = UNSTREAM_STRING( &constant_bin[ 453 ], 42, 0 );
+    PyTuple_SET_ITEM( const_tuple_str_digest_0a035ad313f4791687148b94278fefa3_tuple, 0, const_str_digest_0a035ad313f4791687148b94278fefa3 ); Py_INCREF( const_str_digest_0a035ad313f4791687148b94278fefa3 );
+    const_tuple_str_plain_ok_tuple = PyTuple_New( 1 );
+    PyTuple_SET_ITEM( const_tuple_str_plain_ok_tuple, 0, const_str_plain_ok ); Py_INCREF( const_str_plain_ok );
+    const_xrange_0_9 = BUILTIN_XRANGE3( const_int_0, const_int_pos_9, const_int_pos_1 );
+    const_str_digest_7e46d1b7a02aaa71f443543dcea4d327 = UNSTREAM_STRING( &constant_bin[ 495 ], 2, 0 );
+    const_str_digest_fbc60986c47bdb27eaa03b762df73ad4 = UNSTREAM_STRING( &constant_bin[ 497 ], 34, 0 );
+    const_tuple_str_digest_18b7780adb5fb4b80b0d19ba5d462b03_tuple = PyTuple_New( 1 );
+    const_str_digest_18b7780adb5fb4b80b0d19ba5d462b03 = UNSTREAM_STRING( &constant_bin[ 531 ], 51, 0 );
+    PyTuple_SET_ITEM( const_tuple_str_digest_18b7780adb5fb4b80b0d19ba5d462b03_tuple, 0, const_str_digest_18b7780adb5fb4b80b0d19ba5d462b03 ); Py_INCREF( const_str_digest_18b7780adb5fb4b80b0d19ba5d462b03 );
+    const_tuple_str_plain_OK_tuple = PyTuple_New( 1 );
+    PyTuple_SET_ITEM( const_tuple_str_plain_OK_tuple, 0, const_str_plain_OK ); Py_INCREF( const_str_plain_OK );
+    const_str_angle_module = UNSTREAM_STRING( &constant_bin[ 582 ], 8, 0 );
+    const_int_pos_7 = PyLong_FromUnsignedLong( 7ul );
+    const_tuple_str_plain_u_tuple = PyTuple_New( 1 );
+    PyTuple_SET_ITEM( const_tuple_str_plain_u_tuple, 0, const_str_plain_u ); Py_INCREF( const_str_plain_u );
+    const_tuple_str_plain_f_tuple = PyTuple_New( 1 );
+    PyTuple_SET_ITEM( const_tuple_str_plain_f_tuple, 0, const_str_plain_f ); Py_INCREF( const_str_plain_f );
+    const_tuple_str_digest_56d22133bded4bbb34438c584317dc82_tuple = PyTuple_New( 1 );
+    PyTuple_SET_ITEM( const_tuple_str_digest_56d22133bded4bbb34438c584317dc82_tuple, 0, const_str_digest_56d22133bded4bbb34438c584317dc82 ); Py_INCREF( const_str_digest_56d22133bded4bbb34438c584317dc82 );
+    const_tuple_str_digest_cdd84bdb4119608cb49b60eb9efdb07f_tuple = PyTuple_New( 1 );
+    PyTuple_SET_ITEM( const_tuple_str_digest_cdd84bdb4119608cb49b60eb9efdb07f_tuple, 0, const_str_digest_cdd84bdb4119608cb49b60eb9efdb07f ); Py_INCREF( const_str_digest_cdd84bdb4119608cb49b60eb9efdb07f );
+    const_str_digest_fb48e7be2dff5ce44baabe61d2eb0a4e = UNSTREAM_STRING( &constant_bin[ 590 ], 18, 0 );
+    const_str_plain_gave = UNSTREAM_STRING( &constant_bin[ 608 ], 4, 1 );
+    const_str_digest_704ba592b4c1ed4866f4cb0cd4e22bea = UNSTREAM_STRING( &constant_bin[ 612 ], 24, 0 );
+    const_dict_fb4ddbadafbecbaef28aef989e4b600e = _PyDict_NewPresized( 1 );
+    PyDict_SetItem( const_dict_fb4ddbadafbecbaef28aef989e4b600e, const_str_plain_end, const_str_space );
+    assert( PyDict_Size( const_dict_fb4ddbadafbecbaef28aef989e4b600e ) == 1 );
+    const_str_plain___annotations__ = UNSTREAM_STRING( &constant_bin[ 636 ], 15, 1 );
+
+    constants_created = true;
+}
+
+#ifndef __NUITKA_NO_ASSERT__
+void checkModuleConstants___main__( void )
+{
+    // The module may not have been used at all.
+    if (constants_created == false) return;
+
+
+}
+#endif
+
+// The module code objects.
+static PyCodeObject *codeobj_2b0023940deba7475747880c52bdbd04;
+static PyCodeObject *codeobj_197c1c7622fb164d676e5bf59a244c2f;
+static PyCodeObject *codeobj_a5f3d7fdf5c302d50b2785ec260c380c;
+static PyCodeObject *codeobj_d919de034351cc8afb31200f0bd3bc19;
+static PyCodeObject *codeobj_5b666e34b945b996018bf705374600f5;
+static PyCodeObject *codeobj_952db0bde0028542233c83c413f3c46b;
+static PyCodeObject *codeobj_572eb9fa48c335f9925d1f6c31523968;
+static PyCodeObject *codeobj_32d834cacb17dd188ad83e2de9df6467;
+static PyCodeObject *codeobj_b865081be7c7b5b115cf80eb42bb373b;
+static PyCodeObject *codeobj_1d5d805b093e3794243f2bcdb5ece1e3;
+static PyCodeObject *codeobj_046134e88eb0512b9883d61b8612c687;
+static PyCodeObject *codeobj_fe99c64aaf7891ed8c60b10c41b8b505;
+/* For use in "MainProgram.c". */
+PyCodeObject *codeobj_main = NULL;
+
+static void createModuleCodeObjects(void)
+{
+    module_filename_obj = const_str_digest_fbc60986c47bdb27eaa03b762df73ad4;
+    codeobj_2b0023940deba7475747880c52bdbd04 = MAKE_CODEOBJ( module_filename_obj, const_str_angle_listcontraction, 62, const_tuple_str_plain_u_tuple, 1, 0, CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE | CO_FUTURE_GENERATOR_STOP );
+    codeobj_197c1c7622fb164d676e5bf59a244c2f = MAKE_CODEOBJ( module_filename_obj, const_str_angle_listcontraction, 65, const_tuple_str_plain_u_str_plain_v_tuple, 1, 0, CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE | CO_FUTURE_GENERATOR_STOP );
+    codeobj_a5f3d7fdf5c302d50b2785ec260c380c = MAKE_CODEOBJ( module_filename_obj, const_str_angle_listcontraction, 68, const_tuple_str_plain_u_tuple, 1, 0, CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE | CO_FUTURE_GENERATOR_STOP );
+    codeobj_d919de034351cc8afb31200f0bd3bc19 = MAKE_CODEOBJ( module_filename_obj, const_str_angle_listcontraction, 71, const_tuple_str_plain_u_tuple, 1, 0, CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE | CO_FUTURE_GENERATOR_STOP );
+    codeobj_5b666e34b945b996018bf705374600f5 = MAKE_CODEOBJ( module_filename_obj, const_str_angle_listcontraction, 74, const_tuple_str_plain_f_tuple, 1, 0, CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE | CO_FUTURE_GENERATOR_STOP );
+    codeobj_952db0bde0028542233c83c413f3c46b = MAKE_CODEOBJ( module_filename_obj, const_str_angle_listcontraction, 74, const_tuple_str_plain_l_tuple, 1, 0, CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE | CO_FUTURE_GENERATOR_STOP );
+    codeobj_572eb9fa48c335f9925d1f6c31523968 = MAKE_CODEOBJ( module_filename_obj, const_str_angle_listcontraction, 74, const_tuple_str_plain_m_tuple, 1, 0, CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE | CO_FUTURE_GENERATOR_STOP );
+    codeobj_32d834cacb17dd188ad83e2de9df6467 = MAKE_CODEOBJ( module_filename_obj, const_str_angle_module, 1, const_tuple_empty, 0, 0, CO_NOFREE | CO_FUTURE_GENERATOR_STOP );
+    codeobj_main = codeobj_32d834cacb17dd188ad83e2de9df6467;
+    codeobj_b865081be7c7b5b115cf80eb42bb373b = MAKE_CODEOBJ( module_filename_obj, const_str_plain_cond, 20, const_tuple_empty, 0, 0, CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE | CO_FUTURE_GENERATOR_STOP );
+    codeobj_1d5d805b093e3794243f2bcdb5ece1e3 = MAKE_CODEOBJ( module_filename_obj, const_str_plain_loopingFunction, 23, const_tuple_dd64385d1ed5861620ea2e66d3a6245e_tuple, 1, 0, CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE | CO_FUTURE_GENERATOR_STOP );
+    codeobj_046134e88eb0512b9883d61b8612c687 = MAKE_CODEOBJ( module_filename_obj, const_str_plain_rangeLoopFunction, 152, const_tuple_str_plain_n_str_plain_result_str_plain_x_str_plain_y_tuple, 1, 0, CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE | CO_FUTURE_GENERATOR_STOP );
+    codeobj_fe99c64aaf7891ed8c60b10c41b8b505 = MAKE_CODEOBJ( module_filename_obj, const_str_plain_rangeLoopGenerator, 183, const_tuple_str_plain_n_str_plain_x_tuple, 1, 0, CO_GENERATOR | CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE | CO_FUTURE_GENERATOR_STOP );
+}
+
+// The module function declarations.
+#if _NUITKA_STACKLESS_GENERATORS
+static PyObject *__main__$$$function_4_rangeLoopGenerator$$$genobj_1_rangeLoopGenerator_context( struct Nuitka_GeneratorObject *generator, PyObject *yield_return_value );
+#else
+static void __main__$$$function_4_rangeLoopGenerator$$$genobj_1_rangeLoopGenerator_context( struct Nuitka_GeneratorObject *generator );
+#endif
+
+
+static PyObject *MAKE_FUNCTION___main__$$$function_1_cond(  );
+
+
+static PyObject *MAKE_FUNCTION___main__$$$function_2_loopingFunction( PyObject *defaults );
+static PyObject *impl___main__$$$function_2_loopingFunction( struct Nuitka_FunctionObject const *self, PyObject **python_pars );
+static PyObject *parse___main__$$$function_2_loopingFunction( struct Nuitka_FunctionObject const *function, PyObject **args, Py_ssize_t args_size, PyObject *kw );
+
+
+static PyObject *MAKE_FUNCTION___main__$$$function_3_rangeLoopFunction(  );
+static PyObject *impl___main__$$$function_3_rangeLoopFunction( struct Nuitka_FunctionObject const *self, PyObject **python_pars );
+static PyObject *parse___main__$$$function_3_rangeLoopFunction( struct Nuitka_FunctionObject const *function, PyObject **args, Py_ssize_t args_size, PyObject *kw );
+
+
+static PyObject *MAKE_FUNCTION___main__$$$function_4_rangeLoopGenerator(  );
+static PyObject *impl___main__$$$function_4_rangeLoopGenerator( struct Nuitka_FunctionObject const *self, PyObject **python_pars );
+static PyObject *parse___main__$$$function_4_rangeLoopGenerator( struct Nuitka_FunctionObject const *function, PyObject **args, Py_ssize_t args_size, PyObject *kw );
+
+
+struct __main__$$$function_4_rangeLoopGenerator$$$genobj_1_rangeLoopGenerator_locals {
+    PyObject *var_x;
+    nuitka_range_iterator tmp_for_loop_1__for_iterator;
+    PyObject *tmp_for_loop_1__iter_value;
+    PyObject *exception_type;
+    PyObject *exception_value;
+    PyTracebackObject *exception_tb;
+    int exception_lineno;
+    PyObject *exception_keeper_type_1;
+    PyObject *exception_keeper_value_1;
+    PyTracebackObject *exception_keeper_tb_1;
+    int exception_keeper_lineno_1;
+    PyObject *exception_keeper_type_2;
+    PyObject *exception_keeper_value_2;
+    PyTracebackObject *exception_keeper_tb_2;
+    int exception_keeper_lineno_2;
+    PyObject *exception_keeper_type_3;
+    PyObject *exception_keeper_value_3;
+    PyTracebackObject *exception_keeper_tb_3;
+    int exception_keeper_lineno_3;
+    PyObject *tmp_assign_source_1;
+    PyObject *tmp_assign_source_2;
+    PyObject *tmp_compare_left_1;
+    PyObject *tmp_compare_right_1;
+    int tmp_exc_match_exception_match_1;
+    PyObject *tmp_expression_name_1;
+    PyObject *tmp_high_name_1;
+    PyObject *tmp_low_name_1;
+    bool tmp_result;
+    PyObject *tmp_step_name_1;
+    char const *type_description_1;
+};
+
+
+static struct Nuitka_AttributeCache attribute_cache_11;
+
+static struct Nuitka_AttributeCache attribute_cache_12;
+
+static struct Nuitka_AttributeCache attribute_cache_13;
+
+static struct Nuitka_AttributeCache attribute_cache_15;
+
+static struct Nuitka_AttributeCache attribute_cache_16;
+
+static struct Nuitka_AttributeCache attribute_cache_17;
+
+static struct Nuitka_AttributeCache attribute_cache_18;
+
+static struct Nuitka_ModuleVariableCache module_variable_cache_1;
+
+static struct Nuitka_ModuleVariableCache module_variable_cache_10;
+
+static struct Nuitka_ModuleVariableCache module_variable_cache_14;
+
+static struct Nuitka_ModuleVariableCache module_variable_cache_2;
+
+static struct Nuitka_ModuleVariableCache module_variable_cache_3;
+
+static struct Nuitka_ModuleVariableCache module_variable_cache_4;
+
+static struct Nuitka_ModuleVariableCache module_variable_cache_5;
+
+static struct Nuitka_ModuleVariableCache module_variable_cache_6;
+
+static struct Nuitka_ModuleVariableCache module_variable_cache_7;
+
+static struct Nuitka_ModuleVariableCache module_variable_cache_8;
+
+static struct Nuitka_ModuleVariableCache module_variable_cache_9;
+
+// The module function definitions.
+static PyObject *impl___main__$$$function_1_cond( struct Nuitka_FunctionObject const *self, PyObject **python_pars )
+{
+    // Preserve error status for checks
+#ifndef __NUITKA_NO_ASSERT__
+    NUITKA_MAY_BE_UNUSED bool had_error = ERROR_OCCURRED();
+#endif
+
+    // Local variable declarations.
+    PyObject *tmp_return_value;
+    tmp_return_value = NULL;
+
+    // Actual function code.
+    tmp_return_value = Py_False;
+    Py_INCREF( tmp_return_value );
+    goto function_return_exit;
+
+    // Return statement must have exited already.
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_1_cond );
+    return NULL;
+
+function_return_exit:
+
+CHECK_OBJECT( tmp_return_value );
+assert( had_error || !ERROR_OCCURRED() );
+return tmp_return_value;
+
+}
+
+
+static PyObject *impl___main__$$$function_2_loopingFunction( struct Nuitka_FunctionObject const *self, PyObject **python_pars )
+{
+    // Preserve error status for checks
+#ifndef __NUITKA_NO_ASSERT__
+    NUITKA_MAY_BE_UNUSED bool had_error = ERROR_OCCURRED();
+#endif
+
+    // Local variable declarations.
+    PyObject *par_a = python_pars[ 0 ];
+    PyObject *var_c = NULL;
+    PyObject *var_f = NULL;
+    PyObject *var_b = NULL;
+    PyObject *var_z = NULL;
+    PyObject *var_m = NULL;
+    PyObject *var_x = NULL;
+    PyObject *var_y = NULL;
+    PyObject *var_l = NULL;
+    PyObject *outline_0_var_u = NULL;
+    PyObject *outline_1_var_u = NULL;
+    PyObject *outline_1_var_v = NULL;
+    PyObject *outline_2_var_u = NULL;
+    PyObject *outline_3_var_u = NULL;
+    PyObject *outline_4_var_m = NULL;
+    PyObject *outline_5_var_f = NULL;
+    PyObject *outline_6_var_l = NULL;
+    nuitka_range_iterator tmp_for_loop_1__for_iterator = { NULL, 0, 0, 0 };
+    PyObject *tmp_for_loop_1__iter_value = NULL;
+    nuitka_range_iterator tmp_for_loop_2__for_iterator = { NULL, 0, 0, 0 };
+    PyObject *tmp_for_loop_2__iter_value = NULL;
+    nuitka_range_iterator tmp_for_loop_3__for_iterator = { NULL, 0, 0, 0 };
+    PyObject *tmp_for_loop_3__iter_value = NULL;
+    PyObject *tmp_for_loop_4__break_indicator = NULL;
+    nuitka_range_iterator tmp_for_loop_4__for_iterator = { NULL, 0, 0, 0 };
+    PyObject *tmp_for_loop_4__iter_value = NULL;
+    PyObject *tmp_listcontraction$listcontraction_1__$0 = NULL;
+    PyObject *tmp_listcontraction$listcontraction_1__contraction = NULL;
+    PyObject *tmp_listcontraction$listcontraction_1__iter_value_0 = NULL;
+    PyObject *tmp_listcontraction$tuple_unpack_1__element_1 = NULL;
+    PyObject *tmp_listcontraction$tuple_unpack_1__element_2 = NULL;
+    nuitka_unpack_iterator tmp_listcontraction$tuple_unpack_1__source_iter = { NULL, NULL };
+    nuitka_range_iterator tmp_listcontraction_1__$0 = { NULL, 0, 0, 0 };
+    PyObject *tmp_listcontraction_1__contraction = NULL;
+    PyObject *tmp_listcontraction_1__iter_value_0 = NULL;
+    PyObject *tmp_listcontraction_2__$0 = NULL;
+    PyObject *tmp_listcontraction_2__contraction = NULL;
+    PyObject *tmp_listcontraction_2__iter_value_0 = NULL;
+    nuitka_range_iterator tmp_listcontraction_3__$0 = { NULL, 0, 0, 0 };
+    PyObject *tmp_listcontraction_3__contraction = NULL;
+    PyObject *tmp_listcontraction_3__iter_value_0 = NULL;
+    PyObject *tmp_listcontraction_4__$0 = NULL;
+    PyObject *tmp_listcontraction_4__contraction = NULL;
+    PyObject *tmp_listcontraction_4__iter_value_0 = NULL;
+    PyObject *tmp_listcontraction_5__$0 = NULL;
+    PyObject *tmp_listcontraction_5__contraction = NULL;
+    PyObject *tmp_listcontraction_5__iter_value_0 = NULL;
+    nuitka_range_iterator tmp_listcontraction_6__$0 = { NULL, 0, 0, 0 };
+    PyObject *tmp_listcontraction_6__contraction = NULL;
+    PyObject *tmp_listcontraction_6__iter_value_0 = NULL;
+    PyObject *exception_type = NULL;
+    PyObject *exception_value = NULL;
+    PyTracebackObject *exception_tb = NULL;
+    NUITKA_MAY_BE_UNUSED int exception_lineno = 0;
+    PyObject *exception_keeper_type_1;
+    PyObject *exception_keeper_value_1;
+    PyTracebackObject *exception_keeper_tb_1;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_1;
+    PyObject *exception_keeper_type_2;
+    PyObject *exception_keeper_value_2;
+    PyTracebackObject *exception_keeper_tb_2;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_2;
+    PyObject *exception_keeper_type_3;
+    PyObject *exception_keeper_value_3;
+    PyTracebackObject *exception_keeper_tb_3;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_3;
+    PyObject *exception_keeper_type_4;
+    PyObject *exception_keeper_value_4;
+    PyTracebackObject *exception_keeper_tb_4;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_4;
+    PyObject *exception_keeper_type_5;
+    PyObject *exception_keeper_value_5;
+    PyTracebackObject *exception_keeper_tb_5;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_5;
+    PyObject *exception_keeper_type_6;
+    PyObject *exception_keeper_value_6;
+    PyTracebackObject *exception_keeper_tb_6;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_6;
+    PyObject *exception_keeper_type_7;
+    PyObject *exception_keeper_value_7;
+    PyTracebackObject *exception_keeper_tb_7;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_7;
+    PyObject *exception_keeper_type_8;
+    PyObject *exception_keeper_value_8;
+    PyTracebackObject *exception_keeper_tb_8;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_8;
+    PyObject *exception_keeper_type_9;
+    PyObject *exception_keeper_value_9;
+    PyTracebackObject *exception_keeper_tb_9;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_9;
+    PyObject *exception_keeper_type_10;
+    PyObject *exception_keeper_value_10;
+    PyTracebackObject *exception_keeper_tb_10;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_10;
+    PyObject *exception_keeper_type_11;
+    PyObject *exception_keeper_value_11;
+    PyTracebackObject *exception_keeper_tb_11;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_11;
+    PyObject *exception_keeper_type_12;
+    PyObject *exception_keeper_value_12;
+    PyTracebackObject *exception_keeper_tb_12;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_12;
+    PyObject *exception_keeper_type_13;
+    PyObject *exception_keeper_value_13;
+    PyTracebackObject *exception_keeper_tb_13;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_13;
+    PyObject *exception_keeper_type_14;
+    PyObject *exception_keeper_value_14;
+    PyTracebackObject *exception_keeper_tb_14;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_14;
+    PyObject *exception_keeper_type_15;
+    PyObject *exception_keeper_value_15;
+    PyTracebackObject *exception_keeper_tb_15;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_15;
+    PyObject *exception_keeper_type_16;
+    PyObject *exception_keeper_value_16;
+    PyTracebackObject *exception_keeper_tb_16;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_16;
+    PyObject *exception_keeper_type_17;
+    PyObject *exception_keeper_value_17;
+    PyTracebackObject *exception_keeper_tb_17;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_17;
+    PyObject *exception_keeper_type_18;
+    PyObject *exception_keeper_value_18;
+    PyTracebackObject *exception_keeper_tb_18;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_18;
+    PyObject *exception_keeper_type_19;
+    PyObject *exception_keeper_value_19;
+    PyTracebackObject *exception_keeper_tb_19;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_19;
+    PyObject *exception_keeper_type_20;
+    PyObject *exception_keeper_value_20;
+    PyTracebackObject *exception_keeper_tb_20;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_20;
+    PyObject *exception_keeper_type_21;
+    PyObject *exception_keeper_value_21;
+    PyTracebackObject *exception_keeper_tb_21;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_21;
+    PyObject *exception_keeper_type_22;
+    PyObject *exception_keeper_value_22;
+    PyTracebackObject *exception_keeper_tb_22;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_22;
+    PyObject *exception_keeper_type_23;
+    PyObject *exception_keeper_value_23;
+    PyTracebackObject *exception_keeper_tb_23;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_23;
+    PyObject *exception_keeper_type_24;
+    PyObject *exception_keeper_value_24;
+    PyTracebackObject *exception_keeper_tb_24;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_24;
+    PyObject *exception_keeper_type_25;
+    PyObject *exception_keeper_value_25;
+    PyTracebackObject *exception_keeper_tb_25;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_25;
+    PyObject *exception_keeper_type_26;
+    PyObject *exception_keeper_value_26;
+    PyTracebackObject *exception_keeper_tb_26;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_26;
+    PyObject *exception_keeper_type_27;
+    PyObject *exception_keeper_value_27;
+    PyTracebackObject *exception_keeper_tb_27;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_27;
+    PyObject *exception_keeper_type_28;
+    PyObject *exception_keeper_value_28;
+    PyTracebackObject *exception_keeper_tb_28;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_28;
+    PyObject *exception_keeper_type_29;
+    PyObject *exception_keeper_value_29;
+    PyTracebackObject *exception_keeper_tb_29;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_29;
+    PyObject *exception_keeper_type_30;
+    PyObject *exception_keeper_value_30;
+    PyTracebackObject *exception_keeper_tb_30;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_30;
+    PyObject *exception_keeper_type_31;
+    PyObject *exception_keeper_value_31;
+    PyTracebackObject *exception_keeper_tb_31;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_31;
+    PyObject *exception_keeper_type_32;
+    PyObject *exception_keeper_value_32;
+    PyTracebackObject *exception_keeper_tb_32;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_32;
+    PyObject *exception_keeper_type_33;
+    PyObject *exception_keeper_value_33;
+    PyTracebackObject *exception_keeper_tb_33;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_33;
+    PyObject *exception_keeper_type_34;
+    PyObject *exception_keeper_value_34;
+    PyTracebackObject *exception_keeper_tb_34;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_34;
+    PyObject *exception_keeper_type_35;
+    PyObject *exception_keeper_value_35;
+    PyTracebackObject *exception_keeper_tb_35;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_35;
+    PyObject *exception_keeper_type_36;
+    PyObject *exception_keeper_value_36;
+    PyTracebackObject *exception_keeper_tb_36;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_36;
+    int tmp_and_left_truth_1;
+    int tmp_and_left_truth_2;
+    int tmp_and_left_truth_3;
+    int tmp_and_left_truth_4;
+    PyObject *tmp_and_left_value_1;
+    PyObject *tmp_and_left_value_2;
+    PyObject *tmp_and_left_value_3;
+    PyObject *tmp_and_left_value_4;
+    PyObject *tmp_and_right_value_1;
+    PyObject *tmp_and_right_value_2;
+    PyObject *tmp_and_right_value_3;
+    PyObject *tmp_and_right_value_4;
+    PyObject *tmp_append_list_1;
+    PyObject *tmp_append_list_2;
+    PyObject *tmp_append_list_3;
+    PyObject *tmp_append_list_4;
+    PyObject *tmp_append_list_5;
+    PyObject *tmp_append_list_6;
+    PyObject *tmp_append_list_7;
+    PyObject *tmp_append_value_1;
+    PyObject *tmp_append_value_2;
+    PyObject *tmp_append_value_3;
+    PyObject *tmp_append_value_4;
+    PyObject *tmp_append_value_5;
+    PyObject *tmp_append_value_6;
+    PyObject *tmp_append_value_7;
+    PyObject *tmp_args_element_name_1;
+    PyObject *tmp_args_element_name_2;
+    PyObject *tmp_args_element_name_3;
+    PyObject *tmp_args_element_name_4;
+    PyObject *tmp_args_element_name_5;
+    PyObject *tmp_args_element_name_6;
+    PyObject *tmp_args_element_name_7;
+    PyObject *tmp_args_element_name_8;
+    PyObject *tmp_args_element_name_9;
+    PyObject *tmp_args_element_name_10;
+    PyObject *tmp_args_element_name_11;
+    PyObject *tmp_args_element_name_12;
+    PyObject *tmp_args_element_name_13;
+    PyObject *tmp_args_element_name_14;
+    PyObject *tmp_args_element_name_15;
+    PyObject *tmp_args_element_name_16;
+    PyObject *tmp_args_element_name_17;
+    PyObject *tmp_args_element_name_18;
+    PyObject *tmp_assign_source_1;
+    PyObject *tmp_assign_source_2;
+    PyObject *tmp_assign_source_3;
+    PyObject *tmp_assign_source_4;
+    PyObject *tmp_assign_source_5;
+    PyObject *tmp_assign_source_6;
+    PyObject *tmp_assign_source_7;
+    PyObject *tmp_assign_source_8;
+    PyObject *tmp_assign_source_9;
+    PyObject *tmp_assign_source_10;
+    PyObject *tmp_assign_source_11;
+    PyObject *tmp_assign_source_12;
+    PyObject *tmp_assign_source_13;
+    PyObject *tmp_assign_source_14;
+    PyObject *tmp_assign_source_15;
+    PyObject *tmp_assign_source_16;
+    PyObject *tmp_assign_source_17;
+    PyObject *tmp_assign_source_18;
+    PyObject *tmp_assign_source_19;
+    PyObject *tmp_assign_source_20;
+    PyObject *tmp_assign_source_21;
+    PyObject *tmp_assign_source_22;
+    PyObject *tmp_assign_source_23;
+    PyObject *tmp_assign_source_24;
+    PyObject *tmp_assign_source_25;
+    PyObject *tmp_assign_source_26;
+    PyObject *tmp_assign_source_27;
+    PyObject *tmp_assign_source_28;
+    PyObject *tmp_assign_source_29;
+    PyObject *tmp_assign_source_30;
+    PyObject *tmp_assign_source_31;
+    PyObject *tmp_assign_source_32;
+    PyObject *tmp_assign_source_33;
+    PyObject *tmp_assign_source_34;
+    PyObject *tmp_assign_source_35;
+    PyObject *tmp_assign_source_36;
+    PyObject *tmp_assign_source_37;
+    PyObject *tmp_assign_source_38;
+    PyObject *tmp_assign_source_39;
+    PyObject *tmp_assign_source_40;
+    PyObject *tmp_assign_source_41;
+    PyObject *tmp_assign_source_42;
+    PyObject *tmp_assign_source_43;
+    PyObject *tmp_assign_source_44;
+    PyObject *tmp_assign_source_45;
+    PyObject *tmp_assign_source_46;
+    PyObject *tmp_assign_source_47;
+    PyObject *tmp_assign_source_48;
+    PyObject *tmp_assign_source_49;
+    PyObject *tmp_assign_source_50;
+    PyObject *tmp_assign_source_51;
+    PyObject *tmp_assign_source_52;
+    PyObject *tmp_assign_source_53;
+    PyObject *tmp_assign_source_54;
+    PyObject *tmp_bool_arg_1;
+    PyObject *tmp_called_name_1;
+    PyObject *tmp_called_name_2;
+    PyObject *tmp_called_name_3;
+    PyObject *tmp_called_name_4;
+    PyObject *tmp_called_name_5;
+    PyObject *tmp_called_name_6;
+    PyObject *tmp_called_name_7;
+    PyObject *tmp_called_name_8;
+    PyObject *tmp_called_name_9;
+    PyObject *tmp_called_name_10;
+    PyObject *tmp_called_name_11;
+    PyObject *tmp_called_name_12;
+    PyObject *tmp_called_name_13;
+    PyObject *tmp_called_name_14;
+    PyObject *tmp_called_name_15;
+    PyObject *tmp_called_name_16;
+    PyObject *tmp_called_name_17;
+    PyObject *tmp_called_name_18;
+    PyObject *tmp_called_name_19;
+    PyObject *tmp_called_name_20;
+    PyObject *tmp_called_name_21;
+    PyObject *tmp_called_name_22;
+    PyObject *tmp_called_name_23;
+    PyObject *tmp_called_name_24;
+    PyObject *tmp_called_name_25;
+    PyObject *tmp_called_name_26;
+    PyObject *tmp_called_name_27;
+    PyObject *tmp_called_name_28;
+    PyObject *tmp_called_name_29;
+    PyObject *tmp_called_name_30;
+    PyObject *tmp_called_name_31;
+    PyObject *tmp_called_name_32;
+    PyObject *tmp_called_name_33;
+    int tmp_cmp_Eq_1;
+    int tmp_cmp_Eq_2;
+    int tmp_cmp_Eq_3;
+    int tmp_cmp_Eq_4;
+    int tmp_cmp_Eq_5;
+    int tmp_cmp_Lt_1;
+    int tmp_cmp_Lt_2;
+    int tmp_cmp_NotEq_1;
+    PyObject *tmp_compare_left_1;
+    PyObject *tmp_compare_left_2;
+    PyObject *tmp_compare_left_3;
+    PyObject *tmp_compare_left_4;
+    PyObject *tmp_compare_left_5;
+    PyObject *tmp_compare_left_6;
+    PyObject *tmp_compare_left_7;
+    PyObject *tmp_compare_left_8;
+    PyObject *tmp_compare_left_9;
+    PyObject *tmp_compare_left_10;
+    PyObject *tmp_compare_left_11;
+    PyObject *tmp_compare_left_12;
+    PyObject *tmp_compare_left_13;
+    PyObject *tmp_compare_left_14;
+    PyObject *tmp_compare_left_15;
+    PyObject *tmp_compare_left_16;
+    PyObject *tmp_compare_left_17;
+    PyObject *tmp_compare_left_18;
+    PyObject *tmp_compare_left_19;
+    PyObject *tmp_compare_left_20;
+    PyObject *tmp_compare_right_1;
+    PyObject *tmp_compare_right_2;
+    PyObject *tmp_compare_right_3;
+    PyObject *tmp_compare_right_4;
+    PyObject *tmp_compare_right_5;
+    PyObject *tmp_compare_right_6;
+    PyObject *tmp_compare_right_7;
+    PyObject *tmp_compare_right_8;
+    PyObject *tmp_compare_right_9;
+    PyObject *tmp_compare_right_10;
+    PyObject *tmp_compare_right_11;
+    PyObject *tmp_compare_right_12;
+    PyObject *tmp_compare_right_13;
+    PyObject *tmp_compare_right_14;
+    PyObject *tmp_compare_right_15;
+    PyObject *tmp_compare_right_16;
+    PyObject *tmp_compare_right_17;
+    PyObject *tmp_compare_right_18;
+    PyObject *tmp_compare_right_19;
+    PyObject *tmp_compare_right_20;
+    PyObject *tmp_compexpr_left_1;
+    PyObject *tmp_compexpr_left_2;
+    PyObject *tmp_compexpr_right_1;
+    PyObject *tmp_compexpr_right_2;
+    int tmp_cond_truth_1;
+    int tmp_cond_truth_2;
+    int tmp_cond_truth_3;
+    int tmp_cond_truth_4;
+    int tmp_cond_truth_5;
+    int tmp_cond_truth_6;
+    int tmp_cond_truth_7;
+    int tmp_cond_truth_8;
+    int tmp_cond_truth_9;
+    int tmp_cond_truth_10;
+    int tmp_cond_truth_11;
+    int tmp_cond_truth_12;
+    int tmp_cond_truth_13;
+    PyObject *tmp_cond_value_1;
+    PyObject *tmp_cond_value_2;
+    PyObject *tmp_cond_value_3;
+    PyObject *tmp_cond_value_4;
+    PyObject *tmp_cond_value_5;
+    PyObject *tmp_cond_value_6;
+    PyObject *tmp_cond_value_7;
+    PyObject *tmp_cond_value_8;
+    PyObject *tmp_cond_value_9;
+    PyObject *tmp_cond_value_10;
+    PyObject *tmp_cond_value_11;
+    PyObject *tmp_cond_value_12;
+    PyObject *tmp_cond_value_13;
+    int tmp_exc_match_exception_match_1;
+    int tmp_exc_match_exception_match_2;
+    int tmp_exc_match_exception_match_3;
+    int tmp_exc_match_exception_match_4;
+    int tmp_exc_match_exception_match_5;
+    int tmp_exc_match_exception_match_6;
+    int tmp_exc_match_exception_match_7;
+    int tmp_exc_match_exception_match_8;
+    int tmp_exc_match_exception_match_9;
+    int tmp_exc_match_exception_match_10;
+    int tmp_exc_match_exception_match_11;
+    bool tmp_is_1;
+    PyObject *tmp_iter_arg_1;
+    PyObject *tmp_iter_arg_2;
+    PyObject *tmp_iter_arg_3;
+    PyObject *tmp_iter_arg_4;
+    PyObject *tmp_iter_arg_5;
+    PyObject *tmp_left_name_1;
+    PyObject *tmp_left_name_2;
+    PyObject *tmp_left_name_3;
+    PyObject *tmp_left_name_4;
+    PyObject *tmp_left_name_5;
+    PyObject *tmp_list_element_1;
+    int tmp_or_left_truth_1;
+    int tmp_or_left_truth_2;
+    int tmp_or_left_truth_3;
+    int tmp_or_left_truth_4;
+    PyObject *tmp_or_left_value_1;
+    PyObject *tmp_or_left_value_2;
+    PyObject *tmp_or_left_value_3;
+    PyObject *tmp_or_left_value_4;
+    PyObject *tmp_or_right_value_1;
+    PyObject *tmp_or_right_value_2;
+    PyObject *tmp_or_right_value_3;
+    PyObject *tmp_or_right_value_4;
+    PyObject *tmp_outline_return_value_1;
+    PyObject *tmp_outline_return_value_2;
+    PyObject *tmp_outline_return_value_3;
+    PyObject *tmp_outline_return_value_4;
+    PyObject *tmp_outline_return_value_5;
+    PyObject *tmp_outline_return_value_6;
+    PyObject *tmp_outline_return_value_7;
+    int tmp_res;
+    bool tmp_result;
+    PyObject *tmp_return_value;
+    PyObject *tmp_right_name_1;
+    PyObject *tmp_right_name_2;
+    PyObject *tmp_right_name_3;
+    PyObject *tmp_right_name_4;
+    PyObject *tmp_right_name_5;
+    PyObject *tmp_source_name_1;
+    PyObject *tmp_source_name_2;
+    PyObject *tmp_source_name_3;
+    PyObject *tmp_tuple_element_1;
+    PyObject *tmp_tuple_element_2;
+    PyObject *tmp_tuple_element_3;
+    PyObject *tmp_tuple_element_4;
+    PyObject *tmp_tuple_element_5;
+    NUITKA_MAY_BE_UNUSED PyObject *tmp_unused;
+    PyObject *tmp_value_name_1;
+    PyObject *tmp_value_name_2;
+    PyObject *tmp_value_name_3;
+    PyObject *tmp_value_name_4;
+    PyObject *tmp_value_name_5;
+    PyObject *tmp_value_name_6;
+    static struct Nuitka_FrameObject *cache_frame_2b0023940deba7475747880c52bdbd04_2[ _NUITKA_FRAME_CACHE_DEPTH ];
+static int cache_depth_frame_2b0023940deba7475747880c52bdbd04_2 = 0;
+int depth_frame_2b0023940deba7475747880c52bdbd04_2;
+
+    struct Nuitka_FrameObject *frame_2b0023940deba7475747880c52bdbd04_2;
+
+    static struct Nuitka_FrameObject *cache_frame_197c1c7622fb164d676e5bf59a244c2f_3[ _NUITKA_FRAME_CACHE_DEPTH ];
+static int cache_depth_frame_197c1c7622fb164d676e5bf59a244c2f_3 = 0;
+int depth_frame_197c1c7622fb164d676e5bf59a244c2f_3;
+
+    struct Nuitka_FrameObject *frame_197c1c7622fb164d676e5bf59a244c2f_3;
+
+    static struct Nuitka_FrameObject *cache_frame_a5f3d7fdf5c302d50b2785ec260c380c_4[ _NUITKA_FRAME_CACHE_DEPTH ];
+static int cache_depth_frame_a5f3d7fdf5c302d50b2785ec260c380c_4 = 0;
+int depth_frame_a5f3d7fdf5c302d50b2785ec260c380c_4;
+
+    struct Nuitka_FrameObject *frame_a5f3d7fdf5c302d50b2785ec260c380c_4;
+
+    static struct Nuitka_FrameObject *cache_frame_d919de034351cc8afb31200f0bd3bc19_5[ _NUITKA_FRAME_CACHE_DEPTH ];
+static int cache_depth_frame_d919de034351cc8afb31200f0bd3bc19_5 = 0;
+int depth_frame_d919de034351cc8afb31200f0bd3bc19_5;
+
+    struct Nuitka_FrameObject *frame_d919de034351cc8afb31200f0bd3bc19_5;
+
+    static struct Nuitka_FrameObject *cache_frame_5b666e34b945b996018bf705374600f5_6[ _NUITKA_FRAME_CACHE_DEPTH ];
+static int cache_depth_frame_5b666e34b945b996018bf705374600f5_6 = 0;
+int depth_frame_5b666e34b945b996018bf705374600f5_6;
+
+    struct Nuitka_FrameObject *frame_5b666e34b945b996018bf705374600f5_6;
+
+    static struct Nuitka_FrameObject *cache_frame_952db0bde0028542233c83c413f3c46b_8[ _NUITKA_FRAME_CACHE_DEPTH ];
+static int cache_depth_frame_952db0bde0028542233c83c413f3c46b_8 = 0;
+int depth_frame_952db0bde0028542233c83c413f3c46b_8;
+
+    struct Nuitka_FrameObject *frame_952db0bde0028542233c83c413f3c46b_8;
+
+    static struct Nuitka_FrameObject *cache_frame_572eb9fa48c335f9925d1f6c31523968_7[ _NUITKA_FRAME_CACHE_DEPTH ];
+static int cache_depth_frame_572eb9fa48c335f9925d1f6c31523968_7 = 0;
+int depth_frame_572eb9fa48c335f9925d1f6c31523968_7;
+
+    struct Nuitka_FrameObject *frame_572eb9fa48c335f9925d1f6c31523968_7;
+
+    static struct Nuitka_FrameObject *cache_frame_1d5d805b093e3794243f2bcdb5ece1e3[ _NUITKA_FRAME_CACHE_DEPTH ];
+static int cache_depth_frame_1d5d805b093e3794243f2bcdb5ece1e3 = 0;
+int depth_frame_1d5d805b093e3794243f2bcdb5ece1e3;
+
+    struct Nuitka_FrameObject *frame_1d5d805b093e3794243f2bcdb5ece1e3;
+
+    NUITKA_MAY_BE_UNUSED char const *type_description_1 = NULL;
+    NUITKA_MAY_BE_UNUSED char const *type_description_2 = NULL;
+    NUITKA_MAY_BE_UNUSED char const *type_description_3 = NULL;
+    NUITKA_MAY_BE_UNUSED char const *type_description_4 = NULL;
+    NUITKA_MAY_BE_UNUSED char const *type_description_5 = NULL;
+    NUITKA_MAY_BE_UNUSED char const *type_description_6 = NULL;
+    NUITKA_MAY_BE_UNUSED char const *type_description_7 = NULL;
+    NUITKA_MAY_BE_UNUSED char const *type_description_8 = NULL;
+    tmp_return_value = NULL;
+    tmp_outline_return_value_1 = NULL;
+    tmp_outline_return_value_2 = NULL;
+    tmp_outline_return_value_3 = NULL;
+    tmp_outline_return_value_4 = NULL;
+    tmp_outline_return_value_5 = NULL;
+    tmp_outline_return_value_6 = NULL;
+    tmp_outline_return_value_7 = NULL;
+
+    // Actual function code.
+    tmp_assign_source_1 = PyList_New( 0 );
+    assert( var_c == NULL );
+    var_c = tmp_assign_source_1;
+
+    tmp_assign_source_2 = PyList_New( 2 );
+    tmp_list_element_1 = var_c;
+
+    CHECK_OBJECT( tmp_list_element_1 );
+    Py_INCREF( tmp_list_element_1 );
+    PyList_SET_ITEM( tmp_assign_source_2, 0, tmp_list_element_1 );
+    tmp_list_element_1 = par_a;
+
+    CHECK_OBJECT( tmp_list_element_1 );
+    Py_INCREF( tmp_list_element_1 );
+    PyList_SET_ITEM( tmp_assign_source_2, 1, tmp_list_element_1 );
+    assert( var_f == NULL );
+    var_f = tmp_assign_source_2;
+
+    tmp_result = MAKE_RANGE_ITERATOR( &tmp_for_loop_1__for_iterator, const_int_0, const_int_pos_6, const_int_pos_1, true );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+
+
+        goto function_exception_exit;
+    }
+    // Tried code:
+    depth_frame_1d5d805b093e3794243f2bcdb5ece1e3 = cache_depth_frame_1d5d805b093e3794243f2bcdb5ece1e3++;
+    MAKE_OR_REUSE_FRAME( FRAME_CACHE_SLOT( cache_frame_1d5d805b093e3794243f2bcdb5ece1e3, depth_frame_1d5d805b093e3794243f2bcdb5ece1e3 ), codeobj_1d5d805b093e3794243f2bcdb5ece1e3, module___main__, sizeof(void *)+sizeof(void *)+sizeof(void *)+sizeof(void *)+sizeof(void *)+sizeof(void *)+sizeof(void *)+sizeof(void *)+sizeof(void *)+sizeof(void *) );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3 = FRAME_CACHE_SLOT( cache_frame_1d5d805b093e3794243f2bcdb5ece1e3, depth_frame_1d5d805b093e3794243f2bcdb5ece1e3 );
+
+    // Push the new frame as the currently active one.
+    pushFrameStack( frame_1d5d805b093e3794243f2bcdb5ece1e3 );
+
+    // Mark the frame object as in use, ref count 1 will be up for reuse.
+    assert( Py_REFCNT( frame_1d5d805b093e3794243f2bcdb5ece1e3 ) == 2 ); // Frame stack
+
+    // Framed code:
+    // Tried code:
+    loop_start_1:;
+    // Tried code:
+    tmp_assign_source_3 = RANGE_ITERATOR_NEXT( &tmp_for_loop_1__for_iterator );
+    if ( tmp_assign_source_3 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_1 = "oooooooooN";
+        exception_lineno = 27;
+        goto try_except_handler_3;
+    }
+    {
+        PyObject *old = tmp_for_loop_1__iter_value;
+        tmp_for_loop_1__iter_value = tmp_assign_source_3;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_1;
+    // Exception handler code:
+    try_except_handler_3:;
+    exception_keeper_type_1 = exception_type;
+    exception_keeper_value_1 = exception_value;
+    exception_keeper_tb_1 = exception_tb;
+    exception_keeper_lineno_1 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_1 = exception_keeper_type_1;
+    tmp_compare_right_1 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_1 = EXCEPTION_MATCH_BOOL( tmp_compare_left_1, tmp_compare_right_1 );
+    if ( tmp_exc_match_exception_match_1 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_1 );
+        Py_XDECREF( exception_keeper_value_1 );
+        Py_XDECREF( exception_keeper_tb_1 );
+
+        exception_lineno = 27;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_2;
+    }
+    if ( tmp_exc_match_exception_match_1 == 1 )
+    {
+        goto branch_yes_1;
+    }
+    else
+    {
+        goto branch_no_1;
+    }
+    branch_yes_1:;
+    Py_DECREF( exception_keeper_type_1 );
+    Py_XDECREF( exception_keeper_value_1 );
+    Py_XDECREF( exception_keeper_tb_1 );
+    goto loop_end_1;
+    goto branch_end_1;
+    branch_no_1:;
+    // Re-raise.
+    exception_type = exception_keeper_type_1;
+    exception_value = exception_keeper_value_1;
+    exception_tb = exception_keeper_tb_1;
+    exception_lineno = exception_keeper_lineno_1;
+
+    goto try_except_handler_2;
+    branch_end_1:;
+    // End of try:
+    try_end_1:;
+    tmp_assign_source_4 = tmp_for_loop_1__iter_value;
+
+    CHECK_OBJECT( tmp_assign_source_4 );
+    {
+        PyObject *old = par_a;
+        par_a = tmp_assign_source_4;
+        Py_INCREF( par_a );
+        Py_XDECREF( old );
+    }
+
+    Py_XDECREF( tmp_for_loop_2__for_iterator.iterator );
+    tmp_for_loop_2__for_iterator.iterator = NULL;
+    tmp_result = MAKE_RANGE_ITERATOR( &tmp_for_loop_2__for_iterator, const_int_0, const_int_pos_8, const_int_pos_1, true );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 28;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_2;
+    }
+    // Tried code:
+    loop_start_2:;
+    // Tried code:
+    tmp_assign_source_5 = RANGE_ITERATOR_NEXT( &tmp_for_loop_2__for_iterator );
+    if ( tmp_assign_source_5 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_1 = "oooooooooN";
+        exception_lineno = 28;
+        goto try_except_handler_5;
+    }
+    {
+        PyObject *old = tmp_for_loop_2__iter_value;
+        tmp_for_loop_2__iter_value = tmp_assign_source_5;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_2;
+    // Exception handler code:
+    try_except_handler_5:;
+    exception_keeper_type_2 = exception_type;
+    exception_keeper_value_2 = exception_value;
+    exception_keeper_tb_2 = exception_tb;
+    exception_keeper_lineno_2 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_2 = exception_keeper_type_2;
+    tmp_compare_right_2 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_2 = EXCEPTION_MATCH_BOOL( tmp_compare_left_2, tmp_compare_right_2 );
+    if ( tmp_exc_match_exception_match_2 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_2 );
+        Py_XDECREF( exception_keeper_value_2 );
+        Py_XDECREF( exception_keeper_tb_2 );
+
+        exception_lineno = 28;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    if ( tmp_exc_match_exception_match_2 == 1 )
+    {
+        goto branch_yes_2;
+    }
+    else
+    {
+        goto branch_no_2;
+    }
+    branch_yes_2:;
+    Py_DECREF( exception_keeper_type_2 );
+    Py_XDECREF( exception_keeper_value_2 );
+    Py_XDECREF( exception_keeper_tb_2 );
+    goto loop_end_2;
+    goto branch_end_2;
+    branch_no_2:;
+    // Re-raise.
+    exception_type = exception_keeper_type_2;
+    exception_value = exception_keeper_value_2;
+    exception_tb = exception_keeper_tb_2;
+    exception_lineno = exception_keeper_lineno_2;
+
+    goto try_except_handler_4;
+    branch_end_2:;
+    // End of try:
+    try_end_2:;
+    tmp_assign_source_6 = tmp_for_loop_2__iter_value;
+
+    CHECK_OBJECT( tmp_assign_source_6 );
+    {
+        PyObject *old = var_b;
+        var_b = tmp_assign_source_6;
+        Py_INCREF( var_b );
+        Py_XDECREF( old );
+    }
+
+    tmp_compare_left_3 = par_a;
+
+    if ( tmp_compare_left_3 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "a" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 29;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    tmp_compare_right_3 = var_b;
+
+    CHECK_OBJECT( tmp_compare_right_3 );
+    tmp_cmp_Eq_1 = RICH_COMPARE_BOOL_EQ( tmp_compare_left_3, tmp_compare_right_3 );
+    if ( tmp_cmp_Eq_1 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 29;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    if ( tmp_cmp_Eq_1 == 1 )
+    {
+        goto branch_yes_3;
+    }
+    else
+    {
+        goto branch_no_3;
+    }
+    branch_yes_3:;
+    tmp_source_name_1 = var_c;
+
+    if ( tmp_source_name_1 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "c" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 30;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    tmp_called_name_1 = LOOKUP_ATTRIBUTE_CACHED( tmp_source_name_1, const_str_plain_append, &attribute_cache_11 );
+    if ( tmp_called_name_1 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 30;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    tmp_args_element_name_1 = PyTuple_New( 3 );
+    tmp_tuple_element_1 = par_a;
+
+    if ( tmp_tuple_element_1 == NULL )
+    {
+        Py_DECREF( tmp_called_name_1 );
+        Py_DECREF( tmp_args_element_name_1 );
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "a" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 30;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    Py_INCREF( tmp_tuple_element_1 );
+    PyTuple_SET_ITEM( tmp_args_element_name_1, 0, tmp_tuple_element_1 );
+    tmp_tuple_element_1 = var_b;
+
+    if ( tmp_tuple_element_1 == NULL )
+    {
+        Py_DECREF( tmp_called_name_1 );
+        Py_DECREF( tmp_args_element_name_1 );
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "b" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 30;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    Py_INCREF( tmp_tuple_element_1 );
+    PyTuple_SET_ITEM( tmp_args_element_name_1, 1, tmp_tuple_element_1 );
+    tmp_tuple_element_1 = Py_True;
+    Py_INCREF( tmp_tuple_element_1 );
+    PyTuple_SET_ITEM( tmp_args_element_name_1, 2, tmp_tuple_element_1 );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 30;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_1 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_1, call_args );
+    }
+
+    Py_DECREF( tmp_called_name_1 );
+    Py_DECREF( tmp_args_element_name_1 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 30;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    Py_DECREF( tmp_unused );
+    goto branch_end_3;
+    branch_no_3:;
+    tmp_compare_left_4 = par_a;
+
+    if ( tmp_compare_left_4 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "a" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 31;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    tmp_compare_right_4 = var_b;
+
+    if ( tmp_compare_right_4 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "b" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 31;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    tmp_cmp_Lt_1 = RICH_COMPARE_BOOL_LT( tmp_compare_left_4, tmp_compare_right_4 );
+    if ( tmp_cmp_Lt_1 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 31;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    if ( tmp_cmp_Lt_1 == 1 )
+    {
+        goto branch_yes_4;
+    }
+    else
+    {
+        goto branch_no_4;
+    }
+    branch_yes_4:;
+    tmp_source_name_2 = var_c;
+
+    if ( tmp_source_name_2 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "c" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 32;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    tmp_called_name_2 = LOOKUP_ATTRIBUTE_CACHED( tmp_source_name_2, const_str_plain_append, &attribute_cache_12 );
+    if ( tmp_called_name_2 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 32;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    tmp_args_element_name_2 = PyTuple_New( 3 );
+    tmp_tuple_element_2 = var_b;
+
+    if ( tmp_tuple_element_2 == NULL )
+    {
+        Py_DECREF( tmp_called_name_2 );
+        Py_DECREF( tmp_args_element_name_2 );
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "b" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 32;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    Py_INCREF( tmp_tuple_element_2 );
+    PyTuple_SET_ITEM( tmp_args_element_name_2, 0, tmp_tuple_element_2 );
+    tmp_tuple_element_2 = par_a;
+
+    if ( tmp_tuple_element_2 == NULL )
+    {
+        Py_DECREF( tmp_called_name_2 );
+        Py_DECREF( tmp_args_element_name_2 );
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "a" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 32;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    Py_INCREF( tmp_tuple_element_2 );
+    PyTuple_SET_ITEM( tmp_args_element_name_2, 1, tmp_tuple_element_2 );
+    tmp_tuple_element_2 = Py_False;
+    Py_INCREF( tmp_tuple_element_2 );
+    PyTuple_SET_ITEM( tmp_args_element_name_2, 2, tmp_tuple_element_2 );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 32;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_2 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_2, call_args );
+    }
+
+    Py_DECREF( tmp_called_name_2 );
+    Py_DECREF( tmp_args_element_name_2 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 32;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    Py_DECREF( tmp_unused );
+    goto branch_end_4;
+    branch_no_4:;
+    tmp_source_name_3 = var_c;
+
+    if ( tmp_source_name_3 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "c" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 34;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    tmp_called_name_3 = LOOKUP_ATTRIBUTE_CACHED( tmp_source_name_3, const_str_plain_append, &attribute_cache_13 );
+    if ( tmp_called_name_3 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 34;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    tmp_args_element_name_3 = PyTuple_New( 3 );
+    tmp_tuple_element_3 = par_a;
+
+    if ( tmp_tuple_element_3 == NULL )
+    {
+        Py_DECREF( tmp_called_name_3 );
+        Py_DECREF( tmp_args_element_name_3 );
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "a" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 34;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    Py_INCREF( tmp_tuple_element_3 );
+    PyTuple_SET_ITEM( tmp_args_element_name_3, 0, tmp_tuple_element_3 );
+    tmp_tuple_element_3 = var_b;
+
+    if ( tmp_tuple_element_3 == NULL )
+    {
+        Py_DECREF( tmp_called_name_3 );
+        Py_DECREF( tmp_args_element_name_3 );
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "b" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 34;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    Py_INCREF( tmp_tuple_element_3 );
+    PyTuple_SET_ITEM( tmp_args_element_name_3, 1, tmp_tuple_element_3 );
+    tmp_tuple_element_3 = Py_False;
+    Py_INCREF( tmp_tuple_element_3 );
+    PyTuple_SET_ITEM( tmp_args_element_name_3, 2, tmp_tuple_element_3 );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 34;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_3 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_3, call_args );
+    }
+
+    Py_DECREF( tmp_called_name_3 );
+    Py_DECREF( tmp_args_element_name_3 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 34;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    Py_DECREF( tmp_unused );
+    branch_end_4:;
+    branch_end_3:;
+    tmp_compare_left_5 = par_a;
+
+    if ( tmp_compare_left_5 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "a" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 36;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    tmp_compare_right_5 = var_b;
+
+    if ( tmp_compare_right_5 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "b" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 36;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    tmp_cmp_NotEq_1 = RICH_COMPARE_BOOL_NE( tmp_compare_left_5, tmp_compare_right_5 );
+    if ( tmp_cmp_NotEq_1 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 36;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    if ( tmp_cmp_NotEq_1 == 1 )
+    {
+        goto branch_yes_5;
+    }
+    else
+    {
+        goto branch_no_5;
+    }
+    branch_yes_5:;
+    tmp_assign_source_7 = const_int_pos_1;
+    {
+        PyObject *old = var_z;
+        var_z = tmp_assign_source_7;
+        Py_INCREF( var_z );
+        Py_XDECREF( old );
+    }
+
+    goto branch_end_5;
+    branch_no_5:;
+    tmp_assign_source_8 = const_int_0;
+    {
+        PyObject *old = var_z;
+        var_z = tmp_assign_source_8;
+        Py_INCREF( var_z );
+        Py_XDECREF( old );
+    }
+
+    branch_end_5:;
+    tmp_compare_left_6 = var_z;
+
+    CHECK_OBJECT( tmp_compare_left_6 );
+    tmp_compare_right_6 = const_int_0;
+    tmp_cmp_Eq_2 = RICH_COMPARE_BOOL_EQ( tmp_compare_left_6, tmp_compare_right_6 );
+    if ( tmp_cmp_Eq_2 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 41;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    if ( tmp_cmp_Eq_2 == 1 )
+    {
+        goto branch_yes_6;
+    }
+    else
+    {
+        goto branch_no_6;
+    }
+    branch_yes_6:;
+    goto loop_start_2;
+    branch_no_6:;
+    tmp_compexpr_left_1 = var_z;
+
+    if ( tmp_compexpr_left_1 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "z" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 45;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    tmp_compexpr_right_1 = const_int_pos_1;
+    tmp_and_left_value_1 = RICH_COMPARE_EQ( tmp_compexpr_left_1, tmp_compexpr_right_1 );
+    if ( tmp_and_left_value_1 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 45;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    tmp_and_left_truth_1 = CHECK_IF_TRUE( tmp_and_left_value_1 );
+    if ( tmp_and_left_truth_1 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        Py_DECREF( tmp_and_left_value_1 );
+
+        exception_lineno = 45;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    if ( tmp_and_left_truth_1 == 1 )
+    {
+        goto and_right_1;
+    }
+    else
+    {
+        goto and_left_1;
+    }
+    and_right_1:;
+    Py_DECREF( tmp_and_left_value_1 );
+    tmp_compexpr_left_2 = var_b;
+
+    if ( tmp_compexpr_left_2 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "b" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 45;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    tmp_compexpr_right_2 = const_int_pos_6;
+    tmp_and_right_value_1 = RICH_COMPARE_EQ( tmp_compexpr_left_2, tmp_compexpr_right_2 );
+    if ( tmp_and_right_value_1 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 45;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    tmp_cond_value_1 = tmp_and_right_value_1;
+    goto and_end_1;
+    and_left_1:;
+    tmp_cond_value_1 = tmp_and_left_value_1;
+    and_end_1:;
+    tmp_cond_truth_1 = CHECK_IF_TRUE( tmp_cond_value_1 );
+    if ( tmp_cond_truth_1 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        Py_DECREF( tmp_cond_value_1 );
+
+        exception_lineno = 45;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    Py_DECREF( tmp_cond_value_1 );
+    if ( tmp_cond_truth_1 == 1 )
+    {
+        goto branch_yes_7;
+    }
+    else
+    {
+        goto branch_no_7;
+    }
+    branch_yes_7:;
+    goto loop_end_2;
+    branch_no_7:;
+    tmp_compare_left_7 = par_a;
+
+    if ( tmp_compare_left_7 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "a" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 48;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    tmp_compare_right_7 = var_b;
+
+    if ( tmp_compare_right_7 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "b" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 48;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+
+    tmp_cmp_Eq_3 = RICH_COMPARE_BOOL_EQ( tmp_compare_left_7, tmp_compare_right_7 );
+    if ( tmp_cmp_Eq_3 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 48;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    if ( tmp_cmp_Eq_3 == 1 )
+    {
+        goto branch_yes_8;
+    }
+    else
+    {
+        goto branch_no_8;
+    }
+    branch_yes_8:;
+    tmp_assign_source_9 = const_int_0;
+    {
+        PyObject *old = var_z;
+        var_z = tmp_assign_source_9;
+        Py_INCREF( var_z );
+        Py_XDECREF( old );
+    }
+
+    branch_no_8:;
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 28;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_4;
+    }
+    goto loop_start_2;
+    loop_end_2:;
+    goto try_end_3;
+    // Exception handler code:
+    try_except_handler_4:;
+    exception_keeper_type_3 = exception_type;
+    exception_keeper_value_3 = exception_value;
+    exception_keeper_tb_3 = exception_tb;
+    exception_keeper_lineno_3 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_for_loop_2__iter_value );
+    tmp_for_loop_2__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_2__for_iterator.iterator );
+    tmp_for_loop_2__for_iterator.iterator = NULL;
+    // Re-raise.
+    exception_type = exception_keeper_type_3;
+    exception_value = exception_keeper_value_3;
+    exception_tb = exception_keeper_tb_3;
+    exception_lineno = exception_keeper_lineno_3;
+
+    goto try_except_handler_2;
+    // End of try:
+    try_end_3:;
+    Py_XDECREF( tmp_for_loop_2__iter_value );
+    tmp_for_loop_2__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_2__for_iterator.iterator );
+    tmp_for_loop_2__for_iterator.iterator = NULL;
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 27;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_2;
+    }
+    goto loop_start_1;
+    loop_end_1:;
+    goto try_end_4;
+    // Exception handler code:
+    try_except_handler_2:;
+    exception_keeper_type_4 = exception_type;
+    exception_keeper_value_4 = exception_value;
+    exception_keeper_tb_4 = exception_tb;
+    exception_keeper_lineno_4 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_for_loop_1__iter_value );
+    tmp_for_loop_1__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_1__for_iterator.iterator );
+    tmp_for_loop_1__for_iterator.iterator = NULL;
+    // Re-raise.
+    exception_type = exception_keeper_type_4;
+    exception_value = exception_keeper_value_4;
+    exception_tb = exception_keeper_tb_4;
+    exception_lineno = exception_keeper_lineno_4;
+
+    goto frame_exception_exit_1;
+    // End of try:
+    try_end_4:;
+    Py_XDECREF( tmp_for_loop_1__iter_value );
+    tmp_for_loop_1__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_1__for_iterator.iterator );
+    tmp_for_loop_1__for_iterator.iterator = NULL;
+    tmp_called_name_4 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_4 != NULL );
+    tmp_args_element_name_4 = var_c;
+
+    if ( tmp_args_element_name_4 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "c" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 51;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 51;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_4 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_4, call_args );
+    }
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 51;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_called_name_5 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_5 != NULL );
+    tmp_args_element_name_5 = var_f;
+
+    if ( tmp_args_element_name_5 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "f" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 52;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 52;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_5 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_5, call_args );
+    }
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 52;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_assign_source_10 = const_int_pos_1;
+    {
+        PyObject *old = var_f;
+        var_f = tmp_assign_source_10;
+        Py_INCREF( var_f );
+        Py_XDECREF( old );
+    }
+
+    loop_start_3:;
+    tmp_compare_left_8 = var_f;
+
+    if ( tmp_compare_left_8 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "f" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 56;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_compare_right_8 = const_int_pos_10;
+    tmp_cmp_Lt_2 = RICH_COMPARE_BOOL_LT( tmp_compare_left_8, tmp_compare_right_8 );
+    if ( tmp_cmp_Lt_2 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 56;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_cmp_Lt_2 == 1 )
+    {
+        goto branch_no_9;
+    }
+    else
+    {
+        goto branch_yes_9;
+    }
+    branch_yes_9:;
+    goto loop_end_3;
+    branch_no_9:;
+    tmp_assign_source_11 = const_int_pos_1;
+    {
+        PyObject *old = var_m;
+        var_m = tmp_assign_source_11;
+        Py_INCREF( var_m );
+        Py_XDECREF( old );
+    }
+
+    tmp_left_name_1 = var_f;
+
+    if ( tmp_left_name_1 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "f" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 58;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_right_name_1 = const_int_pos_1;
+    tmp_result = BINARY_OPERATION_ADD_INPLACE( &tmp_left_name_1, tmp_right_name_1 );
+    tmp_assign_source_12 = tmp_left_name_1;
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 58;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    var_f = tmp_assign_source_12;
+
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 56;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    goto loop_start_3;
+    loop_end_3:;
+    tmp_called_name_6 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_6 != NULL );
+    tmp_args_element_name_6 = const_str_digest_dc4c724c6114d6a52a82036cea6d31fd;
+    tmp_args_element_name_7 = var_m;
+
+    if ( tmp_args_element_name_7 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "m" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 60;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 60;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_6, tmp_args_element_name_7 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS2( tmp_called_name_6, call_args );
+    }
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 60;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_result = MAKE_RANGE_ITERATOR( &tmp_listcontraction_1__$0, const_int_0, const_int_pos_8, const_int_pos_1, true );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 62;
+        type_description_1 = "oooooooooN";
+        goto outline_exception_1;
+    }
+    tmp_assign_source_14 = PyList_New( 0 );
+    assert( tmp_listcontraction_1__contraction == NULL );
+    tmp_listcontraction_1__contraction = tmp_assign_source_14;
+
+    // Tried code:
+    depth_frame_2b0023940deba7475747880c52bdbd04_2 = cache_depth_frame_2b0023940deba7475747880c52bdbd04_2++;
+    MAKE_OR_REUSE_FRAME( FRAME_CACHE_SLOT( cache_frame_2b0023940deba7475747880c52bdbd04_2, depth_frame_2b0023940deba7475747880c52bdbd04_2 ), codeobj_2b0023940deba7475747880c52bdbd04, module___main__, sizeof(void *) );
+    frame_2b0023940deba7475747880c52bdbd04_2 = FRAME_CACHE_SLOT( cache_frame_2b0023940deba7475747880c52bdbd04_2, depth_frame_2b0023940deba7475747880c52bdbd04_2 );
+
+    // Push the new frame as the currently active one.
+    pushFrameStack( frame_2b0023940deba7475747880c52bdbd04_2 );
+
+    // Mark the frame object as in use, ref count 1 will be up for reuse.
+    assert( Py_REFCNT( frame_2b0023940deba7475747880c52bdbd04_2 ) == 2 ); // Frame stack
+
+    // Framed code:
+    // Tried code:
+    loop_start_4:;
+    // Tried code:
+    tmp_assign_source_15 = RANGE_ITERATOR_NEXT( &tmp_listcontraction_1__$0 );
+    if ( tmp_assign_source_15 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_2 = "o";
+        exception_lineno = 62;
+        goto try_except_handler_8;
+    }
+    {
+        PyObject *old = tmp_listcontraction_1__iter_value_0;
+        tmp_listcontraction_1__iter_value_0 = tmp_assign_source_15;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_5;
+    // Exception handler code:
+    try_except_handler_8:;
+    exception_keeper_type_5 = exception_type;
+    exception_keeper_value_5 = exception_value;
+    exception_keeper_tb_5 = exception_tb;
+    exception_keeper_lineno_5 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_9 = exception_keeper_type_5;
+    tmp_compare_right_9 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_3 = EXCEPTION_MATCH_BOOL( tmp_compare_left_9, tmp_compare_right_9 );
+    if ( tmp_exc_match_exception_match_3 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_5 );
+        Py_XDECREF( exception_keeper_value_5 );
+        Py_XDECREF( exception_keeper_tb_5 );
+
+        exception_lineno = 62;
+        type_description_2 = "o";
+        goto try_except_handler_7;
+    }
+    if ( tmp_exc_match_exception_match_3 == 1 )
+    {
+        goto branch_yes_10;
+    }
+    else
+    {
+        goto branch_no_10;
+    }
+    branch_yes_10:;
+    Py_DECREF( exception_keeper_type_5 );
+    Py_XDECREF( exception_keeper_value_5 );
+    Py_XDECREF( exception_keeper_tb_5 );
+    goto loop_end_4;
+    goto branch_end_10;
+    branch_no_10:;
+    // Re-raise.
+    exception_type = exception_keeper_type_5;
+    exception_value = exception_keeper_value_5;
+    exception_tb = exception_keeper_tb_5;
+    exception_lineno = exception_keeper_lineno_5;
+
+    goto try_except_handler_7;
+    branch_end_10:;
+    // End of try:
+    try_end_5:;
+    tmp_assign_source_16 = tmp_listcontraction_1__iter_value_0;
+
+    CHECK_OBJECT( tmp_assign_source_16 );
+    {
+        PyObject *old = outline_0_var_u;
+        outline_0_var_u = tmp_assign_source_16;
+        Py_INCREF( outline_0_var_u );
+        Py_XDECREF( old );
+    }
+
+    tmp_append_list_1 = tmp_listcontraction_1__contraction;
+
+    CHECK_OBJECT( tmp_append_list_1 );
+    tmp_append_value_1 = outline_0_var_u;
+
+    CHECK_OBJECT( tmp_append_value_1 );
+    assert( PyList_Check( tmp_append_list_1 ) );
+    tmp_res = PyList_Append( tmp_append_list_1, tmp_append_value_1 );
+    if ( tmp_res == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 62;
+        type_description_2 = "o";
+        goto try_except_handler_7;
+    }
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 62;
+        type_description_2 = "o";
+        goto try_except_handler_7;
+    }
+    goto loop_start_4;
+    loop_end_4:;
+    tmp_outline_return_value_1 = tmp_listcontraction_1__contraction;
+
+    CHECK_OBJECT( tmp_outline_return_value_1 );
+    Py_INCREF( tmp_outline_return_value_1 );
+    goto try_return_handler_7;
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    // Return handler code:
+    try_return_handler_7:;
+    Py_XDECREF( tmp_listcontraction_1__$0.iterator );
+    tmp_listcontraction_1__$0.iterator = NULL;
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_1__contraction );
+    Py_DECREF( tmp_listcontraction_1__contraction );
+    tmp_listcontraction_1__contraction = NULL;
+
+    Py_XDECREF( tmp_listcontraction_1__iter_value_0 );
+    tmp_listcontraction_1__iter_value_0 = NULL;
+
+    goto frame_return_exit_1;
+    // Exception handler code:
+    try_except_handler_7:;
+    exception_keeper_type_6 = exception_type;
+    exception_keeper_value_6 = exception_value;
+    exception_keeper_tb_6 = exception_tb;
+    exception_keeper_lineno_6 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_listcontraction_1__$0.iterator );
+    tmp_listcontraction_1__$0.iterator = NULL;
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_1__contraction );
+    Py_DECREF( tmp_listcontraction_1__contraction );
+    tmp_listcontraction_1__contraction = NULL;
+
+    Py_XDECREF( tmp_listcontraction_1__iter_value_0 );
+    tmp_listcontraction_1__iter_value_0 = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_6;
+    exception_value = exception_keeper_value_6;
+    exception_tb = exception_keeper_tb_6;
+    exception_lineno = exception_keeper_lineno_6;
+
+    goto frame_exception_exit_2;
+    // End of try:
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_2b0023940deba7475747880c52bdbd04_2 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_2b0023940deba7475747880c52bdbd04_2 = depth_frame_2b0023940deba7475747880c52bdbd04_2;
+
+    goto frame_no_exception_1;
+
+    frame_return_exit_1:;
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_2b0023940deba7475747880c52bdbd04_2 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_2b0023940deba7475747880c52bdbd04_2 = depth_frame_2b0023940deba7475747880c52bdbd04_2;
+
+    goto try_return_handler_6;
+
+    frame_exception_exit_2:;
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_2b0023940deba7475747880c52bdbd04_2 );
+#endif
+
+    if ( exception_tb == NULL )
+    {
+        exception_tb = MAKE_TRACEBACK( frame_2b0023940deba7475747880c52bdbd04_2, exception_lineno );
+    }
+    else if ( exception_tb->tb_frame != &frame_2b0023940deba7475747880c52bdbd04_2->m_frame )
+    {
+        exception_tb = ADD_TRACEBACK( exception_tb, frame_2b0023940deba7475747880c52bdbd04_2, exception_lineno );
+    }
+
+#if 0
+    // The line is not updated while running, the traceback has it.
+    frame_2b0023940deba7475747880c52bdbd04_2->m_frame.f_lineno = exception_lineno;
+#endif
+
+    // Attachs locals to frame if any.
+    Nuitka_Frame_AttachLocals(
+        (struct Nuitka_FrameObject *)frame_2b0023940deba7475747880c52bdbd04_2,
+        type_description_2,
+        outline_0_var_u
+    );
+
+
+    // Release cached frame.
+    if ( frame_2b0023940deba7475747880c52bdbd04_2 == FRAME_CACHE_SLOT( cache_frame_2b0023940deba7475747880c52bdbd04_2, depth_frame_2b0023940deba7475747880c52bdbd04_2 ) )
+    {
+        Py_DECREF( frame_2b0023940deba7475747880c52bdbd04_2 );
+        FRAME_CACHE_SLOT( cache_frame_2b0023940deba7475747880c52bdbd04_2, depth_frame_2b0023940deba7475747880c52bdbd04_2 ) = NULL;
+    }
+
+    assertFrameObject( frame_2b0023940deba7475747880c52bdbd04_2 );
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_2b0023940deba7475747880c52bdbd04_2 = depth_frame_2b0023940deba7475747880c52bdbd04_2;
+
+    // Return the error.
+    goto nested_frame_exit_1;
+
+    frame_no_exception_1:;
+
+    goto skip_nested_handling_1;
+    nested_frame_exit_1:;
+    type_description_1 = "oooooooooN";
+    goto try_except_handler_6;
+    skip_nested_handling_1:;
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    // Return handler code:
+    try_return_handler_6:;
+    Py_XDECREF( outline_0_var_u );
+    outline_0_var_u = NULL;
+
+    goto outline_result_1;
+    // Exception handler code:
+    try_except_handler_6:;
+    exception_keeper_type_7 = exception_type;
+    exception_keeper_value_7 = exception_value;
+    exception_keeper_tb_7 = exception_tb;
+    exception_keeper_lineno_7 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( outline_0_var_u );
+    outline_0_var_u = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_7;
+    exception_value = exception_keeper_value_7;
+    exception_tb = exception_keeper_tb_7;
+    exception_lineno = exception_keeper_lineno_7;
+
+    goto outline_exception_1;
+    // End of try:
+    // Return statement must have exited already.
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    outline_exception_1:;
+    exception_lineno = 62;
+    goto frame_exception_exit_1;
+    outline_result_1:;
+    tmp_assign_source_13 = tmp_outline_return_value_1;
+    assert( var_x == NULL );
+    var_x = tmp_assign_source_13;
+
+    tmp_called_name_7 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_7 != NULL );
+    tmp_args_element_name_8 = var_x;
+
+    CHECK_OBJECT( tmp_args_element_name_8 );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 63;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_8 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_7, call_args );
+    }
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 63;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    // Tried code:
+    tmp_called_name_8 = (PyObject *)&PyZip_Type;
+    tmp_args_element_name_9 = const_xrange_0_8;
+    tmp_called_name_9 = (PyObject *)&PyReversed_Type;
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 65;
+    tmp_args_element_name_10 = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_9, &PyTuple_GET_ITEM( const_tuple_xrange_0_8_tuple, 0 ) );
+
+    if ( tmp_args_element_name_10 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 65;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_9;
+    }
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 65;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_9, tmp_args_element_name_10 };
+        tmp_iter_arg_1 = CALL_FUNCTION_WITH_ARGS2( tmp_called_name_8, call_args );
+    }
+
+    Py_DECREF( tmp_args_element_name_10 );
+    if ( tmp_iter_arg_1 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 65;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_9;
+    }
+    tmp_assign_source_18 = MAKE_ITERATOR( tmp_iter_arg_1 );
+    Py_DECREF( tmp_iter_arg_1 );
+    if ( tmp_assign_source_18 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 65;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_9;
+    }
+    assert( tmp_listcontraction_2__$0 == NULL );
+    tmp_listcontraction_2__$0 = tmp_assign_source_18;
+
+    tmp_assign_source_19 = PyList_New( 0 );
+    assert( tmp_listcontraction_2__contraction == NULL );
+    tmp_listcontraction_2__contraction = tmp_assign_source_19;
+
+    depth_frame_197c1c7622fb164d676e5bf59a244c2f_3 = cache_depth_frame_197c1c7622fb164d676e5bf59a244c2f_3++;
+    MAKE_OR_REUSE_FRAME( FRAME_CACHE_SLOT( cache_frame_197c1c7622fb164d676e5bf59a244c2f_3, depth_frame_197c1c7622fb164d676e5bf59a244c2f_3 ), codeobj_197c1c7622fb164d676e5bf59a244c2f, module___main__, sizeof(void *)+sizeof(void *) );
+    frame_197c1c7622fb164d676e5bf59a244c2f_3 = FRAME_CACHE_SLOT( cache_frame_197c1c7622fb164d676e5bf59a244c2f_3, depth_frame_197c1c7622fb164d676e5bf59a244c2f_3 );
+
+    // Push the new frame as the currently active one.
+    pushFrameStack( frame_197c1c7622fb164d676e5bf59a244c2f_3 );
+
+    // Mark the frame object as in use, ref count 1 will be up for reuse.
+    assert( Py_REFCNT( frame_197c1c7622fb164d676e5bf59a244c2f_3 ) == 2 ); // Frame stack
+
+    // Framed code:
+    // Tried code:
+    loop_start_5:;
+    // Tried code:
+    tmp_value_name_1 = tmp_listcontraction_2__$0;
+
+    CHECK_OBJECT( tmp_value_name_1 );
+    tmp_assign_source_20 = ITERATOR_NEXT( tmp_value_name_1 );
+    if ( tmp_assign_source_20 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_2 = "oo";
+        exception_lineno = 65;
+        goto try_except_handler_11;
+    }
+    {
+        PyObject *old = tmp_listcontraction_2__iter_value_0;
+        tmp_listcontraction_2__iter_value_0 = tmp_assign_source_20;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_6;
+    // Exception handler code:
+    try_except_handler_11:;
+    exception_keeper_type_8 = exception_type;
+    exception_keeper_value_8 = exception_value;
+    exception_keeper_tb_8 = exception_tb;
+    exception_keeper_lineno_8 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_10 = exception_keeper_type_8;
+    tmp_compare_right_10 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_4 = EXCEPTION_MATCH_BOOL( tmp_compare_left_10, tmp_compare_right_10 );
+    if ( tmp_exc_match_exception_match_4 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_8 );
+        Py_XDECREF( exception_keeper_value_8 );
+        Py_XDECREF( exception_keeper_tb_8 );
+
+        exception_lineno = 65;
+        type_description_2 = "oo";
+        goto try_except_handler_10;
+    }
+    if ( tmp_exc_match_exception_match_4 == 1 )
+    {
+        goto branch_yes_11;
+    }
+    else
+    {
+        goto branch_no_11;
+    }
+    branch_yes_11:;
+    Py_DECREF( exception_keeper_type_8 );
+    Py_XDECREF( exception_keeper_value_8 );
+    Py_XDECREF( exception_keeper_tb_8 );
+    goto loop_end_5;
+    goto branch_end_11;
+    branch_no_11:;
+    // Re-raise.
+    exception_type = exception_keeper_type_8;
+    exception_value = exception_keeper_value_8;
+    exception_tb = exception_keeper_tb_8;
+    exception_lineno = exception_keeper_lineno_8;
+
+    goto try_except_handler_10;
+    branch_end_11:;
+    // End of try:
+    try_end_6:;
+    // Tried code:
+    tmp_value_name_2 = tmp_listcontraction_2__iter_value_0;
+
+    CHECK_OBJECT( tmp_value_name_2 );
+    Py_XDECREF( tmp_listcontraction$tuple_unpack_1__source_iter.iterator );
+    tmp_listcontraction$tuple_unpack_1__source_iter.iterator = NULL;
+    Py_XDECREF( tmp_listcontraction$tuple_unpack_1__source_iter.sequence );
+    tmp_listcontraction$tuple_unpack_1__source_iter.sequence = NULL;
+    tmp_result = MAKE_UNPACK_ITERATOR( &tmp_listcontraction$tuple_unpack_1__source_iter, tmp_value_name_2 );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 65;
+        type_description_2 = "oo";
+        goto try_except_handler_12;
+    }
+    // Tried code:
+    tmp_assign_source_21 = UNPACK_ITERATOR_NEXT( &tmp_listcontraction$tuple_unpack_1__source_iter, 0, 2 );
+    if ( tmp_assign_source_21 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_2 = "oo";
+        exception_lineno = 65;
+        goto try_except_handler_13;
+    }
+    {
+        PyObject *old = tmp_listcontraction$tuple_unpack_1__element_1;
+        tmp_listcontraction$tuple_unpack_1__element_1 = tmp_assign_source_21;
+        Py_XDECREF( old );
+    }
+
+    tmp_assign_source_22 = UNPACK_ITERATOR_NEXT( &tmp_listcontraction$tuple_unpack_1__source_iter, 1, 2 );
+    if ( tmp_assign_source_22 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_2 = "oo";
+        exception_lineno = 65;
+        goto try_except_handler_13;
+    }
+    {
+        PyObject *old = tmp_listcontraction$tuple_unpack_1__element_2;
+        tmp_listcontraction$tuple_unpack_1__element_2 = tmp_assign_source_22;
+        Py_XDECREF( old );
+    }
+
+    tmp_result = UNPACK_ITERATOR_CHECK_REMAINING( &tmp_listcontraction$tuple_unpack_1__source_iter, 2 );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 65;
+        type_description_2 = "oo";
+        goto try_except_handler_13;
+    }
+    goto try_end_7;
+    // Exception handler code:
+    try_except_handler_13:;
+    exception_keeper_type_9 = exception_type;
+    exception_keeper_value_9 = exception_value;
+    exception_keeper_tb_9 = exception_tb;
+    exception_keeper_lineno_9 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_listcontraction$tuple_unpack_1__source_iter.iterator );
+    tmp_listcontraction$tuple_unpack_1__source_iter.iterator = NULL;
+    Py_XDECREF( tmp_listcontraction$tuple_unpack_1__source_iter.sequence );
+    tmp_listcontraction$tuple_unpack_1__source_iter.sequence = NULL;
+    // Re-raise.
+    exception_type = exception_keeper_type_9;
+    exception_value = exception_keeper_value_9;
+    exception_tb = exception_keeper_tb_9;
+    exception_lineno = exception_keeper_lineno_9;
+
+    goto try_except_handler_12;
+    // End of try:
+    try_end_7:;
+    goto try_end_8;
+    // Exception handler code:
+    try_except_handler_12:;
+    exception_keeper_type_10 = exception_type;
+    exception_keeper_value_10 = exception_value;
+    exception_keeper_tb_10 = exception_tb;
+    exception_keeper_lineno_10 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_listcontraction$tuple_unpack_1__element_1 );
+    tmp_listcontraction$tuple_unpack_1__element_1 = NULL;
+
+    Py_XDECREF( tmp_listcontraction$tuple_unpack_1__element_2 );
+    tmp_listcontraction$tuple_unpack_1__element_2 = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_10;
+    exception_value = exception_keeper_value_10;
+    exception_tb = exception_keeper_tb_10;
+    exception_lineno = exception_keeper_lineno_10;
+
+    goto try_except_handler_10;
+    // End of try:
+    try_end_8:;
+    Py_XDECREF( tmp_listcontraction$tuple_unpack_1__source_iter.iterator );
+    tmp_listcontraction$tuple_unpack_1__source_iter.iterator = NULL;
+    Py_XDECREF( tmp_listcontraction$tuple_unpack_1__source_iter.sequence );
+    tmp_listcontraction$tuple_unpack_1__source_iter.sequence = NULL;
+    tmp_assign_source_23 = tmp_listcontraction$tuple_unpack_1__element_1;
+
+    CHECK_OBJECT( tmp_assign_source_23 );
+    {
+        PyObject *old = outline_1_var_u;
+        outline_1_var_u = tmp_assign_source_23;
+        Py_INCREF( outline_1_var_u );
+        Py_XDECREF( old );
+    }
+
+    Py_XDECREF( tmp_listcontraction$tuple_unpack_1__element_1 );
+    tmp_listcontraction$tuple_unpack_1__element_1 = NULL;
+
+    tmp_assign_source_24 = tmp_listcontraction$tuple_unpack_1__element_2;
+
+    CHECK_OBJECT( tmp_assign_source_24 );
+    {
+        PyObject *old = outline_1_var_v;
+        outline_1_var_v = tmp_assign_source_24;
+        Py_INCREF( outline_1_var_v );
+        Py_XDECREF( old );
+    }
+
+    Py_XDECREF( tmp_listcontraction$tuple_unpack_1__element_2 );
+    tmp_listcontraction$tuple_unpack_1__element_2 = NULL;
+
+    tmp_append_list_2 = tmp_listcontraction_2__contraction;
+
+    CHECK_OBJECT( tmp_append_list_2 );
+    tmp_append_value_2 = PyTuple_New( 2 );
+    tmp_tuple_element_4 = outline_1_var_u;
+
+    if ( tmp_tuple_element_4 == NULL )
+    {
+        Py_DECREF( tmp_append_value_2 );
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "u" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 65;
+        type_description_2 = "oo";
+        goto try_except_handler_10;
+    }
+
+    Py_INCREF( tmp_tuple_element_4 );
+    PyTuple_SET_ITEM( tmp_append_value_2, 0, tmp_tuple_element_4 );
+    tmp_tuple_element_4 = outline_1_var_v;
+
+    if ( tmp_tuple_element_4 == NULL )
+    {
+        Py_DECREF( tmp_append_value_2 );
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "v" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 65;
+        type_description_2 = "oo";
+        goto try_except_handler_10;
+    }
+
+    Py_INCREF( tmp_tuple_element_4 );
+    PyTuple_SET_ITEM( tmp_append_value_2, 1, tmp_tuple_element_4 );
+    assert( PyList_Check( tmp_append_list_2 ) );
+    tmp_res = PyList_Append( tmp_append_list_2, tmp_append_value_2 );
+    Py_DECREF( tmp_append_value_2 );
+    if ( tmp_res == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 65;
+        type_description_2 = "oo";
+        goto try_except_handler_10;
+    }
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 65;
+        type_description_2 = "oo";
+        goto try_except_handler_10;
+    }
+    goto loop_start_5;
+    loop_end_5:;
+    tmp_outline_return_value_2 = tmp_listcontraction_2__contraction;
+
+    CHECK_OBJECT( tmp_outline_return_value_2 );
+    Py_INCREF( tmp_outline_return_value_2 );
+    goto try_return_handler_10;
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    // Return handler code:
+    try_return_handler_10:;
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_2__$0 );
+    Py_DECREF( tmp_listcontraction_2__$0 );
+    tmp_listcontraction_2__$0 = NULL;
+
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_2__contraction );
+    Py_DECREF( tmp_listcontraction_2__contraction );
+    tmp_listcontraction_2__contraction = NULL;
+
+    Py_XDECREF( tmp_listcontraction_2__iter_value_0 );
+    tmp_listcontraction_2__iter_value_0 = NULL;
+
+    goto frame_return_exit_2;
+    // Exception handler code:
+    try_except_handler_10:;
+    exception_keeper_type_11 = exception_type;
+    exception_keeper_value_11 = exception_value;
+    exception_keeper_tb_11 = exception_tb;
+    exception_keeper_lineno_11 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_2__$0 );
+    Py_DECREF( tmp_listcontraction_2__$0 );
+    tmp_listcontraction_2__$0 = NULL;
+
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_2__contraction );
+    Py_DECREF( tmp_listcontraction_2__contraction );
+    tmp_listcontraction_2__contraction = NULL;
+
+    Py_XDECREF( tmp_listcontraction_2__iter_value_0 );
+    tmp_listcontraction_2__iter_value_0 = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_11;
+    exception_value = exception_keeper_value_11;
+    exception_tb = exception_keeper_tb_11;
+    exception_lineno = exception_keeper_lineno_11;
+
+    goto frame_exception_exit_3;
+    // End of try:
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_197c1c7622fb164d676e5bf59a244c2f_3 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_197c1c7622fb164d676e5bf59a244c2f_3 = depth_frame_197c1c7622fb164d676e5bf59a244c2f_3;
+
+    goto frame_no_exception_2;
+
+    frame_return_exit_2:;
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_197c1c7622fb164d676e5bf59a244c2f_3 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_197c1c7622fb164d676e5bf59a244c2f_3 = depth_frame_197c1c7622fb164d676e5bf59a244c2f_3;
+
+    goto try_return_handler_9;
+
+    frame_exception_exit_3:;
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_197c1c7622fb164d676e5bf59a244c2f_3 );
+#endif
+
+    if ( exception_tb == NULL )
+    {
+        exception_tb = MAKE_TRACEBACK( frame_197c1c7622fb164d676e5bf59a244c2f_3, exception_lineno );
+    }
+    else if ( exception_tb->tb_frame != &frame_197c1c7622fb164d676e5bf59a244c2f_3->m_frame )
+    {
+        exception_tb = ADD_TRACEBACK( exception_tb, frame_197c1c7622fb164d676e5bf59a244c2f_3, exception_lineno );
+    }
+
+#if 0
+    // The line is not updated while running, the traceback has it.
+    frame_197c1c7622fb164d676e5bf59a244c2f_3->m_frame.f_lineno = exception_lineno;
+#endif
+
+    // Attachs locals to frame if any.
+    Nuitka_Frame_AttachLocals(
+        (struct Nuitka_FrameObject *)frame_197c1c7622fb164d676e5bf59a244c2f_3,
+        type_description_2,
+        outline_1_var_u,
+        outline_1_var_v
+    );
+
+
+    // Release cached frame.
+    if ( frame_197c1c7622fb164d676e5bf59a244c2f_3 == FRAME_CACHE_SLOT( cache_frame_197c1c7622fb164d676e5bf59a244c2f_3, depth_frame_197c1c7622fb164d676e5bf59a244c2f_3 ) )
+    {
+        Py_DECREF( frame_197c1c7622fb164d676e5bf59a244c2f_3 );
+        FRAME_CACHE_SLOT( cache_frame_197c1c7622fb164d676e5bf59a244c2f_3, depth_frame_197c1c7622fb164d676e5bf59a244c2f_3 ) = NULL;
+    }
+
+    assertFrameObject( frame_197c1c7622fb164d676e5bf59a244c2f_3 );
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_197c1c7622fb164d676e5bf59a244c2f_3 = depth_frame_197c1c7622fb164d676e5bf59a244c2f_3;
+
+    // Return the error.
+    goto nested_frame_exit_2;
+
+    frame_no_exception_2:;
+
+    goto skip_nested_handling_2;
+    nested_frame_exit_2:;
+    type_description_1 = "oooooooooN";
+    goto try_except_handler_9;
+    skip_nested_handling_2:;
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    // Return handler code:
+    try_return_handler_9:;
+    Py_XDECREF( outline_1_var_u );
+    outline_1_var_u = NULL;
+
+    Py_XDECREF( outline_1_var_v );
+    outline_1_var_v = NULL;
+
+    goto outline_result_2;
+    // Exception handler code:
+    try_except_handler_9:;
+    exception_keeper_type_12 = exception_type;
+    exception_keeper_value_12 = exception_value;
+    exception_keeper_tb_12 = exception_tb;
+    exception_keeper_lineno_12 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( outline_1_var_u );
+    outline_1_var_u = NULL;
+
+    Py_XDECREF( outline_1_var_v );
+    outline_1_var_v = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_12;
+    exception_value = exception_keeper_value_12;
+    exception_tb = exception_keeper_tb_12;
+    exception_lineno = exception_keeper_lineno_12;
+
+    goto outline_exception_2;
+    // End of try:
+    // Return statement must have exited already.
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    outline_exception_2:;
+    exception_lineno = 65;
+    goto frame_exception_exit_1;
+    outline_result_2:;
+    tmp_assign_source_17 = tmp_outline_return_value_2;
+    {
+        PyObject *old = var_x;
+        var_x = tmp_assign_source_17;
+        Py_XDECREF( old );
+    }
+
+    tmp_called_name_10 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_10 != NULL );
+    tmp_args_element_name_11 = var_x;
+
+    CHECK_OBJECT( tmp_args_element_name_11 );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 66;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_11 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_10, call_args );
+    }
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 66;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_result = MAKE_RANGE_ITERATOR( &tmp_listcontraction_3__$0, const_int_0, const_int_pos_10, const_int_pos_1, true );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 68;
+        type_description_1 = "oooooooooN";
+        goto outline_exception_3;
+    }
+    tmp_assign_source_26 = PyList_New( 0 );
+    assert( tmp_listcontraction_3__contraction == NULL );
+    tmp_listcontraction_3__contraction = tmp_assign_source_26;
+
+    // Tried code:
+    depth_frame_a5f3d7fdf5c302d50b2785ec260c380c_4 = cache_depth_frame_a5f3d7fdf5c302d50b2785ec260c380c_4++;
+    MAKE_OR_REUSE_FRAME( FRAME_CACHE_SLOT( cache_frame_a5f3d7fdf5c302d50b2785ec260c380c_4, depth_frame_a5f3d7fdf5c302d50b2785ec260c380c_4 ), codeobj_a5f3d7fdf5c302d50b2785ec260c380c, module___main__, sizeof(void *) );
+    frame_a5f3d7fdf5c302d50b2785ec260c380c_4 = FRAME_CACHE_SLOT( cache_frame_a5f3d7fdf5c302d50b2785ec260c380c_4, depth_frame_a5f3d7fdf5c302d50b2785ec260c380c_4 );
+
+    // Push the new frame as the currently active one.
+    pushFrameStack( frame_a5f3d7fdf5c302d50b2785ec260c380c_4 );
+
+    // Mark the frame object as in use, ref count 1 will be up for reuse.
+    assert( Py_REFCNT( frame_a5f3d7fdf5c302d50b2785ec260c380c_4 ) == 2 ); // Frame stack
+
+    // Framed code:
+    // Tried code:
+    loop_start_6:;
+    // Tried code:
+    tmp_assign_source_27 = RANGE_ITERATOR_NEXT( &tmp_listcontraction_3__$0 );
+    if ( tmp_assign_source_27 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_2 = "o";
+        exception_lineno = 68;
+        goto try_except_handler_16;
+    }
+    {
+        PyObject *old = tmp_listcontraction_3__iter_value_0;
+        tmp_listcontraction_3__iter_value_0 = tmp_assign_source_27;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_9;
+    // Exception handler code:
+    try_except_handler_16:;
+    exception_keeper_type_13 = exception_type;
+    exception_keeper_value_13 = exception_value;
+    exception_keeper_tb_13 = exception_tb;
+    exception_keeper_lineno_13 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_11 = exception_keeper_type_13;
+    tmp_compare_right_11 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_5 = EXCEPTION_MATCH_BOOL( tmp_compare_left_11, tmp_compare_right_11 );
+    if ( tmp_exc_match_exception_match_5 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_13 );
+        Py_XDECREF( exception_keeper_value_13 );
+        Py_XDECREF( exception_keeper_tb_13 );
+
+        exception_lineno = 68;
+        type_description_2 = "o";
+        goto try_except_handler_15;
+    }
+    if ( tmp_exc_match_exception_match_5 == 1 )
+    {
+        goto branch_yes_12;
+    }
+    else
+    {
+        goto branch_no_12;
+    }
+    branch_yes_12:;
+    Py_DECREF( exception_keeper_type_13 );
+    Py_XDECREF( exception_keeper_value_13 );
+    Py_XDECREF( exception_keeper_tb_13 );
+    goto loop_end_6;
+    goto branch_end_12;
+    branch_no_12:;
+    // Re-raise.
+    exception_type = exception_keeper_type_13;
+    exception_value = exception_keeper_value_13;
+    exception_tb = exception_keeper_tb_13;
+    exception_lineno = exception_keeper_lineno_13;
+
+    goto try_except_handler_15;
+    branch_end_12:;
+    // End of try:
+    try_end_9:;
+    tmp_assign_source_28 = tmp_listcontraction_3__iter_value_0;
+
+    CHECK_OBJECT( tmp_assign_source_28 );
+    {
+        PyObject *old = outline_2_var_u;
+        outline_2_var_u = tmp_assign_source_28;
+        Py_INCREF( outline_2_var_u );
+        Py_XDECREF( old );
+    }
+
+    tmp_append_list_3 = tmp_listcontraction_3__contraction;
+
+    CHECK_OBJECT( tmp_append_list_3 );
+    tmp_left_name_2 = outline_2_var_u;
+
+    CHECK_OBJECT( tmp_left_name_2 );
+    tmp_right_name_2 = const_int_pos_2;
+    tmp_compare_left_12 = BINARY_OPERATION_REMAINDER( tmp_left_name_2, tmp_right_name_2 );
+    if ( tmp_compare_left_12 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 68;
+        type_description_2 = "o";
+        goto try_except_handler_15;
+    }
+    tmp_compare_right_12 = const_int_0;
+    tmp_cmp_Eq_4 = RICH_COMPARE_BOOL_EQ( tmp_compare_left_12, tmp_compare_right_12 );
+    if ( tmp_cmp_Eq_4 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        Py_DECREF( tmp_compare_left_12 );
+
+        exception_lineno = 68;
+        type_description_2 = "o";
+        goto try_except_handler_15;
+    }
+    Py_DECREF( tmp_compare_left_12 );
+    if ( tmp_cmp_Eq_4 == 1 )
+    {
+        goto condexpr_true_1;
+    }
+    else
+    {
+        goto condexpr_false_1;
+    }
+    condexpr_true_1:;
+    tmp_append_value_3 = outline_2_var_u;
+
+    if ( tmp_append_value_3 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "u" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 68;
+        type_description_2 = "o";
+        goto try_except_handler_15;
+    }
+
+    goto condexpr_end_1;
+    condexpr_false_1:;
+    tmp_append_value_3 = const_int_0;
+    condexpr_end_1:;
+    assert( PyList_Check( tmp_append_list_3 ) );
+    tmp_res = PyList_Append( tmp_append_list_3, tmp_append_value_3 );
+    if ( tmp_res == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 68;
+        type_description_2 = "o";
+        goto try_except_handler_15;
+    }
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 68;
+        type_description_2 = "o";
+        goto try_except_handler_15;
+    }
+    goto loop_start_6;
+    loop_end_6:;
+    tmp_outline_return_value_3 = tmp_listcontraction_3__contraction;
+
+    CHECK_OBJECT( tmp_outline_return_value_3 );
+    Py_INCREF( tmp_outline_return_value_3 );
+    goto try_return_handler_15;
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    // Return handler code:
+    try_return_handler_15:;
+    Py_XDECREF( tmp_listcontraction_3__$0.iterator );
+    tmp_listcontraction_3__$0.iterator = NULL;
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_3__contraction );
+    Py_DECREF( tmp_listcontraction_3__contraction );
+    tmp_listcontraction_3__contraction = NULL;
+
+    Py_XDECREF( tmp_listcontraction_3__iter_value_0 );
+    tmp_listcontraction_3__iter_value_0 = NULL;
+
+    goto frame_return_exit_3;
+    // Exception handler code:
+    try_except_handler_15:;
+    exception_keeper_type_14 = exception_type;
+    exception_keeper_value_14 = exception_value;
+    exception_keeper_tb_14 = exception_tb;
+    exception_keeper_lineno_14 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_listcontraction_3__$0.iterator );
+    tmp_listcontraction_3__$0.iterator = NULL;
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_3__contraction );
+    Py_DECREF( tmp_listcontraction_3__contraction );
+    tmp_listcontraction_3__contraction = NULL;
+
+    Py_XDECREF( tmp_listcontraction_3__iter_value_0 );
+    tmp_listcontraction_3__iter_value_0 = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_14;
+    exception_value = exception_keeper_value_14;
+    exception_tb = exception_keeper_tb_14;
+    exception_lineno = exception_keeper_lineno_14;
+
+    goto frame_exception_exit_4;
+    // End of try:
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_a5f3d7fdf5c302d50b2785ec260c380c_4 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_a5f3d7fdf5c302d50b2785ec260c380c_4 = depth_frame_a5f3d7fdf5c302d50b2785ec260c380c_4;
+
+    goto frame_no_exception_3;
+
+    frame_return_exit_3:;
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_a5f3d7fdf5c302d50b2785ec260c380c_4 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_a5f3d7fdf5c302d50b2785ec260c380c_4 = depth_frame_a5f3d7fdf5c302d50b2785ec260c380c_4;
+
+    goto try_return_handler_14;
+
+    frame_exception_exit_4:;
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_a5f3d7fdf5c302d50b2785ec260c380c_4 );
+#endif
+
+    if ( exception_tb == NULL )
+    {
+        exception_tb = MAKE_TRACEBACK( frame_a5f3d7fdf5c302d50b2785ec260c380c_4, exception_lineno );
+    }
+    else if ( exception_tb->tb_frame != &frame_a5f3d7fdf5c302d50b2785ec260c380c_4->m_frame )
+    {
+        exception_tb = ADD_TRACEBACK( exception_tb, frame_a5f3d7fdf5c302d50b2785ec260c380c_4, exception_lineno );
+    }
+
+#if 0
+    // The line is not updated while running, the traceback has it.
+    frame_a5f3d7fdf5c302d50b2785ec260c380c_4->m_frame.f_lineno = exception_lineno;
+#endif
+
+    // Attachs locals to frame if any.
+    Nuitka_Frame_AttachLocals(
+        (struct Nuitka_FrameObject *)frame_a5f3d7fdf5c302d50b2785ec260c380c_4,
+        type_description_2,
+        outline_2_var_u
+    );
+
+
+    // Release cached frame.
+    if ( frame_a5f3d7fdf5c302d50b2785ec260c380c_4 == FRAME_CACHE_SLOT( cache_frame_a5f3d7fdf5c302d50b2785ec260c380c_4, depth_frame_a5f3d7fdf5c302d50b2785ec260c380c_4 ) )
+    {
+        Py_DECREF( frame_a5f3d7fdf5c302d50b2785ec260c380c_4 );
+        FRAME_CACHE_SLOT( cache_frame_a5f3d7fdf5c302d50b2785ec260c380c_4, depth_frame_a5f3d7fdf5c302d50b2785ec260c380c_4 ) = NULL;
+    }
+
+    assertFrameObject( frame_a5f3d7fdf5c302d50b2785ec260c380c_4 );
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_a5f3d7fdf5c302d50b2785ec260c380c_4 = depth_frame_a5f3d7fdf5c302d50b2785ec260c380c_4;
+
+    // Return the error.
+    goto nested_frame_exit_3;
+
+    frame_no_exception_3:;
+
+    goto skip_nested_handling_3;
+    nested_frame_exit_3:;
+    type_description_1 = "oooooooooN";
+    goto try_except_handler_14;
+    skip_nested_handling_3:;
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    // Return handler code:
+    try_return_handler_14:;
+    Py_XDECREF( outline_2_var_u );
+    outline_2_var_u = NULL;
+
+    goto outline_result_3;
+    // Exception handler code:
+    try_except_handler_14:;
+    exception_keeper_type_15 = exception_type;
+    exception_keeper_value_15 = exception_value;
+    exception_keeper_tb_15 = exception_tb;
+    exception_keeper_lineno_15 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( outline_2_var_u );
+    outline_2_var_u = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_15;
+    exception_value = exception_keeper_value_15;
+    exception_tb = exception_keeper_tb_15;
+    exception_lineno = exception_keeper_lineno_15;
+
+    goto outline_exception_3;
+    // End of try:
+    // Return statement must have exited already.
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    outline_exception_3:;
+    exception_lineno = 68;
+    goto frame_exception_exit_1;
+    outline_result_3:;
+    tmp_assign_source_25 = tmp_outline_return_value_3;
+    {
+        PyObject *old = var_x;
+        var_x = tmp_assign_source_25;
+        Py_XDECREF( old );
+    }
+
+    tmp_called_name_11 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_11 != NULL );
+    tmp_args_element_name_12 = var_x;
+
+    CHECK_OBJECT( tmp_args_element_name_12 );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 69;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_12 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_11, call_args );
+    }
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 69;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    // Tried code:
+    tmp_called_name_12 = GET_MODULE_VARIABLE_VALUE_CACHED( moduledict___main__, const_str_plain_cond, &module_variable_cache_14 );
+
+    if ( tmp_called_name_12 == NULL )
+    {
+
+        exception_type = PyExc_NameError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "name '%s' is not defined", "cond" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 71;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_17;
+    }
+
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 71;
+    tmp_cond_value_2 = CALL_FUNCTION_NO_ARGS( tmp_called_name_12 );
+    if ( tmp_cond_value_2 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 71;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_17;
+    }
+    tmp_cond_truth_2 = CHECK_IF_TRUE( tmp_cond_value_2 );
+    if ( tmp_cond_truth_2 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        Py_DECREF( tmp_cond_value_2 );
+
+        exception_lineno = 71;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_17;
+    }
+    Py_DECREF( tmp_cond_value_2 );
+    if ( tmp_cond_truth_2 == 1 )
+    {
+        goto condexpr_true_2;
+    }
+    else
+    {
+        goto condexpr_false_2;
+    }
+    condexpr_true_2:;
+    tmp_iter_arg_2 = par_a;
+
+    if ( tmp_iter_arg_2 == NULL )
+    {
+
+        exception_type = PyExc_NameError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "free variable '%s' referenced before assignment in enclosing scope", "a" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 71;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_17;
+    }
+
+    goto condexpr_end_2;
+    condexpr_false_2:;
+    tmp_iter_arg_2 = const_xrange_0_9;
+    condexpr_end_2:;
+    tmp_assign_source_30 = MAKE_ITERATOR( tmp_iter_arg_2 );
+    if ( tmp_assign_source_30 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 71;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_17;
+    }
+    assert( tmp_listcontraction_4__$0 == NULL );
+    tmp_listcontraction_4__$0 = tmp_assign_source_30;
+
+    tmp_assign_source_31 = PyList_New( 0 );
+    assert( tmp_listcontraction_4__contraction == NULL );
+    tmp_listcontraction_4__contraction = tmp_assign_source_31;
+
+    depth_frame_d919de034351cc8afb31200f0bd3bc19_5 = cache_depth_frame_d919de034351cc8afb31200f0bd3bc19_5++;
+    MAKE_OR_REUSE_FRAME( FRAME_CACHE_SLOT( cache_frame_d919de034351cc8afb31200f0bd3bc19_5, depth_frame_d919de034351cc8afb31200f0bd3bc19_5 ), codeobj_d919de034351cc8afb31200f0bd3bc19, module___main__, sizeof(void *) );
+    frame_d919de034351cc8afb31200f0bd3bc19_5 = FRAME_CACHE_SLOT( cache_frame_d919de034351cc8afb31200f0bd3bc19_5, depth_frame_d919de034351cc8afb31200f0bd3bc19_5 );
+
+    // Push the new frame as the currently active one.
+    pushFrameStack( frame_d919de034351cc8afb31200f0bd3bc19_5 );
+
+    // Mark the frame object as in use, ref count 1 will be up for reuse.
+    assert( Py_REFCNT( frame_d919de034351cc8afb31200f0bd3bc19_5 ) == 2 ); // Frame stack
+
+    // Framed code:
+    // Tried code:
+    loop_start_7:;
+    // Tried code:
+    tmp_value_name_3 = tmp_listcontraction_4__$0;
+
+    CHECK_OBJECT( tmp_value_name_3 );
+    tmp_assign_source_32 = ITERATOR_NEXT( tmp_value_name_3 );
+    if ( tmp_assign_source_32 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_2 = "o";
+        exception_lineno = 71;
+        goto try_except_handler_19;
+    }
+    {
+        PyObject *old = tmp_listcontraction_4__iter_value_0;
+        tmp_listcontraction_4__iter_value_0 = tmp_assign_source_32;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_10;
+    // Exception handler code:
+    try_except_handler_19:;
+    exception_keeper_type_16 = exception_type;
+    exception_keeper_value_16 = exception_value;
+    exception_keeper_tb_16 = exception_tb;
+    exception_keeper_lineno_16 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_13 = exception_keeper_type_16;
+    tmp_compare_right_13 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_6 = EXCEPTION_MATCH_BOOL( tmp_compare_left_13, tmp_compare_right_13 );
+    if ( tmp_exc_match_exception_match_6 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_16 );
+        Py_XDECREF( exception_keeper_value_16 );
+        Py_XDECREF( exception_keeper_tb_16 );
+
+        exception_lineno = 71;
+        type_description_2 = "o";
+        goto try_except_handler_18;
+    }
+    if ( tmp_exc_match_exception_match_6 == 1 )
+    {
+        goto branch_yes_13;
+    }
+    else
+    {
+        goto branch_no_13;
+    }
+    branch_yes_13:;
+    Py_DECREF( exception_keeper_type_16 );
+    Py_XDECREF( exception_keeper_value_16 );
+    Py_XDECREF( exception_keeper_tb_16 );
+    goto loop_end_7;
+    goto branch_end_13;
+    branch_no_13:;
+    // Re-raise.
+    exception_type = exception_keeper_type_16;
+    exception_value = exception_keeper_value_16;
+    exception_tb = exception_keeper_tb_16;
+    exception_lineno = exception_keeper_lineno_16;
+
+    goto try_except_handler_18;
+    branch_end_13:;
+    // End of try:
+    try_end_10:;
+    tmp_assign_source_33 = tmp_listcontraction_4__iter_value_0;
+
+    CHECK_OBJECT( tmp_assign_source_33 );
+    {
+        PyObject *old = outline_3_var_u;
+        outline_3_var_u = tmp_assign_source_33;
+        Py_INCREF( outline_3_var_u );
+        Py_XDECREF( old );
+    }
+
+    tmp_append_list_4 = tmp_listcontraction_4__contraction;
+
+    CHECK_OBJECT( tmp_append_list_4 );
+    tmp_left_name_3 = outline_3_var_u;
+
+    CHECK_OBJECT( tmp_left_name_3 );
+    tmp_right_name_3 = const_int_pos_2;
+    tmp_compare_left_14 = BINARY_OPERATION_REMAINDER( tmp_left_name_3, tmp_right_name_3 );
+    if ( tmp_compare_left_14 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 71;
+        type_description_2 = "o";
+        goto try_except_handler_18;
+    }
+    tmp_compare_right_14 = const_int_0;
+    tmp_cmp_Eq_5 = RICH_COMPARE_BOOL_EQ( tmp_compare_left_14, tmp_compare_right_14 );
+    if ( tmp_cmp_Eq_5 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        Py_DECREF( tmp_compare_left_14 );
+
+        exception_lineno = 71;
+        type_description_2 = "o";
+        goto try_except_handler_18;
+    }
+    Py_DECREF( tmp_compare_left_14 );
+    if ( tmp_cmp_Eq_5 == 1 )
+    {
+        goto condexpr_true_3;
+    }
+    else
+    {
+        goto condexpr_false_3;
+    }
+    condexpr_true_3:;
+    tmp_append_value_4 = outline_3_var_u;
+
+    if ( tmp_append_value_4 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "u" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 71;
+        type_description_2 = "o";
+        goto try_except_handler_18;
+    }
+
+    goto condexpr_end_3;
+    condexpr_false_3:;
+    tmp_append_value_4 = const_int_0;
+    condexpr_end_3:;
+    assert( PyList_Check( tmp_append_list_4 ) );
+    tmp_res = PyList_Append( tmp_append_list_4, tmp_append_value_4 );
+    if ( tmp_res == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 71;
+        type_description_2 = "o";
+        goto try_except_handler_18;
+    }
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 71;
+        type_description_2 = "o";
+        goto try_except_handler_18;
+    }
+    goto loop_start_7;
+    loop_end_7:;
+    tmp_outline_return_value_4 = tmp_listcontraction_4__contraction;
+
+    CHECK_OBJECT( tmp_outline_return_value_4 );
+    Py_INCREF( tmp_outline_return_value_4 );
+    goto try_return_handler_18;
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    // Return handler code:
+    try_return_handler_18:;
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_4__$0 );
+    Py_DECREF( tmp_listcontraction_4__$0 );
+    tmp_listcontraction_4__$0 = NULL;
+
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_4__contraction );
+    Py_DECREF( tmp_listcontraction_4__contraction );
+    tmp_listcontraction_4__contraction = NULL;
+
+    Py_XDECREF( tmp_listcontraction_4__iter_value_0 );
+    tmp_listcontraction_4__iter_value_0 = NULL;
+
+    goto frame_return_exit_4;
+    // Exception handler code:
+    try_except_handler_18:;
+    exception_keeper_type_17 = exception_type;
+    exception_keeper_value_17 = exception_value;
+    exception_keeper_tb_17 = exception_tb;
+    exception_keeper_lineno_17 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_4__$0 );
+    Py_DECREF( tmp_listcontraction_4__$0 );
+    tmp_listcontraction_4__$0 = NULL;
+
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_4__contraction );
+    Py_DECREF( tmp_listcontraction_4__contraction );
+    tmp_listcontraction_4__contraction = NULL;
+
+    Py_XDECREF( tmp_listcontraction_4__iter_value_0 );
+    tmp_listcontraction_4__iter_value_0 = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_17;
+    exception_value = exception_keeper_value_17;
+    exception_tb = exception_keeper_tb_17;
+    exception_lineno = exception_keeper_lineno_17;
+
+    goto frame_exception_exit_5;
+    // End of try:
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_d919de034351cc8afb31200f0bd3bc19_5 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_d919de034351cc8afb31200f0bd3bc19_5 = depth_frame_d919de034351cc8afb31200f0bd3bc19_5;
+
+    goto frame_no_exception_4;
+
+    frame_return_exit_4:;
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_d919de034351cc8afb31200f0bd3bc19_5 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_d919de034351cc8afb31200f0bd3bc19_5 = depth_frame_d919de034351cc8afb31200f0bd3bc19_5;
+
+    goto try_return_handler_17;
+
+    frame_exception_exit_5:;
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_d919de034351cc8afb31200f0bd3bc19_5 );
+#endif
+
+    if ( exception_tb == NULL )
+    {
+        exception_tb = MAKE_TRACEBACK( frame_d919de034351cc8afb31200f0bd3bc19_5, exception_lineno );
+    }
+    else if ( exception_tb->tb_frame != &frame_d919de034351cc8afb31200f0bd3bc19_5->m_frame )
+    {
+        exception_tb = ADD_TRACEBACK( exception_tb, frame_d919de034351cc8afb31200f0bd3bc19_5, exception_lineno );
+    }
+
+#if 0
+    // The line is not updated while running, the traceback has it.
+    frame_d919de034351cc8afb31200f0bd3bc19_5->m_frame.f_lineno = exception_lineno;
+#endif
+
+    // Attachs locals to frame if any.
+    Nuitka_Frame_AttachLocals(
+        (struct Nuitka_FrameObject *)frame_d919de034351cc8afb31200f0bd3bc19_5,
+        type_description_2,
+        outline_3_var_u
+    );
+
+
+    // Release cached frame.
+    if ( frame_d919de034351cc8afb31200f0bd3bc19_5 == FRAME_CACHE_SLOT( cache_frame_d919de034351cc8afb31200f0bd3bc19_5, depth_frame_d919de034351cc8afb31200f0bd3bc19_5 ) )
+    {
+        Py_DECREF( frame_d919de034351cc8afb31200f0bd3bc19_5 );
+        FRAME_CACHE_SLOT( cache_frame_d919de034351cc8afb31200f0bd3bc19_5, depth_frame_d919de034351cc8afb31200f0bd3bc19_5 ) = NULL;
+    }
+
+    assertFrameObject( frame_d919de034351cc8afb31200f0bd3bc19_5 );
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_d919de034351cc8afb31200f0bd3bc19_5 = depth_frame_d919de034351cc8afb31200f0bd3bc19_5;
+
+    // Return the error.
+    goto nested_frame_exit_4;
+
+    frame_no_exception_4:;
+
+    goto skip_nested_handling_4;
+    nested_frame_exit_4:;
+    type_description_1 = "oooooooooN";
+    goto try_except_handler_17;
+    skip_nested_handling_4:;
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    // Return handler code:
+    try_return_handler_17:;
+    Py_XDECREF( outline_3_var_u );
+    outline_3_var_u = NULL;
+
+    goto outline_result_4;
+    // Exception handler code:
+    try_except_handler_17:;
+    exception_keeper_type_18 = exception_type;
+    exception_keeper_value_18 = exception_value;
+    exception_keeper_tb_18 = exception_tb;
+    exception_keeper_lineno_18 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( outline_3_var_u );
+    outline_3_var_u = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_18;
+    exception_value = exception_keeper_value_18;
+    exception_tb = exception_keeper_tb_18;
+    exception_lineno = exception_keeper_lineno_18;
+
+    goto outline_exception_4;
+    // End of try:
+    // Return statement must have exited already.
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    outline_exception_4:;
+    exception_lineno = 71;
+    goto frame_exception_exit_1;
+    outline_result_4:;
+    tmp_assign_source_29 = tmp_outline_return_value_4;
+    {
+        PyObject *old = var_x;
+        var_x = tmp_assign_source_29;
+        Py_XDECREF( old );
+    }
+
+    tmp_called_name_13 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_13 != NULL );
+    tmp_args_element_name_13 = var_x;
+
+    CHECK_OBJECT( tmp_args_element_name_13 );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 72;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_13 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_13, call_args );
+    }
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 72;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    // Tried code:
+    tmp_result = MAKE_RANGE_ITERATOR( &tmp_listcontraction_6__$0, const_int_0, const_int_pos_2, const_int_pos_1, true );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 74;
+        type_description_1 = "oooooooooN";
+        goto outline_exception_6;
+    }
+    tmp_assign_source_36 = PyList_New( 0 );
+    assert( tmp_listcontraction_6__contraction == NULL );
+    tmp_listcontraction_6__contraction = tmp_assign_source_36;
+
+    // Tried code:
+    depth_frame_5b666e34b945b996018bf705374600f5_6 = cache_depth_frame_5b666e34b945b996018bf705374600f5_6++;
+    MAKE_OR_REUSE_FRAME( FRAME_CACHE_SLOT( cache_frame_5b666e34b945b996018bf705374600f5_6, depth_frame_5b666e34b945b996018bf705374600f5_6 ), codeobj_5b666e34b945b996018bf705374600f5, module___main__, sizeof(void *) );
+    frame_5b666e34b945b996018bf705374600f5_6 = FRAME_CACHE_SLOT( cache_frame_5b666e34b945b996018bf705374600f5_6, depth_frame_5b666e34b945b996018bf705374600f5_6 );
+
+    // Push the new frame as the currently active one.
+    pushFrameStack( frame_5b666e34b945b996018bf705374600f5_6 );
+
+    // Mark the frame object as in use, ref count 1 will be up for reuse.
+    assert( Py_REFCNT( frame_5b666e34b945b996018bf705374600f5_6 ) == 2 ); // Frame stack
+
+    // Framed code:
+    // Tried code:
+    loop_start_8:;
+    // Tried code:
+    tmp_assign_source_37 = RANGE_ITERATOR_NEXT( &tmp_listcontraction_6__$0 );
+    if ( tmp_assign_source_37 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_2 = "o";
+        exception_lineno = 74;
+        goto try_except_handler_23;
+    }
+    {
+        PyObject *old = tmp_listcontraction_6__iter_value_0;
+        tmp_listcontraction_6__iter_value_0 = tmp_assign_source_37;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_11;
+    // Exception handler code:
+    try_except_handler_23:;
+    exception_keeper_type_19 = exception_type;
+    exception_keeper_value_19 = exception_value;
+    exception_keeper_tb_19 = exception_tb;
+    exception_keeper_lineno_19 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_15 = exception_keeper_type_19;
+    tmp_compare_right_15 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_7 = EXCEPTION_MATCH_BOOL( tmp_compare_left_15, tmp_compare_right_15 );
+    if ( tmp_exc_match_exception_match_7 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_19 );
+        Py_XDECREF( exception_keeper_value_19 );
+        Py_XDECREF( exception_keeper_tb_19 );
+
+        exception_lineno = 74;
+        type_description_2 = "o";
+        goto try_except_handler_22;
+    }
+    if ( tmp_exc_match_exception_match_7 == 1 )
+    {
+        goto branch_yes_14;
+    }
+    else
+    {
+        goto branch_no_14;
+    }
+    branch_yes_14:;
+    Py_DECREF( exception_keeper_type_19 );
+    Py_XDECREF( exception_keeper_value_19 );
+    Py_XDECREF( exception_keeper_tb_19 );
+    goto loop_end_8;
+    goto branch_end_14;
+    branch_no_14:;
+    // Re-raise.
+    exception_type = exception_keeper_type_19;
+    exception_value = exception_keeper_value_19;
+    exception_tb = exception_keeper_tb_19;
+    exception_lineno = exception_keeper_lineno_19;
+
+    goto try_except_handler_22;
+    branch_end_14:;
+    // End of try:
+    try_end_11:;
+    tmp_assign_source_38 = tmp_listcontraction_6__iter_value_0;
+
+    CHECK_OBJECT( tmp_assign_source_38 );
+    {
+        PyObject *old = outline_5_var_f;
+        outline_5_var_f = tmp_assign_source_38;
+        Py_INCREF( outline_5_var_f );
+        Py_XDECREF( old );
+    }
+
+    tmp_append_list_5 = tmp_listcontraction_6__contraction;
+
+    CHECK_OBJECT( tmp_append_list_5 );
+    tmp_append_value_5 = outline_5_var_f;
+
+    CHECK_OBJECT( tmp_append_value_5 );
+    assert( PyList_Check( tmp_append_list_5 ) );
+    tmp_res = PyList_Append( tmp_append_list_5, tmp_append_value_5 );
+    if ( tmp_res == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 74;
+        type_description_2 = "o";
+        goto try_except_handler_22;
+    }
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 74;
+        type_description_2 = "o";
+        goto try_except_handler_22;
+    }
+    goto loop_start_8;
+    loop_end_8:;
+    tmp_outline_return_value_6 = tmp_listcontraction_6__contraction;
+
+    CHECK_OBJECT( tmp_outline_return_value_6 );
+    Py_INCREF( tmp_outline_return_value_6 );
+    goto try_return_handler_22;
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    // Return handler code:
+    try_return_handler_22:;
+    Py_XDECREF( tmp_listcontraction_6__$0.iterator );
+    tmp_listcontraction_6__$0.iterator = NULL;
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_6__contraction );
+    Py_DECREF( tmp_listcontraction_6__contraction );
+    tmp_listcontraction_6__contraction = NULL;
+
+    Py_XDECREF( tmp_listcontraction_6__iter_value_0 );
+    tmp_listcontraction_6__iter_value_0 = NULL;
+
+    goto frame_return_exit_5;
+    // Exception handler code:
+    try_except_handler_22:;
+    exception_keeper_type_20 = exception_type;
+    exception_keeper_value_20 = exception_value;
+    exception_keeper_tb_20 = exception_tb;
+    exception_keeper_lineno_20 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_listcontraction_6__$0.iterator );
+    tmp_listcontraction_6__$0.iterator = NULL;
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_6__contraction );
+    Py_DECREF( tmp_listcontraction_6__contraction );
+    tmp_listcontraction_6__contraction = NULL;
+
+    Py_XDECREF( tmp_listcontraction_6__iter_value_0 );
+    tmp_listcontraction_6__iter_value_0 = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_20;
+    exception_value = exception_keeper_value_20;
+    exception_tb = exception_keeper_tb_20;
+    exception_lineno = exception_keeper_lineno_20;
+
+    goto frame_exception_exit_6;
+    // End of try:
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_5b666e34b945b996018bf705374600f5_6 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_5b666e34b945b996018bf705374600f5_6 = depth_frame_5b666e34b945b996018bf705374600f5_6;
+
+    goto frame_no_exception_5;
+
+    frame_return_exit_5:;
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_5b666e34b945b996018bf705374600f5_6 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_5b666e34b945b996018bf705374600f5_6 = depth_frame_5b666e34b945b996018bf705374600f5_6;
+
+    goto try_return_handler_21;
+
+    frame_exception_exit_6:;
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_5b666e34b945b996018bf705374600f5_6 );
+#endif
+
+    if ( exception_tb == NULL )
+    {
+        exception_tb = MAKE_TRACEBACK( frame_5b666e34b945b996018bf705374600f5_6, exception_lineno );
+    }
+    else if ( exception_tb->tb_frame != &frame_5b666e34b945b996018bf705374600f5_6->m_frame )
+    {
+        exception_tb = ADD_TRACEBACK( exception_tb, frame_5b666e34b945b996018bf705374600f5_6, exception_lineno );
+    }
+
+#if 0
+    // The line is not updated while running, the traceback has it.
+    frame_5b666e34b945b996018bf705374600f5_6->m_frame.f_lineno = exception_lineno;
+#endif
+
+    // Attachs locals to frame if any.
+    Nuitka_Frame_AttachLocals(
+        (struct Nuitka_FrameObject *)frame_5b666e34b945b996018bf705374600f5_6,
+        type_description_2,
+        outline_5_var_f
+    );
+
+
+    // Release cached frame.
+    if ( frame_5b666e34b945b996018bf705374600f5_6 == FRAME_CACHE_SLOT( cache_frame_5b666e34b945b996018bf705374600f5_6, depth_frame_5b666e34b945b996018bf705374600f5_6 ) )
+    {
+        Py_DECREF( frame_5b666e34b945b996018bf705374600f5_6 );
+        FRAME_CACHE_SLOT( cache_frame_5b666e34b945b996018bf705374600f5_6, depth_frame_5b666e34b945b996018bf705374600f5_6 ) = NULL;
+    }
+
+    assertFrameObject( frame_5b666e34b945b996018bf705374600f5_6 );
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_5b666e34b945b996018bf705374600f5_6 = depth_frame_5b666e34b945b996018bf705374600f5_6;
+
+    // Return the error.
+    goto nested_frame_exit_5;
+
+    frame_no_exception_5:;
+
+    goto skip_nested_handling_5;
+    nested_frame_exit_5:;
+    type_description_1 = "oooooooooN";
+    goto try_except_handler_21;
+    skip_nested_handling_5:;
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    // Return handler code:
+    try_return_handler_21:;
+    Py_XDECREF( outline_5_var_f );
+    outline_5_var_f = NULL;
+
+    goto outline_result_6;
+    // Exception handler code:
+    try_except_handler_21:;
+    exception_keeper_type_21 = exception_type;
+    exception_keeper_value_21 = exception_value;
+    exception_keeper_tb_21 = exception_tb;
+    exception_keeper_lineno_21 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( outline_5_var_f );
+    outline_5_var_f = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_21;
+    exception_value = exception_keeper_value_21;
+    exception_tb = exception_keeper_tb_21;
+    exception_lineno = exception_keeper_lineno_21;
+
+    goto outline_exception_6;
+    // End of try:
+    // Return statement must have exited already.
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    outline_exception_6:;
+    exception_lineno = 74;
+    goto try_except_handler_20;
+    outline_result_6:;
+    tmp_iter_arg_3 = tmp_outline_return_value_6;
+    tmp_assign_source_35 = MAKE_ITERATOR( tmp_iter_arg_3 );
+    Py_DECREF( tmp_iter_arg_3 );
+    if ( tmp_assign_source_35 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 74;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_20;
+    }
+    assert( tmp_listcontraction_5__$0 == NULL );
+    tmp_listcontraction_5__$0 = tmp_assign_source_35;
+
+    tmp_assign_source_39 = PyList_New( 0 );
+    assert( tmp_listcontraction_5__contraction == NULL );
+    tmp_listcontraction_5__contraction = tmp_assign_source_39;
+
+    depth_frame_572eb9fa48c335f9925d1f6c31523968_7 = cache_depth_frame_572eb9fa48c335f9925d1f6c31523968_7++;
+    MAKE_OR_REUSE_FRAME( FRAME_CACHE_SLOT( cache_frame_572eb9fa48c335f9925d1f6c31523968_7, depth_frame_572eb9fa48c335f9925d1f6c31523968_7 ), codeobj_572eb9fa48c335f9925d1f6c31523968, module___main__, sizeof(void *) );
+    frame_572eb9fa48c335f9925d1f6c31523968_7 = FRAME_CACHE_SLOT( cache_frame_572eb9fa48c335f9925d1f6c31523968_7, depth_frame_572eb9fa48c335f9925d1f6c31523968_7 );
+
+    // Push the new frame as the currently active one.
+    pushFrameStack( frame_572eb9fa48c335f9925d1f6c31523968_7 );
+
+    // Mark the frame object as in use, ref count 1 will be up for reuse.
+    assert( Py_REFCNT( frame_572eb9fa48c335f9925d1f6c31523968_7 ) == 2 ); // Frame stack
+
+    // Framed code:
+    // Tried code:
+    loop_start_9:;
+    // Tried code:
+    tmp_value_name_4 = tmp_listcontraction_5__$0;
+
+    CHECK_OBJECT( tmp_value_name_4 );
+    tmp_assign_source_40 = ITERATOR_NEXT( tmp_value_name_4 );
+    if ( tmp_assign_source_40 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_2 = "o";
+        exception_lineno = 74;
+        goto try_except_handler_25;
+    }
+    {
+        PyObject *old = tmp_listcontraction_5__iter_value_0;
+        tmp_listcontraction_5__iter_value_0 = tmp_assign_source_40;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_12;
+    // Exception handler code:
+    try_except_handler_25:;
+    exception_keeper_type_22 = exception_type;
+    exception_keeper_value_22 = exception_value;
+    exception_keeper_tb_22 = exception_tb;
+    exception_keeper_lineno_22 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_16 = exception_keeper_type_22;
+    tmp_compare_right_16 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_8 = EXCEPTION_MATCH_BOOL( tmp_compare_left_16, tmp_compare_right_16 );
+    if ( tmp_exc_match_exception_match_8 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_22 );
+        Py_XDECREF( exception_keeper_value_22 );
+        Py_XDECREF( exception_keeper_tb_22 );
+
+        exception_lineno = 74;
+        type_description_2 = "o";
+        goto try_except_handler_24;
+    }
+    if ( tmp_exc_match_exception_match_8 == 1 )
+    {
+        goto branch_yes_15;
+    }
+    else
+    {
+        goto branch_no_15;
+    }
+    branch_yes_15:;
+    Py_DECREF( exception_keeper_type_22 );
+    Py_XDECREF( exception_keeper_value_22 );
+    Py_XDECREF( exception_keeper_tb_22 );
+    goto loop_end_9;
+    goto branch_end_15;
+    branch_no_15:;
+    // Re-raise.
+    exception_type = exception_keeper_type_22;
+    exception_value = exception_keeper_value_22;
+    exception_tb = exception_keeper_tb_22;
+    exception_lineno = exception_keeper_lineno_22;
+
+    goto try_except_handler_24;
+    branch_end_15:;
+    // End of try:
+    try_end_12:;
+    tmp_assign_source_41 = tmp_listcontraction_5__iter_value_0;
+
+    CHECK_OBJECT( tmp_assign_source_41 );
+    {
+        PyObject *old = outline_4_var_m;
+        outline_4_var_m = tmp_assign_source_41;
+        Py_INCREF( outline_4_var_m );
+        Py_XDECREF( old );
+    }
+
+    tmp_append_list_6 = tmp_listcontraction_5__contraction;
+
+    CHECK_OBJECT( tmp_append_list_6 );
+    // Tried code:
+    tmp_iter_arg_4 = PyTuple_New( 2 );
+    tmp_tuple_element_5 = outline_4_var_m;
+
+    CHECK_OBJECT( tmp_tuple_element_5 );
+    Py_INCREF( tmp_tuple_element_5 );
+    PyTuple_SET_ITEM( tmp_iter_arg_4, 0, tmp_tuple_element_5 );
+    tmp_left_name_4 = outline_4_var_m;
+
+    CHECK_OBJECT( tmp_left_name_4 );
+    tmp_right_name_4 = const_int_pos_1;
+    tmp_tuple_element_5 = BINARY_OPERATION_ADD( tmp_left_name_4, tmp_right_name_4 );
+    if ( tmp_tuple_element_5 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        Py_DECREF( tmp_iter_arg_4 );
+
+        exception_lineno = 74;
+        type_description_2 = "o";
+        goto try_except_handler_26;
+    }
+    PyTuple_SET_ITEM( tmp_iter_arg_4, 1, tmp_tuple_element_5 );
+    tmp_assign_source_42 = MAKE_ITERATOR( tmp_iter_arg_4 );
+    Py_DECREF( tmp_iter_arg_4 );
+    if ( tmp_assign_source_42 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 74;
+        type_description_2 = "o";
+        goto try_except_handler_26;
+    }
+    {
+        PyObject *old = tmp_listcontraction$listcontraction_1__$0;
+        tmp_listcontraction$listcontraction_1__$0 = tmp_assign_source_42;
+        Py_XDECREF( old );
+    }
+
+    tmp_assign_source_43 = PyList_New( 0 );
+    {
+        PyObject *old = tmp_listcontraction$listcontraction_1__contraction;
+        tmp_listcontraction$listcontraction_1__contraction = tmp_assign_source_43;
+        Py_XDECREF( old );
+    }
+
+    depth_frame_952db0bde0028542233c83c413f3c46b_8 = cache_depth_frame_952db0bde0028542233c83c413f3c46b_8++;
+    MAKE_OR_REUSE_FRAME( FRAME_CACHE_SLOT( cache_frame_952db0bde0028542233c83c413f3c46b_8, depth_frame_952db0bde0028542233c83c413f3c46b_8 ), codeobj_952db0bde0028542233c83c413f3c46b, module___main__, sizeof(void *) );
+    frame_952db0bde0028542233c83c413f3c46b_8 = FRAME_CACHE_SLOT( cache_frame_952db0bde0028542233c83c413f3c46b_8, depth_frame_952db0bde0028542233c83c413f3c46b_8 );
+
+    // Push the new frame as the currently active one.
+    pushFrameStack( frame_952db0bde0028542233c83c413f3c46b_8 );
+
+    // Mark the frame object as in use, ref count 1 will be up for reuse.
+    assert( Py_REFCNT( frame_952db0bde0028542233c83c413f3c46b_8 ) == 2 ); // Frame stack
+
+    // Framed code:
+    // Tried code:
+    loop_start_10:;
+    // Tried code:
+    tmp_value_name_5 = tmp_listcontraction$listcontraction_1__$0;
+
+    CHECK_OBJECT( tmp_value_name_5 );
+    tmp_assign_source_44 = ITERATOR_NEXT( tmp_value_name_5 );
+    if ( tmp_assign_source_44 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_3 = "o";
+        exception_lineno = 74;
+        goto try_except_handler_28;
+    }
+    {
+        PyObject *old = tmp_listcontraction$listcontraction_1__iter_value_0;
+        tmp_listcontraction$listcontraction_1__iter_value_0 = tmp_assign_source_44;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_13;
+    // Exception handler code:
+    try_except_handler_28:;
+    exception_keeper_type_23 = exception_type;
+    exception_keeper_value_23 = exception_value;
+    exception_keeper_tb_23 = exception_tb;
+    exception_keeper_lineno_23 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_17 = exception_keeper_type_23;
+    tmp_compare_right_17 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_9 = EXCEPTION_MATCH_BOOL( tmp_compare_left_17, tmp_compare_right_17 );
+    if ( tmp_exc_match_exception_match_9 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_23 );
+        Py_XDECREF( exception_keeper_value_23 );
+        Py_XDECREF( exception_keeper_tb_23 );
+
+        exception_lineno = 74;
+        type_description_3 = "o";
+        goto try_except_handler_27;
+    }
+    if ( tmp_exc_match_exception_match_9 == 1 )
+    {
+        goto branch_yes_16;
+    }
+    else
+    {
+        goto branch_no_16;
+    }
+    branch_yes_16:;
+    Py_DECREF( exception_keeper_type_23 );
+    Py_XDECREF( exception_keeper_value_23 );
+    Py_XDECREF( exception_keeper_tb_23 );
+    goto loop_end_10;
+    goto branch_end_16;
+    branch_no_16:;
+    // Re-raise.
+    exception_type = exception_keeper_type_23;
+    exception_value = exception_keeper_value_23;
+    exception_tb = exception_keeper_tb_23;
+    exception_lineno = exception_keeper_lineno_23;
+
+    goto try_except_handler_27;
+    branch_end_16:;
+    // End of try:
+    try_end_13:;
+    tmp_assign_source_45 = tmp_listcontraction$listcontraction_1__iter_value_0;
+
+    CHECK_OBJECT( tmp_assign_source_45 );
+    {
+        PyObject *old = outline_6_var_l;
+        outline_6_var_l = tmp_assign_source_45;
+        Py_INCREF( outline_6_var_l );
+        Py_XDECREF( old );
+    }
+
+    tmp_append_list_7 = tmp_listcontraction$listcontraction_1__contraction;
+
+    CHECK_OBJECT( tmp_append_list_7 );
+    tmp_left_name_5 = const_int_pos_3;
+    tmp_cond_value_3 = outline_6_var_l;
+
+    CHECK_OBJECT( tmp_cond_value_3 );
+    tmp_cond_truth_3 = CHECK_IF_TRUE( tmp_cond_value_3 );
+    if ( tmp_cond_truth_3 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 74;
+        type_description_3 = "o";
+        goto try_except_handler_27;
+    }
+    if ( tmp_cond_truth_3 == 1 )
+    {
+        goto condexpr_true_4;
+    }
+    else
+    {
+        goto condexpr_false_4;
+    }
+    condexpr_true_4:;
+    tmp_right_name_5 = outline_6_var_l;
+
+    CHECK_OBJECT( tmp_right_name_5 );
+    goto condexpr_end_4;
+    condexpr_false_4:;
+    tmp_right_name_5 = const_int_neg_1;
+    condexpr_end_4:;
+    tmp_append_value_7 = BINARY_OPERATION_ADD( tmp_left_name_5, tmp_right_name_5 );
+    if ( tmp_append_value_7 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 74;
+        type_description_3 = "o";
+        goto try_except_handler_27;
+    }
+    assert( PyList_Check( tmp_append_list_7 ) );
+    tmp_res = PyList_Append( tmp_append_list_7, tmp_append_value_7 );
+    Py_DECREF( tmp_append_value_7 );
+    if ( tmp_res == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 74;
+        type_description_3 = "o";
+        goto try_except_handler_27;
+    }
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 74;
+        type_description_3 = "o";
+        goto try_except_handler_27;
+    }
+    goto loop_start_10;
+    loop_end_10:;
+    tmp_outline_return_value_7 = tmp_listcontraction$listcontraction_1__contraction;
+
+    CHECK_OBJECT( tmp_outline_return_value_7 );
+    Py_INCREF( tmp_outline_return_value_7 );
+    goto try_return_handler_27;
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    // Return handler code:
+    try_return_handler_27:;
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction$listcontraction_1__$0 );
+    Py_DECREF( tmp_listcontraction$listcontraction_1__$0 );
+    tmp_listcontraction$listcontraction_1__$0 = NULL;
+
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction$listcontraction_1__contraction );
+    Py_DECREF( tmp_listcontraction$listcontraction_1__contraction );
+    tmp_listcontraction$listcontraction_1__contraction = NULL;
+
+    Py_XDECREF( tmp_listcontraction$listcontraction_1__iter_value_0 );
+    tmp_listcontraction$listcontraction_1__iter_value_0 = NULL;
+
+    goto frame_return_exit_7;
+    // Exception handler code:
+    try_except_handler_27:;
+    exception_keeper_type_24 = exception_type;
+    exception_keeper_value_24 = exception_value;
+    exception_keeper_tb_24 = exception_tb;
+    exception_keeper_lineno_24 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction$listcontraction_1__$0 );
+    Py_DECREF( tmp_listcontraction$listcontraction_1__$0 );
+    tmp_listcontraction$listcontraction_1__$0 = NULL;
+
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction$listcontraction_1__contraction );
+    Py_DECREF( tmp_listcontraction$listcontraction_1__contraction );
+    tmp_listcontraction$listcontraction_1__contraction = NULL;
+
+    Py_XDECREF( tmp_listcontraction$listcontraction_1__iter_value_0 );
+    tmp_listcontraction$listcontraction_1__iter_value_0 = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_24;
+    exception_value = exception_keeper_value_24;
+    exception_tb = exception_keeper_tb_24;
+    exception_lineno = exception_keeper_lineno_24;
+
+    goto frame_exception_exit_8;
+    // End of try:
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_952db0bde0028542233c83c413f3c46b_8 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_952db0bde0028542233c83c413f3c46b_8 = depth_frame_952db0bde0028542233c83c413f3c46b_8;
+
+    goto frame_no_exception_6;
+
+    frame_return_exit_7:;
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_952db0bde0028542233c83c413f3c46b_8 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_952db0bde0028542233c83c413f3c46b_8 = depth_frame_952db0bde0028542233c83c413f3c46b_8;
+
+    goto try_return_handler_26;
+
+    frame_exception_exit_8:;
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_952db0bde0028542233c83c413f3c46b_8 );
+#endif
+
+    if ( exception_tb == NULL )
+    {
+        exception_tb = MAKE_TRACEBACK( frame_952db0bde0028542233c83c413f3c46b_8, exception_lineno );
+    }
+    else if ( exception_tb->tb_frame != &frame_952db0bde0028542233c83c413f3c46b_8->m_frame )
+    {
+        exception_tb = ADD_TRACEBACK( exception_tb, frame_952db0bde0028542233c83c413f3c46b_8, exception_lineno );
+    }
+
+#if 0
+    // The line is not updated while running, the traceback has it.
+    frame_952db0bde0028542233c83c413f3c46b_8->m_frame.f_lineno = exception_lineno;
+#endif
+
+    // Attachs locals to frame if any.
+    Nuitka_Frame_AttachLocals(
+        (struct Nuitka_FrameObject *)frame_952db0bde0028542233c83c413f3c46b_8,
+        type_description_3,
+        outline_6_var_l
+    );
+
+
+    // Release cached frame.
+    if ( frame_952db0bde0028542233c83c413f3c46b_8 == FRAME_CACHE_SLOT( cache_frame_952db0bde0028542233c83c413f3c46b_8, depth_frame_952db0bde0028542233c83c413f3c46b_8 ) )
+    {
+        Py_DECREF( frame_952db0bde0028542233c83c413f3c46b_8 );
+        FRAME_CACHE_SLOT( cache_frame_952db0bde0028542233c83c413f3c46b_8, depth_frame_952db0bde0028542233c83c413f3c46b_8 ) = NULL;
+    }
+
+    assertFrameObject( frame_952db0bde0028542233c83c413f3c46b_8 );
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_952db0bde0028542233c83c413f3c46b_8 = depth_frame_952db0bde0028542233c83c413f3c46b_8;
+
+    // Return the error.
+    goto nested_frame_exit_7;
+
+    frame_no_exception_6:;
+
+    goto skip_nested_handling_6;
+    nested_frame_exit_7:;
+    type_description_2 = "o";
+    goto try_except_handler_26;
+    skip_nested_handling_6:;
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    // Return handler code:
+    try_return_handler_26:;
+    Py_XDECREF( outline_6_var_l );
+    outline_6_var_l = NULL;
+
+    goto outline_result_7;
+    // Exception handler code:
+    try_except_handler_26:;
+    exception_keeper_type_25 = exception_type;
+    exception_keeper_value_25 = exception_value;
+    exception_keeper_tb_25 = exception_tb;
+    exception_keeper_lineno_25 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( outline_6_var_l );
+    outline_6_var_l = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_25;
+    exception_value = exception_keeper_value_25;
+    exception_tb = exception_keeper_tb_25;
+    exception_lineno = exception_keeper_lineno_25;
+
+    goto outline_exception_7;
+    // End of try:
+    // Return statement must have exited already.
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    outline_exception_7:;
+    exception_lineno = 74;
+    goto try_except_handler_24;
+    outline_result_7:;
+    tmp_append_value_6 = tmp_outline_return_value_7;
+    assert( PyList_Check( tmp_append_list_6 ) );
+    tmp_res = PyList_Append( tmp_append_list_6, tmp_append_value_6 );
+    Py_DECREF( tmp_append_value_6 );
+    if ( tmp_res == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 74;
+        type_description_2 = "o";
+        goto try_except_handler_24;
+    }
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 74;
+        type_description_2 = "o";
+        goto try_except_handler_24;
+    }
+    goto loop_start_9;
+    loop_end_9:;
+    tmp_outline_return_value_5 = tmp_listcontraction_5__contraction;
+
+    CHECK_OBJECT( tmp_outline_return_value_5 );
+    Py_INCREF( tmp_outline_return_value_5 );
+    goto try_return_handler_24;
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    // Return handler code:
+    try_return_handler_24:;
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_5__$0 );
+    Py_DECREF( tmp_listcontraction_5__$0 );
+    tmp_listcontraction_5__$0 = NULL;
+
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_5__contraction );
+    Py_DECREF( tmp_listcontraction_5__contraction );
+    tmp_listcontraction_5__contraction = NULL;
+
+    Py_XDECREF( tmp_listcontraction_5__iter_value_0 );
+    tmp_listcontraction_5__iter_value_0 = NULL;
+
+    goto frame_return_exit_6;
+    // Exception handler code:
+    try_except_handler_24:;
+    exception_keeper_type_26 = exception_type;
+    exception_keeper_value_26 = exception_value;
+    exception_keeper_tb_26 = exception_tb;
+    exception_keeper_lineno_26 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_5__$0 );
+    Py_DECREF( tmp_listcontraction_5__$0 );
+    tmp_listcontraction_5__$0 = NULL;
+
+    CHECK_OBJECT( (PyObject *)tmp_listcontraction_5__contraction );
+    Py_DECREF( tmp_listcontraction_5__contraction );
+    tmp_listcontraction_5__contraction = NULL;
+
+    Py_XDECREF( tmp_listcontraction_5__iter_value_0 );
+    tmp_listcontraction_5__iter_value_0 = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_26;
+    exception_value = exception_keeper_value_26;
+    exception_tb = exception_keeper_tb_26;
+    exception_lineno = exception_keeper_lineno_26;
+
+    goto frame_exception_exit_7;
+    // End of try:
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_572eb9fa48c335f9925d1f6c31523968_7 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_572eb9fa48c335f9925d1f6c31523968_7 = depth_frame_572eb9fa48c335f9925d1f6c31523968_7;
+
+    goto frame_no_exception_7;
+
+    frame_return_exit_6:;
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_572eb9fa48c335f9925d1f6c31523968_7 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_572eb9fa48c335f9925d1f6c31523968_7 = depth_frame_572eb9fa48c335f9925d1f6c31523968_7;
+
+    goto try_return_handler_20;
+
+    frame_exception_exit_7:;
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_572eb9fa48c335f9925d1f6c31523968_7 );
+#endif
+
+    if ( exception_tb == NULL )
+    {
+        exception_tb = MAKE_TRACEBACK( frame_572eb9fa48c335f9925d1f6c31523968_7, exception_lineno );
+    }
+    else if ( exception_tb->tb_frame != &frame_572eb9fa48c335f9925d1f6c31523968_7->m_frame )
+    {
+        exception_tb = ADD_TRACEBACK( exception_tb, frame_572eb9fa48c335f9925d1f6c31523968_7, exception_lineno );
+    }
+
+#if 0
+    // The line is not updated while running, the traceback has it.
+    frame_572eb9fa48c335f9925d1f6c31523968_7->m_frame.f_lineno = exception_lineno;
+#endif
+
+    // Attachs locals to frame if any.
+    Nuitka_Frame_AttachLocals(
+        (struct Nuitka_FrameObject *)frame_572eb9fa48c335f9925d1f6c31523968_7,
+        type_description_2,
+        outline_4_var_m
+    );
+
+
+    // Release cached frame.
+    if ( frame_572eb9fa48c335f9925d1f6c31523968_7 == FRAME_CACHE_SLOT( cache_frame_572eb9fa48c335f9925d1f6c31523968_7, depth_frame_572eb9fa48c335f9925d1f6c31523968_7 ) )
+    {
+        Py_DECREF( frame_572eb9fa48c335f9925d1f6c31523968_7 );
+        FRAME_CACHE_SLOT( cache_frame_572eb9fa48c335f9925d1f6c31523968_7, depth_frame_572eb9fa48c335f9925d1f6c31523968_7 ) = NULL;
+    }
+
+    assertFrameObject( frame_572eb9fa48c335f9925d1f6c31523968_7 );
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_572eb9fa48c335f9925d1f6c31523968_7 = depth_frame_572eb9fa48c335f9925d1f6c31523968_7;
+
+    // Return the error.
+    goto nested_frame_exit_6;
+
+    frame_no_exception_7:;
+
+    goto skip_nested_handling_7;
+    nested_frame_exit_6:;
+    type_description_1 = "oooooooooN";
+    goto try_except_handler_20;
+    skip_nested_handling_7:;
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    // Return handler code:
+    try_return_handler_20:;
+    Py_XDECREF( outline_4_var_m );
+    outline_4_var_m = NULL;
+
+    goto outline_result_5;
+    // Exception handler code:
+    try_except_handler_20:;
+    exception_keeper_type_27 = exception_type;
+    exception_keeper_value_27 = exception_value;
+    exception_keeper_tb_27 = exception_tb;
+    exception_keeper_lineno_27 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( outline_4_var_m );
+    outline_4_var_m = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_27;
+    exception_value = exception_keeper_value_27;
+    exception_tb = exception_keeper_tb_27;
+    exception_lineno = exception_keeper_lineno_27;
+
+    goto outline_exception_5;
+    // End of try:
+    // Return statement must have exited already.
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    outline_exception_5:;
+    exception_lineno = 74;
+    goto frame_exception_exit_1;
+    outline_result_5:;
+    tmp_assign_source_34 = tmp_outline_return_value_5;
+    assert( var_y == NULL );
+    var_y = tmp_assign_source_34;
+
+    tmp_called_name_14 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_14 != NULL );
+    tmp_args_element_name_14 = const_str_digest_7e46d1b7a02aaa71f443543dcea4d327;
+    tmp_args_element_name_15 = var_f;
+
+    if ( tmp_args_element_name_15 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "f" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 75;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 75;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_14, tmp_args_element_name_15 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS2( tmp_called_name_14, call_args );
+    }
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 75;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_called_name_15 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_15 != NULL );
+    tmp_args_element_name_16 = const_str_digest_e6facc1cff9058d9f8a1254c5bb3f915;
+    tmp_args_element_name_17 = var_y;
+
+    CHECK_OBJECT( tmp_args_element_name_17 );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 76;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_16, tmp_args_element_name_17 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS2( tmp_called_name_15, call_args );
+    }
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 76;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_bool_arg_1 = var_x;
+
+    if ( tmp_bool_arg_1 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "x" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 78;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_unused = TO_BOOL( tmp_bool_arg_1 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 78;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    tmp_cond_value_4 = var_x;
+
+    if ( tmp_cond_value_4 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "x" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 83;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_cond_truth_4 = CHECK_IF_TRUE( tmp_cond_value_4 );
+    if ( tmp_cond_truth_4 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 83;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_cond_truth_4 == 1 )
+    {
+        goto branch_yes_17;
+    }
+    else
+    {
+        goto branch_no_17;
+    }
+    branch_yes_17:;
+    tmp_assign_source_46 = const_str_plain_yes;
+    assert( var_l == NULL );
+    Py_INCREF( tmp_assign_source_46 );
+    var_l = tmp_assign_source_46;
+
+    goto branch_end_17;
+    branch_no_17:;
+    tmp_assign_source_47 = const_str_plain_no;
+    assert( var_l == NULL );
+    Py_INCREF( tmp_assign_source_47 );
+    var_l = tmp_assign_source_47;
+
+    branch_end_17:;
+    tmp_called_name_16 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_16 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 89;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_16, &PyTuple_GET_ITEM( const_tuple_str_digest_cdd84bdb4119608cb49b60eb9efdb07f_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 89;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_and_left_value_2 = var_m;
+
+    if ( tmp_and_left_value_2 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "m" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 91;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_and_left_truth_2 = CHECK_IF_TRUE( tmp_and_left_value_2 );
+    if ( tmp_and_left_truth_2 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 91;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_and_left_truth_2 == 1 )
+    {
+        goto and_right_2;
+    }
+    else
+    {
+        goto and_left_2;
+    }
+    and_right_2:;
+    tmp_and_left_value_3 = var_l;
+
+    CHECK_OBJECT( tmp_and_left_value_3 );
+    tmp_and_left_truth_3 = CHECK_IF_TRUE( tmp_and_left_value_3 );
+    if ( tmp_and_left_truth_3 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 91;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_and_left_truth_3 == 1 )
+    {
+        goto and_right_3;
+    }
+    else
+    {
+        goto and_left_3;
+    }
+    and_right_3:;
+    tmp_and_right_value_3 = var_f;
+
+    if ( tmp_and_right_value_3 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "f" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 91;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_and_right_value_2 = tmp_and_right_value_3;
+    goto and_end_3;
+    and_left_3:;
+    tmp_and_right_value_2 = tmp_and_left_value_3;
+    and_end_3:;
+    tmp_cond_value_5 = tmp_and_right_value_2;
+    goto and_end_2;
+    and_left_2:;
+    tmp_cond_value_5 = tmp_and_left_value_2;
+    and_end_2:;
+    tmp_cond_truth_5 = CHECK_IF_TRUE( tmp_cond_value_5 );
+    if ( tmp_cond_truth_5 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 91;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_cond_truth_5 == 1 )
+    {
+        goto branch_yes_18;
+    }
+    else
+    {
+        goto branch_no_18;
+    }
+    branch_yes_18:;
+    tmp_called_name_17 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_17 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 92;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_17, &PyTuple_GET_ITEM( const_tuple_str_plain_OK_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 92;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    branch_no_18:;
+    tmp_called_name_18 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_18 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 94;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_18, &PyTuple_GET_ITEM( const_tuple_str_digest_8fce46a6ae4b5a4efc2bd40e08df4154_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 94;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_or_left_value_1 = var_m;
+
+    if ( tmp_or_left_value_1 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "m" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 95;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_or_left_truth_1 = CHECK_IF_TRUE( tmp_or_left_value_1 );
+    if ( tmp_or_left_truth_1 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 95;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_or_left_truth_1 == 1 )
+    {
+        goto or_left_1;
+    }
+    else
+    {
+        goto or_right_1;
+    }
+    or_right_1:;
+    tmp_or_left_value_2 = var_l;
+
+    CHECK_OBJECT( tmp_or_left_value_2 );
+    tmp_or_left_truth_2 = CHECK_IF_TRUE( tmp_or_left_value_2 );
+    if ( tmp_or_left_truth_2 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 95;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_or_left_truth_2 == 1 )
+    {
+        goto or_left_2;
+    }
+    else
+    {
+        goto or_right_2;
+    }
+    or_right_2:;
+    tmp_or_right_value_2 = var_f;
+
+    if ( tmp_or_right_value_2 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "f" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 95;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_or_right_value_1 = tmp_or_right_value_2;
+    goto or_end_2;
+    or_left_2:;
+    tmp_or_right_value_1 = tmp_or_left_value_2;
+    or_end_2:;
+    tmp_cond_value_6 = tmp_or_right_value_1;
+    goto or_end_1;
+    or_left_1:;
+    tmp_cond_value_6 = tmp_or_left_value_1;
+    or_end_1:;
+    tmp_cond_truth_6 = CHECK_IF_TRUE( tmp_cond_value_6 );
+    if ( tmp_cond_truth_6 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 95;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_cond_truth_6 == 1 )
+    {
+        goto branch_yes_19;
+    }
+    else
+    {
+        goto branch_no_19;
+    }
+    branch_yes_19:;
+    tmp_called_name_19 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_19 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 96;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_19, &PyTuple_GET_ITEM( const_tuple_str_plain_Okey_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 96;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    branch_no_19:;
+    tmp_called_name_20 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_20 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 98;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_20, &PyTuple_GET_ITEM( const_tuple_str_digest_ea9e46aaa77eee8d9efc490f40f00045_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 98;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_cond_value_7 = var_m;
+
+    if ( tmp_cond_value_7 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "m" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 99;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_cond_truth_7 = CHECK_IF_TRUE( tmp_cond_value_7 );
+    if ( tmp_cond_truth_7 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 99;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_cond_truth_7 == 1 )
+    {
+        goto branch_no_20;
+    }
+    else
+    {
+        goto branch_yes_20;
+    }
+    branch_yes_20:;
+    tmp_cond_value_8 = var_l;
+
+    if ( tmp_cond_value_8 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "l" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 100;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_cond_truth_8 = CHECK_IF_TRUE( tmp_cond_value_8 );
+    if ( tmp_cond_truth_8 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 100;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_cond_truth_8 == 1 )
+    {
+        goto branch_no_21;
+    }
+    else
+    {
+        goto branch_yes_21;
+    }
+    branch_yes_21:;
+    tmp_called_name_21 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_21 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 101;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_21, &PyTuple_GET_ITEM( const_tuple_str_plain_ok_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 101;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    branch_no_21:;
+    branch_no_20:;
+    tmp_called_name_22 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_22 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 103;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_22, &PyTuple_GET_ITEM( const_tuple_str_digest_0dbf11a4c874ec83ccac34718f8f9c87_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 103;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_or_left_value_3 = var_m;
+
+    if ( tmp_or_left_value_3 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "m" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 104;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_or_left_truth_3 = CHECK_IF_TRUE( tmp_or_left_value_3 );
+    if ( tmp_or_left_truth_3 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 104;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_or_left_truth_3 == 1 )
+    {
+        goto or_left_3;
+    }
+    else
+    {
+        goto or_right_3;
+    }
+    or_right_3:;
+    tmp_or_right_value_3 = var_l;
+
+    if ( tmp_or_right_value_3 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "l" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 104;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_cond_value_9 = tmp_or_right_value_3;
+    goto or_end_3;
+    or_left_3:;
+    tmp_cond_value_9 = tmp_or_left_value_3;
+    or_end_3:;
+    tmp_cond_truth_9 = CHECK_IF_TRUE( tmp_cond_value_9 );
+    if ( tmp_cond_truth_9 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 104;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_cond_truth_9 == 1 )
+    {
+        goto branch_no_22;
+    }
+    else
+    {
+        goto branch_yes_22;
+    }
+    branch_yes_22:;
+    tmp_called_name_23 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_23 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 105;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_23, &PyTuple_GET_ITEM( const_tuple_str_plain_oki_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 105;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    branch_no_22:;
+    tmp_called_name_24 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_24 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 107;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_24, &PyTuple_GET_ITEM( const_tuple_str_digest_73b7b1f333ded478224c044b51fa2532_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 107;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_and_left_value_4 = var_m;
+
+    if ( tmp_and_left_value_4 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "m" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 108;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_and_left_truth_4 = CHECK_IF_TRUE( tmp_and_left_value_4 );
+    if ( tmp_and_left_truth_4 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 108;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_and_left_truth_4 == 1 )
+    {
+        goto and_right_4;
+    }
+    else
+    {
+        goto and_left_4;
+    }
+    and_right_4:;
+    tmp_and_right_value_4 = var_l;
+
+    if ( tmp_and_right_value_4 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "l" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 108;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_cond_value_10 = tmp_and_right_value_4;
+    goto and_end_4;
+    and_left_4:;
+    tmp_cond_value_10 = tmp_and_left_value_4;
+    and_end_4:;
+    tmp_cond_truth_10 = CHECK_IF_TRUE( tmp_cond_value_10 );
+    if ( tmp_cond_truth_10 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 108;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_cond_truth_10 == 1 )
+    {
+        goto branch_no_23;
+    }
+    else
+    {
+        goto branch_yes_23;
+    }
+    branch_yes_23:;
+    tmp_called_name_25 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_25 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 109;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_25, &PyTuple_GET_ITEM( const_tuple_str_plain_oki_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 109;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    branch_no_23:;
+    tmp_called_name_26 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_26 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 112;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_26, &PyTuple_GET_ITEM( const_tuple_str_digest_d0029e2577ed0f543eb463df46a3802c_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 112;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_cond_value_11 = par_a;
+
+    if ( tmp_cond_value_11 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "a" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 113;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_cond_truth_11 = CHECK_IF_TRUE( tmp_cond_value_11 );
+    if ( tmp_cond_truth_11 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 113;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_cond_truth_11 == 1 )
+    {
+        goto branch_yes_24;
+    }
+    else
+    {
+        goto branch_no_24;
+    }
+    branch_yes_24:;
+    tmp_or_left_value_4 = var_b;
+
+    if ( tmp_or_left_value_4 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "b" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 114;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_or_left_truth_4 = CHECK_IF_TRUE( tmp_or_left_value_4 );
+    if ( tmp_or_left_truth_4 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 114;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_or_left_truth_4 == 1 )
+    {
+        goto or_left_4;
+    }
+    else
+    {
+        goto or_right_4;
+    }
+    or_right_4:;
+    tmp_or_right_value_4 = var_c;
+
+    if ( tmp_or_right_value_4 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "c" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 114;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_cond_value_12 = tmp_or_right_value_4;
+    goto or_end_4;
+    or_left_4:;
+    tmp_cond_value_12 = tmp_or_left_value_4;
+    or_end_4:;
+    tmp_cond_truth_12 = CHECK_IF_TRUE( tmp_cond_value_12 );
+    if ( tmp_cond_truth_12 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 114;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    if ( tmp_cond_truth_12 == 1 )
+    {
+        goto branch_yes_25;
+    }
+    else
+    {
+        goto branch_no_25;
+    }
+    branch_yes_25:;
+    tmp_called_name_27 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_27 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 116;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_27, &PyTuple_GET_ITEM( const_tuple_str_digest_186e3b3dbfd8bbccfc71bbfc4554a7bf_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 116;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    branch_no_25:;
+    goto branch_end_24;
+    branch_no_24:;
+    tmp_called_name_28 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_28 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 119;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_28, &PyTuple_GET_ITEM( const_tuple_str_digest_37caecb2e1c4a0533584667453af65ce_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 119;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    branch_end_24:;
+    tmp_called_name_29 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_29 != NULL );
+    tmp_args_element_name_18 = var_x;
+
+    if ( tmp_args_element_name_18 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "x" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 121;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 121;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_18 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_29, call_args );
+    }
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 121;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    // Tried code:
+    tmp_called_name_30 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_30 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 126;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_30, &PyTuple_GET_ITEM( const_tuple_str_digest_18b7780adb5fb4b80b0d19ba5d462b03_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 126;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_29;
+    }
+    Py_DECREF( tmp_unused );
+    goto try_end_14;
+    // Exception handler code:
+    try_except_handler_29:;
+    exception_keeper_type_28 = exception_type;
+    exception_keeper_value_28 = exception_value;
+    exception_keeper_tb_28 = exception_tb;
+    exception_keeper_lineno_28 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_28;
+    exception_value = exception_keeper_value_28;
+    exception_tb = exception_keeper_tb_28;
+    exception_lineno = exception_keeper_lineno_28;
+
+    goto frame_exception_exit_1;
+    // End of try:
+    try_end_14:;
+    tmp_result = MAKE_RANGE_ITERATOR( &tmp_for_loop_3__for_iterator, const_int_0, const_int_pos_7, const_int_pos_1, true );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 133;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    // Tried code:
+    // Tried code:
+    loop_start_11:;
+    // Tried code:
+    tmp_assign_source_48 = RANGE_ITERATOR_NEXT( &tmp_for_loop_3__for_iterator );
+    if ( tmp_assign_source_48 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_1 = "oooooooooN";
+        exception_lineno = 133;
+        goto try_except_handler_32;
+    }
+    {
+        PyObject *old = tmp_for_loop_3__iter_value;
+        tmp_for_loop_3__iter_value = tmp_assign_source_48;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_15;
+    // Exception handler code:
+    try_except_handler_32:;
+    exception_keeper_type_29 = exception_type;
+    exception_keeper_value_29 = exception_value;
+    exception_keeper_tb_29 = exception_tb;
+    exception_keeper_lineno_29 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_18 = exception_keeper_type_29;
+    tmp_compare_right_18 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_10 = EXCEPTION_MATCH_BOOL( tmp_compare_left_18, tmp_compare_right_18 );
+    if ( tmp_exc_match_exception_match_10 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_29 );
+        Py_XDECREF( exception_keeper_value_29 );
+        Py_XDECREF( exception_keeper_tb_29 );
+
+        exception_lineno = 133;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_31;
+    }
+    if ( tmp_exc_match_exception_match_10 == 1 )
+    {
+        goto branch_yes_26;
+    }
+    else
+    {
+        goto branch_no_26;
+    }
+    branch_yes_26:;
+    Py_DECREF( exception_keeper_type_29 );
+    Py_XDECREF( exception_keeper_value_29 );
+    Py_XDECREF( exception_keeper_tb_29 );
+    goto loop_end_11;
+    goto branch_end_26;
+    branch_no_26:;
+    // Re-raise.
+    exception_type = exception_keeper_type_29;
+    exception_value = exception_keeper_value_29;
+    exception_tb = exception_keeper_tb_29;
+    exception_lineno = exception_keeper_lineno_29;
+
+    goto try_except_handler_31;
+    branch_end_26:;
+    // End of try:
+    try_end_15:;
+    tmp_assign_source_49 = tmp_for_loop_3__iter_value;
+
+    CHECK_OBJECT( tmp_assign_source_49 );
+    {
+        PyObject *old = var_x;
+        var_x = tmp_assign_source_49;
+        Py_INCREF( var_x );
+        Py_XDECREF( old );
+    }
+
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 133;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_31;
+    }
+    goto loop_start_11;
+    loop_end_11:;
+    goto try_end_16;
+    // Exception handler code:
+    try_except_handler_31:;
+    exception_keeper_type_30 = exception_type;
+    exception_keeper_value_30 = exception_value;
+    exception_keeper_tb_30 = exception_tb;
+    exception_keeper_lineno_30 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_for_loop_3__iter_value );
+    tmp_for_loop_3__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_3__for_iterator.iterator );
+    tmp_for_loop_3__for_iterator.iterator = NULL;
+    // Re-raise.
+    exception_type = exception_keeper_type_30;
+    exception_value = exception_keeper_value_30;
+    exception_tb = exception_keeper_tb_30;
+    exception_lineno = exception_keeper_lineno_30;
+
+    goto try_except_handler_30;
+    // End of try:
+    try_end_16:;
+    Py_XDECREF( tmp_for_loop_3__iter_value );
+    tmp_for_loop_3__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_3__for_iterator.iterator );
+    tmp_for_loop_3__for_iterator.iterator = NULL;
+    tmp_called_name_31 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_31 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 136;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_31, &PyTuple_GET_ITEM( const_tuple_str_digest_0a035ad313f4791687148b94278fefa3_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 136;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_30;
+    }
+    Py_DECREF( tmp_unused );
+    goto try_end_17;
+    // Exception handler code:
+    try_except_handler_30:;
+    exception_keeper_type_31 = exception_type;
+    exception_keeper_value_31 = exception_value;
+    exception_keeper_tb_31 = exception_tb;
+    exception_keeper_lineno_31 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_31;
+    exception_value = exception_keeper_value_31;
+    exception_tb = exception_keeper_tb_31;
+    exception_lineno = exception_keeper_lineno_31;
+
+    goto frame_exception_exit_1;
+    // End of try:
+    try_end_17:;
+    tmp_assign_source_50 = Py_False;
+    assert( tmp_for_loop_4__break_indicator == NULL );
+    Py_INCREF( tmp_assign_source_50 );
+    tmp_for_loop_4__break_indicator = tmp_assign_source_50;
+
+    tmp_result = MAKE_RANGE_ITERATOR( &tmp_for_loop_4__for_iterator, const_int_0, const_int_pos_7, const_int_pos_1, true );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 138;
+        type_description_1 = "oooooooooN";
+        goto frame_exception_exit_1;
+    }
+    // Tried code:
+    // Tried code:
+    loop_start_12:;
+    // Tried code:
+    tmp_assign_source_51 = RANGE_ITERATOR_NEXT( &tmp_for_loop_4__for_iterator );
+    if ( tmp_assign_source_51 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_1 = "oooooooooN";
+        exception_lineno = 138;
+        goto try_except_handler_35;
+    }
+    assert( tmp_for_loop_4__iter_value == NULL );
+    tmp_for_loop_4__iter_value = tmp_assign_source_51;
+
+    goto try_end_18;
+    // Exception handler code:
+    try_except_handler_35:;
+    exception_keeper_type_32 = exception_type;
+    exception_keeper_value_32 = exception_value;
+    exception_keeper_tb_32 = exception_tb;
+    exception_keeper_lineno_32 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_19 = exception_keeper_type_32;
+    tmp_compare_right_19 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_11 = EXCEPTION_MATCH_BOOL( tmp_compare_left_19, tmp_compare_right_19 );
+    if ( tmp_exc_match_exception_match_11 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_32 );
+        Py_XDECREF( exception_keeper_value_32 );
+        Py_XDECREF( exception_keeper_tb_32 );
+
+        exception_lineno = 138;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_34;
+    }
+    if ( tmp_exc_match_exception_match_11 == 1 )
+    {
+        goto branch_yes_27;
+    }
+    else
+    {
+        goto branch_no_27;
+    }
+    branch_yes_27:;
+    tmp_assign_source_52 = Py_True;
+    {
+        PyObject *old = tmp_for_loop_4__break_indicator;
+        assert( old != NULL );
+        tmp_for_loop_4__break_indicator = tmp_assign_source_52;
+        Py_INCREF( tmp_for_loop_4__break_indicator );
+        Py_DECREF( old );
+    }
+
+    Py_DECREF( exception_keeper_type_32 );
+    Py_XDECREF( exception_keeper_value_32 );
+    Py_XDECREF( exception_keeper_tb_32 );
+    goto loop_end_12;
+    goto branch_end_27;
+    branch_no_27:;
+    // Re-raise.
+    exception_type = exception_keeper_type_32;
+    exception_value = exception_keeper_value_32;
+    exception_tb = exception_keeper_tb_32;
+    exception_lineno = exception_keeper_lineno_32;
+
+    goto try_except_handler_34;
+    branch_end_27:;
+    // End of try:
+    try_end_18:;
+    tmp_assign_source_53 = tmp_for_loop_4__iter_value;
+
+    CHECK_OBJECT( tmp_assign_source_53 );
+    {
+        PyObject *old = var_x;
+        var_x = tmp_assign_source_53;
+        Py_INCREF( var_x );
+        Py_XDECREF( old );
+    }
+
+    goto loop_end_12;
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 138;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_34;
+    }
+    goto loop_start_12;
+    loop_end_12:;
+    goto try_end_19;
+    // Exception handler code:
+    try_except_handler_34:;
+    exception_keeper_type_33 = exception_type;
+    exception_keeper_value_33 = exception_value;
+    exception_keeper_tb_33 = exception_tb;
+    exception_keeper_lineno_33 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_for_loop_4__iter_value );
+    tmp_for_loop_4__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_4__for_iterator.iterator );
+    tmp_for_loop_4__for_iterator.iterator = NULL;
+    // Re-raise.
+    exception_type = exception_keeper_type_33;
+    exception_value = exception_keeper_value_33;
+    exception_tb = exception_keeper_tb_33;
+    exception_lineno = exception_keeper_lineno_33;
+
+    goto try_except_handler_33;
+    // End of try:
+    try_end_19:;
+    Py_XDECREF( tmp_for_loop_4__iter_value );
+    tmp_for_loop_4__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_4__for_iterator.iterator );
+    tmp_for_loop_4__for_iterator.iterator = NULL;
+    tmp_compare_left_20 = tmp_for_loop_4__break_indicator;
+
+    CHECK_OBJECT( tmp_compare_left_20 );
+    tmp_compare_right_20 = Py_True;
+    tmp_is_1 = ( tmp_compare_left_20 == tmp_compare_right_20 );
+    if ( tmp_is_1 )
+    {
+        goto branch_yes_28;
+    }
+    else
+    {
+        goto branch_no_28;
+    }
+    branch_yes_28:;
+    tmp_called_name_32 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_32 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 141;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_32, &PyTuple_GET_ITEM( const_tuple_str_digest_bf8b58b3a2e74fe51be4b0f231744143_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 141;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_33;
+    }
+    Py_DECREF( tmp_unused );
+    branch_no_28:;
+    goto try_end_20;
+    // Exception handler code:
+    try_except_handler_33:;
+    exception_keeper_type_34 = exception_type;
+    exception_keeper_value_34 = exception_value;
+    exception_keeper_tb_34 = exception_tb;
+    exception_keeper_lineno_34 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_for_loop_4__break_indicator );
+    tmp_for_loop_4__break_indicator = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_34;
+    exception_value = exception_keeper_value_34;
+    exception_tb = exception_keeper_tb_34;
+    exception_lineno = exception_keeper_lineno_34;
+
+    goto frame_exception_exit_1;
+    // End of try:
+    try_end_20:;
+    CHECK_OBJECT( (PyObject *)tmp_for_loop_4__break_indicator );
+    Py_DECREF( tmp_for_loop_4__break_indicator );
+    tmp_for_loop_4__break_indicator = NULL;
+
+    tmp_iter_arg_5 = const_xrange_0_5;
+    tmp_assign_source_54 = MAKE_ITERATOR( tmp_iter_arg_5 );
+    assert( tmp_assign_source_54 != NULL );
+    {
+        PyObject *old = var_x;
+        var_x = tmp_assign_source_54;
+        Py_XDECREF( old );
+    }
+
+    // Tried code:
+    loop_start_13:;
+    tmp_value_name_6 = var_x;
+
+    CHECK_OBJECT( tmp_value_name_6 );
+    tmp_cond_value_13 = ITERATOR_NEXT( tmp_value_name_6 );
+    if ( tmp_cond_value_13 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_1 = "oooooooooN";
+        exception_lineno = 145;
+        goto try_except_handler_36;
+    }
+    tmp_cond_truth_13 = CHECK_IF_TRUE( tmp_cond_value_13 );
+    if ( tmp_cond_truth_13 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        Py_DECREF( tmp_cond_value_13 );
+
+        exception_lineno = 145;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_36;
+    }
+    Py_DECREF( tmp_cond_value_13 );
+    if ( tmp_cond_truth_13 == 1 )
+    {
+        goto branch_no_29;
+    }
+    else
+    {
+        goto branch_yes_29;
+    }
+    branch_yes_29:;
+    goto loop_end_13;
+    branch_no_29:;
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 145;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_36;
+    }
+    goto loop_start_13;
+    loop_end_13:;
+    tmp_called_name_33 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_33 != NULL );
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = 148;
+    tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_33, &PyTuple_GET_ITEM( const_tuple_str_digest_458a092cc4447f5af6ed4602fc1aa978_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 148;
+        type_description_1 = "oooooooooN";
+        goto try_except_handler_36;
+    }
+    Py_DECREF( tmp_unused );
+    goto try_end_21;
+    // Exception handler code:
+    try_except_handler_36:;
+    exception_keeper_type_35 = exception_type;
+    exception_keeper_value_35 = exception_value;
+    exception_keeper_tb_35 = exception_tb;
+    exception_keeper_lineno_35 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_35;
+    exception_value = exception_keeper_value_35;
+    exception_tb = exception_keeper_tb_35;
+    exception_lineno = exception_keeper_lineno_35;
+
+    goto frame_exception_exit_1;
+    // End of try:
+    try_end_21:;
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_1d5d805b093e3794243f2bcdb5ece1e3 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_1d5d805b093e3794243f2bcdb5ece1e3 = depth_frame_1d5d805b093e3794243f2bcdb5ece1e3;
+
+    goto frame_no_exception_8;
+
+    frame_exception_exit_1:;
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_1d5d805b093e3794243f2bcdb5ece1e3 );
+#endif
+
+    if ( exception_tb == NULL )
+    {
+        exception_tb = MAKE_TRACEBACK( frame_1d5d805b093e3794243f2bcdb5ece1e3, exception_lineno );
+    }
+    else if ( exception_tb->tb_frame != &frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame )
+    {
+        exception_tb = ADD_TRACEBACK( exception_tb, frame_1d5d805b093e3794243f2bcdb5ece1e3, exception_lineno );
+    }
+
+#if 0
+    // The line is not updated while running, the traceback has it.
+    frame_1d5d805b093e3794243f2bcdb5ece1e3->m_frame.f_lineno = exception_lineno;
+#endif
+
+    // Attachs locals to frame if any.
+    Nuitka_Frame_AttachLocals(
+        (struct Nuitka_FrameObject *)frame_1d5d805b093e3794243f2bcdb5ece1e3,
+        type_description_1,
+        par_a,
+        var_c,
+        var_f,
+        var_b,
+        var_z,
+        var_m,
+        var_x,
+        var_y,
+        var_l,
+        NULL
+    );
+
+
+    // Release cached frame.
+    if ( frame_1d5d805b093e3794243f2bcdb5ece1e3 == FRAME_CACHE_SLOT( cache_frame_1d5d805b093e3794243f2bcdb5ece1e3, depth_frame_1d5d805b093e3794243f2bcdb5ece1e3 ) )
+    {
+        Py_DECREF( frame_1d5d805b093e3794243f2bcdb5ece1e3 );
+        FRAME_CACHE_SLOT( cache_frame_1d5d805b093e3794243f2bcdb5ece1e3, depth_frame_1d5d805b093e3794243f2bcdb5ece1e3 ) = NULL;
+    }
+
+    assertFrameObject( frame_1d5d805b093e3794243f2bcdb5ece1e3 );
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_1d5d805b093e3794243f2bcdb5ece1e3 = depth_frame_1d5d805b093e3794243f2bcdb5ece1e3;
+
+    // Return the error.
+    goto try_except_handler_1;
+
+    frame_no_exception_8:;
+
+    tmp_return_value = Py_None;
+    Py_INCREF( tmp_return_value );
+    goto try_return_handler_1;
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+    // Return handler code:
+    try_return_handler_1:;
+    Py_XDECREF( par_a );
+    par_a = NULL;
+
+    Py_XDECREF( var_c );
+    var_c = NULL;
+
+    Py_XDECREF( var_f );
+    var_f = NULL;
+
+    Py_XDECREF( var_b );
+    var_b = NULL;
+
+    Py_XDECREF( var_z );
+    var_z = NULL;
+
+    Py_XDECREF( var_m );
+    var_m = NULL;
+
+    Py_XDECREF( var_x );
+    var_x = NULL;
+
+    Py_XDECREF( var_y );
+    var_y = NULL;
+
+    Py_XDECREF( var_l );
+    var_l = NULL;
+
+    goto function_return_exit;
+    // Exception handler code:
+    try_except_handler_1:;
+    exception_keeper_type_36 = exception_type;
+    exception_keeper_value_36 = exception_value;
+    exception_keeper_tb_36 = exception_tb;
+    exception_keeper_lineno_36 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( par_a );
+    par_a = NULL;
+
+    Py_XDECREF( var_c );
+    var_c = NULL;
+
+    Py_XDECREF( var_f );
+    var_f = NULL;
+
+    Py_XDECREF( var_b );
+    var_b = NULL;
+
+    Py_XDECREF( var_z );
+    var_z = NULL;
+
+    Py_XDECREF( var_m );
+    var_m = NULL;
+
+    Py_XDECREF( var_x );
+    var_x = NULL;
+
+    Py_XDECREF( var_y );
+    var_y = NULL;
+
+    Py_XDECREF( var_l );
+    var_l = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_36;
+    exception_value = exception_keeper_value_36;
+    exception_tb = exception_keeper_tb_36;
+    exception_lineno = exception_keeper_lineno_36;
+
+    goto function_exception_exit;
+    // End of try:
+
+    // Return statement must have exited already.
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_2_loopingFunction );
+    return NULL;
+
+function_exception_exit:
+    assert( exception_type );
+    RESTORE_ERROR_OCCURRED( exception_type, exception_value, exception_tb );
+
+    return NULL;
+function_return_exit:
+
+CHECK_OBJECT( tmp_return_value );
+assert( had_error || !ERROR_OCCURRED() );
+return tmp_return_value;
+
+}
+
+
+static PyObject *impl___main__$$$function_3_rangeLoopFunction( struct Nuitka_FunctionObject const *self, PyObject **python_pars )
+{
+    // Preserve error status for checks
+#ifndef __NUITKA_NO_ASSERT__
+    NUITKA_MAY_BE_UNUSED bool had_error = ERROR_OCCURRED();
+#endif
+
+    // Local variable declarations.
+    PyObject *par_n = python_pars[ 0 ];
+    PyObject *var_result = NULL;
+    PyObject *var_x = NULL;
+    PyObject *var_y = NULL;
+    nuitka_range_iterator tmp_for_loop_1__for_iterator = { NULL, 0, 0, 0 };
+    PyObject *tmp_for_loop_1__iter_value = NULL;
+    nuitka_range_iterator tmp_for_loop_2__for_iterator = { NULL, 0, 0, 0 };
+    PyObject *tmp_for_loop_2__iter_value = NULL;
+    nuitka_range_iterator tmp_for_loop_3__for_iterator = { NULL, 0, 0, 0 };
+    PyObject *tmp_for_loop_3__iter_value = NULL;
+    PyObject *tmp_for_loop_4__break_indicator = NULL;
+    nuitka_range_iterator tmp_for_loop_4__for_iterator = { NULL, 0, 0, 0 };
+    PyObject *tmp_for_loop_4__iter_value = NULL;
+    nuitka_range_iterator tmp_for_loop_5__for_iterator = { NULL, 0, 0, 0 };
+    PyObject *tmp_for_loop_5__iter_value = NULL;
+    nuitka_range_iterator tmp_for_loop_6__for_iterator = { NULL, 0, 0, 0 };
+    PyObject *tmp_for_loop_6__iter_value = NULL;
+    PyObject *exception_type = NULL;
+    PyObject *exception_value = NULL;
+    PyTracebackObject *exception_tb = NULL;
+    NUITKA_MAY_BE_UNUSED int exception_lineno = 0;
+    PyObject *exception_keeper_type_1;
+    PyObject *exception_keeper_value_1;
+    PyTracebackObject *exception_keeper_tb_1;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_1;
+    PyObject *exception_keeper_type_2;
+    PyObject *exception_keeper_value_2;
+    PyTracebackObject *exception_keeper_tb_2;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_2;
+    PyObject *exception_keeper_type_3;
+    PyObject *exception_keeper_value_3;
+    PyTracebackObject *exception_keeper_tb_3;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_3;
+    PyObject *exception_keeper_type_4;
+    PyObject *exception_keeper_value_4;
+    PyTracebackObject *exception_keeper_tb_4;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_4;
+    PyObject *exception_keeper_type_5;
+    PyObject *exception_keeper_value_5;
+    PyTracebackObject *exception_keeper_tb_5;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_5;
+    PyObject *exception_keeper_type_6;
+    PyObject *exception_keeper_value_6;
+    PyTracebackObject *exception_keeper_tb_6;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_6;
+    PyObject *exception_keeper_type_7;
+    PyObject *exception_keeper_value_7;
+    PyTracebackObject *exception_keeper_tb_7;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_7;
+    PyObject *exception_keeper_type_8;
+    PyObject *exception_keeper_value_8;
+    PyTracebackObject *exception_keeper_tb_8;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_8;
+    PyObject *exception_keeper_type_9;
+    PyObject *exception_keeper_value_9;
+    PyTracebackObject *exception_keeper_tb_9;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_9;
+    PyObject *exception_keeper_type_10;
+    PyObject *exception_keeper_value_10;
+    PyTracebackObject *exception_keeper_tb_10;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_10;
+    PyObject *exception_keeper_type_11;
+    PyObject *exception_keeper_value_11;
+    PyTracebackObject *exception_keeper_tb_11;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_11;
+    PyObject *exception_keeper_type_12;
+    PyObject *exception_keeper_value_12;
+    PyTracebackObject *exception_keeper_tb_12;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_12;
+    PyObject *exception_keeper_type_13;
+    PyObject *exception_keeper_value_13;
+    PyTracebackObject *exception_keeper_tb_13;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_13;
+    PyObject *exception_keeper_type_14;
+    PyObject *exception_keeper_value_14;
+    PyTracebackObject *exception_keeper_tb_14;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_14;
+    PyObject *exception_keeper_type_15;
+    PyObject *exception_keeper_value_15;
+    PyTracebackObject *exception_keeper_tb_15;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_15;
+    PyObject *tmp_args_element_name_1;
+    PyObject *tmp_args_element_name_2;
+    PyObject *tmp_args_element_name_3;
+    PyObject *tmp_args_element_name_4;
+    PyObject *tmp_assign_source_1;
+    PyObject *tmp_assign_source_2;
+    PyObject *tmp_assign_source_3;
+    PyObject *tmp_assign_source_4;
+    PyObject *tmp_assign_source_5;
+    PyObject *tmp_assign_source_6;
+    PyObject *tmp_assign_source_7;
+    PyObject *tmp_assign_source_8;
+    PyObject *tmp_assign_source_9;
+    PyObject *tmp_assign_source_10;
+    PyObject *tmp_assign_source_11;
+    PyObject *tmp_assign_source_12;
+    PyObject *tmp_assign_source_13;
+    PyObject *tmp_assign_source_14;
+    PyObject *tmp_assign_source_15;
+    PyObject *tmp_assign_source_16;
+    PyObject *tmp_called_instance_1;
+    PyObject *tmp_called_instance_2;
+    PyObject *tmp_called_name_1;
+    PyObject *tmp_called_name_2;
+    PyObject *tmp_called_name_3;
+    PyObject *tmp_called_name_4;
+    int tmp_cmp_Eq_1;
+    PyObject *tmp_compare_left_1;
+    PyObject *tmp_compare_left_2;
+    PyObject *tmp_compare_left_3;
+    PyObject *tmp_compare_left_4;
+    PyObject *tmp_compare_left_5;
+    PyObject *tmp_compare_left_6;
+    PyObject *tmp_compare_left_7;
+    PyObject *tmp_compare_left_8;
+    PyObject *tmp_compare_right_1;
+    PyObject *tmp_compare_right_2;
+    PyObject *tmp_compare_right_3;
+    PyObject *tmp_compare_right_4;
+    PyObject *tmp_compare_right_5;
+    PyObject *tmp_compare_right_6;
+    PyObject *tmp_compare_right_7;
+    PyObject *tmp_compare_right_8;
+    int tmp_exc_match_exception_match_1;
+    int tmp_exc_match_exception_match_2;
+    int tmp_exc_match_exception_match_3;
+    int tmp_exc_match_exception_match_4;
+    int tmp_exc_match_exception_match_5;
+    int tmp_exc_match_exception_match_6;
+    PyObject *tmp_high_name_1;
+    PyObject *tmp_high_name_2;
+    bool tmp_is_1;
+    PyObject *tmp_left_name_1;
+    PyObject *tmp_low_name_1;
+    PyObject *tmp_low_name_2;
+    PyObject *tmp_low_name_3;
+    PyObject *tmp_low_name_4;
+    PyObject *tmp_low_name_5;
+    PyObject *tmp_low_name_6;
+    PyObject *tmp_operand_name_1;
+    PyObject *tmp_operand_name_2;
+    bool tmp_result;
+    PyObject *tmp_return_value;
+    PyObject *tmp_right_name_1;
+    PyObject *tmp_source_name_1;
+    PyObject *tmp_source_name_2;
+    PyObject *tmp_source_name_3;
+    PyObject *tmp_source_name_4;
+    PyObject *tmp_step_name_1;
+    PyObject *tmp_step_name_2;
+    PyObject *tmp_tuple_element_1;
+    PyObject *tmp_tuple_element_2;
+    NUITKA_MAY_BE_UNUSED PyObject *tmp_unused;
+    static struct Nuitka_FrameObject *cache_frame_046134e88eb0512b9883d61b8612c687[ _NUITKA_FRAME_CACHE_DEPTH ];
+static int cache_depth_frame_046134e88eb0512b9883d61b8612c687 = 0;
+int depth_frame_046134e88eb0512b9883d61b8612c687;
+
+    struct Nuitka_FrameObject *frame_046134e88eb0512b9883d61b8612c687;
+
+    NUITKA_MAY_BE_UNUSED char const *type_description_1 = NULL;
+    tmp_return_value = NULL;
+
+    // Actual function code.
+    tmp_assign_source_1 = PyList_New( 0 );
+    assert( var_result == NULL );
+    var_result = tmp_assign_source_1;
+
+    tmp_assign_source_2 = Py_None;
+    assert( var_x == NULL );
+    Py_INCREF( tmp_assign_source_2 );
+    var_x = tmp_assign_source_2;
+
+    // Tried code:
+    depth_frame_046134e88eb0512b9883d61b8612c687 = cache_depth_frame_046134e88eb0512b9883d61b8612c687++;
+    MAKE_OR_REUSE_FRAME( FRAME_CACHE_SLOT( cache_frame_046134e88eb0512b9883d61b8612c687, depth_frame_046134e88eb0512b9883d61b8612c687 ), codeobj_046134e88eb0512b9883d61b8612c687, module___main__, sizeof(void *)+sizeof(void *)+sizeof(void *)+sizeof(void *) );
+    frame_046134e88eb0512b9883d61b8612c687 = FRAME_CACHE_SLOT( cache_frame_046134e88eb0512b9883d61b8612c687, depth_frame_046134e88eb0512b9883d61b8612c687 );
+
+    // Push the new frame as the currently active one.
+    pushFrameStack( frame_046134e88eb0512b9883d61b8612c687 );
+
+    // Mark the frame object as in use, ref count 1 will be up for reuse.
+    assert( Py_REFCNT( frame_046134e88eb0512b9883d61b8612c687 ) == 2 ); // Frame stack
+
+    // Framed code:
+    tmp_low_name_1 = par_n;
+
+    CHECK_OBJECT( tmp_low_name_1 );
+    tmp_result = MAKE_RANGE_ITERATOR( &tmp_for_loop_1__for_iterator, NULL, tmp_low_name_1, NULL, true );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 157;
+        type_description_1 = "oooo";
+        goto frame_exception_exit_1;
+    }
+    // Tried code:
+    loop_start_1:;
+    // Tried code:
+    tmp_assign_source_3 = RANGE_ITERATOR_NEXT( &tmp_for_loop_1__for_iterator );
+    if ( tmp_assign_source_3 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_1 = "oooo";
+        exception_lineno = 157;
+        goto try_except_handler_3;
+    }
+    {
+        PyObject *old = tmp_for_loop_1__iter_value;
+        tmp_for_loop_1__iter_value = tmp_assign_source_3;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_1;
+    // Exception handler code:
+    try_except_handler_3:;
+    exception_keeper_type_1 = exception_type;
+    exception_keeper_value_1 = exception_value;
+    exception_keeper_tb_1 = exception_tb;
+    exception_keeper_lineno_1 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_1 = exception_keeper_type_1;
+    tmp_compare_right_1 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_1 = EXCEPTION_MATCH_BOOL( tmp_compare_left_1, tmp_compare_right_1 );
+    if ( tmp_exc_match_exception_match_1 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_1 );
+        Py_XDECREF( exception_keeper_value_1 );
+        Py_XDECREF( exception_keeper_tb_1 );
+
+        exception_lineno = 157;
+        type_description_1 = "oooo";
+        goto try_except_handler_2;
+    }
+    if ( tmp_exc_match_exception_match_1 == 1 )
+    {
+        goto branch_yes_1;
+    }
+    else
+    {
+        goto branch_no_1;
+    }
+    branch_yes_1:;
+    Py_DECREF( exception_keeper_type_1 );
+    Py_XDECREF( exception_keeper_value_1 );
+    Py_XDECREF( exception_keeper_tb_1 );
+    goto loop_end_1;
+    goto branch_end_1;
+    branch_no_1:;
+    // Re-raise.
+    exception_type = exception_keeper_type_1;
+    exception_value = exception_keeper_value_1;
+    exception_tb = exception_keeper_tb_1;
+    exception_lineno = exception_keeper_lineno_1;
+
+    goto try_except_handler_2;
+    branch_end_1:;
+    // End of try:
+    try_end_1:;
+    tmp_assign_source_4 = tmp_for_loop_1__iter_value;
+
+    CHECK_OBJECT( tmp_assign_source_4 );
+    {
+        PyObject *old = var_x;
+        var_x = tmp_assign_source_4;
+        Py_INCREF( var_x );
+        Py_XDECREF( old );
+    }
+
+    tmp_source_name_1 = var_result;
+
+    if ( tmp_source_name_1 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "result" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 158;
+        type_description_1 = "oooo";
+        goto try_except_handler_2;
+    }
+
+    tmp_called_name_1 = LOOKUP_ATTRIBUTE_CACHED( tmp_source_name_1, const_str_plain_append, &attribute_cache_15 );
+    if ( tmp_called_name_1 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 158;
+        type_description_1 = "oooo";
+        goto try_except_handler_2;
+    }
+    tmp_args_element_name_1 = var_x;
+
+    if ( tmp_args_element_name_1 == NULL )
+    {
+        Py_DECREF( tmp_called_name_1 );
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "x" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 158;
+        type_description_1 = "oooo";
+        goto try_except_handler_2;
+    }
+
+    frame_046134e88eb0512b9883d61b8612c687->m_frame.f_lineno = 158;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_1 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_1, call_args );
+    }
+
+    Py_DECREF( tmp_called_name_1 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 158;
+        type_description_1 = "oooo";
+        goto try_except_handler_2;
+    }
+    Py_DECREF( tmp_unused );
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 157;
+        type_description_1 = "oooo";
+        goto try_except_handler_2;
+    }
+    goto loop_start_1;
+    loop_end_1:;
+    goto try_end_2;
+    // Exception handler code:
+    try_except_handler_2:;
+    exception_keeper_type_2 = exception_type;
+    exception_keeper_value_2 = exception_value;
+    exception_keeper_tb_2 = exception_tb;
+    exception_keeper_lineno_2 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_for_loop_1__iter_value );
+    tmp_for_loop_1__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_1__for_iterator.iterator );
+    tmp_for_loop_1__for_iterator.iterator = NULL;
+    // Re-raise.
+    exception_type = exception_keeper_type_2;
+    exception_value = exception_keeper_value_2;
+    exception_tb = exception_keeper_tb_2;
+    exception_lineno = exception_keeper_lineno_2;
+
+    goto frame_exception_exit_1;
+    // End of try:
+    try_end_2:;
+    Py_XDECREF( tmp_for_loop_1__iter_value );
+    tmp_for_loop_1__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_1__for_iterator.iterator );
+    tmp_for_loop_1__for_iterator.iterator = NULL;
+    tmp_operand_name_1 = par_n;
+
+    if ( tmp_operand_name_1 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "n" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 160;
+        type_description_1 = "oooo";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_low_name_2 = UNARY_OPERATION( PyNumber_Negative, tmp_operand_name_1 );
+    if ( tmp_low_name_2 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 160;
+        type_description_1 = "oooo";
+        goto frame_exception_exit_1;
+    }
+    tmp_left_name_1 = const_int_pos_2;
+    tmp_right_name_1 = par_n;
+
+    if ( tmp_right_name_1 == NULL )
+    {
+        Py_DECREF( tmp_low_name_2 );
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "n" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 160;
+        type_description_1 = "oooo";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_high_name_1 = BINARY_OPERATION_MUL( tmp_left_name_1, tmp_right_name_1 );
+    if ( tmp_high_name_1 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        Py_DECREF( tmp_low_name_2 );
+
+        exception_lineno = 160;
+        type_description_1 = "oooo";
+        goto frame_exception_exit_1;
+    }
+    tmp_step_name_1 = const_int_pos_3;
+    tmp_result = MAKE_RANGE_ITERATOR( &tmp_for_loop_2__for_iterator, tmp_low_name_2, tmp_high_name_1, tmp_step_name_1, true );
+    Py_DECREF( tmp_low_name_2 );
+    Py_DECREF( tmp_high_name_1 );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 160;
+        type_description_1 = "oooo";
+        goto frame_exception_exit_1;
+    }
+    // Tried code:
+    loop_start_2:;
+    // Tried code:
+    tmp_assign_source_5 = RANGE_ITERATOR_NEXT( &tmp_for_loop_2__for_iterator );
+    if ( tmp_assign_source_5 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_1 = "oooo";
+        exception_lineno = 160;
+        goto try_except_handler_5;
+    }
+    {
+        PyObject *old = tmp_for_loop_2__iter_value;
+        tmp_for_loop_2__iter_value = tmp_assign_source_5;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_3;
+    // Exception handler code:
+    try_except_handler_5:;
+    exception_keeper_type_3 = exception_type;
+    exception_keeper_value_3 = exception_value;
+    exception_keeper_tb_3 = exception_tb;
+    exception_keeper_lineno_3 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_2 = exception_keeper_type_3;
+    tmp_compare_right_2 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_2 = EXCEPTION_MATCH_BOOL( tmp_compare_left_2, tmp_compare_right_2 );
+    if ( tmp_exc_match_exception_match_2 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_3 );
+        Py_XDECREF( exception_keeper_value_3 );
+        Py_XDECREF( exception_keeper_tb_3 );
+
+        exception_lineno = 160;
+        type_description_1 = "oooo";
+        goto try_except_handler_4;
+    }
+    if ( tmp_exc_match_exception_match_2 == 1 )
+    {
+        goto branch_yes_2;
+    }
+    else
+    {
+        goto branch_no_2;
+    }
+    branch_yes_2:;
+    Py_DECREF( exception_keeper_type_3 );
+    Py_XDECREF( exception_keeper_value_3 );
+    Py_XDECREF( exception_keeper_tb_3 );
+    goto loop_end_2;
+    goto branch_end_2;
+    branch_no_2:;
+    // Re-raise.
+    exception_type = exception_keeper_type_3;
+    exception_value = exception_keeper_value_3;
+    exception_tb = exception_keeper_tb_3;
+    exception_lineno = exception_keeper_lineno_3;
+
+    goto try_except_handler_4;
+    branch_end_2:;
+    // End of try:
+    try_end_3:;
+    tmp_assign_source_6 = tmp_for_loop_2__iter_value;
+
+    CHECK_OBJECT( tmp_assign_source_6 );
+    {
+        PyObject *old = var_x;
+        var_x = tmp_assign_source_6;
+        Py_INCREF( var_x );
+        Py_XDECREF( old );
+    }
+
+    tmp_source_name_2 = var_result;
+
+    if ( tmp_source_name_2 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "result" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 161;
+        type_description_1 = "oooo";
+        goto try_except_handler_4;
+    }
+
+    tmp_called_name_2 = LOOKUP_ATTRIBUTE_CACHED( tmp_source_name_2, const_str_plain_append, &attribute_cache_16 );
+    if ( tmp_called_name_2 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 161;
+        type_description_1 = "oooo";
+        goto try_except_handler_4;
+    }
+    tmp_args_element_name_2 = var_x;
+
+    if ( tmp_args_element_name_2 == NULL )
+    {
+        Py_DECREF( tmp_called_name_2 );
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "x" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 161;
+        type_description_1 = "oooo";
+        goto try_except_handler_4;
+    }
+
+    frame_046134e88eb0512b9883d61b8612c687->m_frame.f_lineno = 161;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_2 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_2, call_args );
+    }
+
+    Py_DECREF( tmp_called_name_2 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 161;
+        type_description_1 = "oooo";
+        goto try_except_handler_4;
+    }
+    Py_DECREF( tmp_unused );
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 160;
+        type_description_1 = "oooo";
+        goto try_except_handler_4;
+    }
+    goto loop_start_2;
+    loop_end_2:;
+    goto try_end_4;
+    // Exception handler code:
+    try_except_handler_4:;
+    exception_keeper_type_4 = exception_type;
+    exception_keeper_value_4 = exception_value;
+    exception_keeper_tb_4 = exception_tb;
+    exception_keeper_lineno_4 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_for_loop_2__iter_value );
+    tmp_for_loop_2__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_2__for_iterator.iterator );
+    tmp_for_loop_2__for_iterator.iterator = NULL;
+    // Re-raise.
+    exception_type = exception_keeper_type_4;
+    exception_value = exception_keeper_value_4;
+    exception_tb = exception_keeper_tb_4;
+    exception_lineno = exception_keeper_lineno_4;
+
+    goto frame_exception_exit_1;
+    // End of try:
+    try_end_4:;
+    Py_XDECREF( tmp_for_loop_2__iter_value );
+    tmp_for_loop_2__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_2__for_iterator.iterator );
+    tmp_for_loop_2__for_iterator.iterator = NULL;
+    // Tried code:
+    tmp_low_name_3 = par_n;
+
+    if ( tmp_low_name_3 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "n" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 163;
+        type_description_1 = "oooo";
+        goto try_except_handler_6;
+    }
+
+    tmp_operand_name_2 = par_n;
+
+    if ( tmp_operand_name_2 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "n" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 163;
+        type_description_1 = "oooo";
+        goto try_except_handler_6;
+    }
+
+    tmp_high_name_2 = UNARY_OPERATION( PyNumber_Negative, tmp_operand_name_2 );
+    if ( tmp_high_name_2 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 163;
+        type_description_1 = "oooo";
+        goto try_except_handler_6;
+    }
+    tmp_step_name_2 = const_int_neg_2;
+    tmp_result = MAKE_RANGE_ITERATOR( &tmp_for_loop_3__for_iterator, tmp_low_name_3, tmp_high_name_2, tmp_step_name_2, true );
+    Py_DECREF( tmp_high_name_2 );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 163;
+        type_description_1 = "oooo";
+        goto try_except_handler_6;
+    }
+    // Tried code:
+    loop_start_3:;
+    // Tried code:
+    tmp_assign_source_7 = RANGE_ITERATOR_NEXT( &tmp_for_loop_3__for_iterator );
+    if ( tmp_assign_source_7 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_1 = "oooo";
+        exception_lineno = 163;
+        goto try_except_handler_8;
+    }
+    {
+        PyObject *old = tmp_for_loop_3__iter_value;
+        tmp_for_loop_3__iter_value = tmp_assign_source_7;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_5;
+    // Exception handler code:
+    try_except_handler_8:;
+    exception_keeper_type_5 = exception_type;
+    exception_keeper_value_5 = exception_value;
+    exception_keeper_tb_5 = exception_tb;
+    exception_keeper_lineno_5 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_3 = exception_keeper_type_5;
+    tmp_compare_right_3 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_3 = EXCEPTION_MATCH_BOOL( tmp_compare_left_3, tmp_compare_right_3 );
+    if ( tmp_exc_match_exception_match_3 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_5 );
+        Py_XDECREF( exception_keeper_value_5 );
+        Py_XDECREF( exception_keeper_tb_5 );
+
+        exception_lineno = 163;
+        type_description_1 = "oooo";
+        goto try_except_handler_7;
+    }
+    if ( tmp_exc_match_exception_match_3 == 1 )
+    {
+        goto branch_yes_3;
+    }
+    else
+    {
+        goto branch_no_3;
+    }
+    branch_yes_3:;
+    Py_DECREF( exception_keeper_type_5 );
+    Py_XDECREF( exception_keeper_value_5 );
+    Py_XDECREF( exception_keeper_tb_5 );
+    goto loop_end_3;
+    goto branch_end_3;
+    branch_no_3:;
+    // Re-raise.
+    exception_type = exception_keeper_type_5;
+    exception_value = exception_keeper_value_5;
+    exception_tb = exception_keeper_tb_5;
+    exception_lineno = exception_keeper_lineno_5;
+
+    goto try_except_handler_7;
+    branch_end_3:;
+    // End of try:
+    try_end_5:;
+    tmp_assign_source_8 = tmp_for_loop_3__iter_value;
+
+    CHECK_OBJECT( tmp_assign_source_8 );
+    {
+        PyObject *old = var_x;
+        var_x = tmp_assign_source_8;
+        Py_INCREF( var_x );
+        Py_XDECREF( old );
+    }
+
+    tmp_source_name_3 = var_result;
+
+    if ( tmp_source_name_3 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "result" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 164;
+        type_description_1 = "oooo";
+        goto try_except_handler_7;
+    }
+
+    tmp_called_name_3 = LOOKUP_ATTRIBUTE_CACHED( tmp_source_name_3, const_str_plain_append, &attribute_cache_17 );
+    if ( tmp_called_name_3 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 164;
+        type_description_1 = "oooo";
+        goto try_except_handler_7;
+    }
+    tmp_args_element_name_3 = var_x;
+
+    if ( tmp_args_element_name_3 == NULL )
+    {
+        Py_DECREF( tmp_called_name_3 );
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "x" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 164;
+        type_description_1 = "oooo";
+        goto try_except_handler_7;
+    }
+
+    frame_046134e88eb0512b9883d61b8612c687->m_frame.f_lineno = 164;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_3 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_3, call_args );
+    }
+
+    Py_DECREF( tmp_called_name_3 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 164;
+        type_description_1 = "oooo";
+        goto try_except_handler_7;
+    }
+    Py_DECREF( tmp_unused );
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 163;
+        type_description_1 = "oooo";
+        goto try_except_handler_7;
+    }
+    goto loop_start_3;
+    loop_end_3:;
+    goto try_end_6;
+    // Exception handler code:
+    try_except_handler_7:;
+    exception_keeper_type_6 = exception_type;
+    exception_keeper_value_6 = exception_value;
+    exception_keeper_tb_6 = exception_tb;
+    exception_keeper_lineno_6 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_for_loop_3__iter_value );
+    tmp_for_loop_3__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_3__for_iterator.iterator );
+    tmp_for_loop_3__for_iterator.iterator = NULL;
+    // Re-raise.
+    exception_type = exception_keeper_type_6;
+    exception_value = exception_keeper_value_6;
+    exception_tb = exception_keeper_tb_6;
+    exception_lineno = exception_keeper_lineno_6;
+
+    goto try_except_handler_6;
+    // End of try:
+    try_end_6:;
+    Py_XDECREF( tmp_for_loop_3__iter_value );
+    tmp_for_loop_3__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_3__for_iterator.iterator );
+    tmp_for_loop_3__for_iterator.iterator = NULL;
+    tmp_called_instance_1 = var_result;
+
+    if ( tmp_called_instance_1 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "result" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 166;
+        type_description_1 = "oooo";
+        goto try_except_handler_6;
+    }
+
+    frame_046134e88eb0512b9883d61b8612c687->m_frame.f_lineno = 166;
+    tmp_unused = CALL_METHOD_WITH_ARGS1( tmp_called_instance_1, const_str_plain_append, &PyTuple_GET_ITEM( const_tuple_str_plain_else_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 166;
+        type_description_1 = "oooo";
+        goto try_except_handler_6;
+    }
+    Py_DECREF( tmp_unused );
+    goto try_end_7;
+    // Exception handler code:
+    try_except_handler_6:;
+    exception_keeper_type_7 = exception_type;
+    exception_keeper_value_7 = exception_value;
+    exception_keeper_tb_7 = exception_tb;
+    exception_keeper_lineno_7 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_7;
+    exception_value = exception_keeper_value_7;
+    exception_tb = exception_keeper_tb_7;
+    exception_lineno = exception_keeper_lineno_7;
+
+    goto frame_exception_exit_1;
+    // End of try:
+    try_end_7:;
+    tmp_assign_source_9 = Py_False;
+    assert( tmp_for_loop_4__break_indicator == NULL );
+    Py_INCREF( tmp_assign_source_9 );
+    tmp_for_loop_4__break_indicator = tmp_assign_source_9;
+
+    // Tried code:
+    tmp_low_name_4 = par_n;
+
+    if ( tmp_low_name_4 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "n" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 168;
+        type_description_1 = "oooo";
+        goto try_except_handler_9;
+    }
+
+    tmp_result = MAKE_RANGE_ITERATOR( &tmp_for_loop_4__for_iterator, NULL, tmp_low_name_4, NULL, true );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 168;
+        type_description_1 = "oooo";
+        goto try_except_handler_9;
+    }
+    // Tried code:
+    loop_start_4:;
+    // Tried code:
+    tmp_assign_source_10 = RANGE_ITERATOR_NEXT( &tmp_for_loop_4__for_iterator );
+    if ( tmp_assign_source_10 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_1 = "oooo";
+        exception_lineno = 168;
+        goto try_except_handler_11;
+    }
+    {
+        PyObject *old = tmp_for_loop_4__iter_value;
+        tmp_for_loop_4__iter_value = tmp_assign_source_10;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_8;
+    // Exception handler code:
+    try_except_handler_11:;
+    exception_keeper_type_8 = exception_type;
+    exception_keeper_value_8 = exception_value;
+    exception_keeper_tb_8 = exception_tb;
+    exception_keeper_lineno_8 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_4 = exception_keeper_type_8;
+    tmp_compare_right_4 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_4 = EXCEPTION_MATCH_BOOL( tmp_compare_left_4, tmp_compare_right_4 );
+    if ( tmp_exc_match_exception_match_4 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_8 );
+        Py_XDECREF( exception_keeper_value_8 );
+        Py_XDECREF( exception_keeper_tb_8 );
+
+        exception_lineno = 168;
+        type_description_1 = "oooo";
+        goto try_except_handler_10;
+    }
+    if ( tmp_exc_match_exception_match_4 == 1 )
+    {
+        goto branch_yes_4;
+    }
+    else
+    {
+        goto branch_no_4;
+    }
+    branch_yes_4:;
+    tmp_assign_source_11 = Py_True;
+    {
+        PyObject *old = tmp_for_loop_4__break_indicator;
+        assert( old != NULL );
+        tmp_for_loop_4__break_indicator = tmp_assign_source_11;
+        Py_INCREF( tmp_for_loop_4__break_indicator );
+        Py_DECREF( old );
+    }
+
+    Py_DECREF( exception_keeper_type_8 );
+    Py_XDECREF( exception_keeper_value_8 );
+    Py_XDECREF( exception_keeper_tb_8 );
+    goto loop_end_4;
+    goto branch_end_4;
+    branch_no_4:;
+    // Re-raise.
+    exception_type = exception_keeper_type_8;
+    exception_value = exception_keeper_value_8;
+    exception_tb = exception_keeper_tb_8;
+    exception_lineno = exception_keeper_lineno_8;
+
+    goto try_except_handler_10;
+    branch_end_4:;
+    // End of try:
+    try_end_8:;
+    tmp_assign_source_12 = tmp_for_loop_4__iter_value;
+
+    CHECK_OBJECT( tmp_assign_source_12 );
+    {
+        PyObject *old = var_x;
+        var_x = tmp_assign_source_12;
+        Py_INCREF( var_x );
+        Py_XDECREF( old );
+    }
+
+    tmp_compare_left_5 = var_x;
+
+    CHECK_OBJECT( tmp_compare_left_5 );
+    tmp_compare_right_5 = const_int_pos_2;
+    tmp_cmp_Eq_1 = RICH_COMPARE_BOOL_EQ( tmp_compare_left_5, tmp_compare_right_5 );
+    if ( tmp_cmp_Eq_1 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 169;
+        type_description_1 = "oooo";
+        goto try_except_handler_10;
+    }
+    if ( tmp_cmp_Eq_1 == 1 )
+    {
+        goto branch_yes_5;
+    }
+    else
+    {
+        goto branch_no_5;
+    }
+    branch_yes_5:;
+    goto loop_end_4;
+    branch_no_5:;
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 168;
+        type_description_1 = "oooo";
+        goto try_except_handler_10;
+    }
+    goto loop_start_4;
+    loop_end_4:;
+    goto try_end_9;
+    // Exception handler code:
+    try_except_handler_10:;
+    exception_keeper_type_9 = exception_type;
+    exception_keeper_value_9 = exception_value;
+    exception_keeper_tb_9 = exception_tb;
+    exception_keeper_lineno_9 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_for_loop_4__iter_value );
+    tmp_for_loop_4__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_4__for_iterator.iterator );
+    tmp_for_loop_4__for_iterator.iterator = NULL;
+    // Re-raise.
+    exception_type = exception_keeper_type_9;
+    exception_value = exception_keeper_value_9;
+    exception_tb = exception_keeper_tb_9;
+    exception_lineno = exception_keeper_lineno_9;
+
+    goto try_except_handler_9;
+    // End of try:
+    try_end_9:;
+    Py_XDECREF( tmp_for_loop_4__iter_value );
+    tmp_for_loop_4__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_4__for_iterator.iterator );
+    tmp_for_loop_4__for_iterator.iterator = NULL;
+    tmp_compare_left_6 = tmp_for_loop_4__break_indicator;
+
+    CHECK_OBJECT( tmp_compare_left_6 );
+    tmp_compare_right_6 = Py_True;
+    tmp_is_1 = ( tmp_compare_left_6 == tmp_compare_right_6 );
+    if ( tmp_is_1 )
+    {
+        goto branch_yes_6;
+    }
+    else
+    {
+        goto branch_no_6;
+    }
+    branch_yes_6:;
+    tmp_called_instance_2 = var_result;
+
+    if ( tmp_called_instance_2 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "result" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 172;
+        type_description_1 = "oooo";
+        goto try_except_handler_9;
+    }
+
+    frame_046134e88eb0512b9883d61b8612c687->m_frame.f_lineno = 172;
+    tmp_unused = CALL_METHOD_WITH_ARGS1( tmp_called_instance_2, const_str_plain_append, &PyTuple_GET_ITEM( const_tuple_str_digest_56d22133bded4bbb34438c584317dc82_tuple, 0 ) );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 172;
+        type_description_1 = "oooo";
+        goto try_except_handler_9;
+    }
+    Py_DECREF( tmp_unused );
+    branch_no_6:;
+    goto try_end_10;
+    // Exception handler code:
+    try_except_handler_9:;
+    exception_keeper_type_10 = exception_type;
+    exception_keeper_value_10 = exception_value;
+    exception_keeper_tb_10 = exception_tb;
+    exception_keeper_lineno_10 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_for_loop_4__break_indicator );
+    tmp_for_loop_4__break_indicator = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_10;
+    exception_value = exception_keeper_value_10;
+    exception_tb = exception_keeper_tb_10;
+    exception_lineno = exception_keeper_lineno_10;
+
+    goto frame_exception_exit_1;
+    // End of try:
+    try_end_10:;
+    CHECK_OBJECT( (PyObject *)tmp_for_loop_4__break_indicator );
+    Py_DECREF( tmp_for_loop_4__break_indicator );
+    tmp_for_loop_4__break_indicator = NULL;
+
+    tmp_low_name_5 = par_n;
+
+    if ( tmp_low_name_5 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "n" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 174;
+        type_description_1 = "oooo";
+        goto frame_exception_exit_1;
+    }
+
+    tmp_result = MAKE_RANGE_ITERATOR( &tmp_for_loop_5__for_iterator, NULL, tmp_low_name_5, NULL, true );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 174;
+        type_description_1 = "oooo";
+        goto frame_exception_exit_1;
+    }
+    // Tried code:
+    loop_start_5:;
+    // Tried code:
+    tmp_assign_source_13 = RANGE_ITERATOR_NEXT( &tmp_for_loop_5__for_iterator );
+    if ( tmp_assign_source_13 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_1 = "oooo";
+        exception_lineno = 174;
+        goto try_except_handler_13;
+    }
+    {
+        PyObject *old = tmp_for_loop_5__iter_value;
+        tmp_for_loop_5__iter_value = tmp_assign_source_13;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_11;
+    // Exception handler code:
+    try_except_handler_13:;
+    exception_keeper_type_11 = exception_type;
+    exception_keeper_value_11 = exception_value;
+    exception_keeper_tb_11 = exception_tb;
+    exception_keeper_lineno_11 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_7 = exception_keeper_type_11;
+    tmp_compare_right_7 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_5 = EXCEPTION_MATCH_BOOL( tmp_compare_left_7, tmp_compare_right_7 );
+    if ( tmp_exc_match_exception_match_5 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_11 );
+        Py_XDECREF( exception_keeper_value_11 );
+        Py_XDECREF( exception_keeper_tb_11 );
+
+        exception_lineno = 174;
+        type_description_1 = "oooo";
+        goto try_except_handler_12;
+    }
+    if ( tmp_exc_match_exception_match_5 == 1 )
+    {
+        goto branch_yes_7;
+    }
+    else
+    {
+        goto branch_no_7;
+    }
+    branch_yes_7:;
+    Py_DECREF( exception_keeper_type_11 );
+    Py_XDECREF( exception_keeper_value_11 );
+    Py_XDECREF( exception_keeper_tb_11 );
+    goto loop_end_5;
+    goto branch_end_7;
+    branch_no_7:;
+    // Re-raise.
+    exception_type = exception_keeper_type_11;
+    exception_value = exception_keeper_value_11;
+    exception_tb = exception_keeper_tb_11;
+    exception_lineno = exception_keeper_lineno_11;
+
+    goto try_except_handler_12;
+    branch_end_7:;
+    // End of try:
+    try_end_11:;
+    tmp_assign_source_14 = tmp_for_loop_5__iter_value;
+
+    CHECK_OBJECT( tmp_assign_source_14 );
+    {
+        PyObject *old = var_x;
+        var_x = tmp_assign_source_14;
+        Py_INCREF( var_x );
+        Py_XDECREF( old );
+    }
+
+    tmp_low_name_6 = var_x;
+
+    CHECK_OBJECT( tmp_low_name_6 );
+    Py_XDECREF( tmp_for_loop_6__for_iterator.iterator );
+    tmp_for_loop_6__for_iterator.iterator = NULL;
+    tmp_result = MAKE_RANGE_ITERATOR( &tmp_for_loop_6__for_iterator, NULL, tmp_low_name_6, NULL, true );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 175;
+        type_description_1 = "oooo";
+        goto try_except_handler_12;
+    }
+    // Tried code:
+    loop_start_6:;
+    // Tried code:
+    tmp_assign_source_15 = RANGE_ITERATOR_NEXT( &tmp_for_loop_6__for_iterator );
+    if ( tmp_assign_source_15 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+        type_description_1 = "oooo";
+        exception_lineno = 175;
+        goto try_except_handler_15;
+    }
+    {
+        PyObject *old = tmp_for_loop_6__iter_value;
+        tmp_for_loop_6__iter_value = tmp_assign_source_15;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_12;
+    // Exception handler code:
+    try_except_handler_15:;
+    exception_keeper_type_12 = exception_type;
+    exception_keeper_value_12 = exception_value;
+    exception_keeper_tb_12 = exception_tb;
+    exception_keeper_lineno_12 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_8 = exception_keeper_type_12;
+    tmp_compare_right_8 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_6 = EXCEPTION_MATCH_BOOL( tmp_compare_left_8, tmp_compare_right_8 );
+    if ( tmp_exc_match_exception_match_6 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_12 );
+        Py_XDECREF( exception_keeper_value_12 );
+        Py_XDECREF( exception_keeper_tb_12 );
+
+        exception_lineno = 175;
+        type_description_1 = "oooo";
+        goto try_except_handler_14;
+    }
+    if ( tmp_exc_match_exception_match_6 == 1 )
+    {
+        goto branch_yes_8;
+    }
+    else
+    {
+        goto branch_no_8;
+    }
+    branch_yes_8:;
+    Py_DECREF( exception_keeper_type_12 );
+    Py_XDECREF( exception_keeper_value_12 );
+    Py_XDECREF( exception_keeper_tb_12 );
+    goto loop_end_6;
+    goto branch_end_8;
+    branch_no_8:;
+    // Re-raise.
+    exception_type = exception_keeper_type_12;
+    exception_value = exception_keeper_value_12;
+    exception_tb = exception_keeper_tb_12;
+    exception_lineno = exception_keeper_lineno_12;
+
+    goto try_except_handler_14;
+    branch_end_8:;
+    // End of try:
+    try_end_12:;
+    tmp_assign_source_16 = tmp_for_loop_6__iter_value;
+
+    CHECK_OBJECT( tmp_assign_source_16 );
+    {
+        PyObject *old = var_y;
+        var_y = tmp_assign_source_16;
+        Py_INCREF( var_y );
+        Py_XDECREF( old );
+    }
+
+    tmp_source_name_4 = var_result;
+
+    if ( tmp_source_name_4 == NULL )
+    {
+
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "result" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 176;
+        type_description_1 = "oooo";
+        goto try_except_handler_14;
+    }
+
+    tmp_called_name_4 = LOOKUP_ATTRIBUTE_CACHED( tmp_source_name_4, const_str_plain_append, &attribute_cache_18 );
+    if ( tmp_called_name_4 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 176;
+        type_description_1 = "oooo";
+        goto try_except_handler_14;
+    }
+    tmp_args_element_name_4 = PyTuple_New( 2 );
+    tmp_tuple_element_1 = var_x;
+
+    if ( tmp_tuple_element_1 == NULL )
+    {
+        Py_DECREF( tmp_called_name_4 );
+        Py_DECREF( tmp_args_element_name_4 );
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "x" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 176;
+        type_description_1 = "oooo";
+        goto try_except_handler_14;
+    }
+
+    Py_INCREF( tmp_tuple_element_1 );
+    PyTuple_SET_ITEM( tmp_args_element_name_4, 0, tmp_tuple_element_1 );
+    tmp_tuple_element_1 = var_y;
+
+    if ( tmp_tuple_element_1 == NULL )
+    {
+        Py_DECREF( tmp_called_name_4 );
+        Py_DECREF( tmp_args_element_name_4 );
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "y" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 176;
+        type_description_1 = "oooo";
+        goto try_except_handler_14;
+    }
+
+    Py_INCREF( tmp_tuple_element_1 );
+    PyTuple_SET_ITEM( tmp_args_element_name_4, 1, tmp_tuple_element_1 );
+    frame_046134e88eb0512b9883d61b8612c687->m_frame.f_lineno = 176;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_4 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_4, call_args );
+    }
+
+    Py_DECREF( tmp_called_name_4 );
+    Py_DECREF( tmp_args_element_name_4 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 176;
+        type_description_1 = "oooo";
+        goto try_except_handler_14;
+    }
+    Py_DECREF( tmp_unused );
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 175;
+        type_description_1 = "oooo";
+        goto try_except_handler_14;
+    }
+    goto loop_start_6;
+    loop_end_6:;
+    goto try_end_13;
+    // Exception handler code:
+    try_except_handler_14:;
+    exception_keeper_type_13 = exception_type;
+    exception_keeper_value_13 = exception_value;
+    exception_keeper_tb_13 = exception_tb;
+    exception_keeper_lineno_13 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_for_loop_6__iter_value );
+    tmp_for_loop_6__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_6__for_iterator.iterator );
+    tmp_for_loop_6__for_iterator.iterator = NULL;
+    // Re-raise.
+    exception_type = exception_keeper_type_13;
+    exception_value = exception_keeper_value_13;
+    exception_tb = exception_keeper_tb_13;
+    exception_lineno = exception_keeper_lineno_13;
+
+    goto try_except_handler_12;
+    // End of try:
+    try_end_13:;
+    Py_XDECREF( tmp_for_loop_6__iter_value );
+    tmp_for_loop_6__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_6__for_iterator.iterator );
+    tmp_for_loop_6__for_iterator.iterator = NULL;
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 174;
+        type_description_1 = "oooo";
+        goto try_except_handler_12;
+    }
+    goto loop_start_5;
+    loop_end_5:;
+    goto try_end_14;
+    // Exception handler code:
+    try_except_handler_12:;
+    exception_keeper_type_14 = exception_type;
+    exception_keeper_value_14 = exception_value;
+    exception_keeper_tb_14 = exception_tb;
+    exception_keeper_lineno_14 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_for_loop_5__iter_value );
+    tmp_for_loop_5__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_5__for_iterator.iterator );
+    tmp_for_loop_5__for_iterator.iterator = NULL;
+    // Re-raise.
+    exception_type = exception_keeper_type_14;
+    exception_value = exception_keeper_value_14;
+    exception_tb = exception_keeper_tb_14;
+    exception_lineno = exception_keeper_lineno_14;
+
+    goto frame_exception_exit_1;
+    // End of try:
+    try_end_14:;
+    Py_XDECREF( tmp_for_loop_5__iter_value );
+    tmp_for_loop_5__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_5__for_iterator.iterator );
+    tmp_for_loop_5__for_iterator.iterator = NULL;
+    tmp_return_value = PyTuple_New( 2 );
+    tmp_tuple_element_2 = var_result;
+
+    if ( tmp_tuple_element_2 == NULL )
+    {
+        Py_DECREF( tmp_return_value );
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "result" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 178;
+        type_description_1 = "oooo";
+        goto frame_exception_exit_1;
+    }
+
+    Py_INCREF( tmp_tuple_element_2 );
+    PyTuple_SET_ITEM( tmp_return_value, 0, tmp_tuple_element_2 );
+    tmp_tuple_element_2 = var_x;
+
+    if ( tmp_tuple_element_2 == NULL )
+    {
+        Py_DECREF( tmp_return_value );
+        exception_type = PyExc_UnboundLocalError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "local variable '%s' referenced before assignment", "x" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 178;
+        type_description_1 = "oooo";
+        goto frame_exception_exit_1;
+    }
+
+    Py_INCREF( tmp_tuple_element_2 );
+    PyTuple_SET_ITEM( tmp_return_value, 1, tmp_tuple_element_2 );
+    goto frame_return_exit_1;
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_046134e88eb0512b9883d61b8612c687 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_046134e88eb0512b9883d61b8612c687 = depth_frame_046134e88eb0512b9883d61b8612c687;
+
+    goto frame_no_exception_1;
+
+    frame_return_exit_1:;
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_046134e88eb0512b9883d61b8612c687 );
+#endif
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_046134e88eb0512b9883d61b8612c687 = depth_frame_046134e88eb0512b9883d61b8612c687;
+
+    goto try_return_handler_1;
+
+    frame_exception_exit_1:;
+
+#if 0
+    RESTORE_FRAME_EXCEPTION( frame_046134e88eb0512b9883d61b8612c687 );
+#endif
+
+    if ( exception_tb == NULL )
+    {
+        exception_tb = MAKE_TRACEBACK( frame_046134e88eb0512b9883d61b8612c687, exception_lineno );
+    }
+    else if ( exception_tb->tb_frame != &frame_046134e88eb0512b9883d61b8612c687->m_frame )
+    {
+        exception_tb = ADD_TRACEBACK( exception_tb, frame_046134e88eb0512b9883d61b8612c687, exception_lineno );
+    }
+
+#if 0
+    // The line is not updated while running, the traceback has it.
+    frame_046134e88eb0512b9883d61b8612c687->m_frame.f_lineno = exception_lineno;
+#endif
+
+    // Attachs locals to frame if any.
+    Nuitka_Frame_AttachLocals(
+        (struct Nuitka_FrameObject *)frame_046134e88eb0512b9883d61b8612c687,
+        type_description_1,
+        par_n,
+        var_result,
+        var_x,
+        var_y
+    );
+
+
+    // Release cached frame.
+    if ( frame_046134e88eb0512b9883d61b8612c687 == FRAME_CACHE_SLOT( cache_frame_046134e88eb0512b9883d61b8612c687, depth_frame_046134e88eb0512b9883d61b8612c687 ) )
+    {
+        Py_DECREF( frame_046134e88eb0512b9883d61b8612c687 );
+        FRAME_CACHE_SLOT( cache_frame_046134e88eb0512b9883d61b8612c687, depth_frame_046134e88eb0512b9883d61b8612c687 ) = NULL;
+    }
+
+    assertFrameObject( frame_046134e88eb0512b9883d61b8612c687 );
+
+    // Put the previous frame back on top.
+    popFrameStack();
+    cache_depth_frame_046134e88eb0512b9883d61b8612c687 = depth_frame_046134e88eb0512b9883d61b8612c687;
+
+    // Return the error.
+    goto try_except_handler_1;
+
+    frame_no_exception_1:;
+
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_3_rangeLoopFunction );
+    return NULL;
+    // Return handler code:
+    try_return_handler_1:;
+    Py_XDECREF( par_n );
+    par_n = NULL;
+
+    Py_XDECREF( var_result );
+    var_result = NULL;
+
+    Py_XDECREF( var_x );
+    var_x = NULL;
+
+    Py_XDECREF( var_y );
+    var_y = NULL;
+
+    goto function_return_exit;
+    // Exception handler code:
+    try_except_handler_1:;
+    exception_keeper_type_15 = exception_type;
+    exception_keeper_value_15 = exception_value;
+    exception_keeper_tb_15 = exception_tb;
+    exception_keeper_lineno_15 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( par_n );
+    par_n = NULL;
+
+    Py_XDECREF( var_result );
+    var_result = NULL;
+
+    Py_XDECREF( var_x );
+    var_x = NULL;
+
+    Py_XDECREF( var_y );
+    var_y = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_15;
+    exception_value = exception_keeper_value_15;
+    exception_tb = exception_keeper_tb_15;
+    exception_lineno = exception_keeper_lineno_15;
+
+    goto function_exception_exit;
+    // End of try:
+
+    // Return statement must have exited already.
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_3_rangeLoopFunction );
+    return NULL;
+
+function_exception_exit:
+    assert( exception_type );
+    RESTORE_ERROR_OCCURRED( exception_type, exception_value, exception_tb );
+
+    return NULL;
+function_return_exit:
+
+CHECK_OBJECT( tmp_return_value );
+assert( had_error || !ERROR_OCCURRED() );
+return tmp_return_value;
+
+}
+
+
+static PyObject *impl___main__$$$function_4_rangeLoopGenerator( struct Nuitka_FunctionObject const *self, PyObject **python_pars )
+{
+    // Preserve error status for checks
+#ifndef __NUITKA_NO_ASSERT__
+    NUITKA_MAY_BE_UNUSED bool had_error = ERROR_OCCURRED();
+#endif
+
+    // Local variable declarations.
+    PyObject *par_n = python_pars[ 0 ];
+    PyObject *tmp_return_value;
+    tmp_return_value = NULL;
+
+    // Actual function code.
+    // Tried code:
+    tmp_return_value = Nuitka_Generator_New(
+        __main__$$$function_4_rangeLoopGenerator$$$genobj_1_rangeLoopGenerator_context,
+        module___main__,
+        const_str_plain_rangeLoopGenerator,
+#if PYTHON_VERSION >= 350
+        const_str_plain_rangeLoopGenerator,
+#endif
+        codeobj_fe99c64aaf7891ed8c60b10c41b8b505,
+        1,
+        1,
+#if _NUITKA_STACKLESS_GENERATORS
+        sizeof(struct __main__$$$function_4_rangeLoopGenerator$$$genobj_1_rangeLoopGenerator_locals)
+#else
+        0
+#endif
+    );
+
+    ((struct Nuitka_GeneratorObject *)tmp_return_value)->m_closure[0] = Nuitka_Cell_NewInline( ((struct Nuitka_GeneratorObject *)tmp_return_value)->m_closure, 1, 0, par_n );
+    assert( Py_SIZE( tmp_return_value ) >= 1 ); 
+
+
+    goto try_return_handler_1;
+    // tried codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_4_rangeLoopGenerator );
+    return NULL;
+    // Return handler code:
+    try_return_handler_1:;
+    CHECK_OBJECT( (PyObject *)par_n );
+    Py_DECREF( par_n );
+    par_n = NULL;
+
+    goto function_return_exit;
+    // End of try:
+    CHECK_OBJECT( (PyObject *)par_n );
+    Py_DECREF( par_n );
+    par_n = NULL;
+
+
+    // Return statement must have exited already.
+    NUITKA_CANNOT_GET_HERE( __main__$$$function_4_rangeLoopGenerator );
+    return NULL;
+
+function_return_exit:
+
+CHECK_OBJECT( tmp_return_value );
+assert( had_error || !ERROR_OCCURRED() );
+return tmp_return_value;
+
+}
+
+
+
+#if _NUITKA_STACKLESS_GENERATORS
+static PyObject *__main__$$$function_4_rangeLoopGenerator$$$genobj_1_rangeLoopGenerator_context( struct Nuitka_GeneratorObject *generator, PyObject *yield_return_value )
+#else
+static void __main__$$$function_4_rangeLoopGenerator$$$genobj_1_rangeLoopGenerator_context( struct Nuitka_GeneratorObject *generator )
+#endif
+{
+    CHECK_OBJECT( (PyObject *)generator );
+    assert( Nuitka_Generator_Check( (PyObject *)generator ) );
+
+    // Local variable initialization
+    struct __main__$$$function_4_rangeLoopGenerator$$$genobj_1_rangeLoopGenerator_locals *generator_heap = (struct __main__$$$function_4_rangeLoopGenerator$$$genobj_1_rangeLoopGenerator_locals *)generator->m_heap_storage;
+    NUITKA_MAY_BE_UNUSED PyObject *tmp_unused;
+    static struct Nuitka_FrameObject *cache_frame_generator = NULL;
+
+    // Dispatch to yield based on return label index:
+    switch( generator->m_yield_return_index )
+    {
+    case 1: goto yield_return_1;
+    }
+
+    // Heap access initialization, when first entered.
+    generator_heap->var_x = NULL;
+    { nuitka_range_iterator init_value = { NULL, 0, 0, 0 }; generator_heap->tmp_for_loop_1__for_iterator = init_value; }
+    generator_heap->tmp_for_loop_1__iter_value = NULL;
+    generator_heap->exception_type = NULL;
+    generator_heap->exception_value = NULL;
+    generator_heap->exception_tb = NULL;
+    generator_heap->exception_lineno = 0;
+    generator_heap->type_description_1 = NULL;
+
+    // Actual function code.
+    // Tried code:
+    MAKE_OR_REUSE_FRAME( cache_frame_generator, codeobj_fe99c64aaf7891ed8c60b10c41b8b505, module___main__, sizeof(void *)+sizeof(void *) );
+    generator->m_frame = cache_frame_generator;
+
+    // Mark the frame object as in use, ref count 1 will be up for reuse.
+    Py_INCREF( generator->m_frame );
+    assert( Py_REFCNT( generator->m_frame ) == 2 ); // Frame stack
+
+#if PYTHON_VERSION >= 340
+    generator->m_frame->m_frame.f_gen = (PyObject *)generator;
+#endif
+
+    Py_CLEAR( generator->m_frame->m_frame.f_back );
+
+    generator->m_frame->m_frame.f_back = PyThreadState_GET()->frame;
+    Py_INCREF( generator->m_frame->m_frame.f_back );
+
+    PyThreadState_GET()->frame = &generator->m_frame->m_frame;
+    Py_INCREF( generator->m_frame );
+
+    Nuitka_Frame_MarkAsExecuting( generator->m_frame );
+
+#if PYTHON_VERSION >= 300
+    // Accept currently existing exception as the one to publish again when we
+    // yield or yield from.
+    {
+        PyThreadState *thread_state = PyThreadState_GET();
+
+        generator->m_frame->m_frame.f_exc_type = thread_state->exc_type;
+        if ( generator->m_frame->m_frame.f_exc_type == Py_None ) generator->m_frame->m_frame.f_exc_type = NULL;
+        Py_XINCREF( generator->m_frame->m_frame.f_exc_type );
+        generator->m_frame->m_frame.f_exc_value = thread_state->exc_value;
+        Py_XINCREF( generator->m_frame->m_frame.f_exc_value );
+        generator->m_frame->m_frame.f_exc_traceback = thread_state->exc_traceback;
+        Py_XINCREF( generator->m_frame->m_frame.f_exc_traceback );
+    }
+#endif
+
+    // Framed code:
+    if ( NUITKA_INLINE_CELL( generator->m_closure, 1, 0 ) == NULL )
+    {
+        generator_heap->tmp_low_name_1 = NULL;
+    }
+    else
+    {
+        generator_heap->tmp_low_name_1 = PyCell_GET( NUITKA_INLINE_CELL( generator->m_closure, 1, 0 ) );
+    }
+
+    if ( generator_heap->tmp_low_name_1 == NULL )
+    {
+
+        generator_heap->exception_type = PyExc_NameError;
+        Py_INCREF( generator_heap->exception_type );
+        generator_heap->exception_value = PyUnicode_FromFormat( "free variable '%s' referenced before assignment in enclosing scope", "n" );
+        generator_heap->exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &generator_heap->exception_type, &generator_heap->exception_value, &generator_heap->exception_tb );
+        CHAIN_EXCEPTION( generator_heap->exception_value );
+
+        generator_heap->exception_lineno = 184;
+        generator_heap->type_description_1 = "oo";
+        goto frame_exception_exit_1;
+    }
+
+    generator_heap->tmp_high_name_1 = const_int_0;
+    generator_heap->tmp_step_name_1 = const_int_neg_1;
+    generator_heap->tmp_result = MAKE_RANGE_ITERATOR( &generator_heap->tmp_for_loop_1__for_iterator, generator_heap->tmp_low_name_1, generator_heap->tmp_high_name_1, generator_heap->tmp_step_name_1, true );
+    if ( generator_heap->tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &generator_heap->exception_type, &generator_heap->exception_value, &generator_heap->exception_tb );
+
+
+        generator_heap->exception_lineno = 184;
+        generator_heap->type_description_1 = "oo";
+        goto frame_exception_exit_1;
+    }
+    // Tried code:
+    loop_start_1:;
+    // Tried code:
+    generator_heap->tmp_assign_source_1 = RANGE_ITERATOR_NEXT( &generator_heap->tmp_for_loop_1__for_iterator );
+    if ( generator_heap->tmp_assign_source_1 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            generator_heap->exception_type = PyExc_StopIteration;
+            Py_INCREF( generator_heap->exception_type );
+            generator_heap->exception_value = NULL;
+            generator_heap->exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &generator_heap->exception_type, &generator_heap->exception_value, &generator_heap->exception_tb );
+        }
+
+
+        generator_heap->type_description_1 = "oo";
+        generator_heap->exception_lineno = 184;
+        goto try_except_handler_3;
+    }
+    {
+        PyObject *old = generator_heap->tmp_for_loop_1__iter_value;
+        generator_heap->tmp_for_loop_1__iter_value = generator_heap->tmp_assign_source_1;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_1;
+    // Exception handler code:
+    try_except_handler_3:;
+    generator_heap->exception_keeper_type_1 = generator_heap->exception_type;
+    generator_heap->exception_keeper_value_1 = generator_heap->exception_value;
+    generator_heap->exception_keeper_tb_1 = generator_heap->exception_tb;
+    generator_heap->exception_keeper_lineno_1 = generator_heap->exception_lineno;
+    generator_heap->exception_type = NULL;
+    generator_heap->exception_value = NULL;
+    generator_heap->exception_tb = NULL;
+    generator_heap->exception_lineno = 0;
+
+    generator_heap->tmp_compare_left_1 = generator_heap->exception_keeper_type_1;
+    generator_heap->tmp_compare_right_1 = PyExc_StopIteration;
+    generator_heap->tmp_exc_match_exception_match_1 = EXCEPTION_MATCH_BOOL( generator_heap->tmp_compare_left_1, generator_heap->tmp_compare_right_1 );
+    if ( generator_heap->tmp_exc_match_exception_match_1 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &generator_heap->exception_type, &generator_heap->exception_value, &generator_heap->exception_tb );
+
+        Py_DECREF( generator_heap->exception_keeper_type_1 );
+        Py_XDECREF( generator_heap->exception_keeper_value_1 );
+        Py_XDECREF( generator_heap->exception_keeper_tb_1 );
+
+        generator_heap->exception_lineno = 184;
+        generator_heap->type_description_1 = "oo";
+        goto try_except_handler_2;
+    }
+    if ( generator_heap->tmp_exc_match_exception_match_1 == 1 )
+    {
+        goto branch_yes_1;
+    }
+    else
+    {
+        goto branch_no_1;
+    }
+    branch_yes_1:;
+    Py_DECREF( generator_heap->exception_keeper_type_1 );
+    Py_XDECREF( generator_heap->exception_keeper_value_1 );
+    Py_XDECREF( generator_heap->exception_keeper_tb_1 );
+    goto loop_end_1;
+    goto branch_end_1;
+    branch_no_1:;
+    // Re-raise.
+    generator_heap->exception_type = generator_heap->exception_keeper_type_1;
+    generator_heap->exception_value = generator_heap->exception_keeper_value_1;
+    generator_heap->exception_tb = generator_heap->exception_keeper_tb_1;
+    generator_heap->exception_lineno = generator_heap->exception_keeper_lineno_1;
+
+    goto try_except_handler_2;
+    branch_end_1:;
+    // End of try:
+    try_end_1:;
+    generator_heap->tmp_assign_source_2 = generator_heap->tmp_for_loop_1__iter_value;
+
+    CHECK_OBJECT( generator_heap->tmp_assign_source_2 );
+    {
+        PyObject *old = generator_heap->var_x;
+        generator_heap->var_x = generator_heap->tmp_assign_source_2;
+        Py_INCREF( generator_heap->var_x );
+        Py_XDECREF( old );
+    }
+
+    generator_heap->tmp_expression_name_1 = generator_heap->var_x;
+
+    CHECK_OBJECT( generator_heap->tmp_expression_name_1 );
+    Py_INCREF( generator_heap->tmp_expression_name_1 );
+    generator->m_yield_return_index = 1;
+    return GENERATOR_YIELD_SUSPEND( generator, generator_heap->tmp_expression_name_1 );
+    yield_return_1:
+    tmp_unused = GENERATOR_YIELD_RESUME( generator, yield_return_value );
+
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &generator_heap->exception_type, &generator_heap->exception_value, &generator_heap->exception_tb );
+
+
+        generator_heap->exception_lineno = 185;
+        generator_heap->type_description_1 = "oo";
+        goto try_except_handler_2;
+    }
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &generator_heap->exception_type, &generator_heap->exception_value, &generator_heap->exception_tb );
+
+
+        generator_heap->exception_lineno = 184;
+        generator_heap->type_description_1 = "oo";
+        goto try_except_handler_2;
+    }
+    goto loop_start_1;
+    loop_end_1:;
+    goto try_end_2;
+    // Exception handler code:
+    try_except_handler_2:;
+    generator_heap->exception_keeper_type_2 = generator_heap->exception_type;
+    generator_heap->exception_keeper_value_2 = generator_heap->exception_value;
+    generator_heap->exception_keeper_tb_2 = generator_heap->exception_tb;
+    generator_heap->exception_keeper_lineno_2 = generator_heap->exception_lineno;
+    generator_heap->exception_type = NULL;
+    generator_heap->exception_value = NULL;
+    generator_heap->exception_tb = NULL;
+    generator_heap->exception_lineno = 0;
+
+    Py_XDECREF( generator_heap->tmp_for_loop_1__iter_value );
+    generator_heap->tmp_for_loop_1__iter_value = NULL;
+
+    Py_XDECREF( generator_heap->tmp_for_loop_1__for_iterator.iterator );
+    generator_heap->tmp_for_loop_1__for_iterator.iterator = NULL;
+    // Re-raise.
+    generator_heap->exception_type = generator_heap->exception_keeper_type_2;
+    generator_heap->exception_value = generator_heap->exception_keeper_value_2;
+    generator_heap->exception_tb = generator_heap->exception_keeper_tb_2;
+    generator_heap->exception_lineno = generator_heap->exception_keeper_lineno_2;
+
+    goto frame_exception_exit_1;
+    // End of try:
+    try_end_2:;
+
+    Nuitka_Frame_MarkAsNotExecuting( generator->m_frame );
+
+#if PYTHON_VERSION >= 300
+    Py_CLEAR( generator->m_frame->m_frame.f_exc_type );
+    Py_CLEAR( generator->m_frame->m_frame.f_exc_value );
+    Py_CLEAR( generator->m_frame->m_frame.f_exc_traceback );
+#endif
+
+    // Allow re-use of the frame again.
+    Py_DECREF( generator->m_frame );
+    goto frame_no_exception_1;
+
+    frame_exception_exit_1:;
+
+    // If it's not an exit exception, consider and create a traceback for it.
+    if ( !EXCEPTION_MATCH_GENERATOR( generator_heap->exception_type ) )
+    {
+        if ( generator_heap->exception_tb == NULL )
+        {
+            generator_heap->exception_tb = MAKE_TRACEBACK( generator->m_frame, generator_heap->exception_lineno );
+        }
+        else if ( generator_heap->exception_tb->tb_frame != &generator->m_frame->m_frame )
+        {
+            generator_heap->exception_tb = ADD_TRACEBACK( generator_heap->exception_tb, generator->m_frame, generator_heap->exception_lineno );
+        }
+
+#if 0
+        // The line is not updated while running, the traceback has it.
+        generator->m_frame->m_frame.f_lineno = generator_heap->exception_lineno;
+#endif
+
+        Nuitka_Frame_AttachLocals(
+            (struct Nuitka_FrameObject *)generator->m_frame,
+            generator_heap->type_description_1,
+            NUITKA_INLINE_CELL( generator->m_closure, 1, 0 )->ob_ref,
+            generator_heap->var_x
+        );
+
+
+        // Release cached frame.
+        if ( generator->m_frame == cache_frame_generator )
+        {
+            Py_DECREF( generator->m_frame );
+        }
+        cache_frame_generator = NULL;
+
+        assertFrameObject( generator->m_frame );
+    }
+
+#if PYTHON_VERSION >= 300
+    Py_CLEAR( generator->m_frame->m_frame.f_exc_type );
+    Py_CLEAR( generator->m_frame->m_frame.f_exc_value );
+    Py_CLEAR( generator->m_frame->m_frame.f_exc_traceback );
+#endif
+
+    Py_DECREF( generator->m_frame );
+    // Return the error.
+    goto try_except_handler_1;
+
+    frame_no_exception_1:;
+
+    goto try_end_3;
+    // Exception handler code:
+    try_except_handler_1:;
+    generator_heap->exception_keeper_type_3 = generator_heap->exception_type;
+    generator_heap->exception_keeper_value_3 = generator_heap->exception_value;
+    generator_heap->exception_keeper_tb_3 = generator_heap->exception_tb;
+    generator_heap->exception_keeper_lineno_3 = generator_heap->exception_lineno;
+    generator_heap->exception_type = NULL;
+    generator_heap->exception_value = NULL;
+    generator_heap->exception_tb = NULL;
+    generator_heap->exception_lineno = 0;
+
+    Py_XDECREF( generator_heap->var_x );
+    generator_heap->var_x = NULL;
+
+    // Re-raise.
+    generator_heap->exception_type = generator_heap->exception_keeper_type_3;
+    generator_heap->exception_value = generator_heap->exception_keeper_value_3;
+    generator_heap->exception_tb = generator_heap->exception_keeper_tb_3;
+    generator_heap->exception_lineno = generator_heap->exception_keeper_lineno_3;
+
+    goto function_exception_exit;
+    // End of try:
+    try_end_3:;
+    Py_XDECREF( generator_heap->tmp_for_loop_1__iter_value );
+    generator_heap->tmp_for_loop_1__iter_value = NULL;
+
+    Py_XDECREF( generator_heap->tmp_for_loop_1__for_iterator.iterator );
+    generator_heap->tmp_for_loop_1__for_iterator.iterator = NULL;
+    Py_XDECREF( generator_heap->var_x );
+    generator_heap->var_x = NULL;
+
+
+#if _NUITKA_STACKLESS_GENERATORS
+    return NULL;
+#else
+    generator->m_yielded = NULL;
+    return;
+#endif
+
+    function_exception_exit:
+    assert( generator_heap->exception_type );
+    RESTORE_ERROR_OCCURRED( generator_heap->exception_type, generator_heap->exception_value, generator_heap->exception_tb );
+
+#if _NUITKA_STACKLESS_GENERATORS
+    return NULL;
+#else
+    generator->m_yielded = NULL;
+    return;
+#endif
+
+}
+
+
+
+static PyObject *MAKE_FUNCTION___main__$$$function_1_cond(  )
+{
+    struct Nuitka_FunctionObject *result = Nuitka_Function_New(
+        impl___main__$$$function_1_cond,
+        const_str_plain_cond,
+#if PYTHON_VERSION >= 330
+        NULL,
+#endif
+        codeobj_b865081be7c7b5b115cf80eb42bb373b,
+        NULL,
+#if PYTHON_VERSION >= 300
+        NULL,
+        const_dict_empty,
+#endif
+        module___main__,
+        Py_None,
+        0,
+        0
+    );
+
+
+    return (PyObject *)result;
+}
+
+
+
+// Argument parser specialized to the parameters of the function. It handles
+// the common cases and gives up on everything else, notably all errors, for
+// which the generic parser is used.
+static PyObject *parse___main__$$$function_2_loopingFunction( struct Nuitka_FunctionObject const *function, PyObject **args, Py_ssize_t args_size, PyObject *kw )
+{
+    PyObject *python_pars[ 1 ];
+    Py_ssize_t defaults_start;
+
+    if (unlikely( args_size > 1 ))
+    {
+        goto generic;
+    }
+
+    memcpy( python_pars, args, args_size * sizeof(PyObject *) );
+    memset( python_pars + args_size, 0, ( 1 - args_size ) * sizeof(PyObject *) );
+
+    if ( kw != NULL )
+    {
+        Py_ssize_t ppos = 0;
+        PyObject *key, *value;
+
+        while( PyDict_Next( kw, &ppos, &key, &value ) )
+        {
+            if ( key == const_str_plain_a )
+            {
+                if (unlikely( python_pars[ 0 ] != NULL ))
+                {
+                    goto generic;
+                }
+
+                python_pars[ 0 ] = value;
+            }
+            else
+            {
+                goto generic;
+            }
+        }
+    }
+
+    defaults_start = 1 - function->m_defaults_given;
+
+    for( Py_ssize_t i = args_size; i < 1; i++ )
+    {
+        if ( python_pars[ i ] == NULL )
+        {
+            if (unlikely( i < defaults_start ))
+            {
+                goto generic;
+            }
+
+            python_pars[ i ] = PyTuple_GET_ITEM( function->m_defaults, i - defaults_start );
+        }
+    }
+
+    for( Py_ssize_t i = 0; i < 1; i++ )
+    {
+        Py_INCREF( python_pars[ i ] );
+    }
+
+    return impl___main__$$$function_2_loopingFunction( function, python_pars );
+
+generic:
+    return Nuitka_CallFunctionPosArgsKwArgs( function, args, args_size, kw );
+}
+
+static PyObject *MAKE_FUNCTION___main__$$$function_2_loopingFunction( PyObject *defaults )
+{
+    struct Nuitka_FunctionObject *result = Nuitka_Function_New(
+        impl___main__$$$function_2_loopingFunction,
+        const_str_plain_loopingFunction,
+#if PYTHON_VERSION >= 330
+        NULL,
+#endif
+        codeobj_1d5d805b093e3794243f2bcdb5ece1e3,
+        defaults,
+#if PYTHON_VERSION >= 300
+        NULL,
+        const_dict_empty,
+#endif
+        module___main__,
+        Py_None,
+        0,
+        0
+    );
+
+    result->m_c_parse = parse___main__$$$function_2_loopingFunction;
+
+    return (PyObject *)result;
+}
+
+
+
+// Argument parser specialized to the parameters of the function. It handles
+// the common cases and gives up on everything else, notably all errors, for
+// which the generic parser is used.
+static PyObject *parse___main__$$$function_3_rangeLoopFunction( struct Nuitka_FunctionObject const *function, PyObject **args, Py_ssize_t args_size, PyObject *kw )
+{
+    PyObject *python_pars[ 1 ];
+    Py_ssize_t defaults_start;
+
+    if (unlikely( args_size > 1 ))
+    {
+        goto generic;
+    }
+
+    memcpy( python_pars, args, args_size * sizeof(PyObject *) );
+    memset( python_pars + args_size, 0, ( 1 - args_size ) * sizeof(PyObject *) );
+
+    if ( kw != NULL )
+    {
+        Py_ssize_t ppos = 0;
+        PyObject *key, *value;
+
+        while( PyDict_Next( kw, &ppos, &key, &value ) )
+        {
+            if ( key == const_str_plain_n )
+            {
+                if (unlikely( python_pars[ 0 ] != NULL ))
+                {
+                    goto generic;
+                }
+
+                python_pars[ 0 ] = value;
+            }
+            else
+            {
+                goto generic;
+            }
+        }
+    }
+
+    defaults_start = 1 - function->m_defaults_given;
+
+    for( Py_ssize_t i = args_size; i < 1; i++ )
+    {
+        if ( python_pars[ i ] == NULL )
+        {
+            if (unlikely( i < defaults_start ))
+            {
+                goto generic;
+            }
+
+            python_pars[ i ] = PyTuple_GET_ITEM( function->m_defaults, i - defaults_start );
+        }
+    }
+
+    for( Py_ssize_t i = 0; i < 1; i++ )
+    {
+        Py_INCREF( python_pars[ i ] );
+    }
+
+    return impl___main__$$$function_3_rangeLoopFunction( function, python_pars );
+
+generic:
+    return Nuitka_CallFunctionPosArgsKwArgs( function, args, args_size, kw );
+}
+
+static PyObject *MAKE_FUNCTION___main__$$$function_3_rangeLoopFunction(  )
+{
+    struct Nuitka_FunctionObject *result = Nuitka_Function_New(
+        impl___main__$$$function_3_rangeLoopFunction,
+        const_str_plain_rangeLoopFunction,
+#if PYTHON_VERSION >= 330
+        NULL,
+#endif
+        codeobj_046134e88eb0512b9883d61b8612c687,
+        NULL,
+#if PYTHON_VERSION >= 300
+        NULL,
+        const_dict_empty,
+#endif
+        module___main__,
+        Py_None,
+        0,
+        0
+    );
+
+    result->m_c_parse = parse___main__$$$function_3_rangeLoopFunction;
+
+    return (PyObject *)result;
+}
+
+
+
+// Argument parser specialized to the parameters of the function. It handles
+// the common cases and gives up on everything else, notably all errors, for
+// which the generic parser is used.
+static PyObject *parse___main__$$$function_4_rangeLoopGenerator( struct Nuitka_FunctionObject const *function, PyObject **args, Py_ssize_t args_size, PyObject *kw )
+{
+    PyObject *python_pars[ 1 ];
+    Py_ssize_t defaults_start;
+
+    if (unlikely( args_size > 1 ))
+    {
+        goto generic;
+    }
+
+    memcpy( python_pars, args, args_size * sizeof(PyObject *) );
+    memset( python_pars + args_size, 0, ( 1 - args_size ) * sizeof(PyObject *) );
+
+    if ( kw != NULL )
+    {
+        Py_ssize_t ppos = 0;
+        PyObject *key, *value;
+
+        while( PyDict_Next( kw, &ppos, &key, &value ) )
+        {
+            if ( key == const_str_plain_n )
+            {
+                if (unlikely( python_pars[ 0 ] != NULL ))
+                {
+                    goto generic;
+                }
+
+                python_pars[ 0 ] = value;
+            }
+            else
+            {
+                goto generic;
+            }
+        }
+    }
+
+    defaults_start = 1 - function->m_defaults_given;
+
+    for( Py_ssize_t i = args_size; i < 1; i++ )
+    {
+        if ( python_pars[ i ] == NULL )
+        {
+            if (unlikely( i < defaults_start ))
+            {
+                goto generic;
+            }
+
+            python_pars[ i ] = PyTuple_GET_ITEM( function->m_defaults, i - defaults_start );
+        }
+    }
+
+    for( Py_ssize_t i = 0; i < 1; i++ )
+    {
+        Py_INCREF( python_pars[ i ] );
+    }
+
+    return impl___main__$$$function_4_rangeLoopGenerator( function, python_pars );
+
+generic:
+    return Nuitka_CallFunctionPosArgsKwArgs( function, args, args_size, kw );
+}
+
+static PyObject *MAKE_FUNCTION___main__$$$function_4_rangeLoopGenerator(  )
+{
+    struct Nuitka_FunctionObject *result = Nuitka_Function_New(
+        impl___main__$$$function_4_rangeLoopGenerator,
+        const_str_plain_rangeLoopGenerator,
+#if PYTHON_VERSION >= 330
+        NULL,
+#endif
+        codeobj_fe99c64aaf7891ed8c60b10c41b8b505,
+        NULL,
+#if PYTHON_VERSION >= 300
+        NULL,
+        const_dict_empty,
+#endif
+        module___main__,
+        Py_None,
+        0,
+        0
+    );
+
+    result->m_c_parse = parse___main__$$$function_4_rangeLoopGenerator;
+
+    return (PyObject *)result;
+}
+
+
+
+#if PYTHON_VERSION >= 300
+static struct PyModuleDef mdef___main__ =
+{
+    PyModuleDef_HEAD_INIT,
+    "__main__",   /* m_name */
+    NULL,                /* m_doc */
+    -1,                  /* m_size */
+    NULL,                /* m_methods */
+    NULL,                /* m_reload */
+    NULL,                /* m_traverse */
+    NULL,                /* m_clear */
+    NULL,                /* m_free */
+  };
+#endif
+
+extern PyObject *const_str_plain___package__;
+
+#if PYTHON_VERSION >= 300
+extern PyObject *const_str_dot;
+#endif
+#if PYTHON_VERSION >= 330
+extern PyObject *const_str_plain___loader__;
+extern PyObject *metapath_based_loader;
+#endif
+#if PYTHON_VERSION >= 330
+extern PyObject *const_str_plain___spec__;
+#endif
+
+extern void _initCompiledCellType();
+extern void _initCompiledGeneratorType();
+extern void _initCompiledFunctionType();
+extern void _initCompiledMethodType();
+extern void _initCompiledFrameType();
+#if PYTHON_VERSION >= 350
+extern void _initCompiledCoroutineTypes();
+#endif
+#if PYTHON_VERSION >= 360
+extern void _initCompiledAsyncgenTypes();
+#endif
+
+// The exported interface to CPython. On import of the module, this function
+// gets called. It has to have an exact function name, in cases it's a shared
+// library export. This is hidden behind the MOD_INIT_DECL.
+
+MOD_INIT_DECL( __main__ )
+{
+#if defined(_NUITKA_EXE) || PYTHON_VERSION >= 300
+    static bool _init_done = false;
+
+    // Modules might be imported repeatedly, which is to be ignored.
+    if ( _init_done )
+    {
+        return MOD_RETURN_VALUE( module___main__ );
+    }
+    else
+    {
+        _init_done = true;
+    }
+#endif
+
+#ifdef _NUITKA_MODULE
+    // In case of a stand alone extension module, need to call initialization
+    // the init here because that's the first and only time we are going to get
+    // called here.
+
+    // Initialize the constant values used.
+    _initBuiltinModule();
+    createGlobalConstants();
+
+    /* Initialize the compiled types of Nuitka. */
+    _initCompiledCellType();
+    _initCompiledGeneratorType();
+    _initCompiledFunctionType();
+    _initCompiledMethodType();
+    _initCompiledFrameType();
+#if PYTHON_VERSION >= 350
+    _initCompiledCoroutineTypes();
+#endif
+#if PYTHON_VERSION >= 360
+    _initCompiledAsyncgenTypes();
+#endif
+
+#if PYTHON_VERSION < 300
+    _initSlotCompare();
+#endif
+#if PYTHON_VERSION >= 270
+    _initSlotIternext();
+#endif
+
+    patchBuiltinModule();
+    patchTypeComparison();
+
+    // Enable meta path based loader if not already done.
+#ifdef _NUITKA_TRACE
+    puts("__main__: Calling setupMetaPathBasedLoader().");
+#endif
+    setupMetaPathBasedLoader();
+
+#if PYTHON_VERSION >= 300
+    patchInspectModule();
+#endif
+
+#endif
+
+    /* The constants only used by this module are created now. */
+#ifdef _NUITKA_TRACE
+    puts("__main__: Calling createModuleConstants().");
+#endif
+    createModuleConstants();
+
+    /* The code objects used by this module are created now. */
+#ifdef _NUITKA_TRACE
+    puts("__main__: Calling createModuleCodeObjects().");
+#endif
+    createModuleCodeObjects();
+
+    // puts( "in init__main__" );
+
+    // Create the module object first. There are no methods initially, all are
+    // added dynamically in actual code only.  Also no "__doc__" is initially
+    // set at this time, as it could not contain NUL characters this way, they
+    // are instead set in early module code.  No "self" for modules, we have no
+    // use for it.
+#if PYTHON_VERSION < 300
+    module___main__ = Py_InitModule4(
+        "__main__",       // Module Name
+        NULL,                    // No methods initially, all are added
+                                 // dynamically in actual module code only.
+        NULL,                    // No "__doc__" is initially set, as it could
+                                 // not contain NUL this way, added early in
+                                 // actual code.
+        NULL,                    // No self for modules, we don't use it.
+        PYTHON_API_VERSION
+    );
+#else
+
+    module___main__ = PyModule_Create( &mdef___main__ );
+#endif
+
+    moduledict___main__ = MODULE_DICT( module___main__ );
+
+    // Update "__package__" value to what it ought to be.
+    {
+#if 0
+#if PYTHON_VERSION < 300 || PYTHON_VERSION >= 330
+        PyObject *module_name = GET_STRING_DICT_VALUE( moduledict___main__, (Nuitka_StringObject *)const_str_plain___name__ );
+
+        UPDATE_STRING_DICT1(
+            moduledict___main__,
+            (Nuitka_StringObject *)const_str_plain___package__,
+            module_name
+        );
+#endif
+
+#else
+
+#if PYTHON_VERSION < 300
+        PyObject *module_name = GET_STRING_DICT_VALUE( moduledict___main__, (Nuitka_StringObject *)const_str_plain___name__ );
+        char const *module_name_cstr = PyString_AS_STRING( module_name );
+
+        char const *last_dot = strrchr( module_name_cstr, '.' );
+
+        if ( last_dot != NULL )
+        {
+            UPDATE_STRING_DICT1(
+                moduledict___main__,
+                (Nuitka_StringObject *)const_str_plain___package__,
+                PyString_FromStringAndSize( module_name_cstr, last_dot - module_name_cstr )
+            );
+        }
+#elif PYTHON_VERSION < 330
+        UPDATE_STRING_DICT1(
+            moduledict___main__,
+            (Nuitka_StringObject *)const_str_plain___package__,
+            Py_None
+        );
+#else
+        PyObject *module_name = GET_STRING_DICT_VALUE( moduledict___main__, (Nuitka_StringObject *)const_str_plain___name__ );
+        Py_ssize_t dot_index = PyUnicode_Find( module_name, const_str_dot, 0, PyUnicode_GetLength( module_name ), -1 );
+
+        if ( dot_index != -1 )
+        {
+            UPDATE_STRING_DICT1(
+                moduledict___main__,
+                (Nuitka_StringObject *)const_str_plain___package__,
+                PyUnicode_Substring( module_name, 0, dot_index )
+            );
+        }
+#endif
+#endif
+    }
+
+    CHECK_OBJECT( module___main__ );
+
+// Seems to work for Python2.7 out of the box, but for Python3, the module
+// doesn't automatically enter "sys.modules", so do it manually.
+#if PYTHON_VERSION >= 300
+    {
+        int r = PyObject_SetItem( PySys_GetObject( (char *)"modules" ), const_str_plain___main__, module___main__ );
+
+        assert( r != -1 );
+    }
+#endif
+
+    // For deep importing of a module we need to have "__builtins__", so we set
+    // it ourselves in the same way than CPython does. Note: This must be done
+    // before the frame object is allocated, or else it may fail.
+
+    if ( GET_STRING_DICT_VALUE( moduledict___main__, (Nuitka_StringObject *)const_str_plain___builtins__ ) == NULL )
+    {
+        PyObject *value = (PyObject *)builtin_module;
+
+        // Check if main module, not a dict then but the module itself.
+#if !defined(_NUITKA_EXE) || !1
+        value = PyModule_GetDict( value );
+#endif
+
+        UPDATE_STRING_DICT0( moduledict___main__, (Nuitka_StringObject *)const_str_plain___builtins__, value );
+    }
+
+#if PYTHON_VERSION >= 330
+    UPDATE_STRING_DICT0( moduledict___main__, (Nuitka_StringObject *)const_str_plain___loader__, metapath_based_loader );
+#endif
+
+#if PYTHON_VERSION >= 340
+#if 1
+    UPDATE_STRING_DICT0( moduledict___main__, (Nuitka_StringObject *)const_str_plain___spec__, Py_None );
+#else
+    {
+        PyObject *bootstrap_module = PyImport_ImportModule("importlib._bootstrap");
+        CHECK_OBJECT( bootstrap_module );
+        PyObject *module_spec_class = PyObject_GetAttrString( bootstrap_module, "ModuleSpec" );
+        Py_DECREF( bootstrap_module );
+
+        PyObject *args[] = {
+            GET_STRING_DICT_VALUE( moduledict___main__, (Nuitka_StringObject *)const_str_plain___name__ ),
+            metapath_based_loader
+        };
+
+        PyObject *spec_value = CALL_FUNCTION_WITH_ARGS2(
+            module_spec_class,
+            args
+        );
+
+        UPDATE_STRING_DICT1( moduledict___main__, (Nuitka_StringObject *)const_str_plain___spec__, spec_value );
+
+        Py_DECREF( module_spec_class );
+    }
+#endif
+#endif
+
+
+    // Temp variables if any
+    PyObject *tmp_for_loop_1__for_iterator = NULL;
+    PyObject *tmp_for_loop_1__iter_value = NULL;
+    nuitka_range_iterator tmp_for_loop_2__for_iterator = { NULL, 0, 0, 0 };
+    PyObject *tmp_for_loop_2__iter_value = NULL;
+    PyObject *tmp_tuple_unpack_1__element_1 = NULL;
+    PyObject *tmp_tuple_unpack_1__element_2 = NULL;
+    nuitka_unpack_iterator tmp_tuple_unpack_1__source_iter = { NULL, NULL };
+    PyObject *exception_type = NULL;
+    PyObject *exception_value = NULL;
+    PyTracebackObject *exception_tb = NULL;
+    NUITKA_MAY_BE_UNUSED int exception_lineno = 0;
+    PyObject *exception_keeper_type_1;
+    PyObject *exception_keeper_value_1;
+    PyTracebackObject *exception_keeper_tb_1;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_1;
+    PyObject *exception_keeper_type_2;
+    PyObject *exception_keeper_value_2;
+    PyTracebackObject *exception_keeper_tb_2;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_2;
+    PyObject *exception_keeper_type_3;
+    PyObject *exception_keeper_value_3;
+    PyTracebackObject *exception_keeper_tb_3;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_3;
+    PyObject *exception_keeper_type_4;
+    PyObject *exception_keeper_value_4;
+    PyTracebackObject *exception_keeper_tb_4;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_4;
+    PyObject *exception_keeper_type_5;
+    PyObject *exception_keeper_value_5;
+    PyTracebackObject *exception_keeper_tb_5;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_5;
+    PyObject *exception_keeper_type_6;
+    PyObject *exception_keeper_value_6;
+    PyTracebackObject *exception_keeper_tb_6;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_6;
+    PyObject *exception_keeper_type_7;
+    PyObject *exception_keeper_value_7;
+    PyTracebackObject *exception_keeper_tb_7;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_7;
+    PyObject *exception_keeper_type_8;
+    PyObject *exception_keeper_value_8;
+    PyTracebackObject *exception_keeper_tb_8;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_8;
+    PyObject *exception_keeper_type_9;
+    PyObject *exception_keeper_value_9;
+    PyTracebackObject *exception_keeper_tb_9;
+    NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_9;
+    PyObject *exception_preserved_type_1;
+    PyObject *exception_preserved_value_1;
+    PyTracebackObject *exception_preserved_tb_1;
+    PyObject *tmp_args_element_name_1;
+    PyObject *tmp_args_element_name_2;
+    PyObject *tmp_args_element_name_3;
+    PyObject *tmp_args_element_name_4;
+    PyObject *tmp_args_element_name_5;
+    PyObject *tmp_args_element_name_6;
+    PyObject *tmp_args_element_name_7;
+    PyObject *tmp_args_element_name_8;
+    PyObject *tmp_args_name_1;
+    PyObject *tmp_args_name_2;
+    PyObject *tmp_assign_source_1;
+    PyObject *tmp_assign_source_2;
+    PyObject *tmp_assign_source_3;
+    PyObject *tmp_assign_source_4;
+    PyObject *tmp_assign_source_5;
+    PyObject *tmp_assign_source_6;
+    PyObject *tmp_assign_source_7;
+    PyObject *tmp_assign_source_8;
+    PyObject *tmp_assign_source_9;
+    PyObject *tmp_assign_source_10;
+    PyObject *tmp_assign_source_11;
+    PyObject *tmp_assign_source_12;
+    PyObject *tmp_assign_source_13;
+    PyObject *tmp_assign_source_14;
+    PyObject *tmp_assign_source_15;
+    PyObject *tmp_assign_source_16;
+    PyObject *tmp_assign_source_17;
+    PyObject *tmp_assign_source_18;
+    PyObject *tmp_called_name_1;
+    PyObject *tmp_called_name_2;
+    PyObject *tmp_called_name_3;
+    PyObject *tmp_called_name_4;
+    PyObject *tmp_called_name_5;
+    PyObject *tmp_called_name_6;
+    PyObject *tmp_called_name_7;
+    PyObject *tmp_called_name_8;
+    PyObject *tmp_called_name_9;
+    PyObject *tmp_called_name_10;
+    PyObject *tmp_called_name_11;
+    PyObject *tmp_compare_left_1;
+    PyObject *tmp_compare_left_2;
+    PyObject *tmp_compare_left_3;
+    PyObject *tmp_compare_right_1;
+    PyObject *tmp_compare_right_2;
+    PyObject *tmp_compare_right_3;
+    PyObject *tmp_defaults_1;
+    int tmp_exc_match_exception_match_1;
+    int tmp_exc_match_exception_match_2;
+    int tmp_exc_match_exception_match_3;
+    PyObject *tmp_high_name_1;
+    PyObject *tmp_import_name_from_1;
+    PyObject *tmp_iter_arg_1;
+    PyObject *tmp_kw_name_1;
+    PyObject *tmp_kw_name_2;
+    PyObject *tmp_level_name_1;
+    PyObject *tmp_level_name_2;
+    PyObject *tmp_list_arg_1;
+    PyObject *tmp_low_name_1;
+    PyObject *tmp_name_name_1;
+    PyObject *tmp_name_name_2;
+    PyObject *tmp_operand_name_1;
+    PyObject *tmp_operand_name_2;
+    PyObject *tmp_operand_name_3;
+    int tmp_res;
+    bool tmp_result;
+    PyObject *tmp_tuple_element_1;
+    PyObject *tmp_tuple_element_2;
+    NUITKA_MAY_BE_UNUSED PyObject *tmp_unused;
+    PyObject *tmp_value_name_1;
+    PyObject *tmp_value_name_2;
+    struct Nuitka_FrameObject *frame_32d834cacb17dd188ad83e2de9df6467;
+
+    NUITKA_MAY_BE_UNUSED char const *type_description_1 = NULL;
+
+    // Module code.
+    // Frame without reuse.
+    frame_32d834cacb17dd188ad83e2de9df6467 = MAKE_MODULE_FRAME( codeobj_32d834cacb17dd188ad83e2de9df6467, module___main__ );
+
+    // Push the new frame as the currently active one, and we should be exclusively
+    // owning it.
+    pushFrameStack( frame_32d834cacb17dd188ad83e2de9df6467 );
+    assert( Py_REFCNT( frame_32d834cacb17dd188ad83e2de9df6467 ) == 2 );
+
+    // Framed code:
+    tmp_name_name_1 = const_str_plain_os;
+    tmp_level_name_1 = const_int_0;
+    frame_32d834cacb17dd188ad83e2de9df6467->m_frame.f_lineno = 1;
+    tmp_unused = IMPORT_MODULE_KW( tmp_name_name_1, NULL, NULL, NULL, tmp_level_name_1 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 1;
+
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_name_name_2 = const_str_plain_site;
+    tmp_level_name_2 = const_int_0;
+    frame_32d834cacb17dd188ad83e2de9df6467->m_frame.f_lineno = 1;
+    tmp_unused = IMPORT_MODULE_KW( tmp_name_name_2, NULL, NULL, NULL, tmp_level_name_2 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 1;
+
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_assign_source_1 = Py_None;
+    UPDATE_STRING_DICT0( moduledict___main__, (Nuitka_StringObject *)const_str_plain___doc__, tmp_assign_source_1 );
+    tmp_assign_source_2 = const_str_digest_fbc60986c47bdb27eaa03b762df73ad4;
+    UPDATE_STRING_DICT0( moduledict___main__, (Nuitka_StringObject *)const_str_plain___file__, tmp_assign_source_2 );
+    tmp_assign_source_3 = Py_None;
+    UPDATE_STRING_DICT0( moduledict___main__, (Nuitka_StringObject *)const_str_plain___cached__, tmp_assign_source_3 );
+    tmp_assign_source_4 = PyDict_New();
+    UPDATE_STRING_DICT1( moduledict___main__, (Nuitka_StringObject *)const_str_plain___annotations__, tmp_assign_source_4 );
+    frame_32d834cacb17dd188ad83e2de9df6467->m_frame.f_lineno = 18;
+    tmp_import_name_from_1 = PyImport_ImportModule("__future__");
+    assert( tmp_import_name_from_1 != NULL );
+    tmp_assign_source_5 = IMPORT_NAME( tmp_import_name_from_1, const_str_plain_print_function );
+    if ( tmp_assign_source_5 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 18;
+
+        goto frame_exception_exit_1;
+    }
+    UPDATE_STRING_DICT1( moduledict___main__, (Nuitka_StringObject *)const_str_plain_print_function, tmp_assign_source_5 );
+    tmp_assign_source_6 = MAKE_FUNCTION___main__$$$function_1_cond(  );
+    UPDATE_STRING_DICT1( moduledict___main__, (Nuitka_StringObject *)const_str_plain_cond, tmp_assign_source_6 );
+    tmp_defaults_1 = const_tuple_int_pos_2_tuple;
+    Py_INCREF( tmp_defaults_1 );
+    tmp_assign_source_7 = MAKE_FUNCTION___main__$$$function_2_loopingFunction( tmp_defaults_1 );
+    UPDATE_STRING_DICT1( moduledict___main__, (Nuitka_StringObject *)const_str_plain_loopingFunction, tmp_assign_source_7 );
+    tmp_called_name_1 = GET_MODULE_VARIABLE_VALUE_CACHED( moduledict___main__, const_str_plain_loopingFunction, &module_variable_cache_1 );
+
+    CHECK_OBJECT( tmp_called_name_1 );
+    frame_32d834cacb17dd188ad83e2de9df6467->m_frame.f_lineno = 150;
+    if ( Nuitka_Function_Check( tmp_called_name_1 ) && ((struct Nuitka_FunctionObject *)tmp_called_name_1)->m_c_code == impl___main__$$$function_2_loopingFunction )
+    {
+        tmp_unused = Nuitka_CallFunctionParsed( parse___main__$$$function_2_loopingFunction, tmp_called_name_1, NULL, 0 );
+    }
+    else
+    {
+        tmp_unused = CALL_FUNCTION_NO_ARGS( tmp_called_name_1 );
+    }
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 150;
+
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_assign_source_8 = MAKE_FUNCTION___main__$$$function_3_rangeLoopFunction(  );
+    UPDATE_STRING_DICT1( moduledict___main__, (Nuitka_StringObject *)const_str_plain_rangeLoopFunction, tmp_assign_source_8 );
+    tmp_called_name_2 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_2 != NULL );
+    tmp_args_element_name_1 = const_str_digest_12ae0b962f942fea309297ef66f3b7a5;
+    tmp_called_name_3 = GET_MODULE_VARIABLE_VALUE_CACHED( moduledict___main__, const_str_plain_rangeLoopFunction, &module_variable_cache_2 );
+
+    CHECK_OBJECT( tmp_called_name_3 );
+    frame_32d834cacb17dd188ad83e2de9df6467->m_frame.f_lineno = 180;
+    tmp_args_element_name_2 = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_3, &PyTuple_GET_ITEM( const_tuple_int_pos_5_tuple, 0 ) );
+
+    if ( tmp_args_element_name_2 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 180;
+
+        goto frame_exception_exit_1;
+    }
+    frame_32d834cacb17dd188ad83e2de9df6467->m_frame.f_lineno = 180;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_1, tmp_args_element_name_2 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS2( tmp_called_name_2, call_args );
+    }
+
+    Py_DECREF( tmp_args_element_name_2 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 180;
+
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_called_name_4 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_4 != NULL );
+    tmp_args_element_name_3 = const_str_digest_fb48e7be2dff5ce44baabe61d2eb0a4e;
+    tmp_called_name_5 = GET_MODULE_VARIABLE_VALUE_CACHED( moduledict___main__, const_str_plain_rangeLoopFunction, &module_variable_cache_3 );
+
+    if ( tmp_called_name_5 == NULL )
+    {
+
+        exception_type = PyExc_NameError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "name '%s' is not defined", "rangeLoopFunction" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 181;
+
+        goto frame_exception_exit_1;
+    }
+
+    frame_32d834cacb17dd188ad83e2de9df6467->m_frame.f_lineno = 181;
+    tmp_args_element_name_4 = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_5, &PyTuple_GET_ITEM( const_tuple_int_0_tuple, 0 ) );
+
+    if ( tmp_args_element_name_4 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 181;
+
+        goto frame_exception_exit_1;
+    }
+    frame_32d834cacb17dd188ad83e2de9df6467->m_frame.f_lineno = 181;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_3, tmp_args_element_name_4 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS2( tmp_called_name_4, call_args );
+    }
+
+    Py_DECREF( tmp_args_element_name_4 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 181;
+
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_assign_source_9 = MAKE_FUNCTION___main__$$$function_4_rangeLoopGenerator(  );
+    UPDATE_STRING_DICT1( moduledict___main__, (Nuitka_StringObject *)const_str_plain_rangeLoopGenerator, tmp_assign_source_9 );
+    tmp_called_name_6 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_6 != NULL );
+    tmp_args_element_name_5 = const_str_digest_704ba592b4c1ed4866f4cb0cd4e22bea;
+    tmp_called_name_7 = GET_MODULE_VARIABLE_VALUE_CACHED( moduledict___main__, const_str_plain_rangeLoopGenerator, &module_variable_cache_4 );
+
+    CHECK_OBJECT( tmp_called_name_7 );
+    frame_32d834cacb17dd188ad83e2de9df6467->m_frame.f_lineno = 187;
+    tmp_list_arg_1 = CALL_FUNCTION_WITH_ARGS1( tmp_called_name_7, &PyTuple_GET_ITEM( const_tuple_int_pos_4_tuple, 0 ) );
+
+    if ( tmp_list_arg_1 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 187;
+
+        goto frame_exception_exit_1;
+    }
+    tmp_args_element_name_6 = PySequence_List( tmp_list_arg_1 );
+    Py_DECREF( tmp_list_arg_1 );
+    if ( tmp_args_element_name_6 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 187;
+
+        goto frame_exception_exit_1;
+    }
+    frame_32d834cacb17dd188ad83e2de9df6467->m_frame.f_lineno = 187;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_5, tmp_args_element_name_6 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS2( tmp_called_name_6, call_args );
+    }
+
+    Py_DECREF( tmp_args_element_name_6 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 187;
+
+        goto frame_exception_exit_1;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_iter_arg_1 = const_tuple_8f202f740d5c5973363678b255a3a811_tuple;
+    tmp_assign_source_10 = MAKE_ITERATOR( tmp_iter_arg_1 );
+    assert( tmp_assign_source_10 != NULL );
+    assert( tmp_for_loop_1__for_iterator == NULL );
+    tmp_for_loop_1__for_iterator = tmp_assign_source_10;
+
+    // Tried code:
+    loop_start_1:;
+    // Tried code:
+    tmp_value_name_1 = tmp_for_loop_1__for_iterator;
+
+    CHECK_OBJECT( tmp_value_name_1 );
+    tmp_assign_source_11 = ITERATOR_NEXT( tmp_value_name_1 );
+    if ( tmp_assign_source_11 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+
+        exception_lineno = 189;
+        goto try_except_handler_2;
+    }
+    {
+        PyObject *old = tmp_for_loop_1__iter_value;
+        tmp_for_loop_1__iter_value = tmp_assign_source_11;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_1;
+    // Exception handler code:
+    try_except_handler_2:;
+    exception_keeper_type_1 = exception_type;
+    exception_keeper_value_1 = exception_value;
+    exception_keeper_tb_1 = exception_tb;
+    exception_keeper_lineno_1 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_1 = exception_keeper_type_1;
+    tmp_compare_right_1 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_1 = EXCEPTION_MATCH_BOOL( tmp_compare_left_1, tmp_compare_right_1 );
+    if ( tmp_exc_match_exception_match_1 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_1 );
+        Py_XDECREF( exception_keeper_value_1 );
+        Py_XDECREF( exception_keeper_tb_1 );
+
+        exception_lineno = 189;
+
+        goto try_except_handler_1;
+    }
+    if ( tmp_exc_match_exception_match_1 == 1 )
+    {
+        goto branch_yes_1;
+    }
+    else
+    {
+        goto branch_no_1;
+    }
+    branch_yes_1:;
+    Py_DECREF( exception_keeper_type_1 );
+    Py_XDECREF( exception_keeper_value_1 );
+    Py_XDECREF( exception_keeper_tb_1 );
+    goto loop_end_1;
+    goto branch_end_1;
+    branch_no_1:;
+    // Re-raise.
+    exception_type = exception_keeper_type_1;
+    exception_value = exception_keeper_value_1;
+    exception_tb = exception_keeper_tb_1;
+    exception_lineno = exception_keeper_lineno_1;
+
+    goto try_except_handler_1;
+    branch_end_1:;
+    // End of try:
+    try_end_1:;
+    // Tried code:
+    tmp_value_name_2 = tmp_for_loop_1__iter_value;
+
+    CHECK_OBJECT( tmp_value_name_2 );
+    Py_XDECREF( tmp_tuple_unpack_1__source_iter.iterator );
+    tmp_tuple_unpack_1__source_iter.iterator = NULL;
+    Py_XDECREF( tmp_tuple_unpack_1__source_iter.sequence );
+    tmp_tuple_unpack_1__source_iter.sequence = NULL;
+    tmp_result = MAKE_UNPACK_ITERATOR( &tmp_tuple_unpack_1__source_iter, tmp_value_name_2 );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 189;
+
+        goto try_except_handler_3;
+    }
+    // Tried code:
+    tmp_assign_source_12 = UNPACK_ITERATOR_NEXT( &tmp_tuple_unpack_1__source_iter, 0, 2 );
+    if ( tmp_assign_source_12 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+
+        exception_lineno = 189;
+        goto try_except_handler_4;
+    }
+    {
+        PyObject *old = tmp_tuple_unpack_1__element_1;
+        tmp_tuple_unpack_1__element_1 = tmp_assign_source_12;
+        Py_XDECREF( old );
+    }
+
+    tmp_assign_source_13 = UNPACK_ITERATOR_NEXT( &tmp_tuple_unpack_1__source_iter, 1, 2 );
+    if ( tmp_assign_source_13 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+
+        exception_lineno = 189;
+        goto try_except_handler_4;
+    }
+    {
+        PyObject *old = tmp_tuple_unpack_1__element_2;
+        tmp_tuple_unpack_1__element_2 = tmp_assign_source_13;
+        Py_XDECREF( old );
+    }
+
+    tmp_result = UNPACK_ITERATOR_CHECK_REMAINING( &tmp_tuple_unpack_1__source_iter, 2 );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 189;
+
+        goto try_except_handler_4;
+    }
+    goto try_end_2;
+    // Exception handler code:
+    try_except_handler_4:;
+    exception_keeper_type_2 = exception_type;
+    exception_keeper_value_2 = exception_value;
+    exception_keeper_tb_2 = exception_tb;
+    exception_keeper_lineno_2 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_tuple_unpack_1__source_iter.iterator );
+    tmp_tuple_unpack_1__source_iter.iterator = NULL;
+    Py_XDECREF( tmp_tuple_unpack_1__source_iter.sequence );
+    tmp_tuple_unpack_1__source_iter.sequence = NULL;
+    // Re-raise.
+    exception_type = exception_keeper_type_2;
+    exception_value = exception_keeper_value_2;
+    exception_tb = exception_keeper_tb_2;
+    exception_lineno = exception_keeper_lineno_2;
+
+    goto try_except_handler_3;
+    // End of try:
+    try_end_2:;
+    goto try_end_3;
+    // Exception handler code:
+    try_except_handler_3:;
+    exception_keeper_type_3 = exception_type;
+    exception_keeper_value_3 = exception_value;
+    exception_keeper_tb_3 = exception_tb;
+    exception_keeper_lineno_3 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_tuple_unpack_1__element_1 );
+    tmp_tuple_unpack_1__element_1 = NULL;
+
+    Py_XDECREF( tmp_tuple_unpack_1__element_2 );
+    tmp_tuple_unpack_1__element_2 = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_3;
+    exception_value = exception_keeper_value_3;
+    exception_tb = exception_keeper_tb_3;
+    exception_lineno = exception_keeper_lineno_3;
+
+    goto try_except_handler_1;
+    // End of try:
+    try_end_3:;
+    Py_XDECREF( tmp_tuple_unpack_1__source_iter.iterator );
+    tmp_tuple_unpack_1__source_iter.iterator = NULL;
+    Py_XDECREF( tmp_tuple_unpack_1__source_iter.sequence );
+    tmp_tuple_unpack_1__source_iter.sequence = NULL;
+    tmp_assign_source_14 = tmp_tuple_unpack_1__element_1;
+
+    CHECK_OBJECT( tmp_assign_source_14 );
+    UPDATE_STRING_DICT0( moduledict___main__, (Nuitka_StringObject *)const_str_plain_low, tmp_assign_source_14 );
+    Py_XDECREF( tmp_tuple_unpack_1__element_1 );
+    tmp_tuple_unpack_1__element_1 = NULL;
+
+    tmp_assign_source_15 = tmp_tuple_unpack_1__element_2;
+
+    CHECK_OBJECT( tmp_assign_source_15 );
+    UPDATE_STRING_DICT0( moduledict___main__, (Nuitka_StringObject *)const_str_plain_high, tmp_assign_source_15 );
+    Py_XDECREF( tmp_tuple_unpack_1__element_2 );
+    tmp_tuple_unpack_1__element_2 = NULL;
+
+    // Tried code:
+    tmp_called_name_8 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_8 != NULL );
+    tmp_args_name_1 = PyTuple_New( 4 );
+    tmp_tuple_element_1 = const_str_digest_6ad00f07e7481631c8484b17c838ff75;
+    Py_INCREF( tmp_tuple_element_1 );
+    PyTuple_SET_ITEM( tmp_args_name_1, 0, tmp_tuple_element_1 );
+    tmp_operand_name_1 = GET_MODULE_VARIABLE_VALUE_CACHED( moduledict___main__, const_str_plain_low, &module_variable_cache_5 );
+
+    if ( tmp_operand_name_1 == NULL )
+    {
+        Py_DECREF( tmp_args_name_1 );
+        exception_type = PyExc_NameError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "name '%s' is not defined", "low" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 191;
+
+        goto try_except_handler_5;
+    }
+
+    tmp_tuple_element_1 = UNARY_OPERATION( PyObject_Repr, tmp_operand_name_1 );
+    if ( tmp_tuple_element_1 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        Py_DECREF( tmp_args_name_1 );
+
+        exception_lineno = 191;
+
+        goto try_except_handler_5;
+    }
+    PyTuple_SET_ITEM( tmp_args_name_1, 1, tmp_tuple_element_1 );
+    tmp_tuple_element_1 = const_str_plain_to;
+    Py_INCREF( tmp_tuple_element_1 );
+    PyTuple_SET_ITEM( tmp_args_name_1, 2, tmp_tuple_element_1 );
+    tmp_operand_name_2 = GET_MODULE_VARIABLE_VALUE_CACHED( moduledict___main__, const_str_plain_high, &module_variable_cache_6 );
+
+    if ( tmp_operand_name_2 == NULL )
+    {
+        Py_DECREF( tmp_args_name_1 );
+        exception_type = PyExc_NameError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "name '%s' is not defined", "high" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 191;
+
+        goto try_except_handler_5;
+    }
+
+    tmp_tuple_element_1 = UNARY_OPERATION( PyObject_Repr, tmp_operand_name_2 );
+    if ( tmp_tuple_element_1 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        Py_DECREF( tmp_args_name_1 );
+
+        exception_lineno = 191;
+
+        goto try_except_handler_5;
+    }
+    PyTuple_SET_ITEM( tmp_args_name_1, 3, tmp_tuple_element_1 );
+    tmp_kw_name_1 = PyDict_Copy( const_dict_fb4ddbadafbecbaef28aef989e4b600e );
+    frame_32d834cacb17dd188ad83e2de9df6467->m_frame.f_lineno = 191;
+    tmp_unused = CALL_FUNCTION( tmp_called_name_8, tmp_args_name_1, tmp_kw_name_1 );
+    Py_DECREF( tmp_args_name_1 );
+    Py_DECREF( tmp_kw_name_1 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 191;
+
+        goto try_except_handler_5;
+    }
+    Py_DECREF( tmp_unused );
+    tmp_low_name_1 = GET_MODULE_VARIABLE_VALUE_CACHED( moduledict___main__, const_str_plain_low, &module_variable_cache_7 );
+
+    if ( tmp_low_name_1 == NULL )
+    {
+
+        exception_type = PyExc_NameError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "name '%s' is not defined", "low" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 193;
+
+        goto try_except_handler_5;
+    }
+
+    tmp_high_name_1 = GET_MODULE_VARIABLE_VALUE_CACHED( moduledict___main__, const_str_plain_high, &module_variable_cache_8 );
+
+    if ( tmp_high_name_1 == NULL )
+    {
+
+        exception_type = PyExc_NameError;
+        Py_INCREF( exception_type );
+        exception_value = PyUnicode_FromFormat( "name '%s' is not defined", "high" );
+        exception_tb = NULL;
+        NORMALIZE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+        CHAIN_EXCEPTION( exception_value );
+
+        exception_lineno = 193;
+
+        goto try_except_handler_5;
+    }
+
+    Py_XDECREF( tmp_for_loop_2__for_iterator.iterator );
+    tmp_for_loop_2__for_iterator.iterator = NULL;
+    tmp_result = MAKE_RANGE_ITERATOR( &tmp_for_loop_2__for_iterator, tmp_low_name_1, tmp_high_name_1, NULL, true );
+    if ( tmp_result == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 193;
+
+        goto try_except_handler_5;
+    }
+    // Tried code:
+    loop_start_2:;
+    // Tried code:
+    tmp_assign_source_16 = RANGE_ITERATOR_NEXT( &tmp_for_loop_2__for_iterator );
+    if ( tmp_assign_source_16 == NULL )
+    {
+        if ( !ERROR_OCCURRED() )
+        {
+            exception_type = PyExc_StopIteration;
+            Py_INCREF( exception_type );
+            exception_value = NULL;
+            exception_tb = NULL;
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+        }
+
+
+
+        exception_lineno = 193;
+        goto try_except_handler_7;
+    }
+    {
+        PyObject *old = tmp_for_loop_2__iter_value;
+        tmp_for_loop_2__iter_value = tmp_assign_source_16;
+        Py_XDECREF( old );
+    }
+
+    goto try_end_4;
+    // Exception handler code:
+    try_except_handler_7:;
+    exception_keeper_type_4 = exception_type;
+    exception_keeper_value_4 = exception_value;
+    exception_keeper_tb_4 = exception_tb;
+    exception_keeper_lineno_4 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_compare_left_2 = exception_keeper_type_4;
+    tmp_compare_right_2 = PyExc_StopIteration;
+    tmp_exc_match_exception_match_2 = EXCEPTION_MATCH_BOOL( tmp_compare_left_2, tmp_compare_right_2 );
+    if ( tmp_exc_match_exception_match_2 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+        Py_DECREF( exception_keeper_type_4 );
+        Py_XDECREF( exception_keeper_value_4 );
+        Py_XDECREF( exception_keeper_tb_4 );
+
+        exception_lineno = 193;
+
+        goto try_except_handler_6;
+    }
+    if ( tmp_exc_match_exception_match_2 == 1 )
+    {
+        goto branch_yes_2;
+    }
+    else
+    {
+        goto branch_no_2;
+    }
+    branch_yes_2:;
+    Py_DECREF( exception_keeper_type_4 );
+    Py_XDECREF( exception_keeper_value_4 );
+    Py_XDECREF( exception_keeper_tb_4 );
+    goto loop_end_2;
+    goto branch_end_2;
+    branch_no_2:;
+    // Re-raise.
+    exception_type = exception_keeper_type_4;
+    exception_value = exception_keeper_value_4;
+    exception_tb = exception_keeper_tb_4;
+    exception_lineno = exception_keeper_lineno_4;
+
+    goto try_except_handler_6;
+    branch_end_2:;
+    // End of try:
+    try_end_4:;
+    tmp_assign_source_17 = tmp_for_loop_2__iter_value;
+
+    CHECK_OBJECT( tmp_assign_source_17 );
+    UPDATE_STRING_DICT0( moduledict___main__, (Nuitka_StringObject *)const_str_plain_x, tmp_assign_source_17 );
+    tmp_called_name_9 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_9 != NULL );
+    tmp_args_name_2 = PyTuple_New( 1 );
+    tmp_tuple_element_2 = GET_MODULE_VARIABLE_VALUE_CACHED( moduledict___main__, const_str_plain_x, &module_variable_cache_9 );
+
+    CHECK_OBJECT( tmp_tuple_element_2 );
+    Py_INCREF( tmp_tuple_element_2 );
+    PyTuple_SET_ITEM( tmp_args_name_2, 0, tmp_tuple_element_2 );
+    tmp_kw_name_2 = PyDict_Copy( const_dict_fb4ddbadafbecbaef28aef989e4b600e );
+    frame_32d834cacb17dd188ad83e2de9df6467->m_frame.f_lineno = 194;
+    tmp_unused = CALL_FUNCTION( tmp_called_name_9, tmp_args_name_2, tmp_kw_name_2 );
+    Py_DECREF( tmp_args_name_2 );
+    Py_DECREF( tmp_kw_name_2 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 194;
+
+        goto try_except_handler_6;
+    }
+    Py_DECREF( tmp_unused );
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 193;
+
+        goto try_except_handler_6;
+    }
+    goto loop_start_2;
+    loop_end_2:;
+    goto try_end_5;
+    // Exception handler code:
+    try_except_handler_6:;
+    exception_keeper_type_5 = exception_type;
+    exception_keeper_value_5 = exception_value;
+    exception_keeper_tb_5 = exception_tb;
+    exception_keeper_lineno_5 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_for_loop_2__iter_value );
+    tmp_for_loop_2__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_2__for_iterator.iterator );
+    tmp_for_loop_2__for_iterator.iterator = NULL;
+    // Re-raise.
+    exception_type = exception_keeper_type_5;
+    exception_value = exception_keeper_value_5;
+    exception_tb = exception_keeper_tb_5;
+    exception_lineno = exception_keeper_lineno_5;
+
+    goto try_except_handler_5;
+    // End of try:
+    try_end_5:;
+    Py_XDECREF( tmp_for_loop_2__iter_value );
+    tmp_for_loop_2__iter_value = NULL;
+
+    Py_XDECREF( tmp_for_loop_2__for_iterator.iterator );
+    tmp_for_loop_2__for_iterator.iterator = NULL;
+    tmp_called_name_10 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_10 != NULL );
+    frame_32d834cacb17dd188ad83e2de9df6467->m_frame.f_lineno = 196;
+    tmp_unused = CALL_FUNCTION_NO_ARGS( tmp_called_name_10 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 196;
+
+        goto try_except_handler_5;
+    }
+    Py_DECREF( tmp_unused );
+    goto try_end_6;
+    // Exception handler code:
+    try_except_handler_5:;
+    exception_keeper_type_6 = exception_type;
+    exception_keeper_value_6 = exception_value;
+    exception_keeper_tb_6 = exception_tb;
+    exception_keeper_lineno_6 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    // Preserve existing published exception.
+    exception_preserved_type_1 = PyThreadState_GET()->exc_type;
+    Py_XINCREF( exception_preserved_type_1 );
+    exception_preserved_value_1 = PyThreadState_GET()->exc_value;
+    Py_XINCREF( exception_preserved_value_1 );
+    exception_preserved_tb_1 = (PyTracebackObject *)PyThreadState_GET()->exc_traceback;
+    Py_XINCREF( exception_preserved_tb_1 );
+
+    if ( exception_keeper_tb_6 == NULL )
+    {
+        exception_keeper_tb_6 = MAKE_TRACEBACK( frame_32d834cacb17dd188ad83e2de9df6467, exception_keeper_lineno_6 );
+    }
+    else if ( exception_keeper_lineno_6 != 0 )
+    {
+        exception_keeper_tb_6 = ADD_TRACEBACK( exception_keeper_tb_6, frame_32d834cacb17dd188ad83e2de9df6467, exception_keeper_lineno_6 );
+    }
+
+    NORMALIZE_EXCEPTION( &exception_keeper_type_6, &exception_keeper_value_6, &exception_keeper_tb_6 );
+    PyException_SetTraceback( exception_keeper_value_6, (PyObject *)exception_keeper_tb_6 );
+    PUBLISH_EXCEPTION( &exception_keeper_type_6, &exception_keeper_value_6, &exception_keeper_tb_6 );
+    // Tried code:
+    tmp_compare_left_3 = PyThreadState_GET()->exc_type;
+    tmp_compare_right_3 = PyExc_Exception;
+    tmp_exc_match_exception_match_3 = EXCEPTION_MATCH_BOOL( tmp_compare_left_3, tmp_compare_right_3 );
+    if ( tmp_exc_match_exception_match_3 == -1 )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 197;
+
+        goto try_except_handler_8;
+    }
+    if ( tmp_exc_match_exception_match_3 == 1 )
+    {
+        goto branch_yes_3;
+    }
+    else
+    {
+        goto branch_no_3;
+    }
+    branch_yes_3:;
+    tmp_assign_source_18 = PyThreadState_GET()->exc_value;
+    UPDATE_STRING_DICT0( moduledict___main__, (Nuitka_StringObject *)const_str_plain_e, tmp_assign_source_18 );
+    // Tried code:
+    tmp_called_name_11 = LOOKUP_BUILTIN( const_str_plain_print );
+    assert( tmp_called_name_11 != NULL );
+    tmp_args_element_name_7 = const_str_plain_gave;
+    tmp_operand_name_3 = GET_MODULE_VARIABLE_VALUE_CACHED( moduledict___main__, const_str_plain_e, &module_variable_cache_10 );
+
+    CHECK_OBJECT( tmp_operand_name_3 );
+    tmp_args_element_name_8 = UNARY_OPERATION( PyObject_Repr, tmp_operand_name_3 );
+    if ( tmp_args_element_name_8 == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 198;
+
+        goto try_except_handler_9;
+    }
+    frame_32d834cacb17dd188ad83e2de9df6467->m_frame.f_lineno = 198;
+    {
+        PyObject *call_args[] = { tmp_args_element_name_7, tmp_args_element_name_8 };
+        tmp_unused = CALL_FUNCTION_WITH_ARGS2( tmp_called_name_11, call_args );
+    }
+
+    Py_DECREF( tmp_args_element_name_8 );
+    if ( tmp_unused == NULL )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 198;
+
+        goto try_except_handler_9;
+    }
+    Py_DECREF( tmp_unused );
+    goto try_end_7;
+    // Exception handler code:
+    try_except_handler_9:;
+    exception_keeper_type_7 = exception_type;
+    exception_keeper_value_7 = exception_value;
+    exception_keeper_tb_7 = exception_tb;
+    exception_keeper_lineno_7 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    tmp_res = PyDict_DelItem( (PyObject *)moduledict___main__, const_str_plain_e );
+    if ( tmp_res == -1 ) CLEAR_ERROR_OCCURRED();
+
+    // Re-raise.
+    exception_type = exception_keeper_type_7;
+    exception_value = exception_keeper_value_7;
+    exception_tb = exception_keeper_tb_7;
+    exception_lineno = exception_keeper_lineno_7;
+
+    goto try_except_handler_8;
+    // End of try:
+    try_end_7:;
+    tmp_res = PyDict_DelItem( (PyObject *)moduledict___main__, const_str_plain_e );
+    if ( tmp_res == -1 ) CLEAR_ERROR_OCCURRED();
+
+    goto branch_end_3;
+    branch_no_3:;
+    tmp_result = RERAISE_EXCEPTION( &exception_type, &exception_value, &exception_tb );
+    if (unlikely( tmp_result == false ))
+    {
+        exception_lineno = 190;
+    }
+
+    if (exception_tb && exception_tb->tb_frame == &frame_32d834cacb17dd188ad83e2de9df6467->m_frame) frame_32d834cacb17dd188ad83e2de9df6467->m_frame.f_lineno = exception_tb->tb_lineno;
+
+    goto try_except_handler_8;
+    branch_end_3:;
+    goto try_end_8;
+    // Exception handler code:
+    try_except_handler_8:;
+    exception_keeper_type_8 = exception_type;
+    exception_keeper_value_8 = exception_value;
+    exception_keeper_tb_8 = exception_tb;
+    exception_keeper_lineno_8 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    // Restore previous exception.
+    SET_CURRENT_EXCEPTION( exception_preserved_type_1, exception_preserved_value_1, exception_preserved_tb_1 );
+    // Re-raise.
+    exception_type = exception_keeper_type_8;
+    exception_value = exception_keeper_value_8;
+    exception_tb = exception_keeper_tb_8;
+    exception_lineno = exception_keeper_lineno_8;
+
+    goto try_except_handler_1;
+    // End of try:
+    try_end_8:;
+    // Restore previous exception.
+    SET_CURRENT_EXCEPTION( exception_preserved_type_1, exception_preserved_value_1, exception_preserved_tb_1 );
+    goto try_end_6;
+    // exception handler codes exits in all cases
+    NUITKA_CANNOT_GET_HERE( __main__ );
+    return MOD_RETURN_VALUE( NULL );
+    // End of try:
+    try_end_6:;
+    if ( CONSIDER_THREADING() == false )
+    {
+        assert( ERROR_OCCURRED() );
+
+        FETCH_ERROR_OCCURRED( &exception_type, &exception_value, &exception_tb );
+
+
+        exception_lineno = 189;
+
+        goto try_except_handler_1;
+    }
+    goto loop_start_1;
+    loop_end_1:;
+    goto try_end_9;
+    // Exception handler code:
+    try_except_handler_1:;
+    exception_keeper_type_9 = exception_type;
+    exception_keeper_value_9 = exception_value;
+    exception_keeper_tb_9 = exception_tb;
+    exception_keeper_lineno_9 = exception_lineno;
+    exception_type = NULL;
+    exception_value = NULL;
+    exception_tb = NULL;
+    exception_lineno = 0;
+
+    Py_XDECREF( tmp_for_loop_1__iter_value );
+    tmp_for_loop_1__iter_value = NULL;
+
+    CHECK_OBJECT( (PyObject *)tmp_for_loop_1__for_iterator );
+    Py_DECREF( tmp_for_loop_1__for_iterator );
+    tmp_for_loop_1__for_iterator = NULL;
+
+    // Re-raise.
+    exception_type = exception_keeper_type_9;
+    exception_value = exception_keeper_value_9;
+    exception_tb = exception_keeper_tb_9;
+    exception_lineno = exception_keeper_lineno_9;
+
+    goto frame_exception_exit_1;
+    // End of try:
+    try_end_9:;
+
+    // Restore frame exception if necessary.
+#if 1
+    RESTORE_FRAME_EXCEPTION( frame_32d834cacb17dd188ad83e2de9df6467 );
+#endif
+    popFrameStack();
+
+    assertFrameObject( frame_32d834cacb17dd188ad83e2de9df6467 );
+
+    goto frame_no_exception_1;
+    frame_exception_exit_1:;
+#if 1
+    RESTORE_FRAME_EXCEPTION( frame_32d834cacb17dd188ad83e2de9df6467 );
+#endif
+
+    if ( exception_tb == NULL )
+    {
+        exception_tb = MAKE_TRACEBACK( frame_32d834cacb17dd188ad83e2de9df6467, exception_lineno );
+    }
+    else if ( exception_tb->tb_frame != &frame_32d834cacb17dd188ad83e2de9df6467->m_frame )
+    {
+        exception_tb = ADD_TRACEBACK( exception_tb, frame_32d834cacb17dd188ad83e2de9df6467, exception_lineno );
+    }
+
+    // Put the previous frame back on top.
+    popFrameStack();
+
+    // Return the error.
+    goto module_exception_exit;
+    frame_no_exception_1:;
+    Py_XDECREF( tmp_for_loop_1__iter_value );
+    tmp_for_loop_1__iter_value = NULL;
+
+    CHECK_OBJECT( (PyObject *)tmp_for_loop_1__for_iterator );
+    Py_DECREF( tmp_for_loop_1__for_iterator );
+    tmp_for_loop_1__for_iterator = NULL;
+
+
+    return MOD_RETURN_VALUE( module___main__ );
+    module_exception_exit:
+    RESTORE_ERROR_OCCURRED( exception_type, exception_value, exception_tb );
+    return MOD_RETURN_VALUE( NULL );
+}
@@ -148,3 +148,51 @@ def loopingFunction(a = 1*2):
         print("Executed else branch of while loop without break")
 
 loopingFunction()
+
+def rangeLoopFunction(n):
+    # Loops over range values, counted without range objects if possible.
+    result = []
+    x = None
+
+    for x in range(n):
+        result.append(x)
+
+    for x in range(-n, 2*n, 3):
+        result.append(x)
+
+    for x in range(n, -n, -2):
+        result.append(x)
+    else:
+        result.append("else")
+
+    for x in range(n):
+        if x == 2:
+            break
+    else:
+        result.append("no break")
+
+    for x in range(n):
+        for y in range(x):
+            result.append((x, y))
+
+    return result, x
+
+print("Range loops:", rangeLoopFunction(5))
+print("Empty range loops:", rangeLoopFunction(0))
+
+def rangeLoopGenerator(n):
+    for x in range(n, 0, -1):
+        yield x
+
+print("Range loop in generator:", list(rangeLoopGenerator(4)))
+
+for low, high in ((0, 2.0), (2**70, 2**70+2), (0, 0), (3, 5)):
+    try:
+        print("Range loop from", repr(low), "to", repr(high), end = ' ')
+
+        for x in range(low, high):
+            print(x, end = ' ')
+
+        print()
+    except Exception as e:
+        print("gave", repr(e))
@@ -97,3 +97,136 @@ try:
     x = value[1]
 except Exception as e:
     print "Indexing None gives", repr(e)
+
+print "Float arithmetic on local variables:"
+
+def floatKernel(n):
+    x = 0.0
+    y = float(n)
+
+    i = 0
+    while i < n:
+        x = x * 0.5 + y
+        y = y - 0.25 * x
+        y += 1
+        x /= 2
+
+        i += 1
+
+    return x, y
+
+print floatKernel(5)
+
+def floatDivision(a, b):
+    q = float(a)
+    q = q / float(b)
+
+    return q
+
+try:
+    floatDivision(1, 0)
+except ZeroDivisionError as e:
+    print "Float division gives", repr(e)
+
+def floatMaybeUnassigned(cond):
+    if cond:
+        z = 2.5
+
+    return z * 2
+
+print floatMaybeUnassigned(True)
+
+try:
+    floatMaybeUnassigned(False)
+except UnboundLocalError as e:
+    print "Float variable read gives", repr(e)
+
+print "Integer operations near digit boundaries:"
+
+def intOperations(a, b):
+    result = [a + b, a - b, a * b, a & b, a | b, a ^ b]
+
+    try:
+        result += [a // b, a % b]
+    except ZeroDivisionError as e:
+        result.append(repr(e))
+
+    # Avoid huge values from shifting by large amounts.
+    if abs(b) < 100:
+        try:
+            result += [a << b, a >> b]
+        except ValueError as e:
+            result.append(repr(e))
+
+    return result
+
+for a in (0, 7, -7, 2**15, 2**30 - 1, -2**30, 2**60 - 1, -2**60 + 1, 2**62):
+    for b in (0, 3, -3, 2**30, -2**31, 63, 64):
+        print a, b, intOperations(a, b)
+
+def intInplaceOperations(a, b):
+    x = a
+    x += b
+    x -= 2 * b
+    x *= b
+    x //= b or 1
+    x %= 2**61
+    x <<= 3
+    x >>= 1
+    x &= -2
+    x |= 5
+    x ^= a
+
+    return x
+
+print intInplaceOperations(2**29, 2**30), intInplaceOperations(-17, 2**31)
+
+print "Indexing with integers:"
+
+def indexLookups(seq, indexes):
+    result = []
+
+    for i in indexes:
+        try:
+            result.append(seq[i])
+        except (IndexError, KeyError, TypeError) as e:
+            result.append(repr(e))
+
+    return result
+
+def indexAssignments(seq, indexes):
+    result = []
+
+    for i in indexes:
+        try:
+            seq[i] = -i
+        except (IndexError, TypeError, ValueError) as e:
+            result.append(repr(e))
+
+    return seq, result
+
+indexes = (0, 1, 2, -1, -3, -4, 3, 2**40, -2**40, 2**70, True)
+
+for seq in ([1, 2, 3], (1, 2, 3), "abc", u"abc", b"abc", bytearray(b"abc"), {1 : "one", -1 : "minus one"}):
+    print type(seq).__name__, indexLookups(seq, indexes)
+
+for seq in ([1, 2, 3], (1, 2, 3), bytearray(b"abc"), {}):
+    print type(seq).__name__, indexAssignments(seq, indexes)
+
+def constantIndexes(seq):
+    result = [seq[0], seq[-1]]
+
+    try:
+        result.append(seq[3])
+    except IndexError as e:
+        result.append(repr(e))
+
+    try:
+        seq[-1] = 7
+        seq[3] = 8
+    except (IndexError, TypeError) as e:
+        result.append(repr(e))
+
+    return result, seq
+
+print constantIndexes([1, 2, 3]), constantIndexes((1, 2, 3)), constantIndexes("abc")
@@ -16,6 +16,8 @@
 #     limitations under the License.
 #
 
+from __future__ import print_function
+
 count = 0
 
 def recurse():
@@ -26,3 +28,40 @@ def recurse():
         recurse()
 
 recurse()
+print("Recursed", count, "times.")
+
+import sys
+
+def frameDepths(n):
+    if n == 0:
+        frame = sys._getframe()
+        depth = 0
+
+        while frame is not None and frame.f_code is frameDepths.__code__:
+            depth += 1
+            frame = frame.f_back
+
+        return depth
+
+    return frameDepths(n - 1)
+
+for n in (3, 30, 5):
+    print("Frames seen at depth", n, frameDepths(n))
+
+def raiseAtDepth(n):
+    if n == 0:
+        raise ValueError("deep")
+
+    if n % 7 == 0:
+        try:
+            return raiseAtDepth(n - 1)
+        except ValueError:
+            return n
+
+    return raiseAtDepth(n - 1)
+
+for n in (5, 20, 40, 20, 5):
+    try:
+        print("Raised at depth", n, "caught at", raiseAtDepth(n))
+    except ValueError as e:
+        print("Raised at depth", n, "uncaught", e)
@@ -113,6 +113,27 @@ def simpleFunction5():
     return list( g() )
 
 
+def simpleFunction6():
+    def g():
+        try:
+            yield 1
+            yield 2
+        except KeyError:
+            yield 3
+
+    def f():
+        yield from g()
+
+    gi = f()
+    next(gi)
+    gi.send(None)
+    gi.throw(KeyError("k"))
+    gi.close()
+
+    gi = f()
+    next(gi)
+    gi.close()
+
 
 # These need stderr to be wrapped.
 tests_stderr = (3, 4)
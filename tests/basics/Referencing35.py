@@ -146,6 +146,58 @@ def simpleFunction9():
 
     return b
 
+
+def simpleFunction10():
+    async def leaf(x):
+        return (x, x)
+
+    async def foo():
+        result = await leaf(1)
+        result += await leaf(2)
+
+        return result
+
+    run_async(foo())
+
+def simpleFunction11():
+    async def leaf():
+        raise KeyError("leaf")
+
+    async def foo():
+        try:
+            await leaf()
+        except KeyError:
+            pass
+
+    run_async(foo())
+
+def simpleFunction12():
+    class Awaitable:
+        def __await__(self):
+            yield 1
+
+    async def leaf():
+        try:
+            await Awaitable()
+        except ZeroDivisionError:
+            return "handled"
+
+    async def foo():
+        return await leaf()
+
+    coro = foo()
+    coro.send(None)
+
+    try:
+        coro.throw(ZeroDivisionError)
+    except StopIteration:
+        pass
+
+    coro = foo()
+    coro.send(None)
+    coro.close()
+
+
 # These need stderr to be wrapped.
 tests_stderr = ()
 
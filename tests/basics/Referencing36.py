@@ -135,6 +135,36 @@ def simpleFunction4():
 
     ai.__anext__().__next__()
 
+
+def simpleFunction5():
+    async def gen():
+        try:
+            yield 1
+            await awaitable()
+            yield 2
+        except ZeroDivisionError:
+            yield "handled"
+
+    async def iterate():
+        res = []
+        async for i in gen():
+            res.append(i)
+        return res
+
+    run_async(iterate())
+
+    coro = iterate()
+    coro.send(None)
+
+    try:
+        coro.throw(ZeroDivisionError)
+    except StopIteration:
+        pass
+
+    coro = iterate()
+    coro.send(None)
+    coro.close()
+
 # These need stderr to be wrapped.
 tests_stderr = ()
 
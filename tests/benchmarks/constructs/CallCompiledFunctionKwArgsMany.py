@@ -0,0 +1,55 @@
+#     Copyright 2018, Kay Hayen, mailto:kay.hayen@gmail.com
+#
+#     Python test originally created or extracted from other peoples work. The
+#     parts from me are licensed as below. It is at least Free Software where
+#     it's copied from other people. In these cases, that will normally be
+#     indicated.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#         http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+from __future__ import print_function
+
+def compiled_func(host = None, port = 80, user = None, password = None,
+                  database = None, timeout = 30, retries = 3, backoff = 0.5,
+                  pool_size = 10, pool_timeout = 5, ssl = False, ssl_cert = None,
+                  ssl_key = None, encoding = "utf8", autocommit = True,
+                  isolation = None, readonly = False, application = None,
+                  debug = False, log_level = 0, compress = False, keepalive = True):
+    return host, port, database, timeout, debug, keepalive
+
+# Keyword names created at run time, e.g. read from a configuration file, are
+# not identical to the parameter names, and need to be compared.
+config = dict(
+    zip(
+        ("".join(["data", "base"]), "".join(["log_", "level"]), "".join(["keep", "alive"])),
+        ("db", 1, False)
+    )
+)
+
+def calledRepeatedly():
+    # This is supposed to make a call to a compiled function with many keyword
+    # parameters, passing some of them as keywords.
+# construct_begin
+    compiled_func(host = "localhost", database = "db", timeout = 10)
+    compiled_func(keepalive = False, debug = True, log_level = 2, user = "nobody")
+    compiled_func(port = 5432, pool_size = 20, application = "bench")
+    compiled_func(**config)
+# construct_alternative
+    pass
+# construct_end
+
+import itertools
+for x in itertools.repeat(None, 50000):
+    calledRepeatedly()
+
+print("OK.")
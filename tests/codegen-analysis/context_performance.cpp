@@ -17,22 +17,40 @@
 //     See the License for the specific language governing permissions and
 //     limitations under the License.
 //
-// Small program to benchmark the context switches.
+// Small program to benchmark the context switches, comparing "swapcontext"
+// with the hand-written assembler switching used for generators.
+//
+// Compile with e.g. "g++ -O2 context_performance.cpp" on x86_64 or aarch64
+// Linux, and without assembler support, only "swapcontext" is measured.
 
 #include <ucontext.h>
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdint.h>
 #include <assert.h>
+#include <time.h>
 
-ucontext_t m_yielder_context;
-ucontext_t m_caller_context;
+#define MAX_TIMES (10000000)
 
-static void *last_stack = NULL;
+#define STACK_SIZE (1024*1024)
 
 int return_value = 1;
 
-#define MAX_TIMES (10000000)
+static double getTime()
+{
+    struct timespec now;
+    clock_gettime( CLOCK_MONOTONIC, &now );
+
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+// The "ucontext" variant.
+
+ucontext_t m_yielder_context;
+ucontext_t m_caller_context;
+
+static void *last_stack = NULL;
 
 // Context function
 static void m_code( unsigned long value )
@@ -48,14 +66,14 @@ static void m_code( unsigned long value )
     swapcontext( &m_yielder_context, &m_caller_context );
 }
 
-int main()
+static void runUcontext()
 {
     // Nuitka_Generator_New
     m_yielder_context.uc_stack.ss_sp = NULL;
     m_yielder_context.uc_link = NULL;
 
     // Nuitka_Generator_send first time
-    m_yielder_context.uc_stack.ss_size = 1024*1024;
+    m_yielder_context.uc_stack.ss_size = STACK_SIZE;
     m_yielder_context.uc_stack.ss_sp = last_stack ? last_stack : malloc( m_yielder_context.uc_stack.ss_size );
     last_stack = NULL;
 
@@ -64,13 +82,164 @@ int main()
 
     makecontext( &m_yielder_context, (void (*)())m_code, 1, (unsigned long)27 );
 
+    return_value = 1;
+
     while ( return_value > 0 )
     {
         swapcontext( &m_caller_context, &m_yielder_context );
         // printf( "%ld\n", return_value );
     }
 
-    // puts( "completed!" );
+    last_stack = m_yielder_context.uc_stack.ss_sp;
+}
+
+// The assembler variant, same code as in "asm_ucontext_src" of Nuitka.
+
+#if defined(__linux__) && (defined(__x86_64__) || defined(__aarch64__))
+#define HAVE_ASM_FIBERS 1
+
+extern "C" void _swapFiber( void **to, void **from );
+extern "C" void _startFiber( void );
+
+#if defined(__x86_64__)
+asm(
+    ".text\n"
+    ".globl _swapFiber\n"
+    "_swapFiber:\n"
+    "    pushq %rbp\n"
+    "    pushq %rbx\n"
+    "    pushq %r12\n"
+    "    pushq %r13\n"
+    "    pushq %r14\n"
+    "    pushq %r15\n"
+    "    subq $8, %rsp\n"
+    "    stmxcsr (%rsp)\n"
+    "    fnstcw 4(%rsp)\n"
+    "    movq %rsp, (%rdi)\n"
+    "    movq (%rsi), %rsp\n"
+    "    ldmxcsr (%rsp)\n"
+    "    fldcw 4(%rsp)\n"
+    "    addq $8, %rsp\n"
+    "    popq %r15\n"
+    "    popq %r14\n"
+    "    popq %r13\n"
+    "    popq %r12\n"
+    "    popq %rbx\n"
+    "    popq %rbp\n"
+    "    ret\n"
+    ".globl _startFiber\n"
+    "_startFiber:\n"
+    "    movq %r13, %rdi\n"
+    "    callq *%r12\n"
+    "    ud2\n"
+);
+#else
+asm(
+    ".text\n"
+    ".globl _swapFiber\n"
+    "_swapFiber:\n"
+    "    sub sp, sp, #160\n"
+    "    stp x19, x20, [sp, #0]\n"
+    "    stp x21, x22, [sp, #16]\n"
+    "    stp x23, x24, [sp, #32]\n"
+    "    stp x25, x26, [sp, #48]\n"
+    "    stp x27, x28, [sp, #64]\n"
+    "    stp x29, x30, [sp, #80]\n"
+    "    stp d8, d9, [sp, #96]\n"
+    "    stp d10, d11, [sp, #112]\n"
+    "    stp d12, d13, [sp, #128]\n"
+    "    stp d14, d15, [sp, #144]\n"
+    "    mov x9, sp\n"
+    "    str x9, [x0]\n"
+    "    ldr x9, [x1]\n"
+    "    mov sp, x9\n"
+    "    ldp x19, x20, [sp, #0]\n"
+    "    ldp x21, x22, [sp, #16]\n"
+    "    ldp x23, x24, [sp, #32]\n"
+    "    ldp x25, x26, [sp, #48]\n"
+    "    ldp x27, x28, [sp, #64]\n"
+    "    ldp x29, x30, [sp, #80]\n"
+    "    ldp d8, d9, [sp, #96]\n"
+    "    ldp d10, d11, [sp, #112]\n"
+    "    ldp d12, d13, [sp, #128]\n"
+    "    ldp d14, d15, [sp, #144]\n"
+    "    add sp, sp, #160\n"
+    "    ret\n"
+    ".globl _startFiber\n"
+    "_startFiber:\n"
+    "    mov x0, x20\n"
+    "    blr x19\n"
+    "    brk #0\n"
+);
+#endif
+
+void *m_yielder_sp;
+void *m_caller_sp;
+
+static void m_asm_code( unsigned long value )
+{
+    for( int i = MAX_TIMES; i > 0; i-- )
+    {
+        return_value = i;
+
+        _swapFiber( &m_yielder_sp, &m_caller_sp );
+    }
+
+    return_value = 0;
+    _swapFiber( &m_yielder_sp, &m_caller_sp );
+}
+
+static void runAsm()
+{
+    void *stack = last_stack ? last_stack : malloc( STACK_SIZE );
+    last_stack = NULL;
+
+    uintptr_t *top = (uintptr_t *)( ( (uintptr_t)stack + STACK_SIZE ) & ~(uintptr_t)15 );
+
+#if defined(__x86_64__)
+    uintptr_t *frame = top - 8;
+    frame[0] = 0x1F80 | ( (uintptr_t)0x037F << 32 );
+    frame[1] = frame[2] = frame[5] = frame[6] = 0;
+    frame[3] = 27;
+    frame[4] = (uintptr_t)m_asm_code;
+    frame[7] = (uintptr_t)_startFiber;
+#else
+    uintptr_t *frame = top - 20;
+    for( int i = 0; i < 20; i++ ) frame[i] = 0;
+    frame[0] = (uintptr_t)m_asm_code;
+    frame[1] = 27;
+    frame[11] = (uintptr_t)_startFiber;
+#endif
+
+    m_yielder_sp = frame;
+
+    return_value = 1;
+
+    while ( return_value > 0 )
+    {
+        _swapFiber( &m_caller_sp, &m_yielder_sp );
+    }
+
+    last_stack = stack;
+}
+#endif
+
+int main()
+{
+    double start = getTime();
+    runUcontext();
+    double ucontext_time = getTime() - start;
+
+    printf( "swapcontext: %.3f s, %.1f ns per switch\n", ucontext_time, ucontext_time * 1e9 / ( 2.0 * MAX_TIMES ) );
+
+#ifdef HAVE_ASM_FIBERS
+    start = getTime();
+    runAsm();
+    double asm_time = getTime() - start;
+
+    printf( "assembler:   %.3f s, %.1f ns per switch\n", asm_time, asm_time * 1e9 / ( 2.0 * MAX_TIMES ) );
+    printf( "speedup:     %.1fx\n", ucontext_time / asm_time );
+#endif
 
     return 0;
 }